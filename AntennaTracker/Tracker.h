@@ -116,6 +116,19 @@ private:
         int32_t relative_alt;	// the vehicle's relative altitude in meters * 100
     } vehicle;
 
+    // constant-velocity kalman filter used to smooth the vehicle position
+    // between telemetry updates (see tracking.cpp)
+    struct {
+        bool initialised;       // true once the first position update has been processed
+        Location origin;        // reference location.  filter state is an offset from this point
+        Vector3f pos;           // estimated position offset from origin in meters (x=north, y=east, z=up)
+        Vector3f vel;           // estimated velocity in m/s
+        float ppp;              // position variance, shared across axes
+        float ppv;              // position/velocity covariance, shared across axes
+        float pvv;              // velocity variance, shared across axes
+        uint32_t last_predict_us;   // time of the last prediction step
+    } vehicle_estimate;
+
     // Navigation controller state
     struct NavStatus {
         float bearing;                  // bearing to vehicle in centi-degrees
@@ -209,6 +222,7 @@ private:
 
     // tracking.cpp
     void update_vehicle_pos_estimate();
+    void vehicle_estimate_correct(const Location &loc, const Vector3f &vel);
     void update_tracker_position();
     void update_bearing_and_distance();
     void update_tracking(void);
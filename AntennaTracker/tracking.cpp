@@ -1,30 +1,114 @@
 #include "Tracker.h"
 
+// tuning for the constant-velocity filter used to smooth the vehicle position
+#define TRACKING_FILTER_ACCEL_NOISE 3.0f    // process noise, m/s/s 1-sigma
+#define TRACKING_FILTER_POS_NOISE   2.5f    // position measurement noise, m 1-sigma
+#define TRACKING_FILTER_VEL_NOISE   0.5f    // velocity measurement noise, m/s 1-sigma
+
 /**
   update_vehicle_position_estimate - updates estimate of vehicle positions
   should be called at 50hz
  */
 void Tracker::update_vehicle_pos_estimate()
 {
+    const uint32_t now_us = AP_HAL::micros();
+
     // calculate time since last actual position update
-    float dt = (AP_HAL::micros() - vehicle.last_update_us) * 1.0e-6f;
+    float dt = (now_us - vehicle.last_update_us) * 1.0e-6f;
 
     // if less than 5 seconds since last position update estimate the position
-    if (dt < TRACKING_TIMEOUT_SEC) {
-        // project the vehicle position to take account of lost radio packets
-        vehicle.location_estimate = vehicle.location;
-        float north_offset = vehicle.vel.x * dt;
-        float east_offset = vehicle.vel.y * dt;
-        vehicle.location_estimate.offset(north_offset, east_offset);
-    	vehicle.location_estimate.offset_up_m(vehicle.vel.z * dt);
+    if (dt < TRACKING_TIMEOUT_SEC && vehicle_estimate.initialised) {
+        // run the prediction step of the constant-velocity filter.  this
+        // projects the vehicle position to take account of lost radio packets
+        // without the step change in the estimate that re-extrapolating from
+        // the raw position would cause
+        const float pdt = (now_us - vehicle_estimate.last_predict_us) * 1.0e-6f;
+        vehicle_estimate.last_predict_us = now_us;
+
+        vehicle_estimate.pos += vehicle_estimate.vel * pdt;
+
+        const float q = sq(TRACKING_FILTER_ACCEL_NOISE);
+        vehicle_estimate.ppp += pdt * (2.0f * vehicle_estimate.ppv + pdt * vehicle_estimate.pvv) + 0.25f * q * sq(sq(pdt));
+        vehicle_estimate.ppv += pdt * vehicle_estimate.pvv + 0.5f * q * pdt * sq(pdt);
+        vehicle_estimate.pvv += q * sq(pdt);
+
+        vehicle.location_estimate = vehicle_estimate.origin;
+        vehicle.location_estimate.offset(vehicle_estimate.pos.x, vehicle_estimate.pos.y);
+        vehicle.location_estimate.offset_up_m(vehicle_estimate.pos.z);
         // set valid_location flag
         vehicle.location_valid = true;
     } else {
         // vehicle has been lost, set lost flag
         vehicle.location_valid = false;
+        vehicle_estimate.initialised = false;
     }
 }
 
+/**
+  vehicle_estimate_correct - fuse a received position and velocity into the
+  constant-velocity filter.  a single covariance is shared across the three
+  axes as the measurement noise is isotropic
+ */
+void Tracker::vehicle_estimate_correct(const Location &loc, const Vector3f &vel)
+{
+    const uint32_t now_us = AP_HAL::micros();
+
+    if (!vehicle_estimate.initialised) {
+        vehicle_estimate.origin = loc;
+        vehicle_estimate.pos.zero();
+        vehicle_estimate.vel = vel;
+        vehicle_estimate.ppp = sq(TRACKING_FILTER_POS_NOISE);
+        vehicle_estimate.ppv = 0;
+        vehicle_estimate.pvv = sq(TRACKING_FILTER_VEL_NOISE);
+        vehicle_estimate.last_predict_us = now_us;
+        vehicle_estimate.initialised = true;
+        return;
+    }
+
+    // predict forward to the time of the measurement
+    const float pdt = (now_us - vehicle_estimate.last_predict_us) * 1.0e-6f;
+    vehicle_estimate.last_predict_us = now_us;
+    vehicle_estimate.pos += vehicle_estimate.vel * pdt;
+
+    // position measurement as an offset from the filter origin
+    const Vector2f pos_ne = vehicle_estimate.origin.get_distance_NE(loc);
+    const Vector3f pos_meas{pos_ne.x, pos_ne.y, (loc.alt - vehicle_estimate.origin.alt) * 0.01f};
+
+    // position correction
+    {
+        const Vector3f innov = pos_meas - vehicle_estimate.pos;
+        const float s = vehicle_estimate.ppp + sq(TRACKING_FILTER_POS_NOISE);
+        const float kp = vehicle_estimate.ppp / s;
+        const float kv = vehicle_estimate.ppv / s;
+        vehicle_estimate.pos += innov * kp;
+        vehicle_estimate.vel += innov * kv;
+        const float ppv_prev = vehicle_estimate.ppv;
+        vehicle_estimate.ppp *= 1.0f - kp;
+        vehicle_estimate.ppv *= 1.0f - kp;
+        vehicle_estimate.pvv -= kv * ppv_prev;
+    }
+
+    // velocity correction
+    {
+        const Vector3f innov = vel - vehicle_estimate.vel;
+        const float s = vehicle_estimate.pvv + sq(TRACKING_FILTER_VEL_NOISE);
+        const float kp = vehicle_estimate.ppv / s;
+        const float kv = vehicle_estimate.pvv / s;
+        vehicle_estimate.pos += innov * kp;
+        vehicle_estimate.vel += innov * kv;
+        const float ppv_prev = vehicle_estimate.ppv;
+        vehicle_estimate.ppp -= kp * ppv_prev;
+        vehicle_estimate.ppv *= 1.0f - kv;
+        vehicle_estimate.pvv *= 1.0f - kv;
+    }
+
+    // re-base the origin on the corrected estimate so the NE offsets held in
+    // the filter state stay small
+    vehicle_estimate.origin.offset(vehicle_estimate.pos.x, vehicle_estimate.pos.y);
+    vehicle_estimate.origin.offset_up_m(vehicle_estimate.pos.z);
+    vehicle_estimate.pos.zero();
+}
+
 /**
   update_tracker_position - updates antenna tracker position from GPS location
   should be called at 50hz
@@ -149,6 +233,9 @@ void Tracker::tracking_update_position(const mavlink_global_position_int_t &msg)
     vehicle.vel = Vector3f(msg.vx*0.01f, msg.vy*0.01f, msg.vz*0.01f);
     vehicle.last_update_us = AP_HAL::micros();
     vehicle.last_update_ms = AP_HAL::millis();
+
+    // fuse the new position into the smoothing filter
+    vehicle_estimate_correct(vehicle.location, vehicle.vel);
 #if HAL_LOGGING_ENABLED
     // log vehicle as VPOS
     if (should_log(MASK_LOG_GPS)) {
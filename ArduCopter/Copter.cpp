@@ -182,7 +182,7 @@ const AP_Scheduler::Task Copter::scheduler_tasks[] = {
     SCHED_TASK_CLASS(ModeSmartRTL,         &copter.mode_smartrtl,       save_position,    3, 100,  51),
 #endif
 #if HAL_SPRAYER_ENABLED
-    SCHED_TASK_CLASS(AC_Sprayer,           &copter.sprayer,               update,         3,  90,  54),
+    SCHED_TASK(sprayer_update,         3,     90,  54),
 #endif
     SCHED_TASK(three_hz_loop,          3,     75, 57),
 #if AP_SERVORELAYEVENTS_ENABLED
@@ -739,6 +739,17 @@ void Copter::twentyfive_hz_logging()
 #endif  // HAL_LOGGING_ENABLED
 
 // three_hz_loop - 3hz loop
+#if HAL_SPRAYER_ENABLED
+// update the crop sprayer, which is only allocated if SPRAY_ENABLE
+// was set at boot
+void Copter::sprayer_update()
+{
+    if (sprayer != nullptr) {
+        sprayer->update();
+    }
+}
+#endif
+
 void Copter::three_hz_loop()
 {
     // check if we've lost contact with the ground station
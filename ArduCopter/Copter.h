@@ -512,9 +512,9 @@ private:
     AP_Rally_Copter rally;
 #endif
 
-    // Crop Sprayer
+    // Crop Sprayer, allocated at boot only if SPRAY_ENABLE is set
 #if HAL_SPRAYER_ENABLED
-    AC_Sprayer sprayer;
+    AC_Sprayer *sprayer;
 #endif
 
     // Parachute release
@@ -715,6 +715,9 @@ private:
     void twentyfive_hz_logging();
     void three_hz_loop();
     void one_hz_loop();
+#if HAL_SPRAYER_ENABLED
+    void sprayer_update();
+#endif
     void init_simple_bearing();
     void update_simple_mode(void);
     void update_super_simple_bearing(bool force_update);
@@ -415,7 +415,7 @@ const AP_Param::Info Copter::var_info[] = {
 #if HAL_SPRAYER_ENABLED
     // @Group: SPRAY_
     // @Path: ../libraries/AC_Sprayer/AC_Sprayer.cpp
-    GOBJECT(sprayer,                "SPRAY_",       AC_Sprayer),
+    GOBJECTPTR(sprayer,             "SPRAY_",       AC_Sprayer),
 #endif
 
 #if AP_SIM_ENABLED
@@ -1188,6 +1188,16 @@ const AP_Param::GroupInfo ParametersG2::var_info2[] = {
     AP_GROUPINFO("SURFTRAK_GLSAM", 22, ParametersG2, surf_dist_parameters.glitch_num_samples, AP_SURFACEDISTANCE_GLITCH_NUM_SAMPLES_DEFAULT),
 #endif
 
+#if HAL_SPRAYER_ENABLED
+    // @Param: SPRAY_ENABLE
+    // @DisplayName: Sprayer enable/disable
+    // @Description: Allows you to enable (1) or disable (0) the sprayer. The sprayer is only allocated when enabled, saving memory when not fitted
+    // @Values: 0:Disabled,1:Enabled
+    // @User: Standard
+    // @RebootRequired: True
+    AP_GROUPINFO("SPRAY_ENABLE", 23, ParametersG2, sprayer_enable, 0),
+#endif
+
     // ID 62 is reserved for the AP_SUBGROUPEXTENSION
 
     AP_GROUPEND
@@ -1351,6 +1361,18 @@ void Copter::load_parameters(void)
         AP_Param::convert_old_parameters_scaled(pilot_conversion_info, ARRAY_SIZE(pilot_conversion_info), 0.01, 0);
     }
 
+#if HAL_SPRAYER_ENABLED
+    // convert sprayer enable, which moved to a vehicle parameter so
+    // the sprayer itself is only allocated when enabled
+    // PARAMETER_CONVERSION - Added: Aug 2026 for ardupilot-4.8
+    {
+        const AP_Param::ConversionInfo sprayer_conversion_info[] = {
+            { Parameters::k_param_sprayer, 0, AP_PARAM_INT8, "SPRAY_ENABLE" },
+        };
+        AP_Param::convert_old_parameters(&sprayer_conversion_info[0], ARRAY_SIZE(sprayer_conversion_info));
+    }
+#endif
+
     // setup AP_Param frame type flags
     AP_Param::set_frame_type_flags(AP_PARAM_FRAME_COPTER);
 }
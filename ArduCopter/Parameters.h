@@ -4,6 +4,7 @@
 
 #include <AP_Common/AP_Common.h>
 #include "RC_Channel_Copter.h"
+#include <AC_Sprayer/AC_Sprayer_config.h>
 #include <AP_Proximity/AP_Proximity.h>
 #include <AP_SurfaceDistance/AP_SurfaceDistance.h>
 
@@ -698,6 +699,11 @@ public:
     AP_Float                surftrak_tc;
     AP_SurfaceDistance::SurfDistParameters surf_dist_parameters;
 
+#if HAL_SPRAYER_ENABLED
+    // sprayer enable, controls allocation of the sprayer at boot
+    AP_Int8 sprayer_enable;
+#endif
+
     // ramp time of throttle during take-off
     AP_Float takeoff_throttle_slew_time;
     AP_Float takeoff_throttle_max;
@@ -554,8 +554,8 @@ void ModeZigZag::init_auto()
 void ModeZigZag::spray(bool b)
 {
 #if HAL_SPRAYER_ENABLED
-    if (_spray_enabled) {
-        copter.sprayer.run(b);
+    if (_spray_enabled && copter.sprayer != nullptr) {
+        copter.sprayer->run(b);
     }
 #endif
 }
@@ -248,6 +248,7 @@ void Copter::rate_controller_thread()
         const uint32_t dt_us = now_us - last_run_us;
         const float dt = dt_us * 1.0e-6;
         last_run_us = now_us;
+        now_ms = AP_HAL::millis();
 
         // check if we are falling behind
         if (ins.get_num_gyro_samples() > 2) {
@@ -320,8 +321,6 @@ void Copter::rate_controller_thread()
         rate_now_us = AP_HAL::micros();
 #endif
 
-        now_ms = AP_HAL::millis();
-
         // make sure we have the latest target rate
         target_rate_decimation = constrain_int16(g2.att_decimation.get(), 1,
                                                  DIV_ROUND_INT(ins.get_raw_gyro_rate_hz(), AP::scheduler().get_loop_rate_hz()));
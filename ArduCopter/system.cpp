@@ -63,6 +63,17 @@ void Copter::init_ardupilot()
     // allocate the motors class
     allocate_motors();
 
+#if HAL_SPRAYER_ENABLED
+    // only allocate the crop sprayer if it is enabled, saving memory
+    // on the majority of vehicles which have none fitted
+    if (g2.sprayer_enable) {
+        sprayer = NEW_NOTHROW AC_Sprayer();
+        if (sprayer != nullptr) {
+            AP_Param::load_object_from_eeprom(sprayer, AC_Sprayer::var_info);
+        }
+    }
+#endif
+
     // initialise rc channels including setting mode
     rc().convert_options(RC_Channel::AUX_FUNC::ARMDISARM_UNUSED, RC_Channel::AUX_FUNC::ARMDISARM_AIRMODE);
     rc().init();
@@ -3845,7 +3845,7 @@ float QuadPlane::forward_throttle_pct()
         return 0;
     }
     // get component of velocity error in fwd body frame direction
-    Vector3f vel_error_body_ms = ahrs.get_rotation_body_to_ned().transposed() * (desired_velocity_ned_ms - vel_ned_ms);
+    Vector3f vel_error_body_ms = ahrs.earth_to_body(desired_velocity_ned_ms - vel_ned_ms);
 
     float fwd_vel_error_ms = vel_error_body_ms.x;
 
@@ -188,6 +188,7 @@ void Tiltrotor::slew(float newtilt)
 {
     float max_change = tilt_max_change(newtilt<current_tilt, newtilt > get_fully_forward_tilt());
     current_tilt = constrain_float(newtilt, current_tilt-max_change, current_tilt+max_change);
+    update_tilt_trig();
 
     angle_achieved = is_equal(newtilt, current_tilt);
 
@@ -348,6 +349,15 @@ void Tiltrotor::binary_slew(bool forward)
     } else {
         current_tilt = constrain_float(current_tilt-max_change, 0, 1);
     }
+    update_tilt_trig();
+}
+
+// refresh cached sin/cos of the tilt angle after a current_tilt change
+void Tiltrotor::update_tilt_trig(void)
+{
+    const float tilt_rad = current_tilt * M_PI_2;
+    _sin_tilt = sinf(tilt_rad);
+    _cos_tilt = cosf(tilt_rad);
 }
 
 /*
@@ -465,7 +475,7 @@ void Tiltrotor::tilt_compensate_angle(float *thrust, uint8_t num_motors, float n
     }
 
     float largest_tilted = 0;
-    const float sin_tilt = sinf(radians(current_tilt*90));
+    const float sin_tilt = _sin_tilt;
     // yaw_gain relates the amount of differential thrust we get from
     // tilt, so that the scaling of the yaw control is the same at any
     // tilt angle
@@ -509,14 +519,14 @@ void Tiltrotor::tilt_compensate(float *thrust, uint8_t num_motors)
     }
     if (quadplane.in_vtol_mode()) {
         // we are transitioning to VTOL flight
-        const float tilt_factor = cosf(radians(current_tilt*90));
+        const float tilt_factor = _cos_tilt;
         tilt_compensate_angle(thrust, num_motors, tilt_factor, 1);
     } else {
         float inv_tilt_factor;
         if (current_tilt > 0.98f) {
             inv_tilt_factor = 1.0 / cosf(radians(0.98f*90));
         } else {
-            inv_tilt_factor = 1.0 / cosf(radians(current_tilt*90));
+            inv_tilt_factor = 1.0 / _cos_tilt;
         }
         tilt_compensate_angle(thrust, num_motors, 1, inv_tilt_factor);
     }
@@ -624,9 +634,8 @@ void Tiltrotor::vectoring(void)
         }
 
         // now apply vectored thrust for yaw and roll.
-        const float tilt_rad = radians(current_tilt*90);
-        const float sin_tilt = sinf(tilt_rad);
-        const float cos_tilt = cosf(tilt_rad);
+        const float sin_tilt = _sin_tilt;
+        const float cos_tilt = _cos_tilt;
         // the MotorsMatrix library normalises roll factor to 0.5, so
         // we need to use the same factor here to keep the same roll
         // gains when tilted as we have when not tilted
@@ -697,7 +706,7 @@ void Tiltrotor::bicopter_output(void)
     }
 
     // reduce authority of bicopter as motors are tilted forwards
-    const float scaling = cosf(current_tilt * M_PI_2);
+    const float scaling = _cos_tilt;
     tilt_left  *= scaling;
     tilt_right *= scaling;
 
@@ -126,6 +126,13 @@ private:
     // with slow tilt rates the tilt angle can lag
     bool angle_achieved;
 
+    // sin/cos of the current tilt angle, refreshed whenever
+    // current_tilt changes so the per-loop output paths avoid
+    // recomputing trig of the same angle
+    float _sin_tilt;
+    float _cos_tilt = 1.0;
+    void update_tilt_trig();
+
     // references for convenience
     QuadPlane& quadplane;
     AP_MotorsMulticopter*& motors;
@@ -173,6 +173,12 @@ void Fins::output_fins()
 {
     _time = AP_HAL::micros() * 1.0e-6;
 
+    // fins only ever oscillate at the base frequency or, in turbo mode, at
+    // exactly double it, so one trig evaluation per loop covers every fin
+    // with the double angle identity
+    const float cos_base = cosf(freq_hz * _time * 2 * M_PI);
+    const float cos_double = 2 * cos_base * cos_base - 1;
+
     for (int8_t i=0; i<NUM_FINS; i++) {
         _amp[i] =  fmaxf(0,_right_amp_factor[i]*right_out) + fmaxf(0,_front_amp_factor[i]*front_out) +
                    fabsf(_down_amp_factor[i]*down_out) + fabsf(_yaw_amp_factor[i]*yaw_out);
@@ -209,7 +215,7 @@ void Fins::output_fins()
             }
         }
         // finding and outputting current position for each servo from sine wave
-        _thrpos[i]= _amp[i]*cosf(freq_hz * _freq[i] * _time * 2 * M_PI) + _off[i];
+        _thrpos[i]= _amp[i]*(_freq[i] == 2 ? cos_double : cos_base) + _off[i];
         SRV_Channels::set_output_scaled(SRV_Channels::get_motor_function(i), _thrpos[i] * INPUT_AND_OUTPUT_SCALING);
     }
 
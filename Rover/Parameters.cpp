@@ -480,7 +480,7 @@ const AP_Param::GroupInfo ParametersG2::var_info[] = {
 #if HAL_SPRAYER_ENABLED
     // @Group: SPRAY_
     // @Path: ../libraries/AC_Sprayer/AC_Sprayer.cpp
-    AP_SUBGROUPINFO(sprayer, "SPRAY_", 26, ParametersG2, AC_Sprayer),
+    AP_SUBGROUPPTR(sprayer, "SPRAY_", 26, ParametersG2, AC_Sprayer),
 #endif
 
     // @Group: WRC
@@ -634,6 +634,16 @@ const AP_Param::GroupInfo ParametersG2::var_info[] = {
     // @Path: mode_circle.cpp
     AP_SUBGROUPINFO(mode_circle, "CIRC", 57, ParametersG2, ModeCircle),
 
+#if HAL_SPRAYER_ENABLED
+    // @Param: SPRAY_ENABLE
+    // @DisplayName: Sprayer enable/disable
+    // @Description: Allows you to enable (1) or disable (0) the sprayer. The sprayer is only allocated when enabled, saving memory when not fitted
+    // @Values: 0:Disabled,1:Enabled
+    // @User: Standard
+    // @RebootRequired: True
+    AP_GROUPINFO("SPRAY_ENABLE", 58, ParametersG2, sprayer_enable, 0),
+#endif
+
     AP_GROUPEND
 };
 
@@ -756,6 +766,7 @@ const AP_Param::ConversionInfo conversion_table[] = {
     { Parameters::k_param_g2,               369,     AP_PARAM_INT8, "TRQ1_POWER" },
     { Parameters::k_param_g2,               433,     AP_PARAM_FLOAT, "TRQ1_SLEW_TIME" },
     { Parameters::k_param_g2,               497,     AP_PARAM_FLOAT, "TRQ1_DIR_DELAY" },
+    { Parameters::k_param_g2,                26,     AP_PARAM_INT8,  "SPRAY_ENABLE" },
 };
 
 
@@ -356,8 +356,9 @@ public:
     AP_Float loit_radius;
 
 #if HAL_SPRAYER_ENABLED
-    // Sprayer
-    AC_Sprayer sprayer;
+    // Sprayer, allocated at boot only if SPRAY_ENABLE is set
+    AC_Sprayer *sprayer;
+    AP_Int8 sprayer_enable;
 #endif
 
 #if HAL_RALLY_ENABLED
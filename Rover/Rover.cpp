@@ -118,7 +118,7 @@ const AP_Scheduler::Task Rover::scheduler_tasks[] = {
     SCHED_TASK_CLASS(ModeSmartRTL,        &rover.mode_smartrtl,    save_position,   3,  200,  90),
     SCHED_TASK(one_second_loop,         1,   1500,  96),
 #if HAL_SPRAYER_ENABLED
-    SCHED_TASK_CLASS(AC_Sprayer,          &rover.g2.sprayer,       update,          3,  90,  99),
+    SCHED_TASK(sprayer_update,          3,     90,  99),
 #endif
 #if HAL_LOGGING_ENABLED
     SCHED_TASK_CLASS(AP_Logger,           &rover.logger,           periodic_tasks, 50,  300, 108),
@@ -472,6 +472,19 @@ void Rover::handle_auto_arm_once()
 }
 #endif  // AP_ROVER_AUTO_ARM_ONCE_ENABLED
 
+#if HAL_SPRAYER_ENABLED
+/*
+  update the sprayer, which is only allocated if SPRAY_ENABLE was set
+  at boot
+ */
+void Rover::sprayer_update(void)
+{
+    if (g2.sprayer != nullptr) {
+        g2.sprayer->update();
+    }
+}
+#endif
+
 /*
   once a second events
  */
@@ -281,6 +281,9 @@ private:
     void update_logging2(void);
     void one_second_loop(void);
     void update_current_mode(void);
+#if HAL_SPRAYER_ENABLED
+    void sprayer_update(void);
+#endif
 
     // balance_bot.cpp
     void balancebot_pitch_control(float &throttle);
@@ -65,6 +65,17 @@ void Rover::init_ardupilot()
 
     init_rc_in();            // sets up rc channels deadzone
     g2.motors.init(get_frame_type());        // init motors including setting servo out channels ranges
+
+#if HAL_SPRAYER_ENABLED
+    // only allocate the sprayer if it is enabled, saving memory on
+    // the majority of vehicles which have none fitted
+    if (g2.sprayer_enable) {
+        g2.sprayer = NEW_NOTHROW AC_Sprayer();
+        if (g2.sprayer != nullptr) {
+            AP_Param::load_object_from_eeprom(g2.sprayer, AC_Sprayer::var_info);
+        }
+    }
+#endif
     AP::srv().enable_aux_servos();
 
     // init wheel encoders
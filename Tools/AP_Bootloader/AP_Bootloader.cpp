@@ -139,7 +139,14 @@ int main(void)
         // fast boot for good firmware if we haven't been told to stay
         // in bootloader
         try_boot = true;
-        timeout = 1000;
+        timeout = AP_BOOTLOADER_FAST_BOOT_TIMEOUT_MS;
+#if defined(HAL_GPIO_PIN_VBUS) && AP_BOOTLOADER_VBUS_FAST_BOOT
+        if (palReadLine(HAL_GPIO_PIN_VBUS) == 0) {
+            // no USB host attached, so nobody can use the handshake
+            // window; boot immediately
+            timeout = 0;
+        }
+#endif
     }
 #endif   // ifndef(BOOTLOADER_DEV_LIST)
 #if AP_BOOTLOADER_NETWORK_ENABLED
@@ -10,3 +10,17 @@
 #ifndef AP_BOOTLOADER_NETWORK_ENABLED
 #define AP_BOOTLOADER_NETWORK_ENABLED AP_NETWORKING_ENABLED
 #endif
+
+// length of the serial handshake window when the firmware has passed
+// its checks and we have not been asked to stay in the bootloader
+#ifndef AP_BOOTLOADER_FAST_BOOT_TIMEOUT_MS
+#define AP_BOOTLOADER_FAST_BOOT_TIMEOUT_MS 1000
+#endif
+
+// boot good firmware with no handshake window at all when no USB host
+// is present (VBUS low); with nothing on the other end of the USB
+// cable nobody can use the window, and skipping it speeds up field
+// battery swaps. Needs HAL_GPIO_PIN_VBUS in hwdef
+#ifndef AP_BOOTLOADER_VBUS_FAST_BOOT
+#define AP_BOOTLOADER_VBUS_FAST_BOOT 0
+#endif
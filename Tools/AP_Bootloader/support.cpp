@@ -10,6 +10,7 @@
 #include <AP_HAL_ChibiOS/hwdef/common/flash.h>
 #include <AP_HAL_ChibiOS/hwdef/common/stm32_util.h>
 #include <AP_Math/AP_Math.h>
+#include <AP_CheckFirmware/AP_CheckFirmware.h>
 #include "support.h"
 #include "mcu_f1.h"
 #include "mcu_f3.h"
@@ -128,11 +129,17 @@ uint32_t flash_func_read_word(uint32_t offset)
 
 bool flash_func_write_word(uint32_t offset, uint32_t v)
 {
+#if AP_CHECK_FIRMWARE_ENABLED
+    mark_firmware_modified();
+#endif
     return stm32_flash_write(uint32_t(flash_base+offset), &v, sizeof(v));
 }
 
 bool flash_func_write_words(uint32_t offset, uint32_t *v, uint8_t n)
 {
+#if AP_CHECK_FIRMWARE_ENABLED
+    mark_firmware_modified();
+#endif
     return stm32_flash_write(uint32_t(flash_base+offset), v, n*sizeof(*v));
 }
 
@@ -152,9 +159,15 @@ bool flash_func_is_erased(uint32_t sector)
 bool flash_func_erase_sector(uint32_t sector, bool force_erase)
 {
 #if AP_BOOTLOADER_ALWAYS_ERASE
+#if AP_CHECK_FIRMWARE_ENABLED
+    mark_firmware_modified();
+#endif
     return stm32_flash_erasepage(flash_base_page+sector);
 #else
     if (force_erase || !stm32_flash_ispageerased(flash_base_page+sector)) {
+#if AP_CHECK_FIRMWARE_ENABLED
+        mark_firmware_modified();
+#endif
         return stm32_flash_erasepage(flash_base_page+sector);
     }
     return true;
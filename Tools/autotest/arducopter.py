@@ -7,6 +7,7 @@ AP_FLAKE8_CLEAN
 from __future__ import annotations
 
 import copy
+import json
 import math
 import os
 import pathlib
@@ -14080,6 +14081,65 @@ class AutoTestCopter(vehicle_test_suite.TestSuite):
         if not lines[-2].startswith("AP_Vehicle::update_arming"):
             raise NotAchievedException("Expected EFI last not (%s)" % lines[-2])
 
+    def PerfInfoMissionBenchmark(self):
+        '''collect per-task scheduler timing over a canned mission into a machine-readable report'''
+        self.set_parameter('SCHED_OPTIONS', 1)  # enable gathering
+        # the first fetch starts statistics collection:
+        self.fetch_file_via_ftp("@SYS/tasks.txt")
+
+        self.fly_mission("copter_mission.txt", strict=False)
+
+        content = self.fetch_file_via_ftp("@SYS/tasks.txt")
+
+        lines = content.split("\n")
+        if not lines[0].startswith("TasksV2"):
+            raise NotAchievedException("Expected TasksV2 as first line not (%s)" % lines[0])
+
+        line_re = re.compile(
+            r"^(?P<name>\S.*?) +MIN=(?P<min>\d+) +MAX=(?P<max>\d+) +AVG=(?P<avg>\d+) "
+            r"+OVR=(?P<ovr>\d+) +SLP=(?P<slp>\d+), +TOT=(?P<tot>[0-9.]+)%")
+        tasks = {}
+        for line in lines[1:]:
+            m = line_re.match(line)
+            if m is None:
+                continue
+            tasks[m.group("name").rstrip()] = {
+                "min_us": int(m.group("min")),
+                "max_us": int(m.group("max")),
+                "avg_us": int(m.group("avg")),
+                "overruns": int(m.group("ovr")),
+                "slips": int(m.group("slp")),
+                "total_pct": float(m.group("tot")),
+            }
+        if len(tasks) < 10:
+            raise NotAchievedException("Parsed too few tasks (%u)" % len(tasks))
+
+        # emit a machine-readable report for release-over-release comparison
+        report_path = self.buildlogs_path("copter-task-benchmark.json")
+        with open(report_path, "w") as f:
+            json.dump(tasks, f, indent=2, sort_keys=True)
+        self.progress("Wrote task benchmark report to %s" % report_path)
+
+        # a gross-regression tripwire; release comparisons should diff
+        # the reports, these bounds are deliberately generous so that
+        # CI timing noise does not fail the test
+        for name, stats in tasks.items():
+            if stats["total_pct"] > 60.0:
+                raise NotAchievedException(
+                    "Task %s consumed %.1f%% of scheduler time" %
+                    (name, stats["total_pct"]))
+
+    def SchedulerLoopRateKPI(self):
+        '''check achieved loop rate and long-loop fraction over a short flight'''
+        expected_loop_rate = self.get_parameter("SCHED_LOOP_RATE")
+        self.takeoff(10, mode="LOITER")
+        self.delay_sim_time(20)
+        self.do_RTL()
+        self.assert_pm_loop_rate_kpis(
+            self.current_onboard_log_filepath(),
+            expected_loop_rate,
+        )
+
     def RTL_TO_RALLY(self, target_system=1, target_component=1):
         '''Check RTL to rally point'''
         self.wait_ready_to_arm()
@@ -17883,6 +17943,8 @@ return update, 1000
             self.DataFlashErase,
             self.Callisto,
             self.PerfInfo,
+            self.PerfInfoMissionBenchmark,
+            self.SchedulerLoopRateKPI,
             self.ModeAllowsEntryWhenNoPilotInput,
             self.Replay,
             self.FETtecESC,
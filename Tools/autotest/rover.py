@@ -4990,6 +4990,62 @@ Brakes have negligible effect (with=%0.2fm without=%0.2fm delta=%0.2fm)
         self.wait_distance_to_home(3, 7, timeout=300)
         self.disarm_vehicle()
 
+    def PolyFenceObjectAvoidanceBendyRulerPlanTiming(self, target_system=1, target_component=1):
+        '''measure per-plan path planner latency while avoiding a complex
+        fence, using the OAPL log message.  This is the scenario from
+        PolyFenceObjectAvoidanceBendyRulerEasierGuided; the gate on plan time
+        is deliberately generous so it only catches gross planner
+        regressions, but the reported distribution can be compared across
+        releases.
+        '''
+        self.load_fence_using_mavwp("rover-path-bendyruler-fence.txt")
+        self.set_parameters({
+            "AVOID_ENABLE": 3,
+            "OA_TYPE": 1,  # BendyRuler
+            "FENCE_ENABLE": 1,
+            "WP_RADIUS": 5,
+        })
+        self.reboot_sitl()
+        self.set_parameters({
+            "OA_BR_LOOKAHEAD": 60,
+        })
+        self.change_mode('GUIDED')
+        self.wait_ready_to_arm()
+        self.arm_vehicle()
+        target_loc = mavutil.location(40.071260, -105.227000, 1584, 0)
+        self.send_guided_mission_item(target_loc,
+                                      target_system=target_system,
+                                      target_component=target_component)
+        self.wait_location(target_loc, timeout=300, accuracy=15)
+        self.disarm_vehicle()
+
+        dfreader = self.dfreader_for_current_onboard_log()
+        plan_times_us = []
+        while True:
+            m = dfreader.recv_match(type="OAPL")
+            if m is None:
+                break
+            plan_times_us.append(m.RunUS)
+        if len(plan_times_us) < 5:
+            raise NotAchievedException(
+                "Insufficient OAPL messages in onboard log (want>=5 got=%u)" %
+                len(plan_times_us))
+        plan_times_us.sort()
+        mean_us = sum(plan_times_us) / len(plan_times_us)
+        p50_us = plan_times_us[len(plan_times_us) // 2]
+        p90_us = plan_times_us[(len(plan_times_us) * 9) // 10]
+        max_us = plan_times_us[-1]
+        self.progress(
+            "Planner latency over %u plans: mean=%uus p50=%uus p90=%uus max=%uus" %
+            (len(plan_times_us), mean_us, p50_us, p90_us, max_us))
+        # the planner runs at 1Hz and results over 3s old are ignored, so a
+        # plan anywhere near that long has failed regardless of hardware:
+        max_plan_time_us = 1000000
+        if max_us > max_plan_time_us:
+            raise NotAchievedException(
+                "Planner plan time too long (want<%uus got=%uus)" %
+                (max_plan_time_us, max_us))
+
     def test_scripting_simple_loop(self):
         self.start_subtest("Scripting simple loop")
 
@@ -7492,6 +7548,7 @@ return update()
             self.SendToComponents,
             self.PolyFenceObjectAvoidanceBendyRulerEasierGuided,
             self.PolyFenceObjectAvoidanceBendyRulerEasierAuto,
+            self.PolyFenceObjectAvoidanceBendyRulerPlanTiming,
             self.SlewRate,
             self.Scripting,
             self.ScriptingSteeringAndThrottle,
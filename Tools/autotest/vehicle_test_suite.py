@@ -12974,6 +12974,57 @@ switch value'''
                 (path, max_dropped))
         self.progress("Log (%s) has no dropped blocks" % path)
 
+    def assert_pm_loop_rate_kpis(self,
+                                 path,
+                                 expected_loop_rate,
+                                 min_rate_ratio=0.90,
+                                 max_long_loop_fraction=0.15):
+        '''check scheduler PM messages in a dataflash log against
+        performance thresholds.  The achieved loop rate and the
+        fraction of long-running loops are computed over each PM
+        interval; the first interval is ignored as it includes
+        startup.  A regression which costs loop rate passes a
+        behavioural test suite, so tests protecting scheduling
+        headroom should call this on their flight's log.'''
+        dfreader = self.dfreader_for_path(path)
+        last_time_us = None
+        intervals = 0
+        worst_rate = None
+        worst_long_fraction = 0
+        while True:
+            m = dfreader.recv_match(type='PM')
+            if m is None:
+                break
+            time_us = m.TimeUS
+            if last_time_us is None:
+                last_time_us = time_us
+                continue
+            dt = (time_us - last_time_us) * 1.0e-6
+            last_time_us = time_us
+            if dt <= 0 or m.NL == 0:
+                continue
+            intervals += 1
+            if intervals == 1:
+                # contains boot-time initialisation
+                continue
+            rate = m.NL / dt
+            if worst_rate is None or rate < worst_rate:
+                worst_rate = rate
+            long_fraction = m.NLon / m.NL
+            worst_long_fraction = max(worst_long_fraction, long_fraction)
+        if worst_rate is None:
+            raise NotAchievedException("Insufficient PM messages in %s" % path)
+        self.progress("Loop rate KPIs: worst-rate=%.1fHz (expected %.1fHz) worst-long-loop-fraction=%.3f" %
+                      (worst_rate, expected_loop_rate, worst_long_fraction))
+        if worst_rate < expected_loop_rate * min_rate_ratio:
+            raise NotAchievedException(
+                "Achieved loop rate %.1fHz below %.0f%% of expected %.1fHz" %
+                (worst_rate, min_rate_ratio*100, expected_loop_rate))
+        if worst_long_fraction > max_long_loop_fraction:
+            raise NotAchievedException(
+                "Long-running loop fraction %.3f exceeds %.3f" %
+                (worst_long_fraction, max_long_loop_fraction))
+
     def current_onboard_log_contains_message(self, messagetype):
         self.progress("Checking (%s) for (%s)" %
                       (self.current_onboard_log_filepath(), messagetype))
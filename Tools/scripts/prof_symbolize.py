@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+
+'''
+symbolize PROF sampling-profiler messages from a dataflash log against
+the matching ELF, producing "symbol count" lines suitable for
+flamegraph.pl or simple sorting
+
+AP_FLAKE8_CLEAN
+'''
+
+import optparse
+import subprocess
+import sys
+
+from pymavlink import DFReader
+
+
+def symbolize(logfile, elf, addr2line):
+    '''return a dict of symbol -> sample count'''
+    counts = {}
+    log = DFReader.DFReader_binary(logfile)
+    addresses = []
+    while True:
+        m = log.recv_match(type='PROF')
+        if m is None:
+            break
+        addresses.append(m.PC)
+        counts[m.PC] = counts.get(m.PC, 0) + 1
+
+    if len(addresses) == 0:
+        print("No PROF messages found in %s" % logfile, file=sys.stderr)
+        sys.exit(1)
+
+    unique = sorted(counts.keys())
+    cmd = [addr2line, "-e", elf, "-f", "-C"]
+    cmd.extend(["0x%x" % a for a in unique])
+    output = subprocess.check_output(cmd).decode('utf-8').splitlines()
+
+    symbol_counts = {}
+    for i, addr in enumerate(unique):
+        # addr2line emits a function line and a file:line line per address
+        function = output[2*i]
+        symbol_counts[function] = symbol_counts.get(function, 0) + counts[addr]
+    return symbol_counts, len(addresses)
+
+
+if __name__ == '__main__':
+    parser = optparse.OptionParser("prof_symbolize.py [options] LOGFILE ELF")
+    parser.add_option("--addr2line", default="arm-none-eabi-addr2line",
+                      help="addr2line binary to use")
+    opts, args = parser.parse_args()
+    if len(args) != 2:
+        parser.print_help()
+        sys.exit(1)
+
+    symbol_counts, total = symbolize(args[0], args[1], opts.addr2line)
+    for symbol, count in sorted(symbol_counts.items(), key=lambda kv: -kv[1]):
+        print("%s %u %.2f%%" % (symbol, count, 100.0 * count / total))
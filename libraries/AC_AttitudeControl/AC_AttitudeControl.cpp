@@ -213,7 +213,7 @@ float AC_AttitudeControl::get_slew_yaw_max_rads() const
     if (!is_positive(_ang_vel_yaw_max_degs)) {
         return radians(_rate_wp_yaw_max_degs);
     }
-    return MIN(radians(_ang_vel_yaw_max_degs), radians(_rate_wp_yaw_max_degs));
+    return radians(MIN(_ang_vel_yaw_max_degs.get(), _rate_wp_yaw_max_degs.get()));
 }
 
 // get the latest gyro for the purposes of attitude control
@@ -346,8 +346,13 @@ void AC_AttitudeControl::input_quaternion(Quaternion& attitude_desired_quat, Vec
     // Update internal attitude target state
     update_attitude_target();
 
+    // convert the configured rate limits once per iteration
+    const float ang_vel_roll_max_rads = radians(_ang_vel_roll_max_degs);
+    const float ang_vel_pitch_max_rads = radians(_ang_vel_pitch_max_degs);
+    const float ang_vel_yaw_max_rads = radians(_ang_vel_yaw_max_degs);
+
     // Limit the body-frame angular velocity input
-    ang_vel_limit(ang_vel_body_rads, radians(_ang_vel_roll_max_degs), radians(_ang_vel_pitch_max_degs), radians(_ang_vel_yaw_max_degs));
+    ang_vel_limit(ang_vel_body_rads, ang_vel_roll_max_rads, ang_vel_pitch_max_rads, ang_vel_yaw_max_rads);
 
     // Convert the limited body-frame angular velocity input into the frame used for quaternion integration
     Vector3f ang_vel_target = attitude_desired_quat * ang_vel_body_rads;
@@ -360,9 +365,9 @@ void AC_AttitudeControl::input_quaternion(Quaternion& attitude_desired_quat, Vec
 
         // Shape the attitude error into angular velocity and acceleration targets with configured
         // rate and acceleration limits and time constants (roll/pitch use _input_tc, yaw uses _rate_y_tc).
-        attitude_command_model(wrap_PI(attitude_error_angle.x), 0.0, _ang_vel_target_rads.x, _ang_accel_target_rads.x, radians(_ang_vel_roll_max_degs), get_accel_roll_max_radss(), _input_tc, _dt_s);
-        attitude_command_model(wrap_PI(attitude_error_angle.y), 0.0, _ang_vel_target_rads.y, _ang_accel_target_rads.y, radians(_ang_vel_pitch_max_degs), get_accel_pitch_max_radss(), _input_tc, _dt_s);
-        attitude_command_model(wrap_PI(attitude_error_angle.z), 0.0, _ang_vel_target_rads.z, _ang_accel_target_rads.z, radians(_ang_vel_yaw_max_degs), get_accel_yaw_max_radss(), _rate_y_tc, _dt_s);
+        attitude_command_model(wrap_PI(attitude_error_angle.x), 0.0, _ang_vel_target_rads.x, _ang_accel_target_rads.x, ang_vel_roll_max_rads, get_accel_roll_max_radss(), _input_tc, _dt_s);
+        attitude_command_model(wrap_PI(attitude_error_angle.y), 0.0, _ang_vel_target_rads.y, _ang_accel_target_rads.y, ang_vel_pitch_max_rads, get_accel_pitch_max_radss(), _input_tc, _dt_s);
+        attitude_command_model(wrap_PI(attitude_error_angle.z), 0.0, _ang_vel_target_rads.z, _ang_accel_target_rads.z, ang_vel_yaw_max_rads, get_accel_yaw_max_radss(), _rate_y_tc, _dt_s);
     } else {
         // No shaping: directly set attitude and angular velocity targets
         _attitude_target = attitude_desired_quat;
@@ -1133,10 +1138,14 @@ void AC_AttitudeControl::attitude_command_model(float error_angle, float desired
 // This function can be used to predict the delay associated with angle requests.
 void AC_AttitudeControl::command_model_rate_predictor(const Vector2f &error_angle_rad, Vector2f& target_ang_vel_rads, Vector2f& target_ang_accel_rads, float dt) const
 {
+    // convert the configured rate limits once per iteration
+    const float ang_vel_roll_max_rads = radians(_ang_vel_roll_max_degs);
+    const float ang_vel_pitch_max_rads = radians(_ang_vel_pitch_max_degs);
+
     if (_rate_bf_ff_enabled) {
         // translate the roll pitch and yaw acceleration limits to the euler axis
-        attitude_command_model(wrap_PI(error_angle_rad.x), 0.0, target_ang_vel_rads.x, target_ang_accel_rads.x, radians(_ang_vel_roll_max_degs), get_accel_roll_max_radss(), _input_tc, _dt_s);
-        attitude_command_model(wrap_PI(error_angle_rad.y), 0.0, target_ang_vel_rads.y, target_ang_accel_rads.y, radians(_ang_vel_pitch_max_degs), get_accel_pitch_max_radss(), _input_tc, _dt_s);
+        attitude_command_model(wrap_PI(error_angle_rad.x), 0.0, target_ang_vel_rads.x, target_ang_accel_rads.x, ang_vel_roll_max_rads, get_accel_roll_max_radss(), _input_tc, _dt_s);
+        attitude_command_model(wrap_PI(error_angle_rad.y), 0.0, target_ang_vel_rads.y, target_ang_accel_rads.y, ang_vel_pitch_max_rads, get_accel_pitch_max_radss(), _input_tc, _dt_s);
     } else {
         const float angleP_roll = _p_angle_roll.kP() * _angle_P_scale.x;
         const float angleP_pitch = _p_angle_pitch.kP() * _angle_P_scale.y;
@@ -1145,7 +1154,7 @@ void AC_AttitudeControl::command_model_rate_predictor(const Vector2f &error_angl
     }
     // Limit the angular velocity correction
     Vector3f ang_vel_rads(target_ang_vel_rads.x, target_ang_vel_rads.y, 0.0f);
-    ang_vel_limit(ang_vel_rads, radians(_ang_vel_roll_max_degs), radians(_ang_vel_pitch_max_degs), 0.0f);
+    ang_vel_limit(ang_vel_rads, ang_vel_roll_max_rads, ang_vel_pitch_max_rads, 0.0f);
 
     target_ang_vel_rads.x = ang_vel_rads.x;
     target_ang_vel_rads.y = ang_vel_rads.y;
@@ -123,6 +123,13 @@ const AP_Param::GroupInfo AC_Avoid::var_info[] = {
     AP_GROUPINFO_FRAME("ANG_MAX", 11,  AC_Avoid, _angle_max_deg, 10.0, AP_PARAM_FRAME_COPTER | AP_PARAM_FRAME_HELI | AP_PARAM_FRAME_TRICOPTER),
 #endif
 
+    // @Param: OPTIONS
+    // @DisplayName: Avoidance options
+    // @Description: Bitmask of avoidance options. Logging the proximity obstacles records the obstacle set consumed by simple avoidance so decisions can be reconstructed from the log
+    // @Bitmask: 0:Log proximity obstacles
+    // @User: Advanced
+    AP_GROUPINFO("OPTIONS", 12, AC_Avoid, _options, 0),
+
     AP_GROUPEND
 };
 
@@ -1246,6 +1253,18 @@ void AC_Avoid::adjust_velocity_proximity(float kP, float accel_cmss, Vector3f &d
         // no obstacles
         return;
     }
+
+#if HAL_LOGGING_ENABLED
+    // opt-in capture of the obstacle set being consumed, so avoidance
+    // decisions can be reconstructed from the log
+    if (option_enabled(Options::LOG_PROXIMITY_OBSTACLES)) {
+        const uint32_t now_ms = AP_HAL::millis();
+        if ((now_ms - _last_obs_log_ms) > 100) {
+            _last_obs_log_ms = now_ms;
+            Write_SimpleAvoidanceObstacles(_proximity, obstacle_num);
+        }
+    }
+#endif
  
     const AP_AHRS &_ahrs = AP::ahrs();
     
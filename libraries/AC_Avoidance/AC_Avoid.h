@@ -216,6 +216,15 @@ private:
     // Logging function
     void Write_SimpleAvoidance(const uint8_t state, const Vector3f& desired_vel, const Vector3f& modified_vel, const bool back_up) const;
 
+    // log the proximity obstacles being consumed by simple avoidance
+    void Write_SimpleAvoidanceObstacles(const class AP_Proximity &proximity, uint8_t obstacle_count) const;
+
+    // avoidance options
+    enum class Options : uint16_t {
+        LOG_PROXIMITY_OBSTACLES = (1U << 0),
+    };
+    bool option_enabled(Options opt) const { return (uint16_t(_options.get()) & uint16_t(opt)) != 0; }
+
     // parameters
     AP_Int8 _enabled;
 #if AP_AVOIDANCE_ALTHOLD_ENABLED
@@ -229,11 +238,13 @@ private:
     AP_Float _alt_min_m;                // alt below which Proximity based avoidance is turned off
     AP_Float _accel_max_mss;            // maximum acceleration while simple avoidance is active
     AP_Float _backup_deadzone_m;        // distance beyond AVOID_MARGIN parameter, after which vehicle will backaway from obstacles
+    AP_Int16 _options;                  // avoidance options bitmask
 
     bool _proximity_enabled = true;     // true if proximity sensor based avoidance is enabled (used to allow pilot to enable/disable)
     bool _proximity_alt_enabled = true; // true if proximity sensor based avoidance is enabled based on altitude
     uint32_t _last_limit_time;          // the last time a limit was active
     uint32_t _last_log_ms;              // the last time simple avoidance was logged
+    uint32_t _last_obs_log_ms;          // the last time proximity obstacles were logged
     Vector3f _prev_avoid_vel_neu_cms;   // copy of avoidance adjusted velocity
 
     static AC_Avoid *_singleton;
@@ -6,8 +6,10 @@
 #include "AC_Avoid.h"
 #include "AP_OADijkstra.h"
 #include "AP_OABendyRuler.h"
+#include "AP_OAPathPlanner.h"
 #include <AP_Logger/AP_Logger.h>
 #include <AP_AHRS/AP_AHRS.h>
+#include <AP_Proximity/AP_Proximity.h>
 
 #if AP_OAPATHPLANNER_BENDYRULER_ENABLED
 void AP_OABendyRuler::Write_OABendyRuler(const uint8_t type, const bool active, const float target_yaw, const float target_pitch, const bool resist_chg, const float margin, const Location &final_dest, const Location &oa_dest) const
@@ -78,6 +80,42 @@ void AP_OADijkstra::Write_Visgraph_point(const uint8_t version, const uint8_t po
 }
 #endif
 
+#if AP_OAPATHPLANNER_ENABLED
+void AP_OAPathPlanner::Write_OAPlanner(const uint8_t type, const uint8_t state, const uint32_t run_us) const
+{
+    const struct log_OAPlanner pkt{
+        LOG_PACKET_HEADER_INIT(LOG_OA_PLANNER_MSG),
+        time_us     : AP_HAL::micros64(),
+        type        : type,
+        state       : state,
+        run_us      : run_us,
+    };
+    AP::logger().WriteBlock(&pkt, sizeof(pkt));
+}
+#endif
+
+#if AP_AVOIDANCE_ENABLED && HAL_PROXIMITY_ENABLED
+void AC_Avoid::Write_SimpleAvoidanceObstacles(const AP_Proximity &proximity, const uint8_t obstacle_count) const
+{
+    for (uint8_t i = 0; i < obstacle_count; i++) {
+        Vector3f vector_to_obstacle_neu;
+        if (!proximity.get_obstacle(i, vector_to_obstacle_neu)) {
+            continue;
+        }
+        const struct log_SimpleAvoidObstacle pkt{
+            LOG_PACKET_HEADER_INIT(LOG_SIMPLE_AVOID_OBS_MSG),
+            time_us   : AP_HAL::micros64(),
+            id        : i,
+            count     : obstacle_count,
+            pos_x     : vector_to_obstacle_neu.x * 0.01f,
+            pos_y     : vector_to_obstacle_neu.y * 0.01f,
+            pos_z     : vector_to_obstacle_neu.z * 0.01f,
+        };
+        AP::logger().WriteBlock(&pkt, sizeof(pkt));
+    }
+}
+#endif  // AP_AVOIDANCE_ENABLED && HAL_PROXIMITY_ENABLED
+
 #if AP_AVOIDANCE_ENABLED
 void AC_Avoid::Write_SimpleAvoidance(const uint8_t state, const Vector3f& desired_vel, const Vector3f& modified_vel, const bool back_up) const
 {
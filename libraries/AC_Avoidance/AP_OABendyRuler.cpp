@@ -168,8 +168,10 @@ bool AP_OABendyRuler::search_xy_path(const Location& current_loc, const Location
             Location test_loc = current_loc;
             test_loc.offset_bearing(bearing_test, lookahead_step1_dist);
 
-            // calculate margin from obstacles for this scenario
-            float margin = calc_avoidance_margin(current_loc, test_loc, proximity_only);
+            // calculate margin from obstacles for this scenario.  the exact value only
+            // matters while the margin beats both the best seen so far and the threshold
+            // for the second stage test, so pass the tighter of the two as pruning bound
+            float margin = calc_avoidance_margin(current_loc, test_loc, proximity_only, MIN(best_margin, _margin_max));
             if (margin > best_margin) {
                 best_margin_bearing = bearing_test;
                 best_margin = margin;
@@ -198,7 +200,8 @@ bool AP_OABendyRuler::search_xy_path(const Location& current_loc, const Location
                     test_loc2.offset_bearing(bearing_test2, distance2);
 
                     // calculate minimum margin to fence and obstacles for this scenario
-                    float margin2 = calc_avoidance_margin(test_loc, test_loc2, proximity_only);
+                    // the margin is only compared against the threshold so prune at it
+                    float margin2 = calc_avoidance_margin(test_loc, test_loc2, proximity_only, _margin_max);
                     if (margin2 > _margin_max) {
                         // if the chosen direction is directly towards the destination avoidance can be turned off
                         // i == 0 && j == 0 implies no deviation from bearing to destination 
@@ -270,8 +273,8 @@ bool AP_OABendyRuler::search_vertical_path(const Location &current_loc, const Lo
             Location test_loc = current_loc;
             test_loc.offset_bearing_and_pitch(bearing_to_dest, pitch_delta, lookahead_step1_dist);
 
-            // calculate margin from obstacles for this scenario
-            float margin = calc_avoidance_margin(current_loc, test_loc, proximity_only);
+            // calculate margin from obstacles for this scenario, pruning as in search_xy_path
+            float margin = calc_avoidance_margin(current_loc, test_loc, proximity_only, MIN(best_margin, _margin_max));
 
             if (margin > best_margin) {
                 best_margin_pitch = pitch_delta;
@@ -299,7 +302,8 @@ bool AP_OABendyRuler::search_vertical_path(const Location &current_loc, const Lo
                     test_loc2.offset_bearing_and_pitch(bearing_to_dest2, bearing_test2, distance2);
 
                     // calculate minimum margin to fence and obstacles for this scenario
-                    float margin2 = calc_avoidance_margin(test_loc, test_loc2, proximity_only);
+                    // the margin is only compared against the threshold so prune at it
+                    float margin2 = calc_avoidance_margin(test_loc, test_loc2, proximity_only, _margin_max);
                     if (margin2 > _margin_max) {
                         // if the chosen direction is directly towards the destination we might turn off avoidance
                         // i == 0 && j == 0 implies no deviation from bearing to destination 
@@ -417,39 +421,58 @@ bool AP_OABendyRuler::resist_bearing_change(const Location &destination, const L
 }
 
 // calculate minimum distance between a segment and any obstacle
-float AP_OABendyRuler::calc_avoidance_margin(const Location &start, const Location &end, bool proximity_only) const
+// margin_limit allows best-so-far pruning: once the margin falls to or below the limit
+// the exact value no longer matters to the caller, so the remaining probes are skipped
+float AP_OABendyRuler::calc_avoidance_margin(const Location &start, const Location &end, bool proximity_only, float margin_limit) const
 {
     float margin_min = FLT_MAX;
 
     float latest_margin;
-    
-    if (calc_margin_from_object_database(start, end, latest_margin)) {
-        margin_min = MIN(margin_min, latest_margin);
-    }
-    
+
     if (proximity_only) {
         // only need margin from proximity data
+        if (calc_margin_from_object_database(start, end, latest_margin)) {
+            margin_min = MIN(margin_min, latest_margin);
+        }
         return margin_min;
     }
-    
+
+    // probes are ordered cheapest first so the pruning bound triggers before
+    // the expensive vertex and obstacle scans
     if (calc_margin_from_circular_fence(start, end, latest_margin)) {
         margin_min = MIN(margin_min, latest_margin);
+        if (margin_min <= margin_limit) {
+            return margin_min;
+        }
     }
-    
-    #if VERTICAL_ENABLED 
+
+    #if VERTICAL_ENABLED
     // alt fence only is only needed in vertical avoidance
     if (get_type() == OABendyType::OA_BENDY_VERTICAL) {
         if (calc_margin_from_alt_fence(start, end, latest_margin)) {
             margin_min = MIN(margin_min, latest_margin);
+            if (margin_min <= margin_limit) {
+                return margin_min;
+            }
         }
     }
     #endif
 
+    if (calc_margin_from_inclusion_and_exclusion_circles(start, end, latest_margin)) {
+        margin_min = MIN(margin_min, latest_margin);
+        if (margin_min <= margin_limit) {
+            return margin_min;
+        }
+    }
+
     if (calc_margin_from_inclusion_and_exclusion_polygons(start, end, latest_margin)) {
         margin_min = MIN(margin_min, latest_margin);
+        if (margin_min <= margin_limit) {
+            return margin_min;
+        }
     }
 
-    if (calc_margin_from_inclusion_and_exclusion_circles(start, end, latest_margin)) {
+    if (calc_margin_from_object_database(start, end, latest_margin)) {
         margin_min = MIN(margin_min, latest_margin);
     }
 
@@ -695,25 +718,10 @@ bool AP_OABendyRuler::calc_margin_from_object_database(const Location &start, co
         return false;
     }
 
-    // check each obstacle's distance from segment
-    float smallest_margin = FLT_MAX;
-    for (uint16_t i=0; i<oaDb->database_count(); i++) {
-        const AP_OADatabase::OA_DbItem& item = oaDb->get_item(i);
-        const Vector3f point_cm = item.pos * 100.0f;
-        // margin is distance between line segment and obstacle minus obstacle's radius
-        const float m = Vector3f::closest_distance_between_line_and_point(start_NEU, end_NEU, point_cm) * 0.01f - item.radius;
-        if (m < smallest_margin) {
-            smallest_margin = m;
-        }
-    }
-
-    // return smallest margin
-    if (smallest_margin < FLT_MAX) {
-        margin = smallest_margin;
-        return true;
-    }
-
-    return false;
+    // query the database's spatial index for the closest obstacle to the
+    // segment.  obstacles beyond twice the maximum margin cannot change any
+    // avoidance decision so the search can be bounded
+    return oaDb->closest_object_margin_to_segment(start_NEU * 0.01f, end_NEU * 0.01f, _margin_max * 2.0f, margin);
 }
 
 #endif  // AP_OAPATHPLANNER_BENDYRULER_ENABLED
@@ -46,7 +46,10 @@ private:
     bool search_vertical_path(const Location &current_loc, const Location &destination, Location &destination_new, float lookahead_step1_dist, float lookahead_step2_dist, float bearing_to_dest, float distance_to_dest, bool proximity_only);
 
     // calculate minimum distance between a path and any obstacle
-    float calc_avoidance_margin(const Location &start, const Location &end, bool proximity_only) const;
+    // margin_limit is a best-so-far pruning bound: once the margin falls to or below it the
+    // caller's decisions cannot change, so remaining (more expensive) probes are skipped and
+    // the returned value is only an upper bound on the true margin
+    float calc_avoidance_margin(const Location &start, const Location &end, bool proximity_only, float margin_limit = -FLT_MAX) const;
 
     // determine if BendyRuler should accept the new bearing or try and resist it. Returns true if bearing is not changed  
     bool resist_bearing_change(const Location &destination, const Location &current_loc, bool active, float bearing_test, float lookahead_step1_dist, float margin, Location &prev_dest, float &prev_bearing, float &final_bearing, float &final_margin, bool proximity_only) const;    
@@ -40,6 +40,15 @@ extern const AP_HAL::HAL& hal;
     #define AP_OADATABASE_DISTANCE_FROM_HOME 3
 #endif
 
+// spatial hash grid used to avoid linear scans of the database.  cell size
+// should be at least as large as typical object radii so that matching an
+// incoming object only needs to search the cells adjacent to its own
+#ifndef AP_OADATABASE_SPATIAL_GRID_CELL_SIZE_M
+    #define AP_OADATABASE_SPATIAL_GRID_CELL_SIZE_M 10.0f
+#endif
+#define AP_OADATABASE_GRID_INDEX_NONE       0xFFFF  // bucket or next value meaning "no item"
+#define AP_OADATABASE_GRID_MAX_REACH_CELLS  2       // fall back to a linear scan if more cells than this must be searched in each direction
+
 const AP_Param::GroupInfo AP_OADatabase::var_info[] = {
 
     // @Param: SIZE
@@ -135,6 +144,10 @@ void AP_OADatabase::init()
         GCS_SEND_TEXT(MAV_SEVERITY_INFO, "DB init failed . Sizes queue:%u, db:%u", (unsigned int)_queue.size, (unsigned int)_database.size);
         delete _queue.items;
         delete[] _database.items;
+        delete[] _grid.buckets;
+        delete[] _grid.next;
+        _grid.buckets = nullptr;
+        _grid.next = nullptr;
         return;
     }
 }
@@ -222,6 +235,80 @@ void AP_OADatabase::init_database()
     }
 
     _database.items = NEW_NOTHROW OA_DbItem[_database.size];
+    if (_database.items == nullptr) {
+        return;
+    }
+
+    // allocate the spatial hash grid with roughly two buckets per item,
+    // rounded up to a power of two.  if allocation fails all queries fall
+    // back to linear scans of the items array
+    uint32_t num_buckets = 16;
+    while (num_buckets < MIN(2U * _database.size, 16384U)) {
+        num_buckets <<= 1;
+    }
+    _grid.buckets = NEW_NOTHROW uint16_t[num_buckets];
+    _grid.next = NEW_NOTHROW uint16_t[_database.size];
+    if (_grid.buckets == nullptr || _grid.next == nullptr) {
+        delete[] _grid.buckets;
+        delete[] _grid.next;
+        _grid.buckets = nullptr;
+        _grid.next = nullptr;
+        return;
+    }
+    _grid.num_buckets = num_buckets;
+    memset(_grid.buckets, 0xFF, num_buckets * sizeof(uint16_t));
+}
+
+// return bucket index holding a given grid cell.  multiple cells may share a
+// bucket; queries re-check actual distances so collisions only cost time
+uint16_t AP_OADatabase::grid_bucket_of_cell(const int32_t cell_x, const int32_t cell_y) const
+{
+    const uint32_t hash = ((uint32_t)cell_x * 73856093UL) ^ ((uint32_t)cell_y * 19349663UL);
+    return hash & (_grid.num_buckets - 1);
+}
+
+// return grid cell coordinates holding a given position
+void AP_OADatabase::grid_cell_of_pos(const Vector3f &pos, int32_t &cell_x, int32_t &cell_y) const
+{
+    cell_x = (int32_t)floorf(pos.x / AP_OADATABASE_SPATIAL_GRID_CELL_SIZE_M);
+    cell_y = (int32_t)floorf(pos.y / AP_OADATABASE_SPATIAL_GRID_CELL_SIZE_M);
+}
+
+// add the item at the given database index to the spatial grid
+void AP_OADatabase::grid_link(const uint16_t index)
+{
+    if (!grid_enabled()) {
+        return;
+    }
+    int32_t cell_x, cell_y;
+    grid_cell_of_pos(_database.items[index].pos, cell_x, cell_y);
+    const uint16_t bucket = grid_bucket_of_cell(cell_x, cell_y);
+    _grid.next[index] = _grid.buckets[bucket];
+    _grid.buckets[bucket] = index;
+    _grid.max_radius_m = MAX(_grid.max_radius_m, _database.items[index].radius);
+}
+
+// remove the item at the given database index from the spatial grid
+void AP_OADatabase::grid_unlink(const uint16_t index)
+{
+    if (!grid_enabled()) {
+        return;
+    }
+    int32_t cell_x, cell_y;
+    grid_cell_of_pos(_database.items[index].pos, cell_x, cell_y);
+    const uint16_t bucket = grid_bucket_of_cell(cell_x, cell_y);
+    uint16_t idx = _grid.buckets[bucket];
+    if (idx == index) {
+        _grid.buckets[bucket] = _grid.next[index];
+        return;
+    }
+    while (idx != AP_OADATABASE_GRID_INDEX_NONE) {
+        if (_grid.next[idx] == index) {
+            _grid.next[idx] = _grid.next[index];
+            return;
+        }
+        idx = _grid.next[idx];
+    }
 }
 
 // get bitmask of gcs channels item should be sent to based on its importance
@@ -303,21 +390,53 @@ bool AP_OADatabase::process_queue()
 
         item.send_to_gcs = get_send_to_gcs_flags(item.importance);
 
-        // compare item to all items in database. If found a similar item, update the existing, else add it as a new one
-        bool found = false;
-        for (uint16_t i=0; i<_database.count; i++) {
-            if (item_match(_database.items[i], item)) {
-                database_item_refresh(_database.items[i], item);
-                found = true;
-                break;
+        // compare item to nearby items in database. If found a similar item, update the existing, else add it as a new one
+        uint16_t match_index;
+        if (database_item_find(item, match_index)) {
+            database_item_refresh(match_index, item);
+        } else {
+            database_item_add(item);
+        }
+    }
+    return (_queue.items->available() > 0);
+}
+
+// find index of an item in the database matching the given item
+// returns true on success and updates index
+bool AP_OADatabase::database_item_find(const OA_DbItem &item, uint16_t &index) const
+{
+    // AIS items match on id so the spatial grid cannot help, but these are few
+    if (grid_enabled() && (item.source == OA_DbItem::Source::proximity)) {
+        // matching distance is bounded by the largest radius involved
+        const float reach = MAX(item.radius, _grid.max_radius_m);
+        const int32_t reach_cells = (int32_t)(reach / AP_OADATABASE_SPATIAL_GRID_CELL_SIZE_M) + 1;
+        if (reach_cells <= AP_OADATABASE_GRID_MAX_REACH_CELLS) {
+            int32_t cell_x, cell_y;
+            grid_cell_of_pos(item.pos, cell_x, cell_y);
+            for (int32_t cx = cell_x - reach_cells; cx <= cell_x + reach_cells; cx++) {
+                for (int32_t cy = cell_y - reach_cells; cy <= cell_y + reach_cells; cy++) {
+                    uint16_t idx = _grid.buckets[grid_bucket_of_cell(cx, cy)];
+                    while (idx != AP_OADATABASE_GRID_INDEX_NONE) {
+                        if (item_match(_database.items[idx], item)) {
+                            index = idx;
+                            return true;
+                        }
+                        idx = _grid.next[idx];
+                    }
+                }
             }
+            return false;
         }
+        // radius too large for a bounded neighbourhood search, fall through to linear scan
+    }
 
-        if (!found) {
-            database_item_add(item);
+    for (uint16_t i=0; i<_database.count; i++) {
+        if (item_match(_database.items[i], item)) {
+            index = i;
+            return true;
         }
     }
-    return (_queue.items->available() > 0);
+    return false;
 }
 
 void AP_OADatabase::database_item_add(const OA_DbItem &item)
@@ -327,6 +446,7 @@ void AP_OADatabase::database_item_add(const OA_DbItem &item)
     }
     _database.items[_database.count] = item;
     _database.items[_database.count].send_to_gcs = get_send_to_gcs_flags(_database.items[_database.count].importance);
+    grid_link(_database.count);
     _database.count++;
 }
 
@@ -337,6 +457,9 @@ void AP_OADatabase::database_item_remove(const uint16_t index)
         return;
     }
 
+    // unlink expired object from the spatial grid before it is overwritten
+    grid_unlink(index);
+
     // radius of 0 tells the GCS we don't care about it any more (aka it expired)
     _database.items[index].radius = 0;
     _database.items[index].send_to_gcs = get_send_to_gcs_flags(_database.items[index].importance);
@@ -347,14 +470,18 @@ void AP_OADatabase::database_item_remove(const uint16_t index)
     }
 
     if (index != _database.count) {
-        // copy last object in array over expired object
+        // copy last object in array over expired object, moving it to a new
+        // index in the spatial grid
+        grid_unlink(_database.count);
         _database.items[index] = _database.items[_database.count];
         _database.items[index].send_to_gcs = get_send_to_gcs_flags(_database.items[index].importance);
+        grid_link(index);
     }
 }
 
-void AP_OADatabase::database_item_refresh(OA_DbItem &current_item, const OA_DbItem &new_item) const
+void AP_OADatabase::database_item_refresh(const uint16_t index, const OA_DbItem &new_item)
 {
+    OA_DbItem &current_item = _database.items[index];
     const bool is_different =
             (!is_equal(current_item.radius, new_item.radius)) ||
             (new_item.timestamp_ms - current_item.timestamp_ms >= 500);
@@ -365,10 +492,14 @@ void AP_OADatabase::database_item_refresh(OA_DbItem &current_item, const OA_DbIt
         current_item.timestamp_ms = new_item.timestamp_ms;
         current_item.radius = new_item.radius;
         current_item.send_to_gcs = get_send_to_gcs_flags(current_item.importance);
+        _grid.max_radius_m = MAX(_grid.max_radius_m, current_item.radius);
 
         if (current_item.source == OA_DbItem::Source::AIS) {
-            // Update position for AIS items, these tend to be large and update slowly
+            // Update position for AIS items, these tend to be large and update
+            // slowly.  moving the item can change its grid cell
+            grid_unlink(index);
             current_item.pos = new_item.pos;
+            grid_link(index);
         }
     }
 }
@@ -395,6 +526,65 @@ void AP_OADatabase::database_items_remove_all_expired()
     }
 }
 
+// find the smallest distance (in meters) between a line segment and any obstacle, minus the obstacle's radius
+// seg_start and seg_end are offsets in meters from the EKF origin.  only obstacles within max_dist meters
+// of the segment are guaranteed to be considered which allows the search to be limited to nearby grid cells
+// returns true if an obstacle was found and updates margin
+bool AP_OADatabase::closest_object_margin_to_segment(const Vector3f &seg_start, const Vector3f &seg_end, float max_dist, float &margin) const
+{
+    if (!healthy()) {
+        return false;
+    }
+
+    float smallest_margin = FLT_MAX;
+
+    bool used_grid = false;
+    if (grid_enabled() && is_positive(max_dist)) {
+        // limit the search to grid cells within max_dist of the segment's
+        // bounding box, inflated by the largest object radius.  objects
+        // outside cannot have a margin under max_dist
+        const float inflate = max_dist + _grid.max_radius_m;
+        int32_t cell_x_min, cell_y_min, cell_x_max, cell_y_max;
+        grid_cell_of_pos(Vector3f{MIN(seg_start.x, seg_end.x) - inflate, MIN(seg_start.y, seg_end.y) - inflate, 0}, cell_x_min, cell_y_min);
+        grid_cell_of_pos(Vector3f{MAX(seg_start.x, seg_end.x) + inflate, MAX(seg_start.y, seg_end.y) + inflate, 0}, cell_x_max, cell_y_max);
+
+        // a linear scan is cheaper when the cell range holds more buckets than the database holds items
+        const int32_t num_cells = (cell_x_max - cell_x_min + 1) * (cell_y_max - cell_y_min + 1);
+        if (num_cells <= _database.count) {
+            used_grid = true;
+            for (int32_t cx = cell_x_min; cx <= cell_x_max; cx++) {
+                for (int32_t cy = cell_y_min; cy <= cell_y_max; cy++) {
+                    uint16_t idx = _grid.buckets[grid_bucket_of_cell(cx, cy)];
+                    while (idx != AP_OADATABASE_GRID_INDEX_NONE) {
+                        const OA_DbItem &item = _database.items[idx];
+                        const float m = Vector3f::closest_distance_between_line_and_point(seg_start, seg_end, item.pos) - item.radius;
+                        if (m < smallest_margin) {
+                            smallest_margin = m;
+                        }
+                        idx = _grid.next[idx];
+                    }
+                }
+            }
+        }
+    }
+
+    if (!used_grid) {
+        for (uint16_t i=0; i<_database.count; i++) {
+            const OA_DbItem &item = _database.items[i];
+            const float m = Vector3f::closest_distance_between_line_and_point(seg_start, seg_end, item.pos) - item.radius;
+            if (m < smallest_margin) {
+                smallest_margin = m;
+            }
+        }
+    }
+
+    if (smallest_margin < FLT_MAX) {
+        margin = smallest_margin;
+        return true;
+    }
+    return false;
+}
+
 #if HAL_GCS_ENABLED
 // send ADSB_VEHICLE mavlink messages
 void AP_OADatabase::send_adsb_vehicle(mavlink_channel_t chan, uint16_t interval_ms)
@@ -64,6 +64,12 @@ public:
     // empty queue and try and put into database. Return true if there's more work to do
     bool process_queue();
 
+    // find the smallest distance (in meters) between a line segment and any obstacle, minus the obstacle's radius
+    // seg_start and seg_end are offsets in meters from the EKF origin.  only obstacles within max_dist meters
+    // of the segment are guaranteed to be considered which allows the search to be limited to nearby grid cells
+    // returns true if an obstacle was found and updates margin
+    bool closest_object_margin_to_segment(const Vector3f &seg_start, const Vector3f &seg_end, float max_dist, float &margin) const;
+
     // send ADSB_VEHICLE mavlink messages
     void send_adsb_vehicle(mavlink_channel_t chan, uint16_t interval_ms);
 
@@ -77,10 +83,23 @@ private:
 
     // database item management
     void database_item_add(const OA_DbItem &item);
-    void database_item_refresh(OA_DbItem &current_item, const OA_DbItem &new_item) const;
+    void database_item_refresh(const uint16_t index, const OA_DbItem &new_item);
     void database_item_remove(const uint16_t index);
     void database_items_remove_all_expired();
 
+    // spatial hash grid management.  items are binned into horizontal grid
+    // cells by hashing their cell coordinates into a bucket array, with
+    // per-item next indices forming a singly linked list within each bucket
+    bool grid_enabled() const { return _grid.buckets != nullptr; }
+    uint16_t grid_bucket_of_cell(const int32_t cell_x, const int32_t cell_y) const;
+    void grid_cell_of_pos(const Vector3f &pos, int32_t &cell_x, int32_t &cell_y) const;
+    void grid_link(const uint16_t index);
+    void grid_unlink(const uint16_t index);
+
+    // find index of an item in the database matching the given item
+    // returns true on success and updates index
+    bool database_item_find(const OA_DbItem &item, uint16_t &index) const;
+
     // get bitmask of gcs channels item should be sent to based on its importance
     // returns 0xFF (send to all channels) if should be sent or 0 if it should not be sent
     uint8_t get_send_to_gcs_flags(const OA_DbItemImportance importance) const;
@@ -119,6 +138,13 @@ private:
         uint16_t        size;                               // cached value of _database_size_param that sticks after initialized
     } _database;
 
+    struct {
+        uint16_t        *buckets;                           // head item index for each bucket (or grid index none)
+        uint16_t        *next;                              // next item index within the same bucket for each item
+        uint16_t        num_buckets;                        // power-of-two number of buckets
+        float           max_radius_m;                       // largest object radius seen, bounds the neighbourhood searched (grows only)
+    } _grid;
+
     uint16_t _next_index_to_send[MAVLINK_COMM_NUM_BUFFERS]; // index of next object in _database to send to GCS
     uint16_t _highest_index_sent[MAVLINK_COMM_NUM_BUFFERS]; // highest index in _database sent to GCS
     uint32_t _last_send_to_gcs_ms[MAVLINK_COMM_NUM_BUFFERS];// system time that send_adsb_vehicle was last called
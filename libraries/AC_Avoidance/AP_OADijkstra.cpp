@@ -75,6 +75,7 @@ AP_OADijkstra::AP_OADijkstra_State AP_OADijkstra::update(const Location &current
     // check for inclusion polygon updates
     if (check_inclusion_polygon_updated()) {
         _inclusion_polygon_with_margin_ok = false;
+        _inclusion_polygon_visgraph_dirty = true;
         _polyfence_visgraph_ok = false;
         _shortest_path_ok = false;
     }
@@ -82,6 +83,7 @@ AP_OADijkstra::AP_OADijkstra_State AP_OADijkstra::update(const Location &current
     // check for exclusion polygon updates
     if (check_exclusion_polygon_updated()) {
         _exclusion_polygon_with_margin_ok = false;
+        _exclusion_polygon_visgraph_dirty = true;
         _polyfence_visgraph_ok = false;
         _shortest_path_ok = false;
     }
@@ -89,6 +91,7 @@ AP_OADijkstra::AP_OADijkstra_State AP_OADijkstra::update(const Location &current
     // check for exclusion circle updates
     if (check_exclusion_circle_updated()) {
         _exclusion_circle_with_margin_ok = false;
+        _exclusion_circle_visgraph_dirty = true;
         _polyfence_visgraph_ok = false;
         _shortest_path_ok = false;
     }
@@ -126,9 +129,14 @@ AP_OADijkstra::AP_OADijkstra_State AP_OADijkstra::update(const Location &current
         }
     }
 
-    // create visgraph for all fence (with margin) points
+    // create visgraph for all fence (with margin) points.  if only a single
+    // fence category changed the existing graph is patched which avoids
+    // re-testing every point pair
     if (!_polyfence_visgraph_ok) {
-        _polyfence_visgraph_ok = create_fence_visgraph(_error_id);
+        _polyfence_visgraph_ok = update_fence_visgraph_incremental() || create_fence_visgraph(_error_id);
+        _inclusion_polygon_visgraph_dirty = false;
+        _exclusion_polygon_visgraph_dirty = false;
+        _exclusion_circle_visgraph_dirty = false;
         if (!_polyfence_visgraph_ok) {
             _shortest_path_ok = false;
             dest_to_next_dest_clear = _dest_to_next_dest_clear = false;
@@ -618,7 +626,39 @@ bool AP_OADijkstra::intersects_fence(const Vector2f &seg_start, const Vector2f &
         return false;
     }
 
-    // determine if segment crosses any of the inclusion polygons
+    // determine if segment crosses any of the inclusion or exclusion polygons
+    if (intersects_inclusion_polygons(seg_start, seg_end) ||
+        intersects_exclusion_polygons(seg_start, seg_end)) {
+        return true;
+    }
+
+    // determine if segment crosses any of the inclusion circles
+    for (uint8_t i = 0; i < fence->polyfence().get_inclusion_circle_count(); i++) {
+        Vector2f center_pos_cm;
+        float radius;
+        if (fence->polyfence().get_inclusion_circle(i, center_pos_cm, radius)) {
+            // intersects circle if either start or end is further from the center than the radius
+            const float radius_cm_sq = sq(radius * 100.0f) ;
+            if ((seg_start - center_pos_cm).length_squared() > radius_cm_sq) {
+                return true;
+            }
+            if ((seg_end - center_pos_cm).length_squared() > radius_cm_sq) {
+                return true;
+            }
+        }
+    }
+
+    // determine if segment crosses any of the exclusion circles
+    return intersects_exclusion_circles(seg_start, seg_end);
+}
+
+// returns true if line segment intersects any of the inclusion polygons
+bool AP_OADijkstra::intersects_inclusion_polygons(const Vector2f &seg_start, const Vector2f &seg_end) const
+{
+    const AC_Fence *fence = AC_Fence::get_singleton();
+    if (fence == nullptr) {
+        return false;
+    }
     uint16_t num_points = 0;
     for (uint8_t i = 0; i < fence->polyfence().get_inclusion_polygon_count(); i++) {
         const Vector2f* boundary = fence->polyfence().get_inclusion_polygon(i, num_points);
@@ -629,8 +669,17 @@ bool AP_OADijkstra::intersects_fence(const Vector2f &seg_start, const Vector2f &
             }
         }
     }
+    return false;
+}
 
-    // determine if segment crosses any of the exclusion polygons
+// returns true if line segment intersects any of the exclusion polygons
+bool AP_OADijkstra::intersects_exclusion_polygons(const Vector2f &seg_start, const Vector2f &seg_end) const
+{
+    const AC_Fence *fence = AC_Fence::get_singleton();
+    if (fence == nullptr) {
+        return false;
+    }
+    uint16_t num_points = 0;
     for (uint8_t i = 0; i < fence->polyfence().get_exclusion_polygon_count(); i++) {
         const Vector2f* boundary = fence->polyfence().get_exclusion_polygon(i, num_points);
         if (boundary != nullptr) {
@@ -640,24 +689,16 @@ bool AP_OADijkstra::intersects_fence(const Vector2f &seg_start, const Vector2f &
             }
         }
     }
+    return false;
+}
 
-    // determine if segment crosses any of the inclusion circles
-    for (uint8_t i = 0; i < fence->polyfence().get_inclusion_circle_count(); i++) {
-        Vector2f center_pos_cm;
-        float radius;
-        if (fence->polyfence().get_inclusion_circle(i, center_pos_cm, radius)) {
-            // intersects circle if either start or end is further from the center than the radius
-            const float radius_cm_sq = sq(radius * 100.0f) ;
-            if ((seg_start - center_pos_cm).length_squared() > radius_cm_sq) {
-                return true;
-            }
-            if ((seg_end - center_pos_cm).length_squared() > radius_cm_sq) {
-                return true;
-            }
-        }
+// returns true if line segment intersects any of the exclusion circles
+bool AP_OADijkstra::intersects_exclusion_circles(const Vector2f &seg_start, const Vector2f &seg_end) const
+{
+    const AC_Fence *fence = AC_Fence::get_singleton();
+    if (fence == nullptr) {
+        return false;
     }
-
-    // determine if segment crosses any of the exclusion circles
     for (uint8_t i = 0; i < fence->polyfence().get_exclusion_circle_count(); i++) {
         Vector2f center_pos_cm;
         float radius;
@@ -671,8 +712,6 @@ bool AP_OADijkstra::intersects_fence(const Vector2f &seg_start, const Vector2f &
             }
         }
     }
-
-    // if we got this far then no intersection
     return false;
 }
 
@@ -696,6 +735,7 @@ bool AP_OADijkstra::create_fence_visgraph(AP_OADijkstra_Error &err_id)
 
     // clear fence points visibility graph
     _fence_visgraph.clear();
+    _visgraph_counts_ok = false;
 
     // calculate distance from each point to all other points
     for (uint8_t i = 0; i < total_numpoints() - 1; i++) {
@@ -719,6 +759,135 @@ bool AP_OADijkstra::create_fence_visgraph(AP_OADijkstra_Error &err_id)
         }
     }
 
+    // record the per-category point counts so the graph can be patched
+    // incrementally on the next single category fence change
+    _visgraph_inclusion_polygon_numpoints = _inclusion_polygon_numpoints;
+    _visgraph_exclusion_polygon_numpoints = _exclusion_polygon_numpoints;
+    _visgraph_exclusion_circle_numpoints = _exclusion_circle_numpoints;
+    _visgraph_counts_ok = true;
+
+    return true;
+}
+
+// patch the existing visibility graph after a change to a single fence
+// category instead of rebuilding all point pairs.  edges touching the changed
+// category's points are dropped and recalculated, surviving edges are only
+// re-tested against the changed geometry.  relies on points being laid out as
+// inclusion polygons then exclusion polygons then exclusion circles so that
+// indices outside the changed category shift by a fixed amount
+// returns true on success.  returns false if the graph cannot be patched and
+// a full rebuild with create_fence_visgraph is required
+bool AP_OADijkstra::update_fence_visgraph_incremental()
+{
+    // require a previously built graph and exactly one changed category
+    const uint8_t num_dirty = (_inclusion_polygon_visgraph_dirty ? 1 : 0) +
+                              (_exclusion_polygon_visgraph_dirty ? 1 : 0) +
+                              (_exclusion_circle_visgraph_dirty ? 1 : 0);
+    if (!_visgraph_counts_ok || (num_dirty != 1)) {
+        return false;
+    }
+
+    // fail if more fence points than algorithm can handle
+    if (total_numpoints() >= OA_DIJKSTRA_POLYGON_SHORTPATH_NOTSET_IDX) {
+        return false;
+    }
+
+    // calculate the index range held by the changed category in the old and
+    // new point layouts.  the unchanged categories must be the same size for
+    // the surviving indices to be remapped
+    uint8_t changed_start, changed_end_old, changed_end_new;
+    if (_inclusion_polygon_visgraph_dirty) {
+        if ((_visgraph_exclusion_polygon_numpoints != _exclusion_polygon_numpoints) ||
+            (_visgraph_exclusion_circle_numpoints != _exclusion_circle_numpoints)) {
+            return false;
+        }
+        changed_start = 0;
+        changed_end_old = _visgraph_inclusion_polygon_numpoints;
+        changed_end_new = _inclusion_polygon_numpoints;
+    } else if (_exclusion_polygon_visgraph_dirty) {
+        if ((_visgraph_inclusion_polygon_numpoints != _inclusion_polygon_numpoints) ||
+            (_visgraph_exclusion_circle_numpoints != _exclusion_circle_numpoints)) {
+            return false;
+        }
+        changed_start = _inclusion_polygon_numpoints;
+        changed_end_old = changed_start + _visgraph_exclusion_polygon_numpoints;
+        changed_end_new = changed_start + _exclusion_polygon_numpoints;
+    } else {
+        if ((_visgraph_inclusion_polygon_numpoints != _inclusion_polygon_numpoints) ||
+            (_visgraph_exclusion_polygon_numpoints != _exclusion_polygon_numpoints)) {
+            return false;
+        }
+        changed_start = _inclusion_polygon_numpoints + _exclusion_polygon_numpoints;
+        changed_end_old = changed_start + _visgraph_exclusion_circle_numpoints;
+        changed_end_new = changed_start + _exclusion_circle_numpoints;
+    }
+    const int16_t index_shift = (int16_t)changed_end_new - (int16_t)changed_end_old;
+    _visgraph_counts_ok = false;
+
+    // drop edges touching the changed category, remap indices above it and
+    // re-test surviving edges against the changed geometry only
+    uint16_t num_kept = 0;
+    for (uint16_t i = 0; i < _fence_visgraph.num_items(); i++) {
+        AP_OAVisGraph::VisGraphItem item = _fence_visgraph[i];
+        if ((item.id1.id_num >= changed_start && item.id1.id_num < changed_end_old) ||
+            (item.id2.id_num >= changed_start && item.id2.id_num < changed_end_old)) {
+            continue;
+        }
+        if (item.id1.id_num >= changed_end_old) {
+            item.id1.id_num += index_shift;
+        }
+        if (item.id2.id_num >= changed_end_old) {
+            item.id2.id_num += index_shift;
+        }
+        Vector2f seg_start, seg_end;
+        if (!get_point(item.id1.id_num, seg_start) || !get_point(item.id2.id_num, seg_end)) {
+            return false;
+        }
+        if (_inclusion_polygon_visgraph_dirty && intersects_inclusion_polygons(seg_start, seg_end)) {
+            continue;
+        }
+        if (_exclusion_polygon_visgraph_dirty && intersects_exclusion_polygons(seg_start, seg_end)) {
+            continue;
+        }
+        if (_exclusion_circle_visgraph_dirty && intersects_exclusion_circles(seg_start, seg_end)) {
+            continue;
+        }
+        _fence_visgraph[num_kept++] = item;
+    }
+    _fence_visgraph.truncate(num_kept);
+
+    // add edges from each of the changed category's points to all other
+    // points.  pairs within the changed category are only tested once
+    for (uint8_t i = changed_start; i < changed_end_new; i++) {
+        Vector2f seg_start;
+        if (!get_point(i, seg_start)) {
+            return false;
+        }
+        for (uint8_t j = 0; j < total_numpoints(); j++) {
+            if ((j >= changed_start) && (j <= i)) {
+                continue;
+            }
+            Vector2f seg_end;
+            if (get_point(j, seg_end)) {
+                if (!intersects_fence(seg_start, seg_end)) {
+                    const uint8_t id1 = MIN(i, j);
+                    const uint8_t id2 = MAX(i, j);
+                    if (!_fence_visgraph.add_item({AP_OAVisGraph::OATYPE_INTERMEDIATE_POINT, id1},
+                                                  {AP_OAVisGraph::OATYPE_INTERMEDIATE_POINT, id2},
+                                                  (seg_start - seg_end).length())) {
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+
+    // record the new layout for the next incremental update
+    _visgraph_inclusion_polygon_numpoints = _inclusion_polygon_numpoints;
+    _visgraph_exclusion_polygon_numpoints = _exclusion_polygon_numpoints;
+    _visgraph_exclusion_circle_numpoints = _exclusion_circle_numpoints;
+    _visgraph_counts_ok = true;
+
     return true;
 }
 
@@ -873,6 +1042,36 @@ bool AP_OADijkstra::find_closest_node_idx(node_index &node_idx) const
     return false;
 }
 
+// returns true if every leg of the previously calculated path is still clear
+// of the (possibly updated) fence.  node positions are resolved against the
+// current fence points so a reused path is always collision free even if the
+// point a node id refers to has moved
+bool AP_OADijkstra::previous_path_still_clear() const
+{
+    if (_path_numpoints < 2) {
+        return false;
+    }
+
+    // path is stored in reverse order (destination first, source last).  the
+    // source node resolves to the just-updated _path_source so the first leg
+    // from the vehicle's current position is re-checked as well
+    Vector2f pt_prev;
+    if (!convert_node_to_point(_path[0], pt_prev)) {
+        return false;
+    }
+    for (uint8_t i = 1; i < _path_numpoints; i++) {
+        Vector2f pt;
+        if (!convert_node_to_point(_path[i], pt)) {
+            return false;
+        }
+        if (intersects_fence(pt_prev, pt)) {
+            return false;
+        }
+        pt_prev = pt;
+    }
+    return true;
+}
+
 // calculate shortest path from origin to destination
 // returns true on success.  returns false on failure and err_id is updated
 // requires these functions to have been run: create_inclusion_polygon_with_margin, create_exclusion_polygon_with_margin, create_exclusion_circle_with_margin, create_polygon_fence_visgraph
@@ -880,12 +1079,26 @@ bool AP_OADijkstra::find_closest_node_idx(node_index &node_idx) const
 bool AP_OADijkstra::calc_shortest_path(const Location &origin, const Location &destination, AP_OADijkstra_Error &err_id)
 {
     // convert origin and destination to offsets from EKF origin
-    if (!origin.get_vector_xy_from_origin_NE_cm(_path_source) ||
-        !destination.get_vector_xy_from_origin_NE_cm(_path_destination)) {
+    Vector2f path_source_new, path_destination_new;
+    if (!origin.get_vector_xy_from_origin_NE_cm(path_source_new) ||
+        !destination.get_vector_xy_from_origin_NE_cm(path_destination_new)) {
         err_id = AP_OADijkstra_Error::DIJKSTRA_ERROR_NO_POSITION_ESTIMATE;
         return false;
     }
 
+    // warm start: if the destination is unchanged and every leg of the
+    // previous path is still clear of the (possibly updated) fence then the
+    // previous path remains valid and the search can be skipped.  this is the
+    // common case when the vehicle requests a replan mid-path or when a fence
+    // change does not affect the corridor being flown
+    const bool dest_unchanged = (_path_numpoints >= 2) &&
+        ((path_destination_new - _path_destination).length_squared() < sq(10.0f));
+    _path_source = path_source_new;
+    _path_destination = path_destination_new;
+    if (dest_unchanged && previous_path_still_clear()) {
+        return true;
+    }
+
     // create visgraphs of origin and destination to fence points
     if (!update_visgraph(_source_visgraph, {AP_OAVisGraph::OATYPE_SOURCE, 0}, _path_source, true, _path_destination)) {
         err_id = AP_OADijkstra_Error::DIJKSTRA_ERROR_OUT_OF_MEMORY;
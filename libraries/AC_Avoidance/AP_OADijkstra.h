@@ -119,10 +119,28 @@ private:
     // returns true if line segment intersects polygon or circular fence
     bool intersects_fence(const Vector2f &seg_start, const Vector2f &seg_end) const;
 
+    // per-category intersection tests used when patching the visibility graph
+    bool intersects_inclusion_polygons(const Vector2f &seg_start, const Vector2f &seg_end) const;
+    bool intersects_exclusion_polygons(const Vector2f &seg_start, const Vector2f &seg_end) const;
+    bool intersects_exclusion_circles(const Vector2f &seg_start, const Vector2f &seg_end) const;
+
     // create visibility graph for all fence (with margin) points
     // returns true on success.  returns false on failure and err_id is updated
     bool create_fence_visgraph(AP_OADijkstra_Error &err_id);
 
+    // patch the existing visibility graph after a change to a single fence
+    // category instead of rebuilding all point pairs.  edges touching the
+    // changed category's points are dropped and recalculated, surviving edges
+    // are only re-tested against the changed geometry
+    // returns true on success.  returns false if the graph cannot be patched
+    // and a full rebuild with create_fence_visgraph is required
+    bool update_fence_visgraph_incremental();
+
+    // returns true if every leg of the previously calculated path is still
+    // clear of the (possibly updated) fence.  used as a warm start to avoid
+    // re-running the shortest path search
+    bool previous_path_still_clear() const;
+
     // calculate shortest path from origin to destination
     // returns true on success.  returns false on failure and err_id is updated
     // requires create_polygon_fence_with_margin and create_polygon_fence_visgraph to have been run
@@ -157,6 +175,17 @@ private:
     uint8_t _exclusion_circle_numpoints;    // number of points held in above array
     uint32_t _exclusion_circle_update_ms;   // system time exclusion circles were updated (used to detect changes)
 
+    // incremental visibility graph state.  the per-category point counts of
+    // the last successful graph build allow point indices to be remapped when
+    // a single category changes size
+    bool _visgraph_counts_ok;                       // true if the counts below match the current _fence_visgraph
+    uint8_t _visgraph_inclusion_polygon_numpoints;  // number of inclusion polygon points in last built graph
+    uint8_t _visgraph_exclusion_polygon_numpoints;  // number of exclusion polygon points in last built graph
+    uint8_t _visgraph_exclusion_circle_numpoints;   // number of exclusion circle points in last built graph
+    bool _inclusion_polygon_visgraph_dirty;         // inclusion polygons changed since last graph build
+    bool _exclusion_polygon_visgraph_dirty;         // exclusion polygons changed since last graph build
+    bool _exclusion_circle_visgraph_dirty;          // exclusion circles changed since last graph build
+
     // visibility graphs
     AP_OAVisGraph _fence_visgraph;          // holds distances between all inclusion/exclusion fence points (with margin)
     AP_OAVisGraph _source_visgraph;         // holds distances from source point to all other nodes
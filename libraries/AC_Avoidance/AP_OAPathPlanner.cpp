@@ -308,6 +308,7 @@ void AP_OAPathPlanner::avoidance_thread()
         // run background task looking for best alternative destination
         OA_RetState res = OA_NOT_REQUIRED;
         OAPathPlannerUsed path_planner_used = OAPathPlannerUsed::None;
+        const uint32_t plan_start_us = AP_HAL::micros();
         switch (_type) {
         case OA_PATHPLAN_DISABLED:
             continue;
@@ -403,6 +404,9 @@ void AP_OAPathPlanner::avoidance_thread()
 
         } // switch
 
+        // log how long this plan took so planner cost can be tracked offline
+        Write_OAPlanner((uint8_t)path_planner_used, (uint8_t)res, AP_HAL::micros() - plan_start_us);
+
         {
             // give the main thread the avoidance result
             WITH_SEMAPHORE(_rsem);
@@ -8,6 +8,7 @@
 #include <AP_Common/Location.h>
 #include <AP_Param/AP_Param.h>
 #include <AP_HAL/Semaphores.h>
+#include <AP_Logger/AP_Logger_config.h>
 
 #include "AP_OABendyRuler.h"
 #include "AP_OADijkstra.h"
@@ -94,6 +95,13 @@ private:
     // helper function to map OABendyType to OAPathPlannerUsed
     OAPathPlannerUsed map_bendytype_to_pathplannerused(AP_OABendyRuler::OABendyType bendy_type);
 
+    // Logging function
+#if HAL_LOGGING_ENABLED
+    void Write_OAPlanner(const uint8_t type, const uint8_t state, const uint32_t run_us) const;
+#else
+    void Write_OAPlanner(const uint8_t type, const uint8_t state, const uint32_t run_us) const {}
+#endif
+
     // an avoidance request from the navigation code
     struct avoidance_info {
         Location current_loc;
@@ -52,6 +52,10 @@ public:
     // allow accessing graph as an array, 0 indexed
     // Note: no protection against out-of-bounds accesses so use with num_items()
     const VisGraphItem& operator[](uint16_t i) const { return _items[i]; }
+    VisGraphItem& operator[](uint16_t i) { return _items[i]; }
+
+    // shrink the graph to num_items items (used after filtering items in place)
+    void truncate(uint16_t num_items) { if (num_items < _num_items) { _num_items = num_items; } }
 
 private:
 
@@ -6,7 +6,9 @@
 #define LOG_IDS_FROM_AVOIDANCE \
     LOG_OA_BENDYRULER_MSG, \
     LOG_OA_DIJKSTRA_MSG, \
+    LOG_OA_PLANNER_MSG, \
     LOG_SIMPLE_AVOID_MSG, \
+    LOG_SIMPLE_AVOID_OBS_MSG, \
     LOG_OD_VISGRAPH_MSG
 
 // @LoggerMessage: OABR
@@ -67,6 +69,20 @@ struct PACKED log_OADijkstra {
     int32_t oa_lng;
 };
 
+// @LoggerMessage: OAPL
+// @Description: Object avoidance path planner plan timing
+// @Field: TimeUS: Time since system startup
+// @Field: Type: Path planner that produced the result
+// @Field: State: Path planner's return state
+// @Field: RunUS: Time taken to calculate this plan
+struct PACKED log_OAPlanner {
+    LOG_PACKET_HEADER;
+    uint64_t time_us;
+    uint8_t type;
+    uint8_t state;
+    uint32_t run_us;
+};
+
 // @LoggerMessage: SA
 // @Description: Simple Avoidance messages
 // @Field: TimeUS: Time since system startup
@@ -91,6 +107,24 @@ struct PACKED log_SimpleAvoid {
   uint8_t backing_up;
 };
 
+// @LoggerMessage: SAOB
+// @Description: Simple Avoidance proximity obstacles
+// @Field: TimeUS: Time since system startup
+// @Field: Id: Obstacle number
+// @Field: Cnt: Total number of obstacles
+// @Field: X: Body-frame position of obstacle, X-Axis
+// @Field: Y: Body-frame position of obstacle, Y-Axis
+// @Field: Z: Body-frame position of obstacle, Z-Axis (up)
+struct PACKED log_SimpleAvoidObstacle {
+  LOG_PACKET_HEADER;
+  uint64_t time_us;
+  uint8_t id;
+  uint8_t count;
+  float pos_x;
+  float pos_y;
+  float pos_z;
+};
+
 // @LoggerMessage: OAVG
 // @Description: Object avoidance path planning visgraph points
 // @Field: TimeUS: Time since system startup
@@ -113,8 +147,12 @@ struct PACKED log_OD_Visgraph {
       "OABR","QBBHHHBfLLfLLf","TimeUS,Type,Act,DYaw,Yaw,DP,RChg,Mar,DLt,DLg,DAlt,OLt,OLg,OAlt", "s--ddd-mDUmDUm", "F-------GG0GG0" , true }, \
     { LOG_OA_DIJKSTRA_MSG, sizeof(log_OADijkstra), \
       "OADJ","QBBBBLLLL","TimeUS,State,Err,CurrPoint,TotPoints,DLat,DLng,OALat,OALng", "s----DUDU", "F----GGGG" , true }, \
+    { LOG_OA_PLANNER_MSG, sizeof(log_OAPlanner), \
+      "OAPL","QBBI","TimeUS,Type,State,RunUS", "s--s", "F--F" , true }, \
     { LOG_SIMPLE_AVOID_MSG, sizeof(log_SimpleAvoid), \
       "SA",  "QBffffffB","TimeUS,State,DVelX,DVelY,DVelZ,MVelX,MVelY,MVelZ,Back", "s-nnnnnn-", "F--------", true }, \
+    { LOG_SIMPLE_AVOID_OBS_MSG, sizeof(log_SimpleAvoidObstacle), \
+      "SAOB", "QBBfff","TimeUS,Id,Cnt,X,Y,Z", "s--mmm", "F--000", true }, \
      { LOG_OD_VISGRAPH_MSG, sizeof(log_OD_Visgraph), \
       "OAVG", "QBBLL", "TimeUS,version,point_num,Lat,Lon", "s--DU", "F--GG", true},
 #else
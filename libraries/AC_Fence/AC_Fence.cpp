@@ -179,6 +179,14 @@ const AP_Param::GroupInfo AC_Fence::var_info[] = {
     // @Values: 0:Above sea level, 1:Above Home, 2: Above Origin, 3: Above Terrain
     AP_GROUPINFO_FRAME("ALT_MIN_TP", 15, AC_Fence, _alt_min_type, float(Location::AltFrame::ABOVE_HOME), AP_PARAM_FRAME_COPTER | AP_PARAM_FRAME_SUB | AP_PARAM_FRAME_TRICOPTER | AP_PARAM_FRAME_HELI | AP_PARAM_FRAME_PLANE),
 
+    // @Param: LOOKAHD
+    // @DisplayName: Fence breach prediction lookahead time
+    // @Description: Time over which the vehicle's current velocity is projected forward when evaluating fence margins. A non-zero value triggers margin breach notifications early enough for a fast vehicle to stop before reaching the fence. Only motion towards a fence is considered. Set to 0 to evaluate margins at the current position only.
+    // @Units: s
+    // @Range: 0 10
+    // @User: Standard
+    AP_GROUPINFO("LOOKAHD", 16, AC_Fence, _lookahead_s, 0),
+
     AP_GROUPEND
 };
 
@@ -622,6 +630,42 @@ void AC_Fence::update_safe_alt_min()
     }
 }
 
+/*
+  predictive margin support: the current velocity, captured at the start
+  of check(), is projected over the FENCE_LOOKAHD horizon so margin
+  breaches trigger early enough for the vehicle to stop short of the
+  fence. Only motion towards the fence counts; moving away never shrinks
+  the effective margin. Hard breach detection is unaffected.
+ */
+float AC_Fence::lookahead_climb_m() const
+{
+    if (!_last_check_vel_valid || !is_positive(_lookahead_s.get())) {
+        return 0.0f;
+    }
+    return MAX(-_last_check_vel_ned_ms.z, 0.0f) * _lookahead_s;
+}
+
+float AC_Fence::lookahead_descend_m() const
+{
+    if (!_last_check_vel_valid || !is_positive(_lookahead_s.get())) {
+        return 0.0f;
+    }
+    return MAX(_last_check_vel_ned_ms.z, 0.0f) * _lookahead_s;
+}
+
+// dir_to_fence points from the vehicle towards the nearest point on the
+// fence; the closure is the distance the vehicle will cover towards that
+// point over the lookahead horizon
+float AC_Fence::lookahead_closure_m(const Vector2f &dir_to_fence) const
+{
+    if (!_last_check_vel_valid || !is_positive(_lookahead_s.get()) ||
+        is_zero(dir_to_fence.length_squared())) {
+        return 0.0f;
+    }
+    const float closing_speed_ms = _last_check_vel_ned_ms.xy() * dir_to_fence.normalized();
+    return MAX(closing_speed_ms, 0.0f) * _lookahead_s;
+}
+
 /// returns true if we have freshly breached the maximum altitude
 /// fence; also may set up a fallback fence which, if breached, will
 /// cause the altitude fence to be freshly breached
@@ -667,7 +711,7 @@ bool AC_Fence::check_fence_alt_max()
         }
         // old breach
         return false;
-    } else if (_curr_alt_u_m >= get_safe_alt_max_m()) {
+    } else if (_curr_alt_u_m + lookahead_climb_m() >= get_safe_alt_max_m()) {
         record_margin_breach(AC_FENCE_TYPE_ALT_MAX);
     } else {
         clear_margin_breach(AC_FENCE_TYPE_ALT_MAX);
@@ -725,7 +769,7 @@ bool AC_Fence::check_fence_alt_min()
         }
         // old breach
         return false;
-    } else if (_curr_alt_u_m <= get_safe_alt_min_m()) {
+    } else if (_curr_alt_u_m - lookahead_descend_m() <= get_safe_alt_min_m()) {
         record_margin_breach(AC_FENCE_TYPE_ALT_MIN);
     } else {
         clear_margin_breach(AC_FENCE_TYPE_ALT_MIN);
@@ -794,7 +838,8 @@ bool AC_Fence::check_fence_polygon()
             return true;
         }
         return false;
-    } else if (_polygon_breach_distance_m < 0 && fabsf(_polygon_breach_distance_m) < get_margin_ne_m()) {
+    } else if (_polygon_breach_distance_m < 0 &&
+               fabsf(_polygon_breach_distance_m) - lookahead_closure_m(_polygon_nearest_point) < get_margin_ne_m()) {
         record_margin_breach(AC_FENCE_TYPE_POLYGON);
     } else {
         clear_margin_breach(AC_FENCE_TYPE_POLYGON);
@@ -846,7 +891,7 @@ bool AC_Fence::check_fence_circle()
             return true;
         }
         return false;
-    } else if (_home_distance_m >= _circle_radius_m - get_margin_ne_m()) {
+    } else if (_home_distance_m + lookahead_closure_m(_circle_breach_direction) >= _circle_radius_m - get_margin_ne_m()) {
         record_margin_breach(AC_FENCE_TYPE_CIRCLE);
     } else {
         clear_margin_breach(AC_FENCE_TYPE_CIRCLE);
@@ -935,6 +980,10 @@ uint8_t AC_Fence::check(bool disable_auto_fences)
     // update the location at the time the check was made
     _last_fence_check_loc_valid = AP::ahrs().get_location(_last_fence_check_loc);
 
+    // capture velocity for the predictive margin checks; without a
+    // velocity estimate the margins are evaluated at the current position
+    _last_check_vel_valid = AP::ahrs().get_velocity_NED(_last_check_vel_ned_ms);
+
     // maximum altitude fence check
     if (!(disabled_fences & AC_FENCE_TYPE_ALT_MAX) && check_fence_alt_max()) {
         ret |= AC_FENCE_TYPE_ALT_MAX;
@@ -271,6 +271,12 @@ private:
     /// retrieve the current NED position relative to home
     bool get_current_position_NED(Vector3f& currpos) const;
 
+    // predicted altitude change and horizontal closure over the FENCE_LOOKAHD
+    // horizon; used to trigger margin breaches early enough to stop in time
+    float lookahead_climb_m() const;
+    float lookahead_descend_m() const;
+    float lookahead_closure_m(const Vector2f &dir_to_fence) const;
+
     // get altitude in the supplied frame
     bool get_alt_in_frame_m(Location::AltFrame alt_frame, float &alt) const;
 
@@ -299,6 +305,7 @@ private:
     AP_Int16        _ret_altitude;      // return to this altitude
     AP_Int16        _options;           // options bitmask, see OPTIONS enum
     AP_Float        _notify_freq;       // margin notification frequency
+    AP_Float        _lookahead_s;       // time horizon over which current velocity is projected when evaluating fence margins
     AP_Enum<Location::AltFrame> _alt_max_type;  // altitude max frame type
     AP_Enum<Location::AltFrame> _alt_min_type;  // altitude min frame type
 
@@ -316,6 +323,8 @@ private:
     Vector2f        _circle_breach_direction;   // direction towards the circle breach
     Location        _last_fence_check_loc;      // position used in the last fence check
     bool            _last_fence_check_loc_valid;// whether the position determined in the last fence check was valid
+    Vector3f        _last_check_vel_ned_ms;     // velocity captured for the last fence check, used for predictive margin checks
+    bool            _last_check_vel_valid;      // whether the velocity captured in the last fence check was valid
 
     // other internal variables
     float           _home_distance_m;   // distance from home in meters (provided by main code)
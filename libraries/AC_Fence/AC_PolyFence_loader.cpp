@@ -222,6 +222,18 @@ bool AC_PolyFence_loader::read_latlon_from_storage(uint16_t &read_offset, Vector
     return true;
 }
 
+// returns the squared distance in cm² from pos_cm to the axis-aligned
+// bounding box defined by bounds_min_cm/bounds_max_cm; zero if pos_cm
+// lies within the box
+float AC_PolyFence_loader::sq_distance_to_bounds_cm(const Vector2f &pos_cm,
+                                                    const Vector2f &bounds_min_cm,
+                                                    const Vector2f &bounds_max_cm)
+{
+    const float dx = MAX(MAX(bounds_min_cm.x - pos_cm.x, pos_cm.x - bounds_max_cm.x), 0.0f);
+    const float dy = MAX(MAX(bounds_min_cm.y - pos_cm.y, pos_cm.y - bounds_max_cm.y), 0.0f);
+    return sq(dx) + sq(dy);
+}
+
 bool AC_PolyFence_loader::breached() const
 {
     Location loc;
@@ -253,18 +265,25 @@ bool AC_PolyFence_loader::breached(const Location& loc, float& distance_outside_
     // check we are inside each inclusion zone:
     for (uint8_t i=0; i<_num_loaded_inclusion_boundaries; i++) {
         const InclusionBoundary &boundary = _loaded_inclusion_boundary[i];
-        bool valid_distance = Polygon_closest_distance_point(boundary.points, boundary.count, scaled_pos, fence_direction);
-        float distance = fence_direction.length() * 0.01f; // convert back to meters
-        if (Polygon_outside(pos, boundary.points_lla, boundary.count)) {
+        if (Polygon_outside(pos, boundary.points_lla, boundary.count, boundary.bounds_min_lla, boundary.bounds_max_lla)) {
             num_inclusion_outside++;
-            if (valid_distance) {
+            if (Polygon_closest_distance_point(boundary.points, boundary.count, scaled_pos, fence_direction)) {
+                const float distance = fence_direction.length() * 0.01f; // convert back to meters
                 if (is_positive(distance_outside_fence)) {
                     distance_outside_fence = MIN(distance_outside_fence, distance);
                 } else {
                     distance_outside_fence = distance;
                 }
             }
-        } else if (valid_distance) {
+            continue;
+        }
+        // inside this boundary.  It can only improve the (negative) margin if
+        // it is closer than the best found so far, so check the precomputed
+        // bounding volume before walking the vertex list
+        if (is_negative(distance_outside_fence) &&
+            sq_distance_to_bounds_cm(scaled_pos, boundary.bounds_min_cm, boundary.bounds_max_cm) < sq(distance_outside_fence * 100.0f) &&
+            Polygon_closest_distance_point(boundary.points, boundary.count, scaled_pos, fence_direction)) {
+            const float distance = fence_direction.length() * 0.01f; // convert back to meters
             distance_outside_fence = MAX(distance_outside_fence, -distance);
         }
     }
@@ -272,16 +291,20 @@ bool AC_PolyFence_loader::breached(const Location& loc, float& distance_outside_
     // check we are outside each exclusion zone:
     for (uint8_t i=0; i<_num_loaded_exclusion_boundaries; i++) {
         const ExclusionBoundary &boundary = _loaded_exclusion_boundary[i];
-        bool valid_distance = Polygon_closest_distance_point(boundary.points, boundary.count, scaled_pos, fence_direction);
-        float distance = fence_direction.length() * 0.01f; // convert back to meters
-        if (!Polygon_outside(pos, boundary.points_lla, boundary.count)) {
-            if (valid_distance) {
-                distance_outside_fence = distance;
+        if (!Polygon_outside(pos, boundary.points_lla, boundary.count, boundary.bounds_min_lla, boundary.bounds_max_lla)) {
+            if (Polygon_closest_distance_point(boundary.points, boundary.count, scaled_pos, fence_direction)) {
+                distance_outside_fence = fence_direction.length() * 0.01f; // convert back to meters
             } else {
                 distance_outside_fence = 0.0f;
             }
             return true;
-        } else if (valid_distance) {
+        }
+        // outside this boundary.  As above, only walk the vertex list if the
+        // bounding volume could be closer than the best margin found so far
+        if (is_negative(distance_outside_fence) &&
+            sq_distance_to_bounds_cm(scaled_pos, boundary.bounds_min_cm, boundary.bounds_max_cm) < sq(distance_outside_fence * 100.0f) &&
+            Polygon_closest_distance_point(boundary.points, boundary.count, scaled_pos, fence_direction)) {
+            const float distance = fence_direction.length() * 0.01f; // convert back to meters
             distance_outside_fence = MAX(distance_outside_fence, -distance);
         }
     }
@@ -799,6 +822,9 @@ bool AC_PolyFence_loader::load_from_storage()
                 storage_valid = false;
                 break;
             }
+            // precompute bounding boxes so breach checks can reject distant positions cheaply
+            Polygon_bounds(boundary.points_lla, boundary.count, boundary.bounds_min_lla, boundary.bounds_max_lla);
+            Polygon_bounds(boundary.points, boundary.count, boundary.bounds_min_cm, boundary.bounds_max_cm);
             _num_loaded_inclusion_boundaries++;
             break;
         }
@@ -818,6 +844,9 @@ bool AC_PolyFence_loader::load_from_storage()
                 storage_valid = false;
                 break;
             }
+            // precompute bounding boxes so breach checks can reject distant positions cheaply
+            Polygon_bounds(boundary.points_lla, boundary.count, boundary.bounds_min_lla, boundary.bounds_max_lla);
+            Polygon_bounds(boundary.points, boundary.count, boundary.bounds_min_cm, boundary.bounds_max_cm);
             _num_loaded_exclusion_boundaries++;
             break;
         }
@@ -306,6 +306,10 @@ private:
         Vector2f *points; // pointer into the _loaded_offsets_from_origin array
         Vector2l *points_lla; // pointer into the _loaded_points_lla array
         uint8_t count; // count of points in the boundary
+        Vector2l bounds_min_lla; // bounding box of points_lla, precomputed at load for breach-check early-out
+        Vector2l bounds_max_lla;
+        Vector2f bounds_min_cm; // bounding box of points (offsets from origin in cm), precomputed at load for distance-bound pruning
+        Vector2f bounds_max_cm;
     };
     InclusionBoundary *_loaded_inclusion_boundary;
 
@@ -316,6 +320,10 @@ private:
         Vector2f *points; // pointer into the _loaded_offsets_from_origin array
         Vector2l *points_lla; // pointer into the _loaded_points_lla_lla array
         uint8_t count; // count of points in the boundary
+        Vector2l bounds_min_lla; // bounding box of points_lla, precomputed at load for breach-check early-out
+        Vector2l bounds_max_lla;
+        Vector2f bounds_min_cm; // bounding box of points (offsets from origin in cm), precomputed at load for distance-bound pruning
+        Vector2f bounds_max_cm;
     };
     ExclusionBoundary *_loaded_exclusion_boundary;
 
@@ -371,7 +379,16 @@ private:
     bool scale_latlon_from_origin(const Location &origin,
                                   const Vector2l &point,
                                   Vector2f &pos_cm) const WARN_IF_UNUSED;
-   
+
+    // sq_distance_to_bounds_cm - returns the squared distance in cm²
+    // from pos_cm to the axis-aligned bounding box defined by
+    // bounds_min_cm/bounds_max_cm; zero if pos_cm lies within the
+    // box.  Lower bound on the squared distance to any boundary
+    // vertex or edge, used to prune exact distance calculations.
+    static float sq_distance_to_bounds_cm(const Vector2f &pos_cm,
+                                          const Vector2f &bounds_min_cm,
+                                          const Vector2f &bounds_max_cm);
+
     // read_polygon_from_storage - reads vertex_count
     // latitude/longitude points from offset in permanent storage,
     // transforms them into an offset-from-origin and deposits the
@@ -4,6 +4,10 @@
 #include <AP_Math/AP_Math.h>
 #include "AC_PID.h"
 
+// update_all() runs per-axis at up to the gyro rate when a fast rate
+// loop is active, so compile for speed
+#pragma GCC optimize("O2")
+
 #define AC_PID_DEFAULT_NOTCH_ATTENUATION 40
 
 const AP_Param::GroupInfo AC_PID::var_info[] = {
@@ -238,8 +242,12 @@ float AC_PID::update_all(float target, float measurement, float dt, bool limit,
             target = _target_notch->apply(target);
         }
 #endif
+        // recompute the low-pass filter alphas only when dt or a
+        // filter frequency has changed
+        update_filt_alphas(dt);
+
         // Apply first-order low-pass filter to target value
-        _target += get_filt_T_alpha(dt) * (target - _target);
+        _target += _filt_alpha.T * (target - _target);
 
         // Calculate error and apply error filter
         const float error_last = _error;
@@ -251,12 +259,12 @@ float AC_PID::update_all(float target, float measurement, float dt, bool limit,
         }
 #endif
         // apply notch filters before FTLD/FLTE to minimize shot noise
-        _error += get_filt_E_alpha(dt) * (error - _error);
+        _error += _filt_alpha.E * (error - _error);
 
         if (is_positive(dt)) {
             // Compute and low-pass filter the error derivative (D term)
             float derivative = (_error - error_last) / dt;
-            _derivative += get_filt_D_alpha(dt) * (derivative - _derivative);
+            _derivative += _filt_alpha.D * (derivative - _derivative);
             // Calculate target derivative for D_FF contribution
             _target_derivative = (_target - target_last) / dt;
         }
@@ -411,6 +419,27 @@ void AC_PID::save_gains()
     _filt_D_hz.save();
 }
 
+// Recompute the cached low-pass filter alphas if dt or one of the
+// filter frequencies has changed.  The cache key compares are exact:
+// a stale hit is only possible if the values are bit-identical, in
+// which case the cached alphas are still correct.
+void AC_PID::update_filt_alphas(float dt)
+{
+    if (dt == _filt_alpha.dt &&
+        _filt_T_hz.get() == _filt_alpha.T_hz &&
+        _filt_E_hz.get() == _filt_alpha.E_hz &&
+        _filt_D_hz.get() == _filt_alpha.D_hz) {
+        return;
+    }
+    _filt_alpha.dt = dt;
+    _filt_alpha.T_hz = _filt_T_hz.get();
+    _filt_alpha.E_hz = _filt_E_hz.get();
+    _filt_alpha.D_hz = _filt_D_hz.get();
+    _filt_alpha.T = get_filt_T_alpha(dt);
+    _filt_alpha.E = get_filt_E_alpha(dt);
+    _filt_alpha.D = get_filt_D_alpha(dt);
+}
+
 // Returns alpha value for the target low-pass filter (based on filter frequency and dt)
 float AC_PID::get_filt_T_alpha(float dt) const
 {
@@ -196,6 +196,17 @@ protected:
     float _derivative;        // derivative value to enable filtering
     int8_t _slew_limit_scale;
     float _target_derivative; // target derivative value to enable dff
+
+    // low-pass filter alphas cached against dt and the configured
+    // frequencies so they are not recomputed on every update_all()
+    struct {
+        float dt = -1;        // -1 forces a recompute on first use
+        float T_hz, E_hz, D_hz;
+        float T, E, D;
+    } _filt_alpha;
+
+    // recompute the cached alphas if dt or a filter frequency has changed
+    void update_filt_alphas(float dt);
 #if AP_FILTER_ENABLED
     NotchFilterFloat* _target_notch;
     NotchFilterFloat* _error_notch;
@@ -13,12 +13,8 @@ extern const AP_HAL::HAL& hal;
 // ------------------------------
 
 const AP_Param::GroupInfo AC_Sprayer::var_info[] = {
-    // @Param: ENABLE
-    // @DisplayName: Sprayer enable/disable
-    // @Description: Allows you to enable (1) or disable (0) the sprayer
-    // @Values: 0:Disabled,1:Enabled
-    // @User: Standard
-    AP_GROUPINFO_FLAGS("ENABLE", 0, AC_Sprayer, _enabled, 0, AP_PARAM_FLAG_ENABLE),
+    // 0 was ENABLE, now a vehicle level parameter controlling whether
+    // the sprayer is allocated at all
 
     // @Param: PUMP_RATE
     // @DisplayName: Pump speed
@@ -94,9 +90,9 @@ void AC_Sprayer::run(const bool activate)
         return;
     }
 
-    // set flag indicate whether spraying is permitted:
-    // do not allow running to be set to true if we are currently not enabled
-    _flags.running = _enabled && activate;
+    // set flag indicate whether spraying is permitted. The vehicle
+    // only allocates us when the sprayer is enabled
+    _flags.running = activate;
 
     // turn off the pump and spinner servos if necessary
     if (!_flags.running) {
@@ -115,8 +111,8 @@ void AC_Sprayer::stop_spraying()
 /// update - adjust pwm of servo controlling pump speed according to the desired quantity and our horizontal speed
 void AC_Sprayer::update()
 {
-    // exit immediately if we are disabled or shouldn't be running
-    if (!_enabled || !running()) {
+    // exit immediately if we shouldn't be running
+    if (!running()) {
         run(false);
         return;
     }
@@ -3,6 +3,7 @@
 
 /**
     The crop spraying functionality can be enabled in ArduCopter by doing the following:
+        - set SPRAY_ENABLE to 1 and reboot so the sprayer is allocated
         - set RC7_OPTION or RC8_OPTION parameter to 15 to allow turning the sprayer on/off from one of these channels
         - set SERVO10_FUNCTION to 22 to enable the servo output controlling the pump speed on servo-out 10
         - set SERVO11_FUNCTION to 23 to enable the servo output controlling the spinner on servo-out 11
@@ -66,7 +67,6 @@ public:
 private:
 
     // parameters
-    AP_Int8         _enabled;               ///< top level enable/disable control
     AP_Float        _pump_pct_1ms;          ///< desired pump rate (expressed as a percentage of top rate) when travelling at 1m/s
     AP_Int8         _pump_min_pct;          ///< minimum pump rate (expressed as a percentage from 0 to 100)
     AP_Int16        _spinner_pwm;           ///< pwm rate of spinner
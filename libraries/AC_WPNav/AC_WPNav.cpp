@@ -243,6 +243,9 @@ void AC_WPNav::wp_and_spline_init_m(float speed_ms, Vector3p stopping_point_ned_
     _scurve_prev_leg.init();
     _scurve_this_leg.init();
     _scurve_next_leg.init();
+#if AC_WPNAV_SCURVE_OFFLOAD_ENABLED
+    next_leg_calc_cancel();
+#endif
     _track_dt_scalar = 1.0f;
 
     _flags.reached_destination = true;
@@ -425,6 +428,11 @@ bool AC_WPNav::set_wp_destination_NED_m(const Vector3p& destination_ned_m, bool
     _destination_ned_m = destination_ned_m;
     _is_terrain_alt = is_terrain_alt;
 
+#if AC_WPNAV_SCURVE_OFFLOAD_ENABLED
+    // pick up a just-completed background calculation so the fast waypoint handover below can use it
+    next_leg_calc_collect();
+#endif
+
     if (_flags.fast_waypoint && !_this_leg_is_spline && !_next_leg_is_spline && !_scurve_next_leg.finished()) {
         // Reuse preloaded next leg if valid to avoid unnecessary recalculation
         _scurve_this_leg = _scurve_next_leg;
@@ -442,6 +450,9 @@ bool AC_WPNav::set_wp_destination_NED_m(const Vector3p& destination_ned_m, bool
 
     _this_leg_is_spline = false;
     _scurve_next_leg.init();
+#if AC_WPNAV_SCURVE_OFFLOAD_ENABLED
+    next_leg_calc_cancel();
+#endif
     _next_destination_ned_m.zero(); // clear next destination_ned_m
     _flags.fast_waypoint = false;   // default waypoint back to slow
     _flags.reached_destination = false;
@@ -461,6 +472,22 @@ bool AC_WPNav::set_wp_destination_next_NED_m(const Vector3p& destination_ned_m,
         return true;
     }
 
+#if AC_WPNAV_SCURVE_OFFLOAD_ENABLED
+    if (!_this_leg_is_spline) {
+        // Defer the expensive trajectory calculation to the IO thread.  The result is
+        // installed (and the fast waypoint flag set) by next_leg_calc_collect() from
+        // update_wpnav().  When the current leg is a spline the calculation is needed
+        // immediately for the velocity handoff below so it stays synchronous.
+        next_leg_calc_request(destination_ned_m, arc_rad);
+        _next_leg_is_spline = false;
+
+        // Store the upcoming destination for reference
+        _next_destination_ned_m = destination_ned_m;
+
+        return true;
+    }
+#endif
+
     // Preload next S-curve leg with current speed and acceleration constraints
     _scurve_next_leg.calculate_track(_destination_ned_m, destination_ned_m, arc_rad,
                                      _pos_control.NE_get_max_speed_ms(), _pos_control.get_max_speed_up_ms(), _pos_control.get_max_speed_down_ms(),
@@ -684,6 +711,11 @@ float AC_WPNav::get_wp_bearing_to_destination_rad() const
 // Should be called at 100 Hz or higher for accurate tracking.
 bool AC_WPNav::update_wpnav()
 {
+#if AC_WPNAV_SCURVE_OFFLOAD_ENABLED
+    // install the next leg's s-curve if the IO thread has finished calculating it
+    next_leg_calc_collect();
+#endif
+
     // check for changes in WPNAV_SPEED parameter (horizontal speed target)
     if (_check_wp_speed_change) {
         if (!is_equal(_wp_speed_ms.get(), _last_wp_speed_ms)) {
@@ -732,6 +764,11 @@ bool AC_WPNav::is_active() const
 // Returns true if the stop behavior was newly enforced.
 bool AC_WPNav::force_stop_at_next_wp()
 {
+#if AC_WPNAV_SCURVE_OFFLOAD_ENABLED
+    // discard any in-flight next leg calculation so it cannot re-enable the fast waypoint
+    next_leg_calc_cancel();
+#endif
+
     // skip if vehicle was already going to stop at the next waypoint
     if (!_flags.fast_waypoint) {
         return false;
@@ -750,6 +787,116 @@ bool AC_WPNav::force_stop_at_next_wp()
     return true;
 }
 
+#if AC_WPNAV_SCURVE_OFFLOAD_ENABLED
+// Queues calculation of the next leg's s-curve on the IO thread.
+// Captures the current speed and acceleration limits along with the leg geometry.
+void AC_WPNav::next_leg_calc_request(const Vector3p& destination_ned_m, float arc_rad)
+{
+    WITH_SEMAPHORE(_next_leg_calc.sem);
+
+    // register the IO thread callback on first use
+    if (!_next_leg_calc.io_registered) {
+        hal.scheduler->register_io_process(FUNCTOR_BIND_MEMBER(&AC_WPNav::next_leg_calc_io_timer, void));
+        _next_leg_calc.io_registered = true;
+    }
+
+    // leg runs from the current destination to the next destination
+    _next_leg_calc.origin_ned_m = _destination_ned_m;
+    _next_leg_calc.destination_ned_m = destination_ned_m;
+    _next_leg_calc.arc_rad = arc_rad;
+    _next_leg_calc.speed_ne_ms = _pos_control.NE_get_max_speed_ms();
+    _next_leg_calc.speed_up_ms = _pos_control.get_max_speed_up_ms();
+    _next_leg_calc.speed_down_ms = _pos_control.get_max_speed_down_ms();
+    _next_leg_calc.accel_ne_mss = get_wp_acceleration_mss();
+    _next_leg_calc.accel_d_mss = get_accel_D_mss();
+    _next_leg_calc.accel_corner_mss = get_corner_acceleration_mss();
+    _next_leg_calc.snap_max_mssss = _scurve_snap_max_mssss;
+    _next_leg_calc.jerk_max_msss = _scurve_jerk_max_msss;
+
+    // bump the sequence number so a calculation already in flight is discarded
+    _next_leg_calc.seq++;
+    _next_leg_calc.pending = true;
+    _next_leg_calc.ready = false;
+}
+
+// Discards any pending or completed background calculation.
+// Must be called whenever _scurve_next_leg is reset or the next leg becomes a spline.
+void AC_WPNav::next_leg_calc_cancel()
+{
+    WITH_SEMAPHORE(_next_leg_calc.sem);
+    _next_leg_calc.seq++;
+    _next_leg_calc.pending = false;
+    _next_leg_calc.ready = false;
+}
+
+// Installs a completed background calculation into _scurve_next_leg.
+// Returns true if a new next leg was installed.
+bool AC_WPNav::next_leg_calc_collect()
+{
+    {
+        WITH_SEMAPHORE(_next_leg_calc.sem);
+        if (!_next_leg_calc.ready) {
+            return false;
+        }
+        _scurve_next_leg = _next_leg_calc.result;
+        _next_leg_calc.ready = false;
+    }
+
+    // speed limits may have changed while the calculation was in flight
+    _scurve_next_leg.set_speed_max(_pos_control.NE_get_max_speed_ms(), _pos_control.get_max_speed_up_ms(), _pos_control.get_max_speed_down_ms());
+    _next_leg_is_spline = false;
+
+    // Enable fast waypoint transition since next leg is known
+    _flags.fast_waypoint = true;
+
+    return true;
+}
+
+// IO thread callback that runs the jerk-limited segment planning for a queued request.
+void AC_WPNav::next_leg_calc_io_timer()
+{
+    // take a copy of the request so the main thread can queue a replacement while we work
+    Vector3p origin_ned_m, destination_ned_m;
+    float arc_rad;
+    float speed_ne_ms, speed_up_ms, speed_down_ms;
+    float accel_ne_mss, accel_d_mss, accel_corner_mss;
+    float snap_max_mssss, jerk_max_msss;
+    uint8_t seq;
+    {
+        WITH_SEMAPHORE(_next_leg_calc.sem);
+        if (!_next_leg_calc.pending) {
+            return;
+        }
+        origin_ned_m = _next_leg_calc.origin_ned_m;
+        destination_ned_m = _next_leg_calc.destination_ned_m;
+        arc_rad = _next_leg_calc.arc_rad;
+        speed_ne_ms = _next_leg_calc.speed_ne_ms;
+        speed_up_ms = _next_leg_calc.speed_up_ms;
+        speed_down_ms = _next_leg_calc.speed_down_ms;
+        accel_ne_mss = _next_leg_calc.accel_ne_mss;
+        accel_d_mss = _next_leg_calc.accel_d_mss;
+        accel_corner_mss = _next_leg_calc.accel_corner_mss;
+        snap_max_mssss = _next_leg_calc.snap_max_mssss;
+        jerk_max_msss = _next_leg_calc.jerk_max_msss;
+        seq = _next_leg_calc.seq;
+        _next_leg_calc.pending = false;
+    }
+
+    // result is not read by the main thread until ready is set so it is safe to
+    // fill in outside the semaphore
+    _next_leg_calc.result.calculate_track(origin_ned_m, destination_ned_m, arc_rad,
+                                          speed_ne_ms, speed_up_ms, speed_down_ms,
+                                          accel_ne_mss, accel_d_mss, accel_corner_mss,
+                                          snap_max_mssss, jerk_max_msss);
+
+    WITH_SEMAPHORE(_next_leg_calc.sem);
+    if (_next_leg_calc.seq == seq) {
+        // still the most recent request; hand the result to the main thread
+        _next_leg_calc.ready = true;
+    }
+}
+#endif  // AC_WPNAV_SCURVE_OFFLOAD_ENABLED
+
 // Returns terrain offset in meters above the EKF origin at the current position.
 // Positive values mean terrain lies above the EKF origin altitude.
 // Source may be rangefinder or terrain database depending on availability.
@@ -963,6 +1110,10 @@ bool AC_WPNav::set_spline_destination_next_NED_m(const Vector3p& next_destinatio
     // setup next spline leg.  Note this could be made local
     _spline_next_leg.set_origin_and_destination(_destination_ned_m, next_destination_ned_m, origin_vector_ned_m, destination_vector_ned_m);
     _next_leg_is_spline = true;
+#if AC_WPNAV_SCURVE_OFFLOAD_ENABLED
+    // next leg is a spline so any in-flight s-curve calculation is stale
+    next_leg_calc_cancel();
+#endif
 
     // next destination provided so fast waypoint
     _flags.fast_waypoint = true;
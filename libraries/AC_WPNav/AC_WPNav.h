@@ -1,6 +1,9 @@
 #pragma once
 
+#include "AC_WPNav_config.h"
+
 #include <AP_Common/AP_Common.h>
+#include <AP_HAL/Semaphores.h>
 #include <AP_Param/AP_Param.h>
 #include <AP_Math/AP_Math.h>
 #include <AP_Math/SCurve.h>
@@ -347,6 +350,23 @@ protected:
     // Updates _scurve_jerk_max_msss and _scurve_snap_max_mssss with constrained values.
     void calc_scurve_jerk_and_snap();
 
+#if AC_WPNAV_SCURVE_OFFLOAD_ENABLED
+    // Queues calculation of the next leg's s-curve on the IO thread.
+    // Captures the current speed and acceleration limits along with the leg geometry.
+    void next_leg_calc_request(const Vector3p& destination_ned_m, float arc_rad);
+
+    // Discards any pending or completed background calculation.
+    // Must be called whenever _scurve_next_leg is reset or the next leg becomes a spline.
+    void next_leg_calc_cancel();
+
+    // Installs a completed background calculation into _scurve_next_leg.
+    // Returns true if a new next leg was installed.
+    bool next_leg_calc_collect();
+
+    // IO thread callback that runs the jerk-limited segment planning for a queued request.
+    void next_leg_calc_io_timer();
+#endif
+
     // References to shared sensor fusion, position, and attitude control subsystems.
     const AP_AHRS_View&     _ahrs;
     AC_PosControl&          _pos_control;
@@ -376,6 +396,31 @@ protected:
     float _scurve_jerk_max_msss;    // computed maximum jerk in m/s³ used for trajectory shaping
     float _scurve_snap_max_mssss;   // computed maximum snap in m/s⁴ derived from controller responsiveness
 
+#if AC_WPNAV_SCURVE_OFFLOAD_ENABLED
+    // mailbox for background calculation of the next leg's s-curve.  the request and
+    // bookkeeping fields are protected by sem; result is only written by the IO thread
+    // while ready is false and only read by the main thread once ready is set
+    struct {
+        HAL_Semaphore sem;
+        bool io_registered;             // true once the IO thread callback has been registered
+        bool pending;                   // true if a request is waiting to be computed on the IO thread
+        bool ready;                     // true if result is waiting to be collected by the main thread
+        uint8_t seq;                    // request sequence number, bumped to discard stale work
+        Vector3p origin_ned_m;          // leg origin in meters (NED frame)
+        Vector3p destination_ned_m;     // leg destination in meters (NED frame)
+        float arc_rad;                  // signed arc angle in radians (0 for straight path)
+        float speed_ne_ms;              // horizontal speed limit at request time (m/s)
+        float speed_up_ms;              // climb speed limit at request time (m/s)
+        float speed_down_ms;            // descent speed limit at request time (m/s)
+        float accel_ne_mss;             // horizontal acceleration limit at request time (m/s²)
+        float accel_d_mss;              // vertical acceleration limit at request time (m/s²)
+        float accel_corner_mss;         // cornering acceleration limit at request time (m/s²)
+        float snap_max_mssss;           // snap limit at request time (m/s⁴)
+        float jerk_max_msss;            // jerk limit at request time (m/s³)
+        SCurve result;                  // computed s-curve for the requested leg
+    } _next_leg_calc;
+#endif
+
     // spline curves
     SplineCurve _spline_this_leg;   // spline curve for the current segment
     SplineCurve _spline_next_leg;   // spline curve for the next segment
@@ -5,3 +5,9 @@
 #ifndef AC_WPNAV_OA_ENABLED
 #define AC_WPNAV_OA_ENABLED AP_OAPATHPLANNER_ENABLED
 #endif
+
+// run the next leg's s-curve calculation on the IO thread so waypoint
+// transitions do not spike the main loop
+#ifndef AC_WPNAV_SCURVE_OFFLOAD_ENABLED
+#define AC_WPNAV_SCURVE_OFFLOAD_ENABLED 1
+#endif
@@ -474,6 +474,10 @@ void AP_AHRS::update_state(void)
     update_cd_values();
     update_trig();
 
+    // new attitude, DCM and trig values are now cached; bump the epoch
+    // so consumers can invalidate quantities derived from them
+    state.attitude_epoch++;
+
     state.quat_ok = active_estimates->get_quaternion(state.quat);
     state.secondary_attitude_ok = _get_secondary_attitude(state.secondary_attitude);
     state.secondary_quat_ok = _get_secondary_quaternion(state.secondary_quat);
@@ -512,6 +516,69 @@ void AP_AHRS::update_state(void)
     }
 
     state.velocity_NED_ok = active_estimates->get_velocity_NED(state.velocity_NED);
+
+    update_wind_state();
+}
+
+/*
+  update the smoothed wind estimate, its variability measure and the wind
+  epoch. Runs once per loop so consumers that want a stable mean wind
+  (soaring, speed scheduling) share one filter instead of each smoothing
+  the raw estimate themselves
+ */
+void AP_AHRS::update_wind_state(void)
+{
+    Vector3f wind;
+    if (!wind_estimate(wind)) {
+        state.wind_smoothed_ok = false;
+        state.last_wind_update_ms = 0;
+        return;
+    }
+
+    const uint32_t now_ms = AP_HAL::millis();
+    if (!state.wind_smoothed_ok || state.last_wind_update_ms == 0 ||
+        now_ms - state.last_wind_update_ms > 1000) {
+        // (re)initialise after startup or a gap in wind estimation
+        state.wind_smoothed = wind;
+        state.wind_uncertainty_ms = 0;
+        state.wind_smoothed_ok = true;
+        state.wind_at_last_epoch = wind;
+        state.wind_epoch++;
+        state.last_wind_update_ms = now_ms;
+        return;
+    }
+
+    const float dt = (now_ms - state.last_wind_update_ms) * 0.001f;
+    state.last_wind_update_ms = now_ms;
+
+    // roughly 5 second time constant; consumers of this estimate want
+    // the mean wind, not per-loop estimator noise
+    const float alpha = calc_lowpass_alpha_dt(dt, 1.0f / (M_2PI * 5.0f));
+    state.wind_smoothed += (wind - state.wind_smoothed) * alpha;
+
+    // smooth the deviation of the instantaneous estimate from the mean
+    // as a simple variability measure
+    const float deviation_ms = (wind - state.wind_smoothed).length();
+    state.wind_uncertainty_ms += (deviation_ms - state.wind_uncertainty_ms) * alpha;
+
+    // bump the epoch when the mean wind has shifted by more than 1m/s
+    // since the last bump
+    if ((state.wind_smoothed - state.wind_at_last_epoch).length() > 1.0f) {
+        state.wind_at_last_epoch = state.wind_smoothed;
+        state.wind_epoch++;
+    }
+}
+
+// return the smoothed wind estimate and its variability; false if wind
+// estimation is unavailable
+bool AP_AHRS::wind_estimate_smoothed(Vector3f &wind, float &uncertainty_ms) const
+{
+    if (!state.wind_smoothed_ok) {
+        return false;
+    }
+    wind = state.wind_smoothed;
+    uncertainty_ms = state.wind_uncertainty_ms;
+    return true;
 }
 
 void AP_AHRS::try_set_common_origin(const AP_AHRS_Backend &source_backend, const AP_AHRS_Backend::Estimates &source_estimates)
@@ -137,6 +137,16 @@ public:
     // returns forward head-wind component in m/s. Negative means tail-wind
     float head_wind(void) const;
 
+    // return a smoothed wind estimate (roughly 5 second time constant)
+    // with a variability measure, updated once per loop. Consumers that
+    // want the mean wind rather than the raw per-loop estimate should
+    // use this instead of maintaining their own filters
+    bool wind_estimate_smoothed(Vector3f &wind, float &uncertainty_ms) const;
+
+    // epoch incremented whenever the smoothed wind shifts by more than
+    // 1m/s; lets consumers re-plan only when the wind actually changes
+    uint32_t get_wind_epoch(void) const { return state.wind_epoch; }
+
 #if AP_AHRS_EXTERNAL_WIND_ESTIMATE_ENABLED
     void set_external_wind_estimate(float speed, float direction) {
         dcm.set_external_wind_estimate(speed, direction);
@@ -672,6 +682,14 @@ public:
 
     const Matrix3f &get_rotation_body_to_ned(void) const { return state.dcm_matrix; }
 
+    // attitude epoch, incremented each time the cached rotation matrix
+    // and euler trig values are refreshed from the active backend.
+    // Consumers caching quantities derived from
+    // get_rotation_body_to_ned() or the trig accessors can compare this
+    // against the value they captured to avoid re-deriving within the
+    // same update
+    uint32_t get_attitude_epoch(void) const { return state.attitude_epoch; }
+
     // return a Quaternion representing our current attitude in NED frame
     void get_quat_body_to_ned(Quaternion &quat) const;
 
@@ -991,6 +1009,9 @@ private:
      */
     void update_state(void);
 
+    // update the smoothed wind estimate and wind epoch; called from update_state()
+    void update_wind_state(void);
+
     // returns an EKF type to be used as active if we decide the
     // primary is not good enough.
     EKFType fallback_active_EKF_type(void) const;
@@ -1010,6 +1031,7 @@ private:
         uint8_t primary_core;
         Vector3f gyro_estimate;
         Matrix3f dcm_matrix;
+        uint32_t attitude_epoch;
         Vector3f gyro_drift;
         Vector3f accel_ef;
         Vector3f accel_bias;
@@ -1040,6 +1062,12 @@ private:
         bool origin_ok;
         Vector3f velocity_NED;
         bool velocity_NED_ok;
+        Vector3f wind_smoothed;     // slow low-pass of the active wind estimate
+        float wind_uncertainty_ms;  // smoothed deviation of the raw estimate from the mean
+        bool wind_smoothed_ok;
+        Vector3f wind_at_last_epoch; // smoothed wind when the epoch was last bumped
+        uint32_t wind_epoch;        // bumped when the smoothed wind shifts significantly
+        uint32_t last_wind_update_ms;
     } state;
 
     /*
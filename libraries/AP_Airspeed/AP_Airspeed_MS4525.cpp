@@ -197,9 +197,13 @@ void AP_Airspeed_MS4525::_collect()
 
     WITH_SEMAPHORE(sem);
 
-    _press_sum += press + press2;
+    _press_samples[_press_sample_next] = press;
+    _press_sample_next = (_press_sample_next + 1) % ARRAY_SIZE(_press_samples);
+    _press_samples[_press_sample_next] = press2;
+    _press_sample_next = (_press_sample_next + 1) % ARRAY_SIZE(_press_samples);
+    _press_sample_count = MIN(uint8_t(_press_sample_count + 2), uint8_t(ARRAY_SIZE(_press_samples)));
+
     _temp_sum += temp + temp2;
-    _press_count += 2;
     _temp_count += 2;
 
     _last_sample_time_ms = AP_HAL::millis();
@@ -251,10 +255,31 @@ bool AP_Airspeed_MS4525::get_differential_pressure(float &pressure)
         return false;
     }
 
-    if (_press_count > 0) {
-        _pressure = _press_sum / _press_count;
-        _press_count = 0;
-        _press_sum = 0;
+    if (_press_sample_count > 0) {
+        /*
+          median-of-N decimation of the samples accumulated by the
+          timer thread. The median rejects the occasional electrical
+          or bus-induced spike that a mean folds into the output,
+          allowing a lighter front-end filter, and has the same group
+          delay as the mean: half the collection window
+         */
+        float sorted[ARRAY_SIZE(_press_samples)];
+        memcpy(sorted, _press_samples, sizeof(sorted[0]) * _press_sample_count);
+        for (uint8_t i = 1; i < _press_sample_count; i++) {
+            const float v = sorted[i];
+            int8_t j = i - 1;
+            for (; j >= 0 && sorted[j] > v; j--) {
+                sorted[j+1] = sorted[j];
+            }
+            sorted[j+1] = v;
+        }
+        if (_press_sample_count & 1) {
+            _pressure = sorted[_press_sample_count/2];
+        } else {
+            _pressure = 0.5f * (sorted[_press_sample_count/2 - 1] + sorted[_press_sample_count/2]);
+        }
+        _press_sample_count = 0;
+        _press_sample_next = 0;
     }
 
     pressure = _pressure;
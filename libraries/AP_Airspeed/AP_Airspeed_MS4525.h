@@ -55,9 +55,15 @@ private:
     float _get_temperature(int16_t dT_raw) const;
 
     float _temp_sum;
-    float _press_sum;
     uint32_t _temp_count;
-    uint32_t _press_count;
+
+    // pressure samples accumulated by the timer thread between
+    // front-end reads, decimated by median in get_differential_pressure().
+    // written as a ring so the newest samples win if the front-end
+    // stops consuming
+    float _press_samples[16];
+    uint8_t _press_sample_count;
+    uint8_t _press_sample_next;
     float _temperature;
     float _pressure;
     uint32_t _last_sample_time_ms;
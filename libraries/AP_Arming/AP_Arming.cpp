@@ -1925,6 +1925,15 @@ bool AP_Arming::arm(AP_Arming::Method method, const bool do_arming_checks)
     }
 #endif
 
+#if AP_INERTIALSENSOR_HARMONICNOTCH_ENABLED
+    if (armed) {
+        // prime the gyro notch filter banks so that parameter or option
+        // changes made while disarmed do not produce a settle transient
+        // at takeoff
+        AP::ins().warm_start_notch_filters();
+    }
+#endif
+
 #if AP_TERRAIN_AVAILABLE
     if (armed) {
         // tell terrain we have just armed, so it can setup
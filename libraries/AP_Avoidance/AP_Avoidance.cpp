@@ -345,6 +345,25 @@ void AP_Avoidance::update_threat_level(const Location &loc,
     obstacle.threat_level = MAV_COLLISION_THREAT_LEVEL_NONE;
 
     const uint32_t obstacle_age_ms = AP_HAL::millis() - obstacle.timestamp_ms;
+    const float current_distance_ne_m = loc.get_distance(obstacle_loc);
+
+    // range-shell early-out: even flying straight at each other the
+    // obstacle cannot close more than relative-speed * horizon metres,
+    // so anything beyond the warn shell plus that closure can't become
+    // a threat this pass. This keeps the per-update cost of a dense
+    // vehicle list dominated by this single distance calculation
+    // rather than the four closest-approach evaluations below.
+    const float closing_speed_ms = (obstacle_vel_ned_ms - vel_ned_ms).xy().length();
+    const float horizon_s = MAX(_warn_time_horizon_s, _fail_time_horizon_s) + obstacle_age_ms*0.001f;
+    const float min_possible_ne_m = current_distance_ne_m - closing_speed_ms * horizon_s;
+    if (min_possible_ne_m > MAX(_warn_distance_ne_m, _fail_distance_ne_m)) {
+        obstacle.closest_approach_ne_m = min_possible_ne_m;
+        obstacle.closest_approach_d_m = fabsf(obstacle_loc.alt - loc.alt) * 0.01f;
+        obstacle.distance_to_closest_approach_ned_m = current_distance_ne_m - min_possible_ne_m;
+        obstacle.time_to_closest_approach_s = is_zero(closing_speed_ms) ? 0.0f : horizon_s;
+        return;
+    }
+
     float closest_ne_m = closest_approach_NE_m(loc, vel_ned_ms, obstacle_loc, obstacle_vel_ned_ms, _fail_time_horizon_s + obstacle_age_ms/1000);
     if (closest_ne_m < _fail_distance_ne_m) {
         obstacle.threat_level = MAV_COLLISION_THREAT_LEVEL_HIGH;
@@ -378,7 +397,6 @@ void AP_Avoidance::update_threat_level(const Location &loc,
     // level is none - but only *once the GCS has been informed*!
     obstacle.closest_approach_ne_m = closest_ne_m;
     obstacle.closest_approach_d_m = closest_d_m;
-    float current_distance_ne_m = loc.get_distance(obstacle_loc);
     obstacle.distance_to_closest_approach_ned_m = current_distance_ne_m - closest_ne_m;
     Vector2f net_velocity_ne_ms = Vector2f(vel_ned_ms[0] - obstacle_vel_ned_ms[0], vel_ned_ms[1] - obstacle_vel_ned_ms[1]);
     obstacle.time_to_closest_approach_s = 0.0f;
@@ -746,7 +746,11 @@ void AP_BattMonitor::read()
 {
 #if HAL_LOGGING_ENABLED
     AP_Logger *logger = AP_Logger::get_singleton();
-    if (logger != nullptr && logger->should_log(_log_battery_bit)) {
+    // decide logging once for the whole pass; all instances then share
+    // a single timestamp so entries from one pass line up in the log
+    const bool do_log = logger != nullptr && logger->should_log(_log_battery_bit);
+    const uint64_t log_time_us = do_log ? AP_HAL::micros64() : 0;
+    if (do_log) {
         logger->Write_Power();
     }
 #endif
@@ -763,6 +767,7 @@ void AP_BattMonitor::read()
             if (configured_type(i) == Type::NONE) {
                 continue;
             }
+            const uint32_t read_start_us = AP_HAL::micros();
             drivers[i]->read();
             drivers[i]->update_resistance_estimate();
 
@@ -770,16 +775,27 @@ void AP_BattMonitor::read()
             drivers[i]->update_esc_telem_outbound();
 #endif
 
+            // track worst case per-backend cost so a misbehaving
+            // driver blocking the 10Hz loop can be identified
+            const uint32_t read_us = AP_HAL::micros() - read_start_us;
+            if (read_us > state[i].read_us_max) {
+                state[i].read_us_max = MIN(read_us, UINT16_MAX);
+                if (read_us > 2000 && !state[i].slow_read_reported) {
+                    state[i].slow_read_reported = true;
+                    GCS_SEND_TEXT(MAV_SEVERITY_WARNING, "Battery %u: slow driver read (%uus)",
+                                  unsigned(i+1), unsigned(read_us));
+                }
+            }
+
             // Update last heathy timestamp
             if (state[i].healthy) {
                 state[i].last_healthy_ms = now_ms;
             }
 
 #if HAL_LOGGING_ENABLED
-            if (logger != nullptr && logger->should_log(_log_battery_bit)) {
-                const uint64_t time_us = AP_HAL::micros64();
-                drivers[i]->Log_Write_BAT(i, time_us);
-                drivers[i]->Log_Write_BCL(i, time_us);
+            if (do_log) {
+                drivers[i]->Log_Write_BAT(i, log_time_us);
+                drivers[i]->Log_Write_BCL(i, log_time_us);
             }
 #endif
     }
@@ -140,6 +140,8 @@ public:
         uint8_t     instance;                  // instance number of this backend
         Type        type;                      // allocated instance type
         const struct AP_Param::GroupInfo *var_info;
+        uint16_t    read_us_max;               // worst case backend read() cost in microseconds
+        bool        slow_read_reported;        // only report a slow backend once
     };
 
     static const struct AP_Param::GroupInfo *backend_var_info[AP_BATT_MONITOR_MAX_INSTANCES];
@@ -79,6 +79,22 @@ void AP_BattMonitor_SMBus::read(void)
     }
 }
 
+/*
+  registers that never change once read (serial number, pack capacity,
+  cycle count) only need re-reading while the first read keeps
+  failing, so retry at most once per second rather than on every timer
+  tick to keep the bus free for voltage and current
+ */
+bool AP_BattMonitor_SMBus::static_register_due(void)
+{
+    const uint32_t now_ms = AP_HAL::millis();
+    if (now_ms - _last_static_read_ms < 1000) {
+        return false;
+    }
+    _last_static_read_ms = now_ms;
+    return true;
+}
+
 // reads the pack full charge capacity
 // returns if we already knew the pack capacity
 void AP_BattMonitor_SMBus::read_full_charge_capacity(void)
@@ -86,6 +102,9 @@ void AP_BattMonitor_SMBus::read_full_charge_capacity(void)
     if (_full_charge_capacity != 0) {
         return;
     }
+    if (!static_register_due()) {
+        return;
+    }
 
     if (read_word(BATTMONITOR_SMBUS_FULL_CHARGE_CAPACITY, _full_charge_capacity)) {
         _full_charge_capacity *= get_capacity_scaler();
@@ -102,6 +121,14 @@ void AP_BattMonitor_SMBus::read_remaining_capacity(void)
         return;
     }
 
+    // remaining capacity moves slowly; polling at 1Hz instead of
+    // every timer tick costs nothing in accuracy
+    const uint32_t now_ms = AP_HAL::millis();
+    if (now_ms - _last_remaining_read_ms < 1000) {
+        return;
+    }
+    _last_remaining_read_ms = now_ms;
+
     uint16_t data;
     if (read_word(BATTMONITOR_SMBUS_REMAINING_CAPACITY, data)) {
         _state.consumed_mah = MAX(0, capacity - (data * get_capacity_scaler()));
@@ -111,6 +138,13 @@ void AP_BattMonitor_SMBus::read_remaining_capacity(void)
 // reads the temperature word from the battery
 void AP_BattMonitor_SMBus::read_temp(void)
 {
+    // temperature moves slowly; poll at 1Hz
+    const uint32_t now_ms = AP_HAL::millis();
+    if (now_ms - _last_temp_read_ms < 1000) {
+        return;
+    }
+    _last_temp_read_ms = now_ms;
+
     uint16_t data;
     if (!read_word(BATTMONITOR_SMBUS_TEMP, data)) {
         _has_temperature = (AP_HAL::millis() - _state.temperature_time) <= AP_BATT_MONITOR_TIMEOUT;
@@ -130,6 +164,9 @@ void AP_BattMonitor_SMBus::read_serial_number(void)
     if (_serial_number != -1) {
         return;
     }
+    if (!static_register_due()) {
+        return;
+    }
 
     uint16_t data;
     if (read_word(BATTMONITOR_SMBUS_SERIAL, data)) {
@@ -144,6 +181,9 @@ void AP_BattMonitor_SMBus::read_cycle_count()
     if (_has_cycle_count) {
         return;
     }
+    if (!static_register_due()) {
+        return;
+    }
     _has_cycle_count = read_word(BATTMONITOR_SMBUS_CYCLE_COUNT, _cycle_count);
 }
 
@@ -95,6 +95,10 @@ protected:
     // buff is the data that was read or will be written
     uint8_t get_PEC(const uint8_t i2c_addr, uint8_t cmd, bool reading, const uint8_t buff[], uint8_t len) const;
 
+    // returns true at most once per second; used to poll static
+    // registers so failed reads don't occupy the bus every timer tick
+    bool static_register_due(void);
+
     AP_HAL::I2CDevice *_dev;
     bool _pec_supported; // true if PEC is supported
 
@@ -104,6 +108,9 @@ protected:
     uint16_t _cycle_count = 0;      // number of cycles the battery has experienced. An amount of discharge approximately equal to the value of DesignCapacity.
     bool _has_cycle_count;          // true if cycle count has been retrieved from the battery
     bool _has_temperature;
+    uint32_t _last_static_read_ms;  // last attempt at a static register (serial number etc.)
+    uint32_t _last_temp_read_ms;    // last temperature poll
+    uint32_t _last_remaining_read_ms; // last remaining capacity poll
 
     virtual void timer(void) = 0;   // timer function to read from the battery
 
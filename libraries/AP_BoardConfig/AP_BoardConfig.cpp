@@ -386,7 +386,7 @@ const AP_Param::GroupInfo AP_BoardConfig::var_info[] = {
     // @Param: OPTIONS
     // @DisplayName: Board options
     // @Description: Board specific option flags
-    // @Bitmask: 0:Enable hardware watchdog, 1:Disable MAVftp, 2:Enable set of internal parameters, 3:Enable Debug Pins, 4:Unlock flash on reboot, 5:Write protect firmware flash on reboot, 6:Write protect bootloader flash on reboot, 7:Skip board validation, 8:Disable board arming gpio output change on arm/disarm, 9:Use safety pins as profiled
+    // @Bitmask: 0:Enable hardware watchdog, 1:Disable MAVftp, 2:Enable set of internal parameters, 3:Enable Debug Pins, 4:Unlock flash on reboot, 5:Write protect firmware flash on reboot, 6:Write protect bootloader flash on reboot, 7:Skip board validation, 8:Disable board arming gpio output change on arm/disarm, 9:Use safety pins as profiled, 10:Report sensor bus utilization at boot
     // @User: Advanced
     AP_GROUPINFO("OPTIONS", 19, AP_BoardConfig, _options, HAL_BRD_OPTIONS_DEFAULT),
 
@@ -501,6 +501,7 @@ void AP_BoardConfig::init()
     board_setup();
 
 #if AP_RTC_ENABLED
+    AP::rtc().init();
     AP::rtc().set_utc_usec(hal.util->get_hw_rtc(), AP_RTC::SOURCE_HW);
 #endif
 
@@ -530,6 +531,81 @@ void AP_BoardConfig::init()
         printf("SDCard failed to start\n");
     }
 #endif
+
+    // check sensor bus loading once the drivers have registered their
+    // periodic callbacks and run for a while
+    hal.scheduler->register_io_process(FUNCTOR_BIND_MEMBER(&AP_BoardConfig::check_bus_contention, void));
+}
+
+/*
+  report buses of one type (I2C or SPI) whose periodic callbacks
+  consume more bus time than contention_threshold, suggesting the
+  least loaded bus of the same type as an alternative. get_util is
+  expected to return false for bus numbers that don't exist
+ */
+static void check_bus_set(const char *label, bool (*get_util)(uint8_t bus, float &utilization),
+                          uint8_t max_buses, bool report)
+{
+    const float contention_threshold = 0.8;
+    int8_t worst = -1, best = -1;
+    float worst_util = 0, best_util = 0;
+    for (uint8_t bus = 0; bus < max_buses; bus++) {
+        float util;
+        if (!get_util(bus, util)) {
+            continue;
+        }
+        if (report) {
+            GCS_SEND_TEXT(MAV_SEVERITY_INFO, "%s%u: %u%% bus load", label, unsigned(bus), unsigned(util*100));
+        }
+        if (worst == -1 || util > worst_util) {
+            worst = bus;
+            worst_util = util;
+        }
+        if (best == -1 || util < best_util) {
+            best = bus;
+            best_util = util;
+        }
+    }
+    if (worst == -1 || worst_util < contention_threshold) {
+        return;
+    }
+    if (best != worst && best_util < contention_threshold) {
+        GCS_SEND_TEXT(MAV_SEVERITY_WARNING, "%s%u at %u%% bus load, move a device to %s%u",
+                      label, unsigned(worst), unsigned(worst_util*100), label, unsigned(best));
+    } else {
+        GCS_SEND_TEXT(MAV_SEVERITY_WARNING, "%s%u at %u%% bus load",
+                      label, unsigned(worst), unsigned(worst_util*100));
+    }
+}
+
+/*
+  one-shot analysis of sensor bus loading, run once the drivers have
+  settled after boot. A bus close to saturation makes its periodic
+  callbacks overrun their periods, producing the sample rate drops we
+  otherwise only discover in flight logs. Warnings are always sent
+  (and hence logged); the full per-bus report is enabled with
+  BRD_OPTIONS bit 10
+ */
+void AP_BoardConfig::check_bus_contention(void)
+{
+    if (_bus_check_done ||
+        !hal.scheduler->is_system_initialized() ||
+        AP_HAL::millis() < 10000) {
+        return;
+    }
+    _bus_check_done = true;
+
+    const bool report = (_options & BOARD_OPTION_BUS_REPORT) != 0;
+    if (hal.i2c_mgr != nullptr) {
+        check_bus_set("I2C", [](uint8_t bus, float &util) {
+            return hal.i2c_mgr->get_bus_utilization(bus, util);
+        }, 32, report);
+    }
+    if (hal.spi != nullptr) {
+        check_bus_set("SPI", [](uint8_t bus, float &util) {
+            return hal.spi->get_bus_utilization(bus, util);
+        }, 8, report);
+    }
 }
 
 // set default value for BRD_SAFETY_MASK
@@ -166,6 +166,7 @@ public:
         SKIP_BOARD_VALIDATION = (1<<7),
         DISABLE_ARMING_GPIO = (1<<8),
         IO_SAFETY_PINS_AS_PROFILED = (1<<9),
+        BOARD_OPTION_BUS_REPORT = (1<<10),
     };
 
     //return true if arming gpio output is disabled
@@ -288,6 +289,10 @@ private:
     void board_init_safety(void);
     void board_init_debug(void);
 
+    // one-shot check of sensor bus loading after drivers have settled
+    void check_bus_contention(void);
+    bool _bus_check_done;
+
     void board_setup_uart(void);
     void board_setup_sbus(void);
     void board_setup(void);
@@ -39,6 +39,11 @@ void CANSensor::register_driver(AP_CAN::Protocol dtype)
             is_aux_11bit_driver = true;
             _can_driver = AP::can().get_driver(_driver_index);
             _initialized = true;
+            if (periodic_interval_us() != 0) {
+                // auxiliary drivers receive via the parent driver's
+                // callback, but still need a thread for periodic work
+                hal.scheduler->thread_create(FUNCTOR_BIND_MEMBER(&CANSensor::loop, void), _driver_name, _stack_size, AP_HAL::Scheduler::PRIORITY_CAN, 0);
+            }
         }
     }
 #elif defined(HAL_BUILD_AP_PERIPH)
@@ -148,9 +153,32 @@ void CANSensor::loop()
     const uint32_t LOOP_INTERVAL_US = AP::scheduler().get_loop_period_us();
 #endif
 
+    uint64_t next_update_us = 0;
+
     while (true) {
         uint64_t deadline_us = AP_HAL::micros64() + LOOP_INTERVAL_US;
 
+        // run any periodic transmit work when it falls due, and order
+        // the wait deadline so we wake in time for the next deadline
+        const uint32_t period_us = periodic_interval_us();
+        if (period_us != 0) {
+            if (AP_HAL::micros64() >= next_update_us) {
+                periodic_update();
+                next_update_us = AP_HAL::micros64() + period_us;
+            }
+            deadline_us = MIN(deadline_us, next_update_us);
+        }
+
+        if (_can_iface == nullptr) {
+            // an auxiliary driver receives via the parent driver's
+            // callback, this thread only has periodic work to do
+            const uint64_t now_us = AP_HAL::micros64();
+            if (next_update_us > now_us) {
+                sem_handle.wait(next_update_us - now_us);
+            }
+            continue;
+        }
+
         // wait to receive frame
         bool read_select = true;
         bool write_select = false;
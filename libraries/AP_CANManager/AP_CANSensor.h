@@ -45,6 +45,15 @@ public:
     // handler for outgoing frames
     bool write_frame(AP_HAL::CANFrame &out_frame, const uint32_t timeout_us);
 
+    // optional periodic transmit scheduling, run from the CANSensor
+    // thread in between receives so protocol drivers do not need a
+    // private thread. Return the interval in microseconds, 0 (the
+    // default) disables the callback
+    virtual uint32_t periodic_interval_us() const { return 0; }
+
+    // called from the CANSensor thread at periodic_interval_us()
+    virtual void periodic_update() {}
+
 #ifdef HAL_BUILD_AP_PERIPH
     static void set_periph(const uint8_t i, const AP_CAN::Protocol protocol, AP_HAL::CANIface* iface) {
         if (i < ARRAY_SIZE(_periph)) {
@@ -68,6 +77,10 @@ public:
 protected:
     void register_driver(AP_CAN::Protocol dtype);
 
+    // wake the CANSensor thread early, running periodic_update()
+    // sooner than its next deadline
+    void wake_thread() { sem_handle.signal(); }
+
 private:
     void loop();
 
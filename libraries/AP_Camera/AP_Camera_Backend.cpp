@@ -385,6 +385,12 @@ void AP_Camera_Backend::setup_feedback_callback()
 
         timer_installed = true;
     }
+
+    // snapshot vehicle state from the IO thread so the attitude and
+    // location recorded for a picture are those at the trigger, not
+    // those up to a full 50Hz update period later
+    hal.scheduler->register_io_process(FUNCTOR_BIND_MEMBER(&AP_Camera_Backend::feedback_pin_io, void));
+    io_installed = true;
 }
 
 // interrupt handler for interrupt based feedback trigger
@@ -408,6 +414,27 @@ void AP_Camera_Backend::feedback_pin_timer()
     last_pin_state = pin_state;
 }
 
+// called at ~1kHz from the IO thread.  snapshots vehicle state as soon
+// as possible after the feedback pin changes so that the position and
+// attitude recorded are those at the trigger, not up to 20ms later when
+// the 50Hz update gets around to it
+void AP_Camera_Backend::feedback_pin_io()
+{
+    // feedback_pin_isr/timer set the timestamp before incrementing the
+    // count, so once we observe a new count the timestamp is valid
+    const uint32_t tc = feedback_trigger_count;
+    if (tc == feedback_trigger_snapshot_count) {
+        return;
+    }
+
+    // extend the 32-bit trigger timestamp to 64 bits
+    const uint64_t now64 = AP_HAL::micros64();
+    const uint64_t ts64 = now64 - uint32_t(now64 - feedback_trigger_timestamp_us);
+
+    take_feedback_snapshot(ts64);
+    feedback_trigger_snapshot_count = tc;
+}
+
 // check for feedback pin update and log if necessary
 void AP_Camera_Backend::check_feedback()
 {
@@ -417,8 +444,16 @@ void AP_Camera_Backend::check_feedback()
 #endif
         feedback_trigger_logged_count = feedback_trigger_count;
 
-        // we should consider doing this inside the ISR and pin_timer
-        prep_mavlink_msg_camera_feedback(feedback_trigger_timestamp_us);
+        if (io_installed && feedback_trigger_snapshot_count == feedback_trigger_count) {
+            // the IO thread has already snapshotted vehicle state for
+            // this trigger; just send it.  GCS message emission stays
+            // here as queueing from the IO thread is not safe
+            camera_feedback.feedback_trigger_logged_count = feedback_trigger_logged_count;
+            GCS_SEND_MESSAGE(MSG_CAMERA_FEEDBACK);
+        } else {
+            // IO thread has not run since the trigger; snapshot now
+            prep_mavlink_msg_camera_feedback(feedback_trigger_timestamp_us);
+        }
 
 #if HAL_LOGGING_ENABLED
         // log camera message
@@ -429,7 +464,8 @@ void AP_Camera_Backend::check_feedback()
     }
 }
 
-void AP_Camera_Backend::prep_mavlink_msg_camera_feedback(uint64_t timestamp_us)
+// snapshot vehicle location and attitude into camera_feedback
+void AP_Camera_Backend::take_feedback_snapshot(uint64_t timestamp_us)
 {
     const AP_AHRS &ahrs = AP::ahrs();
     if (!ahrs.get_location(camera_feedback.location)) {
@@ -439,6 +475,11 @@ void AP_Camera_Backend::prep_mavlink_msg_camera_feedback(uint64_t timestamp_us)
     camera_feedback.roll_deg = ahrs.get_roll_deg();
     camera_feedback.pitch_deg = ahrs.get_pitch_deg();
     camera_feedback.yaw_deg = ahrs.get_yaw_deg();
+}
+
+void AP_Camera_Backend::prep_mavlink_msg_camera_feedback(uint64_t timestamp_us)
+{
+    take_feedback_snapshot(timestamp_us);
     camera_feedback.feedback_trigger_logged_count = feedback_trigger_logged_count;
 
     GCS_SEND_MESSAGE(MSG_CAMERA_FEEDBACK);
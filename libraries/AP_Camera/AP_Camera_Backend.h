@@ -160,10 +160,14 @@ protected:
     void setup_feedback_callback();
     void feedback_pin_isr(uint8_t pin, bool high, uint32_t timestamp_us);
     void feedback_pin_timer();
+    void feedback_pin_io();
     void check_feedback();
 
     // store vehicle location and attitude for use in camera_feedback message to GCS
     void prep_mavlink_msg_camera_feedback(uint64_t timestamp_us);
+
+    // snapshot vehicle location and attitude into camera_feedback
+    void take_feedback_snapshot(uint64_t timestamp_us);
     struct {
         uint64_t timestamp_us;      // system time of most recent image
         Location location;          // location where most recent image was taken
@@ -200,10 +204,12 @@ protected:
     uint8_t _instance;      // this instance's number
     bool timer_installed;   // true if feedback pin change detected using timer
     bool isr_installed;     // true if feedback pin change is detected with an interrupt
+    bool io_installed;      // true if the IO thread snapshots vehicle state after a feedback pin change
     uint8_t last_pin_state; // last pin state.  used by timer based detection
     uint32_t feedback_trigger_count;        // number of times the interrupt detected the feedback pin changed
     uint32_t feedback_trigger_timestamp_us; // system time (in microseconds) that timer detected the feedback pin changed
     uint32_t feedback_trigger_logged_count; // number of times the feedback has been logged
+    uint32_t feedback_trigger_snapshot_count; // number of feedback pin changes for which vehicle state has been snapshotted
     bool trigger_pending;           // true if a call to take_pic() was delayed due to the minimum time interval time
     uint32_t last_picture_time_ms;    // system time that photo was last taken
     Location last_location;         // Location that last picture was taken at (used for trigg_dist calculation)
@@ -172,7 +172,7 @@ static check_fw_result_t check_good_firmware_unsigned(void)
     return check_fw_result_t::CHECK_FW_OK;
 }
 
-check_fw_result_t check_good_firmware(void)
+static check_fw_result_t check_good_firmware_uncached(void)
 {
 #if AP_SIGNED_FIRMWARE
     // allow unsigned format if we have no public keys. This allows
@@ -201,6 +201,32 @@ check_fw_result_t check_good_firmware(void)
 #endif
 }
 
+/*
+  the full check covers a CRC of the whole application image (plus a
+  signature check on signed firmware), which is slow on large
+  images. The bootloader runs it once from main() to choose the boot
+  path and again from jump_to_app(), so cache the result, invalidated
+  whenever application flash is modified
+ */
+static struct {
+    bool valid;
+    check_fw_result_t result;
+} fw_check_cache;
+
+void mark_firmware_modified(void)
+{
+    fw_check_cache.valid = false;
+}
+
+check_fw_result_t check_good_firmware(void)
+{
+    if (!fw_check_cache.valid) {
+        fw_check_cache.result = check_good_firmware_uncached();
+        fw_check_cache.valid = true;
+    }
+    return fw_check_cache.result;
+}
+
 const app_descriptor_t *get_app_descriptor(void)
 {
 #if AP_SIGNED_FIRMWARE
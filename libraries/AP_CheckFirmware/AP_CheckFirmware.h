@@ -126,6 +126,9 @@ struct PACKED ap_secure_data {
 
 #ifdef HAL_BOOTLOADER_BUILD
 check_fw_result_t check_good_firmware(void);
+// invalidate the cached result of check_good_firmware(); must be
+// called whenever application flash is written or erased
+void mark_firmware_modified(void);
 const app_descriptor_t *get_app_descriptor(void);
 #else
 void check_firmware_print(void);
@@ -0,0 +1,51 @@
+/*
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/*
+  minimal typed intrusive singly-linked list. The node type embeds its
+  own 'next' pointer so insertion never allocates, and iteration
+  follows one pointer per element. Replaces the common hand-rolled
+  head/next pattern while keeping range-for iteration type safe
+ */
+#pragma once
+
+template <typename T>
+class AP_IntrusiveList {
+public:
+    // insert at the head of the list, O(1). The node must not already
+    // be on a list
+    void push_front(T *node) {
+        node->next = head;
+        head = node;
+    }
+
+    T *first(void) const { return head; }
+    bool empty(void) const { return head == nullptr; }
+
+    // minimal iterator support for range-for loops
+    class iterator {
+    public:
+        iterator(T *_p) : p(_p) {}
+        T *operator*(void) const { return p; }
+        iterator &operator++(void) { p = p->next; return *this; }
+        bool operator!=(const iterator &other) const { return p != other.p; }
+    private:
+        T *p;
+    };
+    iterator begin(void) const { return iterator(head); }
+    iterator end(void) const { return iterator(nullptr); }
+
+private:
+    T *head = nullptr;
+};
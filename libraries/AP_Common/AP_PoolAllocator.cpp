@@ -0,0 +1,114 @@
+/*
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AP_PoolAllocator.h"
+
+#include <AP_HAL/AP_HAL.h>
+#include <AP_Math/AP_Math.h>
+#include <AP_Common/ExpandingString.h>
+#include <AP_InternalError/AP_InternalError.h>
+
+#include <string.h>
+
+AP_PoolAllocator *AP_PoolAllocator::pools;
+
+AP_PoolAllocator::AP_PoolAllocator(const char *_name, uint16_t _block_size, uint16_t _num_blocks) :
+    name(_name),
+    // each free block holds the pointer to the next one, so a block
+    // can never be smaller than a pointer and must be pointer aligned
+    block_size(((MAX(_block_size, (uint16_t)sizeof(void*)) + sizeof(void*) - 1) / sizeof(void*)) * sizeof(void*)),
+    num_blocks(_num_blocks),
+    base(nullptr),
+    free_list(nullptr),
+    in_use(0),
+    max_used(0),
+    failures(0)
+{
+    // add to the registry for reporting
+    next = pools;
+    pools = this;
+}
+
+// allocate the backing store from the heap, returns true on success
+bool AP_PoolAllocator::init(void)
+{
+    if (base != nullptr) {
+        // init has already been called
+        return true;
+    }
+    base = NEW_NOTHROW uint8_t[block_size * (uint32_t)num_blocks];
+    if (base == nullptr) {
+        return false;
+    }
+    // thread the free list through all blocks
+    for (uint16_t i=0; i<num_blocks; i++) {
+        void **block = (void **)&base[block_size * (uint32_t)i];
+        *block = (i+1 < num_blocks) ? &base[block_size * (uint32_t)(i+1)] : nullptr;
+    }
+    free_list = base;
+    return true;
+}
+
+// allocate one block, returns zeroed memory or nullptr if the pool is exhausted
+void *AP_PoolAllocator::alloc(void)
+{
+    WITH_SEMAPHORE(sem);
+    if (free_list == nullptr) {
+        failures++;
+        return nullptr;
+    }
+    void *ret = free_list;
+    free_list = *(void **)ret;
+    in_use++;
+    if (in_use > max_used) {
+        max_used = in_use;
+    }
+    memset(ret, 0, block_size);
+    return ret;
+}
+
+// return a block to the pool. nullptr is ignored
+void AP_PoolAllocator::free_block(void *ptr)
+{
+    if (ptr == nullptr) {
+        return;
+    }
+    const uint32_t offset = (uint8_t *)ptr - base;
+    if ((uint8_t *)ptr < base ||
+        offset >= block_size * (uint32_t)num_blocks ||
+        offset % block_size != 0) {
+        // not a block from this pool
+        INTERNAL_ERROR(AP_InternalError::error_t::invalid_arg_or_result);
+        return;
+    }
+    WITH_SEMAPHORE(sem);
+    *(void **)ptr = free_list;
+    free_list = ptr;
+    in_use--;
+}
+
+// append stats for all registered arenas, used for @SYS/memory.txt
+void AP_PoolAllocator::pool_info(ExpandingString &str)
+{
+    for (AP_PoolAllocator *p = pools; p != nullptr; p = p->next) {
+        str.printf("Pool %s: size=%u blocks=%u used=%u max_used=%u failures=%u\n",
+                   p->name,
+                   unsigned(p->block_size),
+                   unsigned(p->num_blocks),
+                   unsigned(p->in_use),
+                   unsigned(p->max_used),
+                   unsigned(p->failures));
+    }
+}
@@ -0,0 +1,87 @@
+/*
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * AP_PoolAllocator is a named fixed-block pool (arena) allocator
+ *
+ * The backing store is allocated from the heap once in init() and
+ * then carved into equal sized blocks handed out by alloc() and
+ * returned by free_block(). Allocation and free are O(1) via a free
+ * list threaded through the unused blocks, and because the arena is a
+ * single allocation it cannot fragment the main heap however many
+ * times blocks are cycled.
+ *
+ * Every arena is kept on a registry so per-arena usage, high-water
+ * mark and failure counts can be reported via @SYS/memory.txt
+ */
+
+#pragma once
+
+#include <AP_Common/AP_Common.h>
+#include <AP_HAL/AP_HAL_Boards.h>
+#include <AP_HAL/Semaphores.h>
+
+class ExpandingString;
+
+class AP_PoolAllocator
+{
+public:
+
+    // name must remain valid for the lifetime of the allocator (a
+    // string literal is expected)
+    AP_PoolAllocator(const char *name, uint16_t block_size, uint16_t num_blocks);
+
+    /* Do not allow copies */
+    CLASS_NO_COPY(AP_PoolAllocator);
+
+    // allocate the backing store from the heap, returns true on success
+    bool init(void);
+
+    // allocate one block, returns zeroed memory or nullptr if the pool
+    // is exhausted
+    void *alloc(void);
+
+    // return a block to the pool. nullptr is ignored
+    void free_block(void *ptr);
+
+    // accessors for per-arena stats
+    uint16_t get_block_size(void) const { return block_size; }
+    uint16_t get_num_blocks(void) const { return num_blocks; }
+    uint16_t get_in_use(void) const { return in_use; }
+    uint16_t get_max_used(void) const { return max_used; }
+    uint32_t get_failures(void) const { return failures; }
+
+    // append stats for all registered arenas, used for @SYS/memory.txt
+    static void pool_info(ExpandingString &str);
+
+private:
+
+    const char *name;           // arena name for reporting
+    const uint16_t block_size;  // number of bytes in each block, rounded up to pointer alignment
+    const uint16_t num_blocks;  // total number of blocks in the arena
+
+    uint8_t *base;              // backing store, allocated in init()
+    void *free_list;            // head of the free list, threaded through unused blocks
+
+    uint16_t in_use;            // number of blocks currently allocated
+    uint16_t max_used;          // high-water mark of in_use
+    uint32_t failures;          // number of alloc() calls that returned nullptr
+
+    HAL_Semaphore sem;
+
+    // singly linked registry of all arenas for reporting
+    AP_PoolAllocator *next;
+    static AP_PoolAllocator *pools;
+};
@@ -65,6 +65,17 @@ bool ExpandingString::expand(uint32_t min_extra_space_needed)
   print into the buffer, expanding if needed
  */
 void ExpandingString::printf(const char *format, ...)
+{
+    va_list arg;
+    va_start(arg, format);
+    vprintf(format, arg);
+    va_end(arg);
+}
+
+/*
+  print from a va_list into the buffer, expanding if needed
+ */
+void ExpandingString::vprintf(const char *format, va_list arg)
 {
     if (allocation_failed) {
         return;
@@ -78,17 +89,17 @@ void ExpandingString::printf(const char *format, ...)
       print into the buffer, expanding the buffer if needed
      */
     while (true) {
-        va_list arg;
-        va_start(arg, format);
-        n = hal.util->vsnprintf(&buf[used], buflen-used, format, arg);
-        va_end(arg);
+        va_list arg2;
+        va_copy(arg2, arg);
+        n = hal.util->vsnprintf(&buf[used], buflen-used, format, arg2);
+        va_end(arg2);
         if (n < 0) {
             return;
         }
         if (uint32_t(n) < buflen - used) {
             break;
         }
-        if (!expand(n+1)) {            
+        if (!expand(n+1)) {
             return;
         }
     }
@@ -113,6 +124,21 @@ bool ExpandingString::append(const char *s, uint32_t len)
     return true;
 }
 
+/*
+  copy out len bytes starting at ofs, returns the number of bytes copied
+ */
+uint32_t ExpandingString::copy_bytes(uint32_t ofs, char *dest, uint32_t len) const
+{
+    if (buf == nullptr || ofs >= used) {
+        return 0;
+    }
+    if (len > used - ofs) {
+        len = used - ofs;
+    }
+    memcpy(dest, &buf[ofs], len);
+    return len;
+}
+
 ExpandingString::~ExpandingString()
 {
     if (!external_buffer) {
@@ -135,4 +161,148 @@ void ExpandingString::set_buffer(char *s, uint32_t total_len, uint32_t used_len)
     external_buffer = true;
 }
 
+/*
+  allocate a chunk holding at least min_size bytes and append it to the list
+ */
+ChunkedExpandingString::Chunk *ChunkedExpandingString::add_chunk(uint32_t min_size)
+{
+    Chunk *c = (Chunk *)calloc(1, sizeof(Chunk) + min_size);
+    if (c == nullptr) {
+        allocation_failed = true;
+        return nullptr;
+    }
+    c->size = min_size;
+    if (tail != nullptr) {
+        tail->next = c;
+    } else {
+        head = c;
+    }
+    tail = c;
+    return c;
+}
+
+/*
+  print from a va_list into the chunk list
+ */
+void ChunkedExpandingString::vprintf(const char *format, va_list arg)
+{
+    if (external_buffer) {
+        ExpandingString::vprintf(format, arg);
+        return;
+    }
+    if (allocation_failed) {
+        return;
+    }
+    // try to print into the space remaining in the current chunk
+    const uint32_t space = (tail != nullptr) ? tail->size - tail->len : 0;
+    char dummy;
+    va_list arg2;
+    va_copy(arg2, arg);
+    int n = hal.util->vsnprintf(space > 0 ? &tail->data[tail->len] : &dummy, space, format, arg2);
+    va_end(arg2);
+    if (n < 0) {
+        return;
+    }
+    if (uint32_t(n) < space) {
+        tail->len += n;
+        used += n;
+        return;
+    }
+    // did not fit; print into a fresh chunk big enough for the whole
+    // item. Any bytes left in the previous chunk simply go unused
+    const uint32_t needed = uint32_t(n) + 1;
+    if (add_chunk(needed > CHUNK_SIZE ? needed : CHUNK_SIZE) == nullptr) {
+        return;
+    }
+    va_copy(arg2, arg);
+    n = hal.util->vsnprintf(tail->data, tail->size, format, arg2);
+    va_end(arg2);
+    if (n < 0) {
+        return;
+    }
+    tail->len = n;
+    used += n;
+}
+
+/*
+  append data to the chunk list. s can be null for zero fill
+ */
+bool ChunkedExpandingString::append(const char *s, uint32_t len)
+{
+    if (external_buffer) {
+        return ExpandingString::append(s, len);
+    }
+    if (allocation_failed) {
+        return false;
+    }
+    uint32_t ofs = 0;
+    while (ofs < len) {
+        if (tail == nullptr || tail->len == tail->size) {
+            if (add_chunk(CHUNK_SIZE) == nullptr) {
+                return false;
+            }
+        }
+        uint32_t n = len - ofs;
+        if (n > tail->size - tail->len) {
+            n = tail->size - tail->len;
+        }
+        if (s != nullptr) {
+            memcpy(&tail->data[tail->len], s + ofs, n);
+        } else {
+            memset(&tail->data[tail->len], 0, n);
+        }
+        tail->len += n;
+        used += n;
+        ofs += n;
+    }
+    return true;
+}
+
+/*
+  copy out len bytes starting at ofs, walking the chunk list
+ */
+uint32_t ChunkedExpandingString::copy_bytes(uint32_t ofs, char *dest, uint32_t len) const
+{
+    if (head == nullptr) {
+        // no chunked data; fall back to the contiguous buffer used by
+        // set_buffer()
+        return ExpandingString::copy_bytes(ofs, dest, len);
+    }
+    uint32_t ret = 0;
+    for (const Chunk *c = head; c != nullptr && ret < len; c = c->next) {
+        if (ofs >= c->len) {
+            ofs -= c->len;
+            continue;
+        }
+        uint32_t n = len - ret;
+        if (n > c->len - ofs) {
+            n = c->len - ofs;
+        }
+        memcpy(dest + ret, &c->data[ofs], n);
+        ret += n;
+        ofs = 0;
+    }
+    return ret;
+}
+
+/*
+  zero out the string, freeing the chunk list
+ */
+void ChunkedExpandingString::reset()
+{
+    Chunk *c = head;
+    while (c != nullptr) {
+        Chunk *next = c->next;
+        free(c);
+        c = next;
+    }
+    head = tail = nullptr;
+    used = 0;
+}
+
+ChunkedExpandingString::~ChunkedExpandingString()
+{
+    reset();
+}
+
 #endif // HAL_BOOTLOADER_BUILD
@@ -20,6 +20,7 @@
 
 #include <AP_Common/AP_Common.h>
 
+#include <stdarg.h>
 #include <stdint.h>
 
 class ExpandingString {
@@ -40,22 +41,30 @@ public:
     // print into the string
     void printf(const char *format, ...) FMT_PRINTF(2,3);
 
+    // print into the string from a va_list
+    virtual void vprintf(const char *format, va_list arg);
+
     // append data to the string. s can be null for zero fill
-    bool append(const char *s, uint32_t len);
+    virtual bool append(const char *s, uint32_t len);
+
+    // copy out len bytes starting at ofs, returning the number of
+    // bytes copied. Works whether or not the storage is contiguous,
+    // unlike get_string()
+    virtual uint32_t copy_bytes(uint32_t ofs, char *dest, uint32_t len) const;
 
     // set address to custom external buffer
     void set_buffer(char *s, uint32_t total_len, uint32_t used_len);
     // zero out the string
-    void reset() { used = 0; }
+    virtual void reset() { used = 0; }
 
     // destructor
-    ~ExpandingString();
+    virtual ~ExpandingString();
 
     bool has_failed_allocation() const {
         return allocation_failed;
     }
 
-private:
+protected:
     char *buf;
     uint32_t buflen;
     uint32_t used;
@@ -65,3 +74,39 @@ private:
     // try to expand the buffer
     bool expand(uint32_t min_needed) WARN_IF_UNUSED;
 };
+
+/*
+  variant of ExpandingString holding the text in a linked list of
+  chunks instead of one contiguous buffer. Growing never reallocates or
+  copies what has already been written, so building a large report
+  (@SYS pages, can stats) leaves no large transient allocations to
+  fragment the heap. The content is not contiguous so it must be
+  consumed through copy_bytes() rather than get_string()
+ */
+class ChunkedExpandingString : public ExpandingString {
+public:
+    virtual ~ChunkedExpandingString();
+
+    void vprintf(const char *format, va_list arg) override;
+    bool append(const char *s, uint32_t len) override;
+    uint32_t copy_bytes(uint32_t ofs, char *dest, uint32_t len) const override;
+    void reset() override;
+
+private:
+    // default number of data bytes per chunk. A single printf or
+    // append larger than this gets a chunk of its own size
+    static const uint16_t CHUNK_SIZE = 512;
+
+    struct Chunk {
+        Chunk *next;
+        uint32_t size;  // data bytes this chunk can hold
+        uint32_t len;   // data bytes used
+        char data[];
+    };
+    Chunk *head = nullptr;
+    Chunk *tail = nullptr;
+
+    // allocate a chunk holding at least min_size bytes and append it
+    // to the list, returns nullptr on allocation failure
+    Chunk *add_chunk(uint32_t min_size);
+};
@@ -0,0 +1,49 @@
+#include <AP_gtest.h>
+#include <AP_Common/ExpandingString.h>
+#include <AP_HAL/AP_HAL.h>
+
+#include <string.h>
+
+const AP_HAL::HAL& hal = AP_HAL::get_HAL();
+
+TEST(ChunkedExpandingString, Tests)
+{
+    ChunkedExpandingString *test_string = NEW_NOTHROW ChunkedExpandingString();
+    test_string->printf("Test\n");
+    EXPECT_EQ(5u, test_string->get_length());
+    EXPECT_FALSE(test_string->has_failed_allocation());
+    EXPECT_TRUE(test_string->append("Test2\n", 6));
+    EXPECT_EQ(11u, test_string->get_length());
+
+    char out[12] {};
+    EXPECT_EQ(11u, test_string->copy_bytes(0, out, sizeof(out)));
+    EXPECT_STREQ("Test\nTest2\n", out);
+
+    // partial read from an offset
+    memset(out, 0, sizeof(out));
+    EXPECT_EQ(5u, test_string->copy_bytes(5, out, 5));
+    EXPECT_STREQ("Test2", out);
+
+    // reads past the end return what is left
+    EXPECT_EQ(1u, test_string->copy_bytes(10, out, 5));
+    EXPECT_EQ(0u, test_string->copy_bytes(11, out, 5));
+
+    // an item larger than a chunk still lands in one piece
+    char long_string[2048];
+    memset(long_string, 'a', sizeof(long_string)-1);
+    long_string[sizeof(long_string)-1] = 0;
+    test_string->printf("%s", long_string);
+    EXPECT_EQ(11u + 2047u, test_string->get_length());
+    char big_out[2048];
+    EXPECT_EQ(2047u, test_string->copy_bytes(11, big_out, 2047));
+    EXPECT_EQ(0, memcmp(big_out, long_string, 2047));
+
+    // reset frees the chunks and empties the string
+    test_string->reset();
+    EXPECT_EQ(0u, test_string->get_length());
+    EXPECT_EQ(0u, test_string->copy_bytes(0, out, sizeof(out)));
+
+    delete test_string;
+}
+
+AP_GTEST_MAIN()
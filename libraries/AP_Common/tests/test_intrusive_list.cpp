@@ -0,0 +1,37 @@
+#include <AP_gtest.h>
+#include <AP_Common/AP_IntrusiveList.h>
+#include <AP_HAL/AP_HAL.h>
+
+const AP_HAL::HAL& hal = AP_HAL::get_HAL();
+
+struct Node {
+    Node *next;
+    uint8_t value;
+};
+
+TEST(AP_IntrusiveList, Tests)
+{
+    AP_IntrusiveList<Node> list;
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(nullptr, list.first());
+
+    Node nodes[3] {};
+    for (uint8_t i = 0; i < 3; i++) {
+        nodes[i].value = i;
+        list.push_front(&nodes[i]);
+    }
+    EXPECT_FALSE(list.empty());
+    EXPECT_EQ(&nodes[2], list.first());
+
+    // iteration returns nodes most-recently-added first
+    uint8_t expected = 3;
+    uint8_t count = 0;
+    for (const auto *node : list) {
+        expected--;
+        EXPECT_EQ(expected, node->value);
+        count++;
+    }
+    EXPECT_EQ(3u, count);
+}
+
+AP_GTEST_MAIN()
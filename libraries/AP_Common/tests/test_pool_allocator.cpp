@@ -0,0 +1,62 @@
+#include <AP_gtest.h>
+#include <AP_HAL/AP_HAL.h>
+
+#include <AP_Common/AP_PoolAllocator.h>
+
+#include <string.h>
+
+const AP_HAL::HAL& hal = AP_HAL::get_HAL();
+
+TEST(AP_PoolAllocator, alloc_free)
+{
+    AP_PoolAllocator pool{"test", 24, 4};
+    EXPECT_TRUE(pool.init());
+    EXPECT_EQ(4, pool.get_num_blocks());
+    EXPECT_EQ(0, pool.get_in_use());
+
+    void *blocks[4];
+    for (uint8_t i=0; i<4; i++) {
+        blocks[i] = pool.alloc();
+        EXPECT_TRUE(blocks[i] != nullptr);
+    }
+    EXPECT_EQ(4, pool.get_in_use());
+    EXPECT_EQ(4, pool.get_max_used());
+
+    // pool is exhausted
+    EXPECT_TRUE(pool.alloc() == nullptr);
+    EXPECT_EQ(1U, pool.get_failures());
+
+    // returned blocks can be allocated again and come back zeroed
+    memset(blocks[2], 0xff, 24);
+    pool.free_block(blocks[2]);
+    EXPECT_EQ(3, pool.get_in_use());
+    uint8_t *again = (uint8_t *)pool.alloc();
+    EXPECT_TRUE(again != nullptr);
+    for (uint8_t i=0; i<24; i++) {
+        EXPECT_EQ(0, again[i]);
+    }
+    pool.free_block(again);
+
+    for (uint8_t i=0; i<4; i++) {
+        if (i != 2) {
+            pool.free_block(blocks[i]);
+        }
+    }
+    EXPECT_EQ(0, pool.get_in_use());
+    EXPECT_EQ(4, pool.get_max_used());
+
+    // freeing nullptr is a no-op
+    pool.free_block(nullptr);
+    EXPECT_EQ(0, pool.get_in_use());
+}
+
+TEST(AP_PoolAllocator, block_alignment)
+{
+    // block size smaller than a pointer must be rounded up
+    AP_PoolAllocator pool{"align", 1, 2};
+    EXPECT_TRUE(pool.init());
+    EXPECT_GE(pool.get_block_size(), sizeof(void*));
+    EXPECT_EQ(0U, pool.get_block_size() % sizeof(void*));
+}
+
+AP_GTEST_MAIN()
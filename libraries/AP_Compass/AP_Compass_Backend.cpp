@@ -161,6 +161,44 @@ void AP_Compass_Backend::accumulate_sample(Vector3f &field,
     }
 }
 
+void AP_Compass_Backend::accumulate_samples(Vector3f *fields,
+                                            uint8_t count,
+                                            uint32_t max_samples)
+{
+    if (count == 0) {
+        return;
+    }
+
+    Vector3f mean;
+    for (uint8_t i = 0; i < count; i++) {
+        /* rotate each raw_field from sensor frame to body frame */
+        rotate_field(fields[i]);
+
+        /* publish each raw_field (uncorrected point sample) for calibration use */
+        publish_raw_field(fields[i]);
+
+        mean += fields[i];
+    }
+    mean /= count;
+
+    /* correct the batch mean for known errors */
+    correct_field(mean);
+
+    if (!field_ok(mean)) {
+        return;
+    }
+
+    WITH_SEMAPHORE(_sem);
+
+    Compass::mag_state &state = _compass._state[Compass::StateIndex(instance)];
+    state.accum += mean * count;
+    state.accum_count += count;
+    if (max_samples && state.accum_count >= max_samples) {
+        state.accum_count /= 2;
+        state.accum /= 2;
+    }
+}
+
 void AP_Compass_Backend::drain_accumulated_samples(const Vector3f *scaling)
 {
     WITH_SEMAPHORE(_sem);
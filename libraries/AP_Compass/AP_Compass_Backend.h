@@ -115,6 +115,17 @@ protected:
 
     void accumulate_sample(Vector3f &field,
                            uint32_t max_samples = 10);
+
+    // batched version of accumulate_sample(). Each field is rotated
+    // and published to the calibrator individually, but the iron and
+    // motor corrections are applied once to the batch mean. The
+    // corrections are affine with parameters that do not change
+    // within a batch, so this is equivalent to correcting each sample
+    // while costing a single correction pass. The range filter sees
+    // the batch mean rather than each point sample
+    void accumulate_samples(Vector3f *fields, uint8_t count,
+                            uint32_t max_samples = 10);
+
     void drain_accumulated_samples(const Vector3f *scale = NULL);
 
     // register compass instance with the frontend
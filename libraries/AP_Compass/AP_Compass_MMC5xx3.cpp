@@ -286,11 +286,21 @@ void AP_Compass_MMC5XX3::timer()
                        float((data1[4] << 8) + data1[5]) - zero_offset};
         field *= counts_to_milliGauss;
         field -= offset;
-        accumulate_sample(field);
+
+        // stage the sample, delivering to the frontend in batches to
+        // amortise the correction math over several samples
+        field_batch[field_batch_len++] = field;
+        if (field_batch_len == ARRAY_SIZE(field_batch)) {
+            accumulate_samples(field_batch, field_batch_len);
+            field_batch_len = 0;
+        }
 
         // we stay in STATE_MEASURE for measure_count_limit cycles
         if (measure_count++ >= measure_count_limit) {
             measure_count = 0;
+            // flush any staged samples before the set/reset cycle
+            accumulate_samples(field_batch, field_batch_len);
+            field_batch_len = 0;
             state = MMCState::STATE_SET;
         } else {
             if (!dev->write_register(REG_CONTROL0, REG_CONTROL0_TMM)) { // Take Measurement
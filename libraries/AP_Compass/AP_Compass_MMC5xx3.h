@@ -64,6 +64,13 @@ private:
 
     bool force_external;
     Vector3f offset;
+
+    // driver-corrected samples staged for batched delivery to the
+    // frontend. The frontend drains at most at main loop rate, so
+    // staging a few 100Hz samples adds no effective latency
+    Vector3f field_batch[4];
+    uint8_t field_batch_len;
+
     uint16_t measure_count;
     bool have_initial_offset;
     uint32_t refill_start_ms;
@@ -655,14 +655,25 @@ void CompassCalibrator::run_sphere_fit()
 
         calc_sphere_jacob(sample, fit1_params, sphere_jacob);
 
+        // the residual does not depend on the parameter index and JTJ
+        // is symmetric, so evaluate the residual once per sample and
+        // accumulate only the upper triangle
+        const float residual = calc_residual(sample, fit1_params);
         for (uint8_t i = 0;i < COMPASS_CAL_NUM_SPHERE_PARAMS; i++) {
             // compute JTJ
-            for (uint8_t j = 0; j < COMPASS_CAL_NUM_SPHERE_PARAMS; j++) {
+            for (uint8_t j = i; j < COMPASS_CAL_NUM_SPHERE_PARAMS; j++) {
                 JTJ[i*COMPASS_CAL_NUM_SPHERE_PARAMS+j] += sphere_jacob[i] * sphere_jacob[j];
-                JTJ2[i*COMPASS_CAL_NUM_SPHERE_PARAMS+j] += sphere_jacob[i] * sphere_jacob[j];   //a backup JTJ for LM
             }
             // compute JTFI
-            JTFI[i] += sphere_jacob[i] * calc_residual(sample, fit1_params);
+            JTFI[i] += sphere_jacob[i] * residual;
+        }
+    }
+
+    // mirror the upper triangle and take a backup JTJ for LM
+    for (uint8_t i = 0; i < COMPASS_CAL_NUM_SPHERE_PARAMS; i++) {
+        for (uint8_t j = i; j < COMPASS_CAL_NUM_SPHERE_PARAMS; j++) {
+            JTJ[j*COMPASS_CAL_NUM_SPHERE_PARAMS+i] = JTJ[i*COMPASS_CAL_NUM_SPHERE_PARAMS+j];
+            JTJ2[i*COMPASS_CAL_NUM_SPHERE_PARAMS+j] = JTJ2[j*COMPASS_CAL_NUM_SPHERE_PARAMS+i] = JTJ[i*COMPASS_CAL_NUM_SPHERE_PARAMS+j];
         }
     }
 
@@ -673,11 +684,11 @@ void CompassCalibrator::run_sphere_fit()
         JTJ2[i*COMPASS_CAL_NUM_SPHERE_PARAMS+i] += _sphere_lambda/lma_damping;
     }
 
-    if (!mat_inverse(JTJ, JTJ, 4)) {
+    if (!mat_inverse<4>(JTJ, JTJ)) {
         return;
     }
 
-    if (!mat_inverse(JTJ2, JTJ2, 4)) {
+    if (!mat_inverse<4>(JTJ2, JTJ2)) {
         return;
     }
 
@@ -771,14 +782,25 @@ void CompassCalibrator::run_ellipsoid_fit()
 
         calc_ellipsoid_jacob(sample, fit1_params, ellipsoid_jacob);
 
+        // the residual does not depend on the parameter index and JTJ
+        // is symmetric, so evaluate the residual once per sample and
+        // accumulate only the upper triangle
+        const float residual = calc_residual(sample, fit1_params);
         for (uint8_t i = 0;i < COMPASS_CAL_NUM_ELLIPSOID_PARAMS; i++) {
             // compute JTJ
-            for (uint8_t j = 0; j < COMPASS_CAL_NUM_ELLIPSOID_PARAMS; j++) {
-                JTJ [i*COMPASS_CAL_NUM_ELLIPSOID_PARAMS+j] += ellipsoid_jacob[i] * ellipsoid_jacob[j];
-                JTJ2[i*COMPASS_CAL_NUM_ELLIPSOID_PARAMS+j] += ellipsoid_jacob[i] * ellipsoid_jacob[j];
+            for (uint8_t j = i; j < COMPASS_CAL_NUM_ELLIPSOID_PARAMS; j++) {
+                JTJ[i*COMPASS_CAL_NUM_ELLIPSOID_PARAMS+j] += ellipsoid_jacob[i] * ellipsoid_jacob[j];
             }
             // compute JTFI
-            JTFI[i] += ellipsoid_jacob[i] * calc_residual(sample, fit1_params);
+            JTFI[i] += ellipsoid_jacob[i] * residual;
+        }
+    }
+
+    // mirror the upper triangle and take a backup JTJ for LM
+    for (uint8_t i = 0; i < COMPASS_CAL_NUM_ELLIPSOID_PARAMS; i++) {
+        for (uint8_t j = i; j < COMPASS_CAL_NUM_ELLIPSOID_PARAMS; j++) {
+            JTJ[j*COMPASS_CAL_NUM_ELLIPSOID_PARAMS+i] = JTJ[i*COMPASS_CAL_NUM_ELLIPSOID_PARAMS+j];
+            JTJ2[i*COMPASS_CAL_NUM_ELLIPSOID_PARAMS+j] = JTJ2[j*COMPASS_CAL_NUM_ELLIPSOID_PARAMS+i] = JTJ[i*COMPASS_CAL_NUM_ELLIPSOID_PARAMS+j];
         }
     }
 
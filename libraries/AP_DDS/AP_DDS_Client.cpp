@@ -93,6 +93,16 @@ static constexpr uint16_t DELAY_PING_MS = 500;
 static constexpr uint16_t DELAY_STATUS_TOPIC_MS = AP_DDS_DELAY_STATUS_TOPIC_MS;
 #endif // AP_DDS_STATUS_PUB_ENABLED
 
+#if AP_DDS_TX_BANDWIDTH_REPORT_ENABLED
+// bytes queued per entry in topics[] since the last report
+static uint32_t topic_tx_bytes[ARRAY_SIZE(AP_DDS_Client::topics)];
+static uint64_t last_tx_report_time_ms;
+static constexpr uint16_t DELAY_TX_REPORT_MS = 10000;
+#define TX_ACCOUNT(index, nbytes) topic_tx_bytes[to_underlying(TopicIndex::index)] += (nbytes)
+#else
+#define TX_ACCOUNT(index, nbytes) do {} while (false)
+#endif // AP_DDS_TX_BANDWIDTH_REPORT_ENABLED
+
 // Define the subscriber data members, which are static class scope.
 // If these are created on the stack in the subscriber,
 // the AP_DDS_Client::on_topic frame size is exceeded.
@@ -483,6 +493,19 @@ void AP_DDS_Client::update_topic(geometry_msgs_msg_PoseStamped& msg)
         initialize(msg.pose.orientation);
     }
 }
+
+#if AP_DDS_POSE_CHANGE_FILTER_ENABLED
+bool AP_DDS_Client::local_pose_changed(const geometry_msgs_msg_PoseStamped& msg) const
+{
+    return fabsf(float(msg.pose.position.x - last_local_pose_msg_.pose.position.x)) > AP_DDS_POSE_EPSILON_POS_M ||
+           fabsf(float(msg.pose.position.y - last_local_pose_msg_.pose.position.y)) > AP_DDS_POSE_EPSILON_POS_M ||
+           fabsf(float(msg.pose.position.z - last_local_pose_msg_.pose.position.z)) > AP_DDS_POSE_EPSILON_POS_M ||
+           fabsf(float(msg.pose.orientation.w - last_local_pose_msg_.pose.orientation.w)) > AP_DDS_POSE_EPSILON_QUAT ||
+           fabsf(float(msg.pose.orientation.x - last_local_pose_msg_.pose.orientation.x)) > AP_DDS_POSE_EPSILON_QUAT ||
+           fabsf(float(msg.pose.orientation.y - last_local_pose_msg_.pose.orientation.y)) > AP_DDS_POSE_EPSILON_QUAT ||
+           fabsf(float(msg.pose.orientation.z - last_local_pose_msg_.pose.orientation.z)) > AP_DDS_POSE_EPSILON_QUAT;
+}
+#endif // AP_DDS_POSE_CHANGE_FILTER_ENABLED
 #endif // AP_DDS_LOCAL_POSE_PUB_ENABLED
 
 #if AP_DDS_LOCAL_VEL_PUB_ENABLED
@@ -629,6 +652,19 @@ void AP_DDS_Client::update_topic(geographic_msgs_msg_GeoPoseStamped& msg)
         initialize(msg.pose.orientation);
     }
 }
+
+#if AP_DDS_POSE_CHANGE_FILTER_ENABLED
+bool AP_DDS_Client::geo_pose_changed(const geographic_msgs_msg_GeoPoseStamped& msg) const
+{
+    return fabs(msg.pose.position.latitude - last_geo_pose_msg_.pose.position.latitude) > AP_DDS_POSE_EPSILON_LL_DEG ||
+           fabs(msg.pose.position.longitude - last_geo_pose_msg_.pose.position.longitude) > AP_DDS_POSE_EPSILON_LL_DEG ||
+           fabsf(float(msg.pose.position.altitude - last_geo_pose_msg_.pose.position.altitude)) > AP_DDS_POSE_EPSILON_POS_M ||
+           fabsf(float(msg.pose.orientation.w - last_geo_pose_msg_.pose.orientation.w)) > AP_DDS_POSE_EPSILON_QUAT ||
+           fabsf(float(msg.pose.orientation.x - last_geo_pose_msg_.pose.orientation.x)) > AP_DDS_POSE_EPSILON_QUAT ||
+           fabsf(float(msg.pose.orientation.y - last_geo_pose_msg_.pose.orientation.y)) > AP_DDS_POSE_EPSILON_QUAT ||
+           fabsf(float(msg.pose.orientation.z - last_geo_pose_msg_.pose.orientation.z)) > AP_DDS_POSE_EPSILON_QUAT;
+}
+#endif // AP_DDS_POSE_CHANGE_FILTER_ENABLED
 #endif // AP_DDS_GEOPOSE_PUB_ENABLED
 
 #if AP_DDS_GOAL_PUB_ENABLED
@@ -1643,6 +1679,7 @@ void AP_DDS_Client::write_time_topic()
         ucdrBuffer ub {};
         const uint32_t topic_size = builtin_interfaces_msg_Time_size_of_topic(&time_topic, 0);
         uxr_prepare_output_stream(&session, reliable_out, topics[to_underlying(TopicIndex::TIME_PUB)].dw_id, &ub, topic_size);
+        TX_ACCOUNT(TIME_PUB, topic_size);
         const bool success = builtin_interfaces_msg_Time_serialize_topic(&ub, &time_topic);
         if (!success) {
             // TODO sometimes serialization fails on bootup. Determine why.
@@ -1659,6 +1696,7 @@ void AP_DDS_Client::write_nav_sat_fix_topic()
         ucdrBuffer ub {};
         const uint32_t topic_size = sensor_msgs_msg_NavSatFix_size_of_topic(&nav_sat_fix_topic, 0);
         uxr_prepare_output_stream(&session, reliable_out, topics[to_underlying(TopicIndex::NAV_SAT_FIX_PUB)].dw_id, &ub, topic_size);
+        TX_ACCOUNT(NAV_SAT_FIX_PUB, topic_size);
         const bool success = sensor_msgs_msg_NavSatFix_serialize_topic(&ub, &nav_sat_fix_topic);
         if (!success) {
             // TODO sometimes serialization fails on bootup. Determine why.
@@ -1676,6 +1714,7 @@ void AP_DDS_Client::write_static_transforms()
         ucdrBuffer ub {};
         const uint32_t topic_size = tf2_msgs_msg_TFMessage_size_of_topic(&tx_static_transforms_topic, 0);
         uxr_prepare_output_stream(&session, reliable_out, topics[to_underlying(TopicIndex::STATIC_TRANSFORMS_PUB)].dw_id, &ub, topic_size);
+        TX_ACCOUNT(STATIC_TRANSFORMS_PUB, topic_size);
         const bool success = tf2_msgs_msg_TFMessage_serialize_topic(&ub, &tx_static_transforms_topic);
         if (!success) {
             // TODO sometimes serialization fails on bootup. Determine why.
@@ -1693,6 +1732,7 @@ void AP_DDS_Client::write_battery_state_topic()
         ucdrBuffer ub {};
         const uint32_t topic_size = sensor_msgs_msg_BatteryState_size_of_topic(&battery_state_topic, 0);
         uxr_prepare_output_stream(&session, reliable_out, topics[to_underlying(TopicIndex::BATTERY_STATE_PUB)].dw_id, &ub, topic_size);
+        TX_ACCOUNT(BATTERY_STATE_PUB, topic_size);
         const bool success = sensor_msgs_msg_BatteryState_serialize_topic(&ub, &battery_state_topic);
         if (!success) {
             // TODO sometimes serialization fails on bootup. Determine why.
@@ -1710,6 +1750,7 @@ void AP_DDS_Client::write_local_pose_topic()
         ucdrBuffer ub {};
         const uint32_t topic_size = geometry_msgs_msg_PoseStamped_size_of_topic(&local_pose_topic, 0);
         uxr_prepare_output_stream(&session, reliable_out, topics[to_underlying(TopicIndex::LOCAL_POSE_PUB)].dw_id, &ub, topic_size);
+        TX_ACCOUNT(LOCAL_POSE_PUB, topic_size);
         const bool success = geometry_msgs_msg_PoseStamped_serialize_topic(&ub, &local_pose_topic);
         if (!success) {
             // TODO sometimes serialization fails on bootup. Determine why.
@@ -1727,6 +1768,7 @@ void AP_DDS_Client::write_tx_local_velocity_topic()
         ucdrBuffer ub {};
         const uint32_t topic_size = geometry_msgs_msg_TwistStamped_size_of_topic(&tx_local_velocity_topic, 0);
         uxr_prepare_output_stream(&session, reliable_out, topics[to_underlying(TopicIndex::LOCAL_VELOCITY_PUB)].dw_id, &ub, topic_size);
+        TX_ACCOUNT(LOCAL_VELOCITY_PUB, topic_size);
         const bool success = geometry_msgs_msg_TwistStamped_serialize_topic(&ub, &tx_local_velocity_topic);
         if (!success) {
             // TODO sometimes serialization fails on bootup. Determine why.
@@ -1743,6 +1785,7 @@ void AP_DDS_Client::write_tx_local_airspeed_topic()
         ucdrBuffer ub {};
         const uint32_t topic_size = ardupilot_msgs_msg_Airspeed_size_of_topic(&tx_local_airspeed_topic, 0);
         uxr_prepare_output_stream(&session, reliable_out, topics[to_underlying(TopicIndex::LOCAL_AIRSPEED_PUB)].dw_id, &ub, topic_size);
+        TX_ACCOUNT(LOCAL_AIRSPEED_PUB, topic_size);
         const bool success = ardupilot_msgs_msg_Airspeed_serialize_topic(&ub, &tx_local_airspeed_topic);
         if (!success) {
             // TODO sometimes serialization fails on bootup. Determine why.
@@ -1759,6 +1802,7 @@ void AP_DDS_Client::write_tx_local_rc_topic()
         ucdrBuffer ub {};
         const uint32_t topic_size = ardupilot_msgs_msg_Rc_size_of_topic(&tx_local_rc_topic, 0);
         uxr_prepare_output_stream(&session, reliable_out, topics[to_underlying(TopicIndex::LOCAL_RC_PUB)].dw_id, &ub, topic_size);
+        TX_ACCOUNT(LOCAL_RC_PUB, topic_size);
         const bool success = ardupilot_msgs_msg_Rc_serialize_topic(&ub, &tx_local_rc_topic);
         if (!success) {
             // TODO sometimes serialization fails on bootup. Determine why.
@@ -1775,6 +1819,7 @@ void AP_DDS_Client::write_imu_topic()
         ucdrBuffer ub {};
         const uint32_t topic_size = sensor_msgs_msg_Imu_size_of_topic(&imu_topic, 0);
         uxr_prepare_output_stream(&session, reliable_out, topics[to_underlying(TopicIndex::IMU_PUB)].dw_id, &ub, topic_size);
+        TX_ACCOUNT(IMU_PUB, topic_size);
         const bool success = sensor_msgs_msg_Imu_serialize_topic(&ub, &imu_topic);
         if (!success) {
             // TODO sometimes serialization fails on bootup. Determine why.
@@ -1792,6 +1837,7 @@ void AP_DDS_Client::write_geo_pose_topic()
         ucdrBuffer ub {};
         const uint32_t topic_size = geographic_msgs_msg_GeoPoseStamped_size_of_topic(&geo_pose_topic, 0);
         uxr_prepare_output_stream(&session, reliable_out, topics[to_underlying(TopicIndex::GEOPOSE_PUB)].dw_id, &ub, topic_size);
+        TX_ACCOUNT(GEOPOSE_PUB, topic_size);
         const bool success = geographic_msgs_msg_GeoPoseStamped_serialize_topic(&ub, &geo_pose_topic);
         if (!success) {
             // TODO sometimes serialization fails on bootup. Determine why.
@@ -1809,6 +1855,7 @@ void AP_DDS_Client::write_clock_topic()
         ucdrBuffer ub {};
         const uint32_t topic_size = rosgraph_msgs_msg_Clock_size_of_topic(&clock_topic, 0);
         uxr_prepare_output_stream(&session, reliable_out, topics[to_underlying(TopicIndex::CLOCK_PUB)].dw_id, &ub, topic_size);
+        TX_ACCOUNT(CLOCK_PUB, topic_size);
         const bool success = rosgraph_msgs_msg_Clock_serialize_topic(&ub, &clock_topic);
         if (!success) {
             // TODO sometimes serialization fails on bootup. Determine why.
@@ -1826,6 +1873,7 @@ void AP_DDS_Client::write_gps_global_origin_topic()
         ucdrBuffer ub {};
         const uint32_t topic_size = geographic_msgs_msg_GeoPointStamped_size_of_topic(&gps_global_origin_topic, 0);
         uxr_prepare_output_stream(&session, reliable_out, topics[to_underlying(TopicIndex::GPS_GLOBAL_ORIGIN_PUB)].dw_id, &ub, topic_size);
+        TX_ACCOUNT(GPS_GLOBAL_ORIGIN_PUB, topic_size);
         const bool success = geographic_msgs_msg_GeoPointStamped_serialize_topic(&ub, &gps_global_origin_topic);
         if (!success) {
             // AP_HAL::panic("FATAL: DDS_Client failed to serialize");
@@ -1842,6 +1890,7 @@ void AP_DDS_Client::write_goal_topic()
         ucdrBuffer ub {};
         const uint32_t topic_size = geographic_msgs_msg_GeoPointStamped_size_of_topic(&goal_topic, 0);
         uxr_prepare_output_stream(&session, reliable_out, topics[to_underlying(TopicIndex::GOAL_PUB)].dw_id, &ub, topic_size);
+        TX_ACCOUNT(GOAL_PUB, topic_size);
         const bool success = geographic_msgs_msg_GeoPointStamped_serialize_topic(&ub, &goal_topic);
         if (!success) {
             // AP_HAL::panic("FATAL: DDS_Client failed to serialize");
@@ -1858,6 +1907,7 @@ void AP_DDS_Client::write_status_topic()
         ucdrBuffer ub {};
         const uint32_t topic_size = ardupilot_msgs_msg_Status_size_of_topic(&status_topic, 0);
         uxr_prepare_output_stream(&session, reliable_out, topics[to_underlying(TopicIndex::STATUS_PUB)].dw_id, &ub, topic_size);
+        TX_ACCOUNT(STATUS_PUB, topic_size);
         const bool success = ardupilot_msgs_msg_Status_serialize_topic(&ub, &status_topic);
         if (!success) {
             // TODO sometimes serialization fails on bootup. Determine why.
@@ -1901,7 +1951,18 @@ void AP_DDS_Client::update()
     if (cur_time_ms - last_local_pose_time_ms > DELAY_LOCAL_POSE_TOPIC_MS) {
         update_topic(local_pose_topic);
         last_local_pose_time_ms = cur_time_ms;
+#if AP_DDS_POSE_CHANGE_FILTER_ENABLED
+        // only publish when the vehicle has moved, with a keepalive at
+        // 1/5th of the nominal rate
+        if (local_pose_changed(local_pose_topic) ||
+            cur_time_ms - last_local_pose_publish_time_ms > DELAY_LOCAL_POSE_TOPIC_MS * 5) {
+            last_local_pose_msg_ = local_pose_topic;
+            last_local_pose_publish_time_ms = cur_time_ms;
+            write_local_pose_topic();
+        }
+#else
         write_local_pose_topic();
+#endif // AP_DDS_POSE_CHANGE_FILTER_ENABLED
     }
 #endif // AP_DDS_LOCAL_POSE_PUB_ENABLED
 #if AP_DDS_LOCAL_VEL_PUB_ENABLED
@@ -1938,7 +1999,16 @@ void AP_DDS_Client::update()
     if (cur_time_ms - last_geo_pose_time_ms > DELAY_GEO_POSE_TOPIC_MS) {
         update_topic(geo_pose_topic);
         last_geo_pose_time_ms = cur_time_ms;
+#if AP_DDS_POSE_CHANGE_FILTER_ENABLED
+        if (geo_pose_changed(geo_pose_topic) ||
+            cur_time_ms - last_geo_pose_publish_time_ms > DELAY_GEO_POSE_TOPIC_MS * 5) {
+            last_geo_pose_msg_ = geo_pose_topic;
+            last_geo_pose_publish_time_ms = cur_time_ms;
+            write_geo_pose_topic();
+        }
+#else
         write_geo_pose_topic();
+#endif // AP_DDS_POSE_CHANGE_FILTER_ENABLED
     }
 #endif // AP_DDS_GEOPOSE_PUB_ENABLED
 #if AP_DDS_CLOCK_PUB_ENABLED
@@ -1972,6 +2042,27 @@ void AP_DDS_Client::update()
     }
 #endif // AP_DDS_STATUS_PUB_ENABLED
 
+#if AP_DDS_TX_BANDWIDTH_REPORT_ENABLED
+    if (cur_time_ms - last_tx_report_time_ms > DELAY_TX_REPORT_MS) {
+        last_tx_report_time_ms = cur_time_ms;
+        // report the total queued bytes and the busiest topic
+        uint32_t total = 0;
+        uint8_t top = 0;
+        for (uint8_t i = 0; i < ARRAY_SIZE(topic_tx_bytes); i++) {
+            total += topic_tx_bytes[i];
+            if (topic_tx_bytes[i] > topic_tx_bytes[top]) {
+                top = i;
+            }
+        }
+        GCS_SEND_TEXT(MAV_SEVERITY_INFO, "%s tx %lu B/s, top %s %lu B/s", msg_prefix,
+                      (unsigned long)(total / (DELAY_TX_REPORT_MS / 1000)),
+                      topics[top].topic_name,
+                      (unsigned long)(topic_tx_bytes[top] / (DELAY_TX_REPORT_MS / 1000)));
+        memset(topic_tx_bytes, 0, sizeof(topic_tx_bytes));
+    }
+#endif // AP_DDS_TX_BANDWIDTH_REPORT_ENABLED
+
+    // all topics prepared above go out in a single XRCE session write
     status_ok = uxr_run_session_time(&session, 1);
 }
 
@@ -135,6 +135,13 @@ private:
     //! @brief Serialize the current geo_pose and publish to the IO stream(s)
     void write_geo_pose_topic();
     static void update_topic(geographic_msgs_msg_GeoPoseStamped& msg);
+#if AP_DDS_POSE_CHANGE_FILTER_ENABLED
+    // The last GeoPose that was actually published, and when
+    geographic_msgs_msg_GeoPoseStamped last_geo_pose_msg_;
+    uint64_t last_geo_pose_publish_time_ms;
+    //! @brief Check if the pose moved more than the configured epsilons since the last publish
+    bool geo_pose_changed(const geographic_msgs_msg_GeoPoseStamped& msg) const;
+#endif // AP_DDS_POSE_CHANGE_FILTER_ENABLED
 #endif // AP_DDS_GEOPOSE_PUB_ENABLED
 
 #if AP_DDS_LOCAL_POSE_PUB_ENABLED
@@ -144,6 +151,13 @@ private:
     //! @brief Serialize the current local_pose and publish to the IO stream(s)
     void write_local_pose_topic();
     static void update_topic(geometry_msgs_msg_PoseStamped& msg);
+#if AP_DDS_POSE_CHANGE_FILTER_ENABLED
+    // The last local pose that was actually published, and when
+    geometry_msgs_msg_PoseStamped last_local_pose_msg_;
+    uint64_t last_local_pose_publish_time_ms;
+    //! @brief Check if the pose moved more than the configured epsilons since the last publish
+    bool local_pose_changed(const geometry_msgs_msg_PoseStamped& msg) const;
+#endif // AP_DDS_POSE_CHANGE_FILTER_ENABLED
 #endif // AP_DDS_LOCAL_POSE_PUB_ENABLED
 
 #if AP_DDS_LOCAL_VEL_PUB_ENABLED
@@ -74,6 +74,35 @@
 #define AP_DDS_DELAY_LOCAL_POSE_TOPIC_MS 33
 #endif
 
+// Publish the pose topics only when the vehicle has moved by more than
+// the epsilons below since the last publish, with a keepalive at 1/5th
+// of the nominal rate. Saves XRCE link bandwidth on serial transports.
+#ifndef AP_DDS_POSE_CHANGE_FILTER_ENABLED
+#define AP_DDS_POSE_CHANGE_FILTER_ENABLED 0
+#endif
+
+// local position change needed to publish, in meters
+#ifndef AP_DDS_POSE_EPSILON_POS_M
+#define AP_DDS_POSE_EPSILON_POS_M 0.01f
+#endif
+
+// orientation change needed to publish, per quaternion component
+#ifndef AP_DDS_POSE_EPSILON_QUAT
+#define AP_DDS_POSE_EPSILON_QUAT 0.001f
+#endif
+
+// global position change needed to publish, in degrees of lat/lon.
+// 1E-7 degrees is about 1.1cm
+#ifndef AP_DDS_POSE_EPSILON_LL_DEG
+#define AP_DDS_POSE_EPSILON_LL_DEG 1.0E-7
+#endif
+
+// report per-topic publish bandwidth at 0.1Hz, for tuning topic rates
+// and the change filter
+#ifndef AP_DDS_TX_BANDWIDTH_REPORT_ENABLED
+#define AP_DDS_TX_BANDWIDTH_REPORT_ENABLED 0
+#endif
+
 #ifndef AP_DDS_LOCAL_VEL_PUB_ENABLED
 #define AP_DDS_LOCAL_VEL_PUB_ENABLED 1
 #endif
@@ -179,6 +179,42 @@ void CanardInterface::onTransferReception(CanardInstance* ins, CanardRxTransfer*
     iface->handle_message(*transfer);
 }
 
+/*
+  derive hardware acceptance filters from what this node can consume:
+  all broadcast message frames plus service frames addressed to our
+  node id. Per-message-type filtering would need one filter element per
+  subscribed type, more than the hardware offers; the big win on dense
+  buses is shedding the service traffic between other nodes, which two
+  elements achieve. Re-derived when the node id changes, e.g. once
+  dynamic node allocation completes
+ */
+void CanardInterface::update_rx_filters()
+{
+    const uint8_t node_id = canardGetLocalNodeID(&canard);
+    if (node_id == filter_node_id || node_id == CANARD_BROADCAST_NODE_ID) {
+        // no id yet, or filters already match. With no id set we keep
+        // accepting everything so allocation traffic gets through
+        return;
+    }
+
+    const AP_HAL::CANIface::CanFilterConfig filters[] {
+        // broadcast message frames (service bit clear)
+        { 0, (1U<<7) },
+        // service frames with our node id as destination
+        { (1U<<7) | (uint32_t(node_id)<<8), (1U<<7) | (0x7FU<<8) },
+    };
+    bool ok = true;
+    for (uint8_t i=0; i<num_ifaces; i++) {
+        if (ifaces[i] != nullptr &&
+            !ifaces[i]->configureFilters(filters, ARRAY_SIZE(filters))) {
+            ok = false;
+        }
+    }
+    if (ok) {
+        filter_node_id = node_id;
+    }
+}
+
 bool CanardInterface::shouldAcceptTransfer(const CanardInstance* ins,
                                            uint64_t* out_data_type_signature,
                                            uint16_t data_type_id,
@@ -326,62 +362,58 @@ void CanardInterface::update_rx_protocol_stats(int16_t res)
 }
 
 void CanardInterface::processRx() {
-    AP_HAL::CANFrame rxmsg;
+    AP_HAL::CANIface::CanRxItem rx_items[8];
     for (uint8_t i=0; i<num_ifaces; i++) {
+        if (ifaces[i] == NULL) {
+            continue;
+        }
         while(true) {
-            if (ifaces[i] == NULL) {
-                break;
-            }
-            bool read_select = true;
-            bool write_select = false;
-            ifaces[i]->select(read_select, write_select, nullptr, 0);
-            if (!read_select) { // No data pending
-                break;
-            }
-            CanardCANFrame rx_frame {};
-
-            //palToggleLine(HAL_GPIO_PIN_LED);
-            uint64_t timestamp;
-            AP_HAL::CANIface::CanIOFlags flags;
-            if (ifaces[i]->receive(rxmsg, timestamp, flags) <= 0) {
+            // drain the HAL Rx queue in batches, avoiding per-frame
+            // locking on loaded buses
+            const uint8_t nframes = ifaces[i]->receive_batch(rx_items, ARRAY_SIZE(rx_items));
+            if (nframes == 0) {
                 break;
             }
+            for (uint8_t f=0; f<nframes; f++) {
+                AP_HAL::CANFrame &rxmsg = rx_items[f].frame;
 
-            if (!rxmsg.isExtended()) {
-                // 11 bit frame, see if we have a handler
-                if (aux_11bit_driver != nullptr) {
-                    aux_11bit_driver->handle_frame(rxmsg);
+                if (!rxmsg.isExtended()) {
+                    // 11 bit frame, see if we have a handler
+                    if (aux_11bit_driver != nullptr) {
+                        aux_11bit_driver->handle_frame(rxmsg);
+                    }
+                    continue;
                 }
-                continue;
-            }
 
-            rx_frame.data_len = AP_HAL::CANFrame::dlcToDataLength(rxmsg.dlc);
-            memcpy(rx_frame.data, rxmsg.data, rx_frame.data_len);
+                CanardCANFrame rx_frame {};
+                rx_frame.data_len = AP_HAL::CANFrame::dlcToDataLength(rxmsg.dlc);
+                memcpy(rx_frame.data, rxmsg.data, rx_frame.data_len);
 #if HAL_CANFD_SUPPORTED
-            rx_frame.canfd = rxmsg.canfd;
+                rx_frame.canfd = rxmsg.canfd;
 #endif
-            rx_frame.id = rxmsg.id;
+                rx_frame.id = rxmsg.id;
 #if CANARD_MULTI_IFACE
-            rx_frame.iface_id = i;
+                rx_frame.iface_id = i;
 #endif
-            {
-                WITH_SEMAPHORE(_sem_rx);
-
-                const int16_t res = canardHandleRxFrame(&canard, &rx_frame, timestamp);
-                if (res == -CANARD_ERROR_RX_MISSED_START) {
-                    // this might remaining frames from a message that we don't accept, so check
-                    uint64_t dummy_signature;
-                    if (shouldAcceptTransfer(&canard,
-                                        &dummy_signature,
-                                        extractDataType(rx_frame.id),
-                                        extractTransferType(rx_frame.id),
-                                        1)) { // doesn't matter what we pass here
-                        update_rx_protocol_stats(res);
+                {
+                    WITH_SEMAPHORE(_sem_rx);
+
+                    const int16_t res = canardHandleRxFrame(&canard, &rx_frame, rx_items[f].timestamp_us);
+                    if (res == -CANARD_ERROR_RX_MISSED_START) {
+                        // this might remaining frames from a message that we don't accept, so check
+                        uint64_t dummy_signature;
+                        if (shouldAcceptTransfer(&canard,
+                                            &dummy_signature,
+                                            extractDataType(rx_frame.id),
+                                            extractTransferType(rx_frame.id),
+                                            1)) { // doesn't matter what we pass here
+                            update_rx_protocol_stats(res);
+                        } else {
+                            protocol_stats.rx_ignored_not_wanted++;
+                        }
                     } else {
-                        protocol_stats.rx_ignored_not_wanted++;
+                        update_rx_protocol_stats(res);
                     }
-                } else {
-                    update_rx_protocol_stats(res);
                 }
             }
         }
@@ -63,6 +63,10 @@ public:
 
     void update_rx_protocol_stats(int16_t res);
 
+    // derive hardware acceptance filters from what this node consumes,
+    // re-deriving when the node id changes
+    void update_rx_filters();
+
     uint8_t get_node_id() const override { return canard.node_id; }
 
     // get reference to the semaphore that is held during message receive
@@ -85,5 +89,8 @@ private:
 
     // auxillary 11 bit CANSensor
     CANSensor *aux_11bit_driver;
+
+    // node id the hardware acceptance filters were last derived for
+    uint8_t filter_node_id;
 };
 #endif // HAL_ENABLE_DRONECAN_DRIVERS
@@ -127,7 +127,7 @@ const AP_Param::GroupInfo AP_DroneCAN::var_info[] = {
     // @Param: OPTION
     // @DisplayName: DroneCAN options
     // @Description: Option flags
-    // @Bitmask: 0:ClearDNADatabase,1:IgnoreDNANodeConflicts,2:EnableCanfd,3:IgnoreDNANodeUnhealthy,4:SendServoAsPWM,5:SendGNSS,6:UseHimarkServo,7:HobbyWingESC,8:EnableStats,9:EnableFlexDebug,10:SecondaryAllowExtendedFrames
+    // @Bitmask: 0:ClearDNADatabase,1:IgnoreDNANodeConflicts,2:EnableCanfd,3:IgnoreDNANodeUnhealthy,4:SendServoAsPWM,5:SendGNSS,6:UseHimarkServo,7:HobbyWingESC,8:EnableStats,9:EnableFlexDebug,10:SecondaryAllowExtendedFrames,11:UseHardwareRxFilters
     // @User: Advanced
     AP_GROUPINFO("OPTION", 5, AP_DroneCAN, _options, 0),
     
@@ -160,6 +160,14 @@ const AP_Param::GroupInfo AP_DroneCAN::var_info[] = {
     // @User: Advanced
     AP_GROUPINFO("ESC_RV", 9, AP_DroneCAN, _esc_rv, 0),
 
+    // @Param: ESC_KAL
+    // @DisplayName: ESC command keepalive time
+    // @Description: When non-zero, ESC RawCommand messages whose commands are unchanged since the last send are suppressed and only re-sent at this interval, reducing bus load when outputs are static. Zero sends commands at the full servo push rate.
+    // @Range: 0 1000
+    // @Units: ms
+    // @User: Advanced
+    AP_GROUPINFO("ESC_KAL", 24, AP_DroneCAN, _esc_keepalive_ms, 0),
+
 #if AP_RELAY_DRONECAN_ENABLED
     // @Param: RLY_RT
     // @DisplayName: DroneCAN relay output rate
@@ -522,6 +530,13 @@ void AP_DroneCAN::loop(void)
 
         canard_iface.process(1);
 
+        if (option_is_set(Options::USE_HW_FILTERS)) {
+            // note that hardware filtering also drops the other nodes'
+            // traffic for any registered frame forwarding callbacks,
+            // which is why it is opt-in
+            canard_iface.update_rx_filters();
+        }
+
         safety_state_send();
         notify_state_send();
         check_parameter_callback_timeout();
@@ -851,8 +866,20 @@ void AP_DroneCAN::SRV_send_esc(void)
         }
         esc_msg.cmd.len = k;
 
-        if (esc_raw.broadcast(esc_msg)) {
+        // with ESC_KAL set, identical commands are suppressed until
+        // the keepalive interval expires, saving bus bandwidth when
+        // outputs are static
+        const uint32_t now_ms = AP_HAL::millis();
+        if (_esc_keepalive_ms > 0 &&
+            k == _esc_last_cmd_len &&
+            memcmp(esc_msg.cmd.data, _esc_last_cmd, k * sizeof(esc_msg.cmd.data[0])) == 0 &&
+            now_ms - _esc_last_send_ms < uint32_t(_esc_keepalive_ms.get())) {
+            // unchanged within the keepalive window
+        } else if (esc_raw.broadcast(esc_msg)) {
             _esc_send_count++;
+            memcpy(_esc_last_cmd, esc_msg.cmd.data, k * sizeof(esc_msg.cmd.data[0]));
+            _esc_last_cmd_len = k;
+            _esc_last_send_ms = now_ms;
         } else {
             _fail_send_count++;
         }
@@ -904,8 +931,20 @@ void AP_DroneCAN::SRV_send_esc_hobbywing(void)
         }
         esc_msg.command.len = k;
 
-        if (esc_hobbywing_raw.broadcast(esc_msg)) {
+        // with ESC_KAL set, identical commands are suppressed until
+        // the keepalive interval expires, saving bus bandwidth when
+        // outputs are static
+        const uint32_t now_ms = AP_HAL::millis();
+        if (_esc_keepalive_ms > 0 &&
+            k == _esc_last_cmd_len &&
+            memcmp(esc_msg.command.data, _esc_last_cmd, k * sizeof(esc_msg.command.data[0])) == 0 &&
+            now_ms - _esc_last_send_ms < uint32_t(_esc_keepalive_ms.get())) {
+            // unchanged within the keepalive window
+        } else if (esc_hobbywing_raw.broadcast(esc_msg)) {
             _esc_send_count++;
+            memcpy(_esc_last_cmd, esc_msg.command.data, k * sizeof(esc_msg.command.data[0]));
+            _esc_last_cmd_len = k;
+            _esc_last_send_ms = now_ms;
         } else {
             _fail_send_count++;
         }
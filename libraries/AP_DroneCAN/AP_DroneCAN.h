@@ -152,6 +152,7 @@ public:
         ENABLE_STATS              = (1U<<8),
         ENABLE_FLEX_DEBUG         = (1U<<9),
         ALLOW_EXTENDED_AUX        = (1U<<10),
+        USE_HW_FILTERS            = (1U<<11),
     };
 
     // check if a option is set
@@ -242,6 +243,7 @@ private:
     AP_Int16 _notify_state_hz;
     AP_Int16 _pool_size;
     AP_Int32 _esc_rv;
+    AP_Int16 _esc_keepalive_ms;
 
     uint32_t *mem_pool;
 
@@ -264,6 +266,12 @@ private:
     uint32_t _srv_send_count;
     uint32_t _fail_send_count;
 
+    // last ESC commands sent, for ESC_KAL change detection. RawCommand
+    // carries at most 20 commands
+    int16_t _esc_last_cmd[20];
+    uint8_t _esc_last_cmd_len;
+    uint32_t _esc_last_send_ms;
+
     uint32_t _SRV_armed_mask; // mask of servo outputs that are active
     uint32_t _ESC_armed_mask; // mask of ESC outputs that are active
     uint32_t _SRV_last_send_us;
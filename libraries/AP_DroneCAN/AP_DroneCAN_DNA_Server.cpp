@@ -404,6 +404,29 @@ void AP_DroneCAN_DNA_Server::update_node_status(const uint8_t source_node_id, co
 }
 #endif // HAL_LOGGING_ENABLED
 
+/*
+  surface firmware update progress to the GCS. While a node's
+  bootloader is flashing it reports 1 plus the number of kbytes
+  written in vendor_specific_status_code, which is otherwise only
+  visible in the CANH log message
+ */
+void AP_DroneCAN_DNA_Server::report_update_progress(const uint8_t node_id, const uavcan_protocol_NodeStatus &msg)
+{
+    const uint32_t now_ms = AP_HAL::millis();
+    if (node_id == update_progress.node_id &&
+        now_ms - update_progress.last_ms < 5000) {
+        return;
+    }
+    update_progress.node_id = node_id;
+    update_progress.last_ms = now_ms;
+    if (msg.vendor_specific_status_code < 1) {
+        return;
+    }
+    GCS_SEND_TEXT(MAV_SEVERITY_INFO, "DroneCAN: updating node %u: %ukB",
+                  unsigned(node_id),
+                  unsigned(msg.vendor_specific_status_code - 1));
+}
+
 /* Handles Node Status Message, adds to the Seen Node list
 Also starts the Service call for Node Info to complete the
 Verification process. */
@@ -433,6 +456,10 @@ void AP_DroneCAN_DNA_Server::handleNodeStatus(const CanardRxTransfer& transfer,
     //Add node to seen list if not seen before
     node_seen.set(transfer.source_node_id);
 
+    if (msg.mode == UAVCAN_PROTOCOL_NODESTATUS_MODE_SOFTWARE_UPDATE) {
+        report_update_progress(transfer.source_node_id, msg);
+    }
+
 #if HAL_LOGGING_ENABLED
     // Update status data for logging
     update_node_status(transfer.source_node_id, msg);
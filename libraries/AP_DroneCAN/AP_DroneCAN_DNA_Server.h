@@ -120,6 +120,13 @@ class AP_DroneCAN_DNA_Server
     uint8_t fault_node_id;
     char fault_node_name[15];
 
+    // throttle for firmware update progress reports sent to the GCS
+    struct {
+        uint8_t node_id;
+        uint32_t last_ms;
+    } update_progress;
+    void report_update_progress(uint8_t node_id, const uavcan_protocol_NodeStatus &msg);
+
 
     // dynamic node ID allocation state variables
     uint8_t rcvd_unique_id[16];
@@ -180,8 +180,10 @@ bool AP_ESC_Telem::is_telemetry_active(uint32_t servo_channel_mask) const
     return true;
 }
 
-// get an individual ESC's slewed rpm if available, returns true on success
-bool AP_ESC_Telem::get_rpm(uint8_t esc_index, float& rpm) const
+// take a consistent copy of an ESC's RPM data without locking. update_rpm()
+// leaves the sequence odd while writing, so a stable even sequence across the
+// copy means none of the fields were torn by the ingestion thread
+bool AP_ESC_Telem::get_rpm_snapshot(uint8_t esc_index, AP_ESC_Telem_Backend::RpmData &data) const
 {
     if (esc_index >= ESC_TELEM_MAX_ESCS) {
         return false;
@@ -189,6 +191,29 @@ bool AP_ESC_Telem::get_rpm(uint8_t esc_index, float& rpm) const
 
     const volatile AP_ESC_Telem_Backend::RpmData& rpmdata = _rpm_data[esc_index];
 
+    uint32_t seq;
+    do {
+        seq = rpmdata.seq;
+        data.rpm = rpmdata.rpm;
+        data.prev_rpm = rpmdata.prev_rpm;
+        data.error_rate = rpmdata.error_rate;
+        data.last_update_us = rpmdata.last_update_us;
+        data.update_rate_hz = rpmdata.update_rate_hz;
+        data.data_valid = rpmdata.data_valid;
+    } while ((seq & 1U) != 0 || seq != rpmdata.seq);
+    data.seq = seq;
+
+    return true;
+}
+
+// get an individual ESC's slewed rpm if available, returns true on success
+bool AP_ESC_Telem::get_rpm(uint8_t esc_index, float& rpm) const
+{
+    AP_ESC_Telem_Backend::RpmData rpmdata;
+    if (!get_rpm_snapshot(esc_index, rpmdata)) {
+        return false;
+    }
+
     if (is_zero(rpmdata.update_rate_hz)) {
         return false;
     }
@@ -212,12 +237,11 @@ bool AP_ESC_Telem::get_rpm(uint8_t esc_index, float& rpm) const
 // get an individual ESC's raw rpm if available, returns true on success
 bool AP_ESC_Telem::get_raw_rpm_and_error_rate(uint8_t esc_index, float& rpm, float& error_rate) const
 {
-    if (esc_index >= ESC_TELEM_MAX_ESCS) {
+    AP_ESC_Telem_Backend::RpmData rpmdata;
+    if (!get_rpm_snapshot(esc_index, rpmdata)) {
         return false;
     }
 
-    const volatile AP_ESC_Telem_Backend::RpmData& rpmdata = _rpm_data[esc_index];
-
     if (!rpmdata.data_valid) {
         return false;
     }
@@ -599,12 +623,17 @@ void AP_ESC_Telem::update_rpm(const uint8_t esc_index, const float new_rpm, cons
     volatile AP_ESC_Telem_Backend::RpmData& rpmdata = _rpm_data[esc_index];
     const auto last_update_us = rpmdata.last_update_us;
 
+    // the sequence is odd while the update is in progress, allowing
+    // readers to take a consistent copy without locking by re-reading
+    // until they see a stable even value
+    rpmdata.seq++;
     rpmdata.prev_rpm = rpmdata.rpm;
     rpmdata.rpm = new_rpm;
-    rpmdata.update_rate_hz = 1.0e6f / constrain_uint32((now - last_update_us), 100, 1000000U*10U); // limit the update rate 0.1Hz to 10KHz 
+    rpmdata.update_rate_hz = 1.0e6f / constrain_uint32((now - last_update_us), 100, 1000000U*10U); // limit the update rate 0.1Hz to 10KHz
     rpmdata.last_update_us = now;
     rpmdata.error_rate = error_rate;
     rpmdata.data_valid = true;
+    rpmdata.seq++;
 
 #ifdef ESC_TELEM_DEBUG
     hal.console->printf("RPM: rate=%.1fhz, rpm=%f)\n", rpmdata.update_rate_hz, new_rpm);
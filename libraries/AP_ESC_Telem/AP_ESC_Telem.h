@@ -31,6 +31,10 @@ public:
     // get an individual ESC's slewed rpm if available, returns true on success
     bool get_rpm(uint8_t esc_index, float& rpm) const;
 
+    // take a lock-free consistent copy of an ESC's RPM data, for callers
+    // such as the harmonic notch update that run at high rate
+    bool get_rpm_snapshot(uint8_t esc_index, AP_ESC_Telem_Backend::RpmData &data) const;
+
     // get an individual ESC's raw rpm and error rate if available
     bool get_raw_rpm_and_error_rate(uint8_t esc_index, float& rpm, float& error_rate) const;
 
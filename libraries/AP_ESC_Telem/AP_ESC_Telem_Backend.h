@@ -46,6 +46,7 @@ public:
         float    error_rate;        // error rate in percent
         uint32_t last_update_us;    // last update time, greater then 0 means we've gotten data at some point
         float    update_rate_hz;
+        uint32_t seq;               // update sequence, odd while an update is in progress
         bool     data_valid;        // if this isn't set to true, then the ESC data should be ignored
     };
 
@@ -444,6 +444,11 @@ void AP_FETtecOneWire::handle_message_telem(ESC &esc)
           TelemetryType::CONSUMPTION);
 
     esc.last_telem_us = AP_HAL::micros();
+
+    // per-ESC request-to-reply latency statistics, smoothed with a 1/8 gain
+    const uint32_t latency_us = esc.last_telem_us - esc.telem_request_us;
+    esc.telem_max_latency_us = MAX(esc.telem_max_latency_us, latency_us);
+    esc.telem_avg_latency_us += (int32_t(latency_us) - int32_t(esc.telem_avg_latency_us)) / 8;
 }
 #endif  // HAL_WITH_ESC_TELEM
 
@@ -616,6 +621,11 @@ void AP_FETtecOneWire::escs_set_values(const uint16_t* motor_values)
     // send throttle commands to all configured ESCs in a single packet transfer
     if (transmit(fast_throttle_command, sizeof(fast_throttle_command))) {
 #if HAL_WITH_ESC_TELEM
+        if (esc_to_req_telem_from.telem_expected) {
+            // the previous request to this ESC never got a reply
+            esc_to_req_telem_from.telem_missed++;
+        }
+        esc_to_req_telem_from.telem_request_us = AP_HAL::micros();
         esc_to_req_telem_from.telem_expected = true;    // used to make sure that the returned telemetry comes from this ESC and not another
         esc_to_req_telem_from.telem_requested = true;   // used to check if this ESC is periodically sending telemetry
         _fast_throttle_cmd_count++;
@@ -790,6 +800,7 @@ void AP_FETtecOneWire::update()
             }
             _running_mask &= ~(1U << esc.servo_ofs);
             GCS_SEND_TEXT(MAV_SEVERITY_WARNING, "No telem from esc id=%u. Resetting it.", esc.id);
+            GCS_SEND_TEXT(MAV_SEVERITY_DEBUG, "esc id=%u missed=%u avg=%uus max=%uus", esc.id, esc.telem_missed, unsigned(esc.telem_avg_latency_us), unsigned(esc.telem_max_latency_us));
             //GCS_SEND_TEXT(MAV_SEVERITY_WARNING, "unknown %u, invalid %u, too short %u, unexpected: %u, crc_err %u", _unknown_esc_message, _message_invalid_in_state_count, _period_too_short, esc.unexpected_telem, crc_rec_err_cnt);
             esc.set_state(ESCState::WANT_SEND_OK_TO_GET_RUNNING_SW_TYPE);
             esc.telem_requested = false;
@@ -168,6 +168,10 @@ private:
 
 #if HAL_WITH_ESC_TELEM
         uint32_t last_telem_us;              ///< last time we got telemetry from this ESC
+        uint32_t telem_request_us;           ///< time the last telemetry request for this ESC was sent
+        uint32_t telem_avg_latency_us;       ///< smoothed request-to-reply latency
+        uint32_t telem_max_latency_us;       ///< worst request-to-reply latency seen
+        uint16_t telem_missed;               ///< requests that got no reply before the next request
         uint16_t unexpected_telem;
         uint16_t error_count_at_throttle_count_overflow;            ///< overflow counter for error counter from the ESCs.
         bool telem_expected;                 ///< this ESC is fully configured and is now expected to send us telemetry
@@ -294,6 +294,13 @@ uint32_t AP_Filesystem::bytes_until_fsync(int fd)
     return backend.fs.bytes_until_fsync(fd);
 }
 
+// hint that size bytes beyond the current file position will be written soon
+bool AP_Filesystem::allocate_ahead(int fd, uint32_t size)
+{
+    const Backend &backend = backend_by_fd(fd);
+    return backend.fs.allocate_ahead(fd, size);
+}
+
 // return free disk space in bytes
 int64_t AP_Filesystem::disk_free(const char *path)
 {
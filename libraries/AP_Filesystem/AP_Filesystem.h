@@ -114,6 +114,11 @@ public:
     // streaming performance/robustness. if zero, any number can be written.
     uint32_t bytes_until_fsync(int fd);
 
+    // hint that size bytes beyond the current file position will be
+    // written soon. Returns false if the backend does not support
+    // preallocation
+    bool allocate_ahead(int fd, uint32_t size);
+
     // return free disk space in bytes, -1 on error
     int64_t disk_free(const char *path);
 
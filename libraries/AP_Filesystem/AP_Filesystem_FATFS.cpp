@@ -42,6 +42,21 @@ static HAL_Semaphore sem;
 typedef struct {
     FIL fobj; // should be first member; it's the most used
     char *name;
+    // highest position written, used to trim any allocate_ahead()
+    // expansion back to real data on close
+    FSIZE_t write_hwm;
+    bool alloc_ahead;
+#if AP_FATFS_CACHE_BLOCK_SIZE > 0
+    // read-ahead cache, filled one block at a time once a sequential
+    // read pattern is seen. Invalidated by any write to the file
+    uint8_t *cache_data;
+    FSIZE_t cache_ofs;
+    uint32_t cache_len;
+    // where the last read finished, for sequential pattern detection
+    FSIZE_t last_read_end;
+    uint32_t cache_hits;
+    uint32_t cache_misses;
+#endif
 } FAT_FILE;
 
 #define MAX_FILES 16
@@ -99,6 +114,11 @@ static void free_file_descriptor(int fileno)
     FAT_FILE *stream = fileno_to_stream(fileno);
     if (stream != nullptr) {
         file_table[fileno] = NULL;
+#if AP_FATFS_CACHE_BLOCK_SIZE > 0
+        if (stream->cache_data != nullptr) {
+            hal.util->free_type(stream->cache_data, AP_FATFS_CACHE_BLOCK_SIZE, AP_HAL::Util::MEM_DMA_SAFE);
+        }
+#endif
         free(stream->name);
         free(stream);
     }
@@ -302,10 +322,21 @@ int AP_Filesystem_FATFS::close(int fileno)
 
     errno = 0;
 
-    fh = fileno_to_fatfs(fileno);
-    if (fh == nullptr) { // unknown fileno?
+    FAT_FILE *stream = fileno_to_stream(fileno);
+    if (stream == nullptr) { // unknown fileno?
         return -1; // errno already set
     }
+    fh = &stream->fobj;
+#if AP_FATFS_CACHE_BLOCK_SIZE > 0
+    debug("close %s cache hits=%u misses=%u", stream->name,
+          unsigned(stream->cache_hits), unsigned(stream->cache_misses));
+#endif
+    if (stream->alloc_ahead) {
+        // trim the preallocated tail back to the data actually written
+        if (f_lseek(fh, stream->write_hwm) == FR_OK) {
+            f_truncate(fh);
+        }
+    }
     res = f_close(fh);
     free_file_descriptor(fileno);
     if (res != FR_OK) {
@@ -332,10 +363,60 @@ int32_t AP_Filesystem_FATFS::read(int fd, void *buf, uint32_t count)
 
     errno = 0;
 
-    fh = fileno_to_fatfs(fd);
-    if (fh == nullptr) { // unknown fd?
+    FAT_FILE *stream = fileno_to_stream(fd);
+    if (stream == nullptr) { // unknown fd?
         return -1; // errno already set
     }
+    fh = &stream->fobj;
+
+#if AP_FATFS_CACHE_BLOCK_SIZE > 0
+    const FSIZE_t read_ofs = fh->fptr;
+    if (count > 0 &&
+        stream->cache_len > 0 &&
+        read_ofs >= stream->cache_ofs &&
+        read_ofs + count <= stream->cache_ofs + stream->cache_len) {
+        // serve entirely from the read-ahead cache, keeping the FatFs
+        // file position consistent for any later uncached access
+        memcpy(buf, &stream->cache_data[read_ofs - stream->cache_ofs], count);
+        res = f_lseek(fh, read_ofs + count);
+        if (res != FR_OK) {
+            errno = fatfs_to_errno((FRESULT)res);
+            return -1;
+        }
+        stream->cache_hits++;
+        stream->last_read_end = read_ofs + count;
+        return (ssize_t)count;
+    }
+    stream->cache_misses++;
+    if (count > 0 && count < AP_FATFS_CACHE_BLOCK_SIZE &&
+        read_ofs == stream->last_read_end) {
+        // second or later read of a sequential pattern; read a whole
+        // block ahead so the following reads avoid the SD card
+        if (stream->cache_data == nullptr) {
+            stream->cache_data = (uint8_t *)hal.util->malloc_type(AP_FATFS_CACHE_BLOCK_SIZE, AP_HAL::Util::MEM_DMA_SAFE);
+        }
+        if (stream->cache_data != nullptr) {
+            UINT n = 0;
+            if (f_read(fh, stream->cache_data, AP_FATFS_CACHE_BLOCK_SIZE, &n) == FR_OK && n >= count) {
+                stream->cache_ofs = read_ofs;
+                stream->cache_len = n;
+                memcpy(buf, stream->cache_data, count);
+                res = f_lseek(fh, read_ofs + count);
+                if (res != FR_OK) {
+                    stream->cache_len = 0;
+                    errno = fatfs_to_errno((FRESULT)res);
+                    return -1;
+                }
+                stream->last_read_end = read_ofs + count;
+                return (ssize_t)count;
+            }
+            // short file or read error; restore the position and fall
+            // back to the normal path
+            stream->cache_len = 0;
+            f_lseek(fh, read_ofs);
+        }
+    }
+#endif
 
     UINT total = 0;
     do {
@@ -363,6 +444,9 @@ int32_t AP_Filesystem_FATFS::read(int fd, void *buf, uint32_t count)
             break;
         }
     } while (bytes > 0);
+#if AP_FATFS_CACHE_BLOCK_SIZE > 0
+    stream->last_read_end = fh->fptr;
+#endif
     return (ssize_t)total;
 }
 
@@ -413,6 +497,18 @@ int32_t AP_Filesystem_FATFS::write(int fd, const void *buf, uint32_t count)
             break;
         }
     } while (bytes > 0);
+
+    FAT_FILE *stream = fileno_to_stream(fd);
+    if (stream != nullptr) {
+        if (fh->fptr > stream->write_hwm) {
+            stream->write_hwm = fh->fptr;
+        }
+#if AP_FATFS_CACHE_BLOCK_SIZE > 0
+        // the cached data may now be stale
+        stream->cache_len = 0;
+        stream->last_read_end = 0;
+#endif
+    }
     return (ssize_t)total;
 }
 
@@ -706,6 +802,40 @@ uint32_t AP_Filesystem_FATFS::bytes_until_fsync(int fd)
     return block_size - block_pos;
 }
 
+/*
+  pre-extend the cluster chain size bytes beyond the current file
+  position so sequential writes do not stall on FAT allocation while
+  the card garbage collects. FatFs expands a file on a seek past the
+  end in write mode; the expanded tail is undefined data, so close()
+  trims the file back to the write high-water mark
+ */
+bool AP_Filesystem_FATFS::allocate_ahead(int fd, uint32_t size)
+{
+    FS_CHECK_ALLOWED(false);
+    WITH_SEMAPHORE(sem);
+
+    FAT_FILE *stream = fileno_to_stream(fd);
+    if (stream == nullptr) { // unknown fd?
+        return false;
+    }
+    FIL *fh = &stream->fobj;
+    const FSIZE_t pos = fh->fptr;
+    if (pos > stream->write_hwm) {
+        // never truncate away data that existed before preallocation
+        stream->write_hwm = pos;
+    }
+    if (f_size(fh) >= pos + size) {
+        // already extended this far
+        return true;
+    }
+    if (f_lseek(fh, pos + size) != FR_OK ||
+        f_lseek(fh, pos) != FR_OK) {
+        return false;
+    }
+    stream->alloc_ahead = true;
+    return true;
+}
+
 // return free disk space in bytes
 int64_t AP_Filesystem_FATFS::disk_free(const char *path)
 {
@@ -38,6 +38,9 @@ public:
 
     uint32_t bytes_until_fsync(int fd) override;
 
+    // pre-extend the cluster chain ahead of the current file position
+    bool allocate_ahead(int fd, uint32_t size) override;
+
     // return free disk space in bytes, -1 on error
     int64_t disk_free(const char *path) override;
 
@@ -63,6 +63,7 @@ int AP_Filesystem_Param::open(const char *fname, int flags, bool allow_absolute_
     r.file_ofs = 0;
     r.open = true;
     r.with_defaults = false;
+    r.nondefault = false;
     r.start = 0;
     r.count = 0;
     r.read_size = 0;
@@ -79,7 +80,8 @@ int AP_Filesystem_Param::open(const char *fname, int flags, bool allow_absolute_
     }
 
     /*
-      allow for URI style arguments param.pck?start=N&count=C
+      allow for URI style arguments param.pck?start=N&count=C and
+      param.pck?nondefault=1 for a changed-only snapshot
      */
     const char *c = strchr(fname, '?');
     while (c && *c) {
@@ -115,9 +117,25 @@ int AP_Filesystem_Param::open(const char *fname, int flags, bool allow_absolute_
             c = strchr(c, '&');
             continue;
         }
+        if (strncmp(c, "nondefault=", 11) == 0) {
+            uint32_t v = strtoul(c+11, nullptr, 10);
+            if (v > 1) {
+                goto failed;
+            }
+            r.nondefault = v == 1;
+            c += 11;
+            c = strchr(c, '&');
+            continue;
+        }
 #endif
     }
 
+    if (r.nondefault && (r.start != 0 || r.count != 0)) {
+        // a changed-only snapshot has no stable parameter indexes, so
+        // ranged fetches make no sense
+        goto failed;
+    }
+
     return idx;
 
 failed:
@@ -191,8 +209,16 @@ uint8_t AP_Filesystem_Param::pack_param(const struct rfile &r, struct cursor &c,
         c.idx++;
         ap = AP_Param::next_scalar(&c.token, &ptype, &default_val);
     }
+#if AP_PARAM_DEFAULTS_ENABLED
+    if (r.nondefault) {
+        // changed-only snapshot: skip parameters still at their default
+        while (ap != nullptr && is_equal(ap->cast_to_float(ptype), default_val)) {
+            ap = AP_Param::next_scalar(&c.token, &ptype, &default_val);
+        }
+    }
+#endif
     if (ap == nullptr || (r.count && c.idx >= r.count)) {
-        if (r.count == 0 && c.idx != AP_Param::count_parameters()) {
+        if (r.count == 0 && !r.nondefault && c.idx != AP_Param::count_parameters()) {
             // the parameter count is incorrect, invalidate so a
             // repeated param download avoids an error
             AP_Param::invalidate_count();
@@ -280,6 +306,28 @@ uint8_t AP_Filesystem_Param::pack_param(const struct rfile &r, struct cursor &c,
     return packed_len;
 }
 
+#if AP_PARAM_DEFAULTS_ENABLED
+/*
+  number of parameters that differ from their default, for the header
+  of a nondefault=1 snapshot
+ */
+uint16_t AP_Filesystem_Param::count_nondefault(void)
+{
+    uint16_t ret = 0;
+    AP_Param::ParamToken token {};
+    enum ap_var_type ptype;
+    float default_val;
+    for (AP_Param *ap = AP_Param::first(&token, &ptype, &default_val);
+         ap != nullptr;
+         ap = AP_Param::next_scalar(&token, &ptype, &default_val)) {
+        if (!is_equal(ap->cast_to_float(ptype), default_val)) {
+            ret++;
+        }
+    }
+    return ret;
+}
+#endif
+
 /*
   seek the token to match file offset
  */
@@ -368,6 +416,14 @@ int32_t AP_Filesystem_Param::read(int fd, void *buf, uint32_t count)
         if (r.count > 0 && hdr.num_params > r.count) {
             hdr.num_params = r.count;
         }
+#if AP_PARAM_DEFAULTS_ENABLED
+        if (r.nondefault) {
+            // only the changed parameters appear in the file;
+            // total_params still reports the full set so the reader
+            // can tell this is a partial snapshot
+            hdr.num_params = count_nondefault();
+        }
+#endif
         uint8_t n = MIN(sizeof(hdr) - r.file_ofs, count);
         if (r.with_defaults) {
             hdr.magic = pmagic_with_default;
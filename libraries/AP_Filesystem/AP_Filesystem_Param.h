@@ -69,6 +69,7 @@ private:
     struct rfile {
         bool open;
         bool with_defaults;
+        bool nondefault;
         uint16_t read_size;
         uint16_t start;
         uint16_t count;
@@ -79,6 +80,9 @@ private:
     } file[max_open_file];
 
     bool token_seek(const struct rfile &r, const uint32_t data_ofs, struct cursor &c);
+#if AP_PARAM_DEFAULTS_ENABLED
+    static uint16_t count_nondefault(void);
+#endif
     uint8_t pack_param(const struct rfile &r, struct cursor &c, uint8_t *buf);
     bool check_file_name(const char *fname);
 
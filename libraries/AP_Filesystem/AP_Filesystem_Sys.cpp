@@ -26,6 +26,21 @@
 #include <AP_CANManager/AP_CANManager.h>
 #include <AP_Scheduler/AP_Scheduler.h>
 #include <AP_Common/ExpandingString.h>
+#include <AP_NavEKF3/AP_NavEKF3_feature.h>
+#include <GCS_MAVLink/GCS.h>
+#include <AP_ROMFS/AP_ROMFS.h>
+#include <AP_Common/AP_PoolAllocator.h>
+#include <AP_Scripting/AP_Scripting_config.h>
+#if AP_SCRIPTING_ENABLED
+#include <AP_Scripting/lua_scripts.h>
+#endif
+#include <AP_Vehicle/AP_Vehicle_config.h>
+#if AP_BOOT_TIMING_ENABLED
+#include <AP_Vehicle/AP_Vehicle.h>
+#endif
+#if EK3_FEATURE_FUSION_TIMING
+#include <AP_AHRS/AP_AHRS_NavEKF3.h>
+#endif
 
 extern const AP_HAL::HAL& hal;
 
@@ -40,6 +55,20 @@ static const SysFileList sysfs_file_list[] = {
     {"memory.txt"},
     {"uarts.txt"},
     {"timers.txt"},
+#if AP_BOOT_TIMING_ENABLED
+    {"boot.txt"},
+#endif
+    {"adc.txt"},
+    {"i2c.txt"},
+#if HAL_GCS_ENABLED
+    {"routes.txt"},
+#endif
+#if AP_MAVLINK_SIGNING_ENABLED
+    {"signing.txt"},
+#endif
+#if AP_SCRIPTING_ENABLED
+    {"scripts.txt"},
+#endif
 #if HAL_NUM_CAN_IFACES > 0
     {"can0_stats.txt"},
     {"can1_stats.txt"},
@@ -49,6 +78,9 @@ static const SysFileList sysfs_file_list[] = {
 #endif
     {"crash_dump.bin"},
     {"storage.bin"},
+#if EK3_FEATURE_FUSION_TIMING
+    {"ekf3_timing.txt"},
+#endif
 #if AP_FILESYSTEM_SYS_FLASH_ENABLED
     {"flash.bin"},
 #endif
@@ -80,7 +112,9 @@ int AP_Filesystem_Sys::open(const char *fname, int flags, bool allow_absolute_pa
         return -1;
     }
     struct rfile &r = file[idx];
-    r.str = NEW_NOTHROW ExpandingString;
+    // chunked storage avoids the repeated realloc-and-copy of a plain
+    // ExpandingString while a large page is built mid-flight
+    r.str = NEW_NOTHROW ChunkedExpandingString;
     if (r.str == nullptr) {
         errno = ENOMEM;
         return -1;
@@ -108,6 +142,10 @@ int AP_Filesystem_Sys::open(const char *fname, int flags, bool allow_absolute_pa
     }
     if (strcmp(fname, "memory.txt") == 0) {
         hal.util->mem_info(*r.str);
+#if AP_ROMFS_CACHE_ENABLED
+        AP_ROMFS::cache_info(*r.str);
+#endif
+        AP_PoolAllocator::pool_info(*r.str);
     }
 #if HAL_UART_STATS_ENABLED
     if (strcmp(fname, "uarts.txt") == 0) {
@@ -117,6 +155,40 @@ int AP_Filesystem_Sys::open(const char *fname, int flags, bool allow_absolute_pa
     if (strcmp(fname, "timers.txt") == 0) {
         hal.util->timer_info(*r.str);
     }
+#if AP_BOOT_TIMING_ENABLED
+    if (strcmp(fname, "boot.txt") == 0) {
+        AP_Vehicle *vehicle = AP_Vehicle::get_singleton();
+        if (vehicle != nullptr) {
+            vehicle->boot_info(*r.str);
+        }
+    }
+#endif
+    if (strcmp(fname, "adc.txt") == 0) {
+        hal.util->adc_info(*r.str);
+    }
+    if (strcmp(fname, "i2c.txt") == 0) {
+        hal.i2c_mgr->bus_info(*r.str);
+    }
+#if HAL_GCS_ENABLED
+    if (strcmp(fname, "routes.txt") == 0) {
+        GCS_MAVLINK::routing_info(*r.str);
+    }
+#endif
+#if AP_MAVLINK_SIGNING_ENABLED
+    if (strcmp(fname, "signing.txt") == 0) {
+        GCS_MAVLINK::signing_info(*r.str);
+    }
+#endif
+#if AP_SCRIPTING_ENABLED
+    if (strcmp(fname, "scripts.txt") == 0) {
+        lua_scripts::alloc_info(*r.str);
+    }
+#endif
+#if EK3_FEATURE_FUSION_TIMING
+    if (strcmp(fname, "ekf3_timing.txt") == 0) {
+        AP_AHRS_NavEKF3::EKF3.fusion_timing_info(*r.str);
+    }
+#endif
 #if HAL_NUM_CAN_IFACES > 0
     int8_t can_stats_num = -1;
     if (strcmp(fname, "can0_stats.txt") == 0) {
@@ -186,8 +258,7 @@ int32_t AP_Filesystem_Sys::read(int fd, void *buf, uint32_t count)
         return -1;
     }
     struct rfile &r = file[fd];
-    count = MIN(count, r.str->get_length() - r.file_ofs);
-    memcpy(buf, &r.str->get_string()[r.file_ofs], count);
+    count = r.str->copy_bytes(r.file_ofs, (char *)buf, count);
 
     r.file_ofs += count;
     return count;
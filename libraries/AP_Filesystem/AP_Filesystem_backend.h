@@ -63,6 +63,13 @@ public:
     // streaming performance/robustness. if zero, any number can be written.
     virtual uint32_t bytes_until_fsync(int fd) { return 0; }
 
+    // hint that size bytes beyond the current file position will be
+    // written soon, allowing the backend to pre-extend the file so
+    // sequential writes do not stall on block allocation. Any unused
+    // pre-extension is trimmed on close. Returns false if the backend
+    // does not support preallocation
+    virtual bool allocate_ahead(int fd, uint32_t size) { return false; }
+
     // return free disk space in bytes, -1 on error
     virtual int64_t disk_free(const char *path) { return 0; }
 
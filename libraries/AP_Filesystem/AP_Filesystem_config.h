@@ -81,3 +81,11 @@
 #ifndef AP_FATFS_MIN_IO_SIZE
 #define AP_FATFS_MIN_IO_SIZE 4096
 #endif
+
+// per-file read-ahead cache block size for the FATFS backend. Short
+// sequential reads (terrain tiles, Lua loads) are served from the
+// cache instead of hitting the SD card each time. Zero disables the
+// cache
+#ifndef AP_FATFS_CACHE_BLOCK_SIZE
+#define AP_FATFS_CACHE_BLOCK_SIZE 2048
+#endif
@@ -117,7 +117,19 @@ int AP_Filesystem_Posix::fsync(int fd)
 {
 #if AP_FILESYSTEM_POSIX_HAVE_FSYNC
     FS_CHECK_ALLOWED(-1);
-    return ::fsync(fd);
+    const int ret = ::fsync(fd);
+#if CONFIG_HAL_BOARD == HAL_BOARD_LINUX
+    if (ret == 0) {
+        /*
+          drop the synced pages from the page cache. The logger syncs
+          every few hundred kilobytes and never re-reads them, so
+          without this the cache grows until the kernel spends main
+          CPU time on reclaim and writeback during sustained logging
+         */
+        (void)posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    }
+#endif
+    return ret;
 #else
     // we have to pass success here as otherwise it is assumed to be
     // failed IO and the caller may close the fd and give up
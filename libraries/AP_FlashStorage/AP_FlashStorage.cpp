@@ -109,6 +109,8 @@ bool AP_FlashStorage::init(void)
     // clear any write error
     write_error = false;
     reserved_space = 0;
+    erase_pending = false;
+    erase_pending_data_written = false;
     
     // if the first sector is full then write out all data so we can erase it
     if (states[first_sector] == SECTOR_STATE_FULL) {
@@ -151,6 +153,47 @@ bool AP_FlashStorage::switch_full_sector(void)
     return ret;
 }
 
+/*
+  erase a sector left marked full by a previous switch_sectors(). The
+  erase is otherwise deferred until both sectors are full, when
+  write() must do it synchronously via switch_full_sector() - a stall
+  of hundreds of milliseconds at an arbitrary time, typically arming.
+  Doing it here while idle makes that emergency path unreachable in
+  normal operation. The caller must be prepared for the CPU to be
+  offline for the duration of an erase
+ */
+bool AP_FlashStorage::process_pending_erase(void)
+{
+    if (write_error || in_switch_full_sector) {
+        return false;
+    }
+    if (!erase_pending) {
+        return true;
+    }
+    if (!flash_erase_ok()) {
+        return false;
+    }
+
+    if (!erase_pending_data_written) {
+        // write out all data into the current sector so the content
+        // of the full sector is no longer needed. The space was
+        // reserved by switch_sectors() so this cannot run out of room
+        reserved_space = 0;
+        if (!write_all()) {
+            return false;
+        }
+        erase_pending_data_written = true;
+    }
+
+    if (!erase_sector(current_sector ^ 1, true)) {
+        return false;
+    }
+
+    erase_pending = false;
+    erase_pending_data_written = false;
+    return true;
+}
+
 // protected_switch_full_sector is protected by switch_full_sector to
 // avoid an infinite recursion problem; switch_full_sector calls
 // write() which can call switch_full_sector.  This has been seen in
@@ -161,6 +204,8 @@ bool AP_FlashStorage::protected_switch_full_sector(void)
     // clear any write error
     write_error = false;
     reserved_space = 0;
+    erase_pending = false;
+    erase_pending_data_written = false;
     
     if (!write_all()) {
         return false;
@@ -344,6 +389,8 @@ bool AP_FlashStorage::erase_sector(uint8_t sector, bool mark_available)
 bool AP_FlashStorage::erase_all(void)
 {
     write_error = false;
+    erase_pending = false;
+    erase_pending_data_written = false;
 
     current_sector = 0;
     write_offset = sizeof(struct sector_header);
@@ -441,7 +488,12 @@ bool AP_FlashStorage::switch_sectors(void)
     // we need to reserve some space in next sector to ensure we can successfully do a
     // full write out on init()
     reserved_space = reserve_size;
-    
+
+    // the old sector is left marked full; ask for it to be erased
+    // when next idle so that we don't have to do it inside a write()
+    erase_pending = true;
+    erase_pending_data_written = false;
+
     write_offset = sizeof(header);
     return true;    
 }
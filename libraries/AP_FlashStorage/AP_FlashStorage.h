@@ -130,6 +130,13 @@ public:
     // write some data to storage from mem_buffer
     bool write(uint16_t offset, uint16_t length) WARN_IF_UNUSED;
 
+    // erase any sector left marked full by a previous sector switch,
+    // writing out all data first. Should be called when idle and it
+    // is safe for the CPU to be offline for the duration of an erase,
+    // so that write() never needs to erase synchronously. Returns
+    // true when no full sector remains
+    bool process_pending_erase(void);
+
     // fixed storage size
     static const uint16_t storage_size = HAL_STORAGE_SIZE;
     
@@ -241,4 +248,12 @@ private:
     // in practice.
     bool protected_switch_full_sector(void) WARN_IF_UNUSED;
     bool in_switch_full_sector;
+
+    // set by switch_sectors() when it leaves the old sector marked
+    // full; cleared when that sector has been erased
+    bool erase_pending;
+
+    // true when process_pending_erase() has written out all data but
+    // has not yet managed the erase, so retries skip the write
+    bool erase_pending_data_written;
 };
@@ -47,6 +47,7 @@ extern const AP_HAL::HAL& hal;
 
 #define AP_FOLLOW_TIMEOUT          3     // position estimate timeout in seconds
 #define AP_FOLLOW_SYSID_TIMEOUT_MS 10000 // forget sysid we are following if we have not heard from them in 10 seconds
+#define AP_FOLLOW_VEL_HISTORY_TIMEOUT_MS 3000 // discard the velocity history if updates stop for this long
 
 #define AP_FOLLOW_OFFSET_TYPE_NED       0   // offsets are in north-east-down frame
 #define AP_FOLLOW_OFFSET_TYPE_RELATIVE  1   // offsets are relative to lead vehicle's heading
@@ -249,6 +250,9 @@ void AP_Follow::update_estimates()
     if (_sysid != _sysid_used) {
         _sysid_used = _sysid;
         _estimate_valid = false;
+        // velocity history belongs to the previous target
+        _vel_sample_count = 0;
+        _vel_sample_next = 0;
     }
 
     const uint32_t now = AP_HAL::millis();
@@ -614,6 +618,62 @@ float AP_Follow::calc_max_velocity_change(float accel_max, float jerk_max, float
     }
 }
 
+// Records the latest target velocity in the sample ring and derives an acceleration
+// estimate from a least-squares fit of velocity against time. GLOBAL_POSITION_INT
+// carries no acceleration so, at 1-2Hz telemetry rates, pure linear projection makes
+// the estimate lurch each time a message arrives; a fitted acceleration lets the
+// kinematic projection in update_estimates() track a turning or accelerating lead
+// vehicle between messages. The fit spans several messages so it also tolerates the
+// residual timestamp jitter left after JitterCorrection.
+void AP_Follow::update_derived_accel(uint32_t time_ms)
+{
+    // discard the history across long gaps or non-monotonic timestamps;
+    // stale samples would produce a bogus fit
+    if (_vel_sample_count > 0) {
+        const VelSample &newest = _vel_samples[(_vel_sample_next + NUM_VEL_SAMPLES - 1) % NUM_VEL_SAMPLES];
+        if (time_ms <= newest.time_ms || time_ms - newest.time_ms > AP_FOLLOW_VEL_HISTORY_TIMEOUT_MS) {
+            _vel_sample_count = 0;
+            _vel_sample_next = 0;
+        }
+    }
+
+    _vel_samples[_vel_sample_next] = VelSample{time_ms, _target_vel_ned_ms};
+    _vel_sample_next = (_vel_sample_next + 1) % NUM_VEL_SAMPLES;
+    if (_vel_sample_count < NUM_VEL_SAMPLES) {
+        _vel_sample_count++;
+    }
+
+    // need at least three samples for a meaningful slope
+    if (_vel_sample_count < 3) {
+        _target_accel_ned_mss.zero();
+        return;
+    }
+
+    // least-squares slope of velocity against time, with time measured in
+    // seconds before the newest sample so the sums stay well-conditioned
+    float sum_t = 0.0f;
+    float sum_tt = 0.0f;
+    Vector3f sum_v;
+    Vector3f sum_tv;
+    for (uint8_t i = 0; i < _vel_sample_count; i++) {
+        const VelSample &s = _vel_samples[(_vel_sample_next + NUM_VEL_SAMPLES - _vel_sample_count + i) % NUM_VEL_SAMPLES];
+        const float t = (time_ms - s.time_ms) * -0.001f;
+        sum_t += t;
+        sum_tt += sq(t);
+        sum_v += s.vel_ned_ms;
+        sum_tv += s.vel_ned_ms * t;
+    }
+
+    const float n = _vel_sample_count;
+    const float denom = n * sum_tt - sq(sum_t);
+    if (!is_positive(denom)) {
+        // all samples at (nearly) the same instant
+        _target_accel_ned_mss.zero();
+        return;
+    }
+    _target_accel_ned_mss = (sum_tv * n - sum_v * sum_t) / denom;
+}
+
 // Decodes a GLOBAL_POSITION_INT MAVLink message to update the target’s position, velocity, and heading.
 bool AP_Follow::handle_global_position_int_message(const mavlink_message_t &msg)
 {
@@ -682,12 +742,13 @@ bool AP_Follow::handle_global_position_int_message(const mavlink_message_t &msg)
     _target_vel_ned_ms.y = packet.vy * 0.01f; // velocity east
     _target_vel_ned_ms.z = packet.vz * 0.01f; // velocity down
 
-    // target acceleration not available in GLOBAL_POSITION_INT
-    _target_accel_ned_mss.zero();
-
     // apply jitter-corrected timestamp to this update
     _last_location_update_ms = _jitter.correct_offboard_timestamp_msec(packet.time_boot_ms, AP_HAL::millis());
 
+    // target acceleration not available in GLOBAL_POSITION_INT; derive it
+    // from the velocity history instead
+    update_derived_accel(_last_location_update_ms);
+
     // if sysid not yet set, adopt sender’s sysid and enable automatic sysid tracking
     if (_sysid == 0) {
         _sysid.set(msg.sysid);
@@ -775,17 +836,21 @@ bool AP_Follow::handle_follow_target_message(const mavlink_message_t &msg)
     }
 
     // decode acceleration if available (bit 2 of est_capabilities)
-    if (packet.est_capabilities & (1 << 2)) {
+    const bool have_accel = (packet.est_capabilities & (1 << 2)) != 0;
+    if (have_accel) {
         _target_accel_ned_mss.x = packet.acc[0]; // acceleration north
         _target_accel_ned_mss.y = packet.acc[1]; // acceleration east
         _target_accel_ned_mss.z = packet.acc[2]; // acceleration down
-    } else {
-        _target_accel_ned_mss.zero();
     }
 
     // apply jitter-corrected timestamp to this update
     _last_location_update_ms = _jitter.correct_offboard_timestamp_msec(packet.timestamp, AP_HAL::millis());
 
+    if (!have_accel) {
+        // sender doesn't estimate acceleration; derive it from the velocity history
+        update_derived_accel(_last_location_update_ms);
+    }
+
     // if sysid not yet assigned, adopt sender's sysid and enable automatic sysid tracking
     if (_sysid == 0) {
         _sysid.set(msg.sysid);
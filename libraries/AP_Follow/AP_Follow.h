@@ -186,6 +186,9 @@ private:
     bool handle_global_position_int_message(const mavlink_message_t &msg);
     bool handle_follow_target_message(const mavlink_message_t &msg);
 
+    // Records a velocity sample and derives a target acceleration estimate when the link does not supply one.
+    void update_derived_accel(uint32_t time_ms);
+
     // write out an onboard-log message to help diagnose follow problems:
     void Log_Write_FOLL();
 
@@ -243,6 +246,16 @@ private:
     bool        _offsets_were_zero;             // True if initial offset was zero before being initialized
     bool        _using_follow_target;           // True if FOLLOW_TARGET messages are being used instead of GLOBAL_POSITION_INT
 
+    // History of recent velocity samples; used to derive target acceleration on links that don't report it (see update_derived_accel)
+    struct VelSample {
+        uint32_t time_ms;                       // jitter-corrected sample timestamp
+        Vector3f vel_ned_ms;                    // target velocity (NED frame, m/s)
+    };
+    static const uint8_t NUM_VEL_SAMPLES = 4;
+    VelSample   _vel_samples[NUM_VEL_SAMPLES];  // ring buffer of samples, oldest overwritten first
+    uint8_t     _vel_sample_count;              // number of valid samples in the ring
+    uint8_t     _vel_sample_next;               // ring index the next sample will be written to
+
     HAL_Semaphore   _follow_sem;                // semaphore for multi-thread use of update_estimates and LUA calls
 
     //==========================================================================
@@ -1073,6 +1073,10 @@ void AP_GPS::update(void)
 #endif  // HAL_LOGING_ENABLED
 #endif  // GPS_MAX_RECEIVERS > 1
 
+    // let backends that ran out of transmit space catch up on
+    // broadcast RTCM data
+    deliver_rtcm_injection();
+
 #ifndef HAL_BUILD_AP_PERIPH
     // update notify with gps status. We always base this on the primary_instance
     AP_Notify::flags.gps_status = state[primary_instance].status;
@@ -1324,11 +1328,27 @@ void AP_GPS::lock_port(uint8_t instance, bool lock)
     }
 }
 
+// size of the broadcast RTCM injection ring buffer.  Must be a power of
+// two and large enough for a full round from a NTRIP server with all
+// constellations
+#define GPS_RTCM_INJECT_BUFSIZE 2048U
+
 // Inject a packet of raw binary to a GPS
 void AP_GPS::inject_data(const uint8_t *data, uint16_t len)
 {
-    //Support broadcasting to all GPSes.
-    if (_inject_to == GPS_RTK_INJECT_TO_ALL) {
+    if (_inject_to != GPS_RTK_INJECT_TO_ALL) {
+        inject_data(_inject_to, data, len);
+        return;
+    }
+
+    // Broadcasting to all GPSes: the data is written once into a shared
+    // ring buffer and each backend consumes it at its own pace
+    WITH_SEMAPHORE(rtcm_injection.sem);
+    if (rtcm_injection.buf == nullptr) {
+        rtcm_injection.buf = (uint8_t *)calloc(1, GPS_RTCM_INJECT_BUFSIZE);
+    }
+    if (rtcm_injection.buf == nullptr || len > GPS_RTCM_INJECT_BUFSIZE) {
+        // no buffer; fall back to a copy per backend
         for (uint8_t i=0; i<GPS_MAX_RECEIVERS; i++) {
             if (is_rtk_rover(i)) {
                 // we don't externally inject to moving baseline rover
@@ -1336,8 +1356,69 @@ void AP_GPS::inject_data(const uint8_t *data, uint16_t len)
             }
             inject_data(i, data, len);
         }
-    } else {
-        inject_data(_inject_to, data, len);
+        return;
+    }
+
+    // make room: a backend that has fallen more than the buffer size
+    // behind loses its oldest data and the loss is accounted to it
+    for (uint8_t i=0; i<GPS_MAX_RECEIVERS; i++) {
+        const uint32_t lag = rtcm_injection.head + len - rtcm_injection.tail[i];
+        if (lag > GPS_RTCM_INJECT_BUFSIZE) {
+            const uint32_t dropped = lag - GPS_RTCM_INJECT_BUFSIZE;
+            rtcm_injection.tail[i] += dropped;
+            rtcm_injection.overflow[i] += dropped;
+        }
+    }
+
+    // the single copy of the data, split in two if it wraps
+    const uint32_t ofs = rtcm_injection.head % GPS_RTCM_INJECT_BUFSIZE;
+    const uint32_t n = MIN((uint32_t)len, GPS_RTCM_INJECT_BUFSIZE - ofs);
+    memcpy(&rtcm_injection.buf[ofs], data, n);
+    memcpy(&rtcm_injection.buf[0], &data[n], len - n);
+    rtcm_injection.head += len;
+
+    // attempt immediate delivery to keep correction latency low
+    deliver_rtcm_injection();
+}
+
+// deliver any pending broadcast RTCM data.  Each backend accepts what it
+// can; the remainder is offered again on the next call
+void AP_GPS::deliver_rtcm_injection(void)
+{
+    WITH_SEMAPHORE(rtcm_injection.sem);
+    if (rtcm_injection.buf == nullptr) {
+        return;
+    }
+    for (uint8_t i=0; i<GPS_MAX_RECEIVERS; i++) {
+        if (drivers[i] == nullptr || is_rtk_rover(i)) {
+            // not a broadcast target; don't hold data on its behalf
+            rtcm_injection.tail[i] = rtcm_injection.head;
+            continue;
+        }
+        while (rtcm_injection.tail[i] != rtcm_injection.head) {
+            const uint32_t ofs = rtcm_injection.tail[i] % GPS_RTCM_INJECT_BUFSIZE;
+            const uint32_t pending = rtcm_injection.head - rtcm_injection.tail[i];
+            const uint16_t chunk = MIN(pending, GPS_RTCM_INJECT_BUFSIZE - ofs);
+            const uint16_t accepted = drivers[i]->inject_data(&rtcm_injection.buf[ofs], chunk);
+            rtcm_injection.tail[i] += accepted;
+            if (accepted < chunk) {
+                // the backend can't take any more for now
+                break;
+            }
+        }
+    }
+
+    // report per-backend overflow, at most once every 10 seconds
+    const uint32_t now_ms = AP_HAL::millis();
+    if (now_ms - rtcm_injection.last_overflow_report_ms > 10000) {
+        for (uint8_t i=0; i<GPS_MAX_RECEIVERS; i++) {
+            if (rtcm_injection.overflow[i] != rtcm_injection.reported_overflow[i]) {
+                GCS_SEND_TEXT(MAV_SEVERITY_WARNING, "GPS %d: dropped %u bytes of injected data",
+                              i + 1, (unsigned)(rtcm_injection.overflow[i] - rtcm_injection.reported_overflow[i]));
+                rtcm_injection.reported_overflow[i] = rtcm_injection.overflow[i];
+                rtcm_injection.last_overflow_report_ms = now_ms;
+            }
+        }
     }
 }
 
@@ -753,6 +753,21 @@ private:
     //Inject a packet of raw binary to a GPS
     void inject_data(uint8_t instance, const uint8_t *data, uint16_t len);
 
+    // broadcast buffer for injected RTCM data: corrections are written
+    // once here and each backend consumes them at its own pace
+    struct {
+        HAL_Semaphore sem;                      // injection can come from the GCS thread while delivery runs in update()
+        uint8_t *buf;                           // ring buffer, allocated on first injection
+        uint32_t head;                          // total bytes ever written
+        uint32_t tail[GPS_MAX_RECEIVERS];       // total bytes delivered to each backend
+        uint32_t overflow[GPS_MAX_RECEIVERS];   // bytes dropped per backend because it fell too far behind
+        uint32_t reported_overflow[GPS_MAX_RECEIVERS]; // overflow count last reported to the GCS
+        uint32_t last_overflow_report_ms;
+    } rtcm_injection;
+
+    // deliver pending broadcast RTCM data to the backends
+    void deliver_rtcm_injection(void);
+
 #if AP_GPS_BLENDED_ENABLED
     bool _output_is_blended; // true when a blended GPS solution being output
 #endif
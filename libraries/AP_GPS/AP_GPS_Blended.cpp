@@ -4,6 +4,10 @@
 
 #include "AP_GPS_Blended.h"
 
+#if AP_GPS_BLENDED_DEBUG
+#include <GCS_MAVLink/GCS.h>
+#endif
+
 // defines used to specify the mask position for use of different accuracy metrics in the blending algorithm
 #define BLEND_MASK_USE_HPOS_ACC     1
 #define BLEND_MASK_USE_VPOS_ACC     2
@@ -12,9 +16,49 @@
 #define BLEND_COUNTER_FAILURE_INCREMENT 10
 
 /*
- calculate the weightings used to blend GPSs location and velocity data
+ calculate the weightings used to blend GPSs location and velocity
+ data, reusing the previous weights when no receiver has delivered new
+ data since the last call. Parameter changes take effect at the next
+ receiver update
 */
 bool AP_GPS_Blended::_calc_weights(void)
+{
+#if AP_GPS_BLENDED_DEBUG
+    _blend_stats.calls++;
+    const uint32_t now_ms = AP_HAL::millis();
+    if (now_ms - _blend_stats.last_report_ms >= 10000) {
+        _blend_stats.last_report_ms = now_ms;
+        GCS_SEND_TEXT(MAV_SEVERITY_DEBUG, "GPS blend: %u recomputes in %u calls",
+                      unsigned(_blend_stats.recomputes), unsigned(_blend_stats.calls));
+        _blend_stats.calls = 0;
+        _blend_stats.recomputes = 0;
+    }
+#endif
+
+    bool inputs_changed = !_weights_cache.valid;
+    for (uint8_t i=0; i<GPS_MAX_RECEIVERS; i++) {
+        if (gps.state[i].last_gps_time_ms != _weights_cache.last_gps_time_ms[i] ||
+            gps.state[i].status != _weights_cache.status[i]) {
+            inputs_changed = true;
+        }
+    }
+    if (!inputs_changed) {
+        return _weights_cache.result;
+    }
+
+    for (uint8_t i=0; i<GPS_MAX_RECEIVERS; i++) {
+        _weights_cache.last_gps_time_ms[i] = gps.state[i].last_gps_time_ms;
+        _weights_cache.status[i] = gps.state[i].status;
+    }
+    _weights_cache.valid = true;
+    _weights_cache.result = _calc_weights_full();
+#if AP_GPS_BLENDED_DEBUG
+    _blend_stats.recomputes++;
+#endif
+    return _weights_cache.result;
+}
+
+bool AP_GPS_Blended::_calc_weights_full(void)
 {
     static_assert(GPS_MAX_RECEIVERS == 2, "GPS blending only currently works with 2 receivers");
     // Note that the early quit below relies upon exactly 2 instances
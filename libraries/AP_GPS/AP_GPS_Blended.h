@@ -24,6 +24,12 @@
 #include "AP_GPS.h"
 #include "GPS_Backend.h"
 
+// enable blending debug, including a periodic report of how often the
+// blend weights are actually recomputed
+#ifndef AP_GPS_BLENDED_DEBUG
+#define AP_GPS_BLENDED_DEBUG 0
+#endif
+
 class AP_GPS_Blended : public AP_GPS_Backend
 {
 public:
@@ -68,6 +74,27 @@ private:
 
     AP_GPS::GPS_timing &timing;
     bool _calc_weights(void);
+    bool _calc_weights_full(void);
+
+    // cached result of _calc_weights_full(). The inputs to the weight
+    // calculation only change when a receiver delivers new data or a
+    // fix status changes, while calc_weights() is called at the
+    // front-end update rate, so most calls can reuse the last result
+    struct {
+        uint32_t last_gps_time_ms[GPS_MAX_RECEIVERS];
+        AP_GPS_FixType status[GPS_MAX_RECEIVERS];
+        bool valid;
+        bool result;
+    } _weights_cache;
+
+#if AP_GPS_BLENDED_DEBUG
+    // blend cost accounting
+    struct {
+        uint32_t calls;
+        uint32_t recomputes;
+        uint32_t last_report_ms;
+    } _blend_stats;
+#endif
 };
 
 #endif  // AP_GPS_BLENDED_ENABLED
@@ -799,7 +799,7 @@ void AP_GPS_DroneCAN::send_rtcm(void)
 /*
   handle RTCM data from MAVLink GPS_RTCM_DATA, forwarding it over MAVLink
  */
-void AP_GPS_DroneCAN::inject_data(const uint8_t *data, uint16_t len)
+uint16_t AP_GPS_DroneCAN::inject_data(const uint8_t *data, uint16_t len)
 {
     // we only handle this if we are the first DroneCAN GPS or we are
     // using a different uavcan instance than the first GPS, as we
@@ -814,13 +814,17 @@ void AP_GPS_DroneCAN::inject_data(const uint8_t *data, uint16_t len)
             // constellations
             _rtcm_stream.buf = NEW_NOTHROW ByteBuffer(2400);
             if (_rtcm_stream.buf == nullptr) {
-                return;
+                // discard the data
+                return len;
             }
         }
         _detected_modules[_detected_module].last_inject_ms = now_ms;
-        _rtcm_stream.buf->write(data, len);
+        const uint16_t written = _rtcm_stream.buf->write(data, len);
         send_rtcm();
+        return written;
     }
+    // deliberately not sending from this backend; discard the data
+    return len;
 }
 
 /*
@@ -39,7 +39,7 @@ public:
     // Methods
     bool read() override;
 
-    void inject_data(const uint8_t *data, uint16_t len) override;
+    uint16_t inject_data(const uint8_t *data, uint16_t len) override;
 
     static bool _detect(struct SBP_detect_state &state, uint8_t data);
 
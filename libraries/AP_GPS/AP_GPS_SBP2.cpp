@@ -85,15 +85,16 @@ AP_GPS_SBP2::read(void)
     return _attempt_state_update();
 }
 
-void
+uint16_t
 AP_GPS_SBP2::inject_data(const uint8_t *data, uint16_t len)
 {
-    if (port->txspace() > len) {
-        last_injected_data_ms = AP_HAL::millis();
-        port->write(data, len);
-    } else {
+    const uint16_t n = MIN((uint32_t)len, port->txspace());
+    if (n == 0) {
         Debug("PIKSI: Not enough TXSPACE");
+        return 0;
     }
+    last_injected_data_ms = AP_HAL::millis();
+    return port->write(data, n);
 }
 
 //This attempts to reads all SBP messages from the incoming port.
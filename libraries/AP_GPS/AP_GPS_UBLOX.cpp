@@ -32,13 +32,13 @@
 #include <GCS_MAVLink/GCS.h>
 #include "RTCM3_Parser.h"
 #include <stdio.h>
+#include <string.h>
 
 #ifndef UBLOX_SPEED_CHANGE
     #define UBLOX_SPEED_CHANGE 0
 #endif
 
 
-#define UBLOX_DEBUGGING 0
 #define UBLOX_FAKE_3DLOCK 0
 #ifndef CONFIGURE_PPS_PIN
 #define CONFIGURE_PPS_PIN 0
@@ -580,17 +580,50 @@ AP_GPS_UBLOX::read(void)
         }
     }
 
-    const uint16_t numc = MIN(port->available(), 8192U);
-    for (uint16_t i = 0; i < numc; i++) {        // Process bytes received
-
-        // read the next byte
-        uint8_t data;
-        if (!port->read(data)) {
-            break;
-        }
+    // Process bytes received.  The UART is drained in bulk into a staging
+    // buffer so the state machine below does not pay a virtual read call
+    // per byte; bytes left over when parsing stops early (e.g. for an
+    // RTCMv3 packet) are kept for the next call.
+    uint16_t numc = MIN(port->available(), 8192U);
+    bool stop_parsing = false;
+    while (!stop_parsing) {
+        if (_rx_ofs >= _rx_len) {
+            // refill the staging buffer with a bulk read
+            if (numc == 0) {
+                break;
+            }
+            const ssize_t nread = port->read(_rx_buf, MIN(numc, (uint16_t)sizeof(_rx_buf)));
+            if (nread <= 0) {
+                break;
+            }
+            numc -= (uint16_t)nread;
+            _rx_len = (uint16_t)nread;
+            _rx_ofs = 0;
 #if AP_GPS_DEBUG_LOGGING_ENABLED
-        log_data(&data, 1);
+            log_data(_rx_buf, _rx_len);
 #endif
+        }
+
+#if GPS_MOVING_BASELINE
+        // when interleaved RTCMv3 is possible every byte must be offered
+        // to the RTCMv3 parser, so no bytes can be skipped
+        if (rtcm3_parser == nullptr)
+#endif
+        {
+            if (_step == 0) {
+                // while hunting for the sync bytes, jump straight to the
+                // next preamble candidate; the state machine would discard
+                // the intervening bytes one at a time anyway
+                const uint8_t *p = (const uint8_t *)memchr(&_rx_buf[_rx_ofs], PREAMBLE1, _rx_len - _rx_ofs);
+                if (p == nullptr) {
+                    _rx_ofs = _rx_len;
+                    continue;
+                }
+                _rx_ofs = p - _rx_buf;
+            }
+        }
+
+        const uint8_t data = _rx_buf[_rx_ofs++];
 
 #if GPS_MOVING_BASELINE
         if (rtcm3_parser) {
@@ -601,7 +634,8 @@ AP_GPS_UBLOX::read(void)
                 // chance to send the RTCMv3 packet to another (rover)
                 // GPS
                 _step = 0;
-                break;
+                stop_parsing = true;
+                continue;
             }
         }
 #endif
@@ -739,12 +773,40 @@ AP_GPS_UBLOX::read(void)
                 _cfg_v2.process_valget_complete(true);
             }
 #endif
+#if UBLOX_DEBUGGING
+            {
+                // per-frame CPU cost statistics
+                const uint32_t parse_start_us = AP_HAL::micros();
+                if (_parse_gps()) {
+                    parsed = true;
+                }
+                const uint32_t parse_us = AP_HAL::micros() - parse_start_us;
+                _parse_stats.total_us += parse_us;
+                _parse_stats.max_us = MAX(_parse_stats.max_us, parse_us);
+                _parse_stats.frames++;
+            }
+#else
             if (_parse_gps()) {
                 parsed = true;
             }
+#endif
             break;
         }
     }
+
+#if UBLOX_DEBUGGING
+    if (millis_now - _parse_stats.last_report_ms >= 5000 && _parse_stats.frames > 0) {
+        Debug("parse %u frames avg %uus max %uus",
+              (unsigned)_parse_stats.frames,
+              (unsigned)(_parse_stats.total_us / _parse_stats.frames),
+              (unsigned)_parse_stats.max_us);
+        _parse_stats.total_us = 0;
+        _parse_stats.max_us = 0;
+        _parse_stats.frames = 0;
+        _parse_stats.last_report_ms = millis_now;
+    }
+#endif
+
     return parsed;
 }
 
@@ -33,6 +33,9 @@
 #else
 #include "AP_GPS_UBLOX_CFG_List.h"
 #endif
+
+// enable driver debugging, including per-frame parse CPU statistics
+#define UBLOX_DEBUGGING 0
 /*
  *  try to put a UBlox into binary mode. This is in two parts. 
  *
@@ -836,6 +839,22 @@ private:
     uint16_t        _payload_length;
     uint16_t        _payload_counter;
 
+    // staging buffer for bulk UART reads; bytes between _rx_ofs and
+    // _rx_len are still to be parsed
+    uint8_t         _rx_buf[256];
+    uint16_t        _rx_len;
+    uint16_t        _rx_ofs;
+
+#if UBLOX_DEBUGGING
+    // per-frame parse CPU statistics, reported via Debug()
+    struct {
+        uint32_t total_us;
+        uint32_t max_us;
+        uint32_t frames;
+        uint32_t last_report_ms;
+    } _parse_stats;
+#endif
+
     uint8_t         _class;
     bool            _cfg_saved;
 
@@ -113,17 +113,21 @@ void AP_GPS_Backend::velocity_to_speed_course(AP_GPS::GPS_State &s)
     s.ground_speed = s.velocity.xy().length();
 }
 
-void
+uint16_t
 AP_GPS_Backend::inject_data(const uint8_t *data, uint16_t len)
 {
-    // not all backends have valid ports
-    if (port != nullptr) {
-        if (port->txspace() > len) {
-            port->write(data, len);
-        } else {
-            Debug("GPS %d: Not enough TXSPACE", state.instance + 1);
-        }
+    // not all backends have valid ports; discard the data
+    if (port == nullptr) {
+        return len;
+    }
+    // accept as much as the port can take; the caller may offer the
+    // remainder again once the transmit buffer has drained
+    const uint16_t n = MIN((uint32_t)len, port->txspace());
+    if (n == 0) {
+        Debug("GPS %d: Not enough TXSPACE", state.instance + 1);
+        return 0;
     }
+    return port->write(data, n);
 }
 
 void AP_GPS_Backend::_detection_message(char *buffer, const uint8_t buflen) const
@@ -66,7 +66,9 @@ public:
 
     virtual bool is_configured(void) const { return true; }
 
-    virtual void inject_data(const uint8_t *data, uint16_t len);
+    // inject RTCM correction data, returning the number of bytes
+    // accepted.  Unaccepted bytes may be offered again later
+    virtual uint16_t inject_data(const uint8_t *data, uint16_t len);
 
 #if HAL_GCS_ENABLED
     //MAVLink methods
@@ -169,8 +169,8 @@ const AP_Param::GroupInfo AP_GyroFFT::var_info[] = {
 
     // @Param: OPTIONS
     // @DisplayName: FFT options
-    // @Description: FFT configuration options. Values: 1:Apply the FFT *after* the filter bank,2:Check noise at the motor frequencies using ESC data as a reference
-    // @Bitmask: 0:Enable post-filter FFT,1:Check motor noise
+    // @Description: FFT configuration options. Values: 1:Apply the FFT *after* the filter bank,2:Check noise at the motor frequencies using ESC data as a reference,4:Use a fixed-point FFT engine where the platform supports one, allowing larger windows on slower CPUs at some precision cost
+    // @Bitmask: 0:Enable post-filter FFT,1:Check motor noise,2:Fixed-point FFT
     // @User: Advanced
     // @RebootRequired: True
     AP_GROUPINFO("OPTIONS", 15, AP_GyroFFT, _options, 0),
@@ -219,7 +219,9 @@ __INITFUNC__ void AP_GyroFFT::init(uint16_t loop_rate_hz)
 #if defined(STM32H7) || CONFIG_HAL_BOARD == HAL_BOARD_LINUX || CONFIG_HAL_BOARD == HAL_BOARD_SITL
     _window_size.set(constrain_int16(_window_size, 32, 512));
 #else
-    _window_size.set(constrain_int16(_window_size, 32, 256));
+    // the fixed-point engine is not limited by the float FFT tables so larger
+    // windows can be supported within the same CPU budget
+    _window_size.set(constrain_int16(_window_size, 32, using_fixed_point_fft() ? 512 : 256));
 #endif
     // number of samples needed before a new frame can be processed
     _window_overlap.set(constrain_float(_window_overlap, 0.0f, 0.9f));
@@ -311,12 +313,23 @@ __INITFUNC__ void AP_GyroFFT::init(uint16_t loop_rate_hz)
     }
 #endif  // AP_INERTIALSENSOR_HARMONICNOTCH_ENABLED
 
-    // initialise the HAL DSP subsystem
-    _state = hal.dsp->fft_init(_window_size, _fft_sampling_rate_hz, _num_frames);
+    // initialise the HAL DSP subsystem, negotiating the window size downwards
+    // if the backend cannot support the request (e.g. missing FFT tables)
+    const uint16_t requested_window_size = _window_size;
+    _state = hal.dsp->fft_init(_window_size, _fft_sampling_rate_hz, _num_frames, using_fixed_point_fft());
+    while (_state == nullptr && _window_size > 32) {
+        _window_size.set(_window_size / 2);
+        _state = hal.dsp->fft_init(_window_size, _fft_sampling_rate_hz, _num_frames, using_fixed_point_fft());
+    }
     if (_state == nullptr) {
         GCS_SEND_TEXT(MAV_SEVERITY_WARNING, "Failed to initialize DSP engine");
         return;
     }
+    if (_window_size != requested_window_size) {
+        GCS_SEND_TEXT(MAV_SEVERITY_WARNING, "AP_GyroFFT: window reduced to %u", unsigned(_window_size.get()));
+        // the frame size needs to reflect the negotiated window
+        _samples_per_frame = MAX(FFT_MIN_SAMPLES_PER_FRAME, 1 << lrintf(log2f((1.0f - _window_overlap) * _window_size)));
+    }
 
     // per-axis frame time
     _frame_time_ms = _samples_per_frame * 1000 / _fft_sampling_rate_hz;
@@ -355,6 +368,10 @@ __INITFUNC__ void AP_GyroFFT::init(uint16_t loop_rate_hz)
     // the number of cycles required to have a proper noise reference
     _noise_cycles = (_window_size / _samples_per_frame) * XYZ_AXIS_COUNT;
 
+    // seed the published state so that the main thread sees sensible values
+    // before the first analysis cycle completes
+    publish_state();
+
     // finally we are done
     _initialized = true;
     update_parameters(true);
@@ -400,10 +417,26 @@ void AP_GyroFFT::update()
         return;
     }
 
-    WITH_SEMAPHORE(_sem);
-
+    // single byte write, picked up by the FFT thread on its next config copy
     _config._analysis_enabled = _analysis_enabled;
-    _global_state = _thread_state;
+
+    // take a consistent copy of the state published by the FFT thread without
+    // blocking on it. If the FFT thread publishes mid-copy the sequence count
+    // will have changed and we retry; a publish takes well under a microsecond
+    // so colliding on all of the retries is vanishingly unlikely and at worst
+    // mixes two adjacent analysis cycles until the next update
+    for (uint8_t retries = 0; retries < 4; retries++) {
+        const uint32_t seq = _shared_seq.load(std::memory_order_acquire);
+        if (seq & 1U) {
+            continue;   // publish in progress
+        }
+        _global_state = _shared_state;
+        // make sure the copy completed before re-checking the sequence count
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (_shared_seq.load(std::memory_order_relaxed) == seq) {
+            break;
+        }
+    }
 
     // calculate health based on being 5 frames behind, SITL needs longer
 #if CONFIG_HAL_BOARD == HAL_BOARD_SITL
@@ -460,6 +493,7 @@ uint16_t AP_GyroFFT::run_cycle()
     // stay ahead of the gyro loop so drop samples so that this cycle will use all available samples
     if (gyro_buffer.available() > uint32_t(_state->_window_size + uint16_t(_samples_per_frame >> 1))) { // half the frame size is a heuristic
         gyro_buffer.advance(gyro_buffer.available() - _state->_window_size);
+        _thread_state._dropped_windows++;
     }
     // let's go!
     hal.dsp->fft_start(_state, gyro_buffer, _samples_per_frame);
@@ -513,14 +547,31 @@ uint16_t AP_GyroFFT::run_cycle()
     _update_axis = (_update_axis + 1) % XYZ_AXIS_COUNT;
 
     // ready to receive another frame, because lock contention is so expensive we don't lock
-    // around this flag but rather rely on the semaphore at the beginning of the loop to
-    // ensure eventual visibility to the main loop
+    // around this flag but rather rely on the publish below and the semaphore at the
+    // beginning of the loop to ensure eventual visibility
     _thread_state._analysis_started = false;
 
+    // make the results of this cycle visible to the main thread
+    publish_state();
+
     // samples remaining in the next axis
     return get_available_samples(_update_axis);
 }
 
+// publish _thread_state to the main thread
+// called from the FFT thread. The sequence count is bumped to an odd value
+// before the copy and an even value afterwards so that update() can detect
+// a publish that overlapped its read and retry, seqlock style
+void AP_GyroFFT::publish_state()
+{
+    const uint32_t seq = _shared_seq.load(std::memory_order_relaxed);
+    _shared_seq.store(seq + 1, std::memory_order_relaxed);
+    // make sure the odd sequence count is visible before the state is written
+    std::atomic_thread_fence(std::memory_order_release);
+    _shared_state = _thread_state;
+    _shared_seq.store(seq + 2, std::memory_order_release);
+}
+
 // whether analysis can be run again or not
 // called from FFT thread with the semaphore held
 bool AP_GyroFFT::start_analysis() {
@@ -578,6 +629,15 @@ void AP_GyroFFT::update_thread(void)
         // we always delay by at least 1us to give logging a chance to run at the same priority
         uint32_t delay = constrain_int32((int16_t)_state->_window_size - (int16_t)remaining_samples, 0, _samples_per_frame)
             * 1e6 / _fft_sampling_rate_hz;
+        // all three axes fill from the same sample stream so they come into phase and
+        // would be analysed back-to-back, producing a CPU spike every frame period.
+        // spacing consecutive axes a third of a frame apart flattens the load without
+        // reducing per-axis throughput. only do this when we are not behind so that a
+        // slow cycle can still catch up by running back-to-back
+        if (remaining_samples <= uint16_t(_state->_window_size + (_samples_per_frame >> 1))) {
+            const uint32_t spacing = _samples_per_frame * 1e6 / (_fft_sampling_rate_hz * XYZ_AXIS_COUNT);
+            delay = MAX(delay, spacing);
+        }
 #if CONFIG_HAL_BOARD == HAL_BOARD_SITL
         // in SITL the gyros do not run in a different thread
         if (delay > 0) {
@@ -988,6 +1048,7 @@ float AP_GyroFFT::calculate_weighted_freq_hz(const Vector3f& energy, const Vecto
 // @Field: FHY: FFT health, Y-axis
 // @Field: FHZ: FFT health, Z-axis
 // @Field: Tc: FFT cycle time
+// @Field: Dw: number of windows dropped because the FFT thread fell behind the gyro loop
 
 #if HAL_LOGGING_ENABLED
 
@@ -1000,10 +1061,10 @@ void AP_GyroFFT::write_log_messages()
 
     AP::logger().WriteStreaming(
         "FTN1",
-        "TimeUS,PkAvg,BwAvg,SnX,SnY,SnZ,FtX,FtY,FtZ,FHX,FHY,FHZ,Tc",
-        "szz---%%%---s",
-        "F-----------F",
-        "QffffffffBBBI",
+        "TimeUS,PkAvg,BwAvg,SnX,SnY,SnZ,FtX,FtY,FtZ,FHX,FHY,FHZ,Tc,Dw",
+        "szz---%%%---s-",
+        "F-----------F-",
+        "QffffffffBBBII",
         AP_HAL::micros64(),
         get_weighted_noise_center_freq_hz(),
         get_weighted_noise_center_bandwidth_hz(),
@@ -1013,7 +1074,8 @@ void AP_GyroFFT::write_log_messages()
         get_raw_noise_harmonic_fit().x,
         get_raw_noise_harmonic_fit().y,
         get_raw_noise_harmonic_fit().z,
-        _health.x, _health.y, _health.z, _output_cycle_micros);
+        _health.x, _health.y, _health.z, _output_cycle_micros,
+        get_dropped_windows());
 
     log_noise_peak(0, FrequencyPeak::CENTER);
     if (_tracked_peaks> 1) {
@@ -27,6 +27,7 @@
 #include <AP_InertialSensor/AP_InertialSensor.h>
 #include <Filter/LowPassFilter.h>
 #include <Filter/FilterWithBuffer.h>
+#include <atomic>
 
 #define DEBUG_FFT   0
 
@@ -40,7 +41,8 @@ public:
 
     enum class Options : uint32_t {
         FFTPostFilter = 1 << 0,
-        ESCNoiseCheck = 1 << 1
+        ESCNoiseCheck = 1 << 1,
+        FixedPointFFT = 1 << 2
     };
 
     AP_GyroFFT();
@@ -105,12 +107,16 @@ public:
     const Vector3f& get_noise_center_bandwidth_hz(FrequencyPeak peak) const { return _global_state._center_bandwidth_hz_filtered[peak]; };
     // weighted detected peak bandwidth
     float get_weighted_noise_center_bandwidth_hz() const;
+    // number of times the FFT thread fell behind the gyro loop and had to drop samples
+    uint32_t get_dropped_windows() const { return _global_state._dropped_windows; }
     // log gyro fft messages
     void write_log_messages();
     // post filter mask of IMUs
     bool using_post_filter_samples() const { return (_options & uint32_t(Options::FFTPostFilter)) != 0; }
     // post filter mask of IMUs
     bool check_esc_noise() const { return (_options & uint32_t(Options::ESCNoiseCheck)) != 0; }
+    // whether to request a fixed-point FFT engine from the DSP backend
+    bool using_fixed_point_fft() const { return (_options & uint32_t(Options::FixedPointFFT)) != 0; }
     // look for a frequency in the detected noise
     float has_noise_at_frequency_hz(float freq) const;
     static float calculate_notch_frequency(float* freqs, uint16_t numpeaks, float harmonic_fit, uint8_t& harmonics);
@@ -228,7 +234,7 @@ private:
     // semaphore for access to shared FFT data
     HAL_Semaphore _sem;
 
-    // data set from the FFT thread but accessible from the main thread protected by the semaphore
+    // data set from the FFT thread and published to the main thread through _shared_state
     struct EngineState {
         // energy of the detected peak frequency in dB
         Vector3f _center_freq_energy_db;
@@ -257,6 +263,8 @@ private:
         Vector3f _center_freq_energy_filtered[FrequencyPeak::MAX_TRACKED_PEAKS];
         // filtered detected peak width
         Vector3f _center_bandwidth_hz_filtered[FrequencyPeak::MAX_TRACKED_PEAKS];
+        // number of times the FFT thread fell behind the gyro loop and had to drop samples
+        uint32_t _dropped_windows;
         // axes that still require noise calibration
         uint8_t _noise_needs_calibration;
         // whether the analyzer is mid-cycle
@@ -267,6 +275,13 @@ private:
     EngineState _thread_state;
     // Shared FFT engine state accessible by the main thread
     EngineState _global_state;
+    // snapshot of _thread_state published by the FFT thread. The sequence
+    // count is odd while a publish is in progress so that update() can take
+    // a consistent copy without ever blocking on the FFT thread
+    EngineState _shared_state;
+    std::atomic<uint32_t> _shared_seq;
+    // publish _thread_state to the main thread, called from the FFT thread
+    void publish_state();
 
     // number of samples needed before a new frame can be processed
     uint16_t _samples_per_frame;
@@ -74,6 +74,18 @@ int16_t AP_HAL::CANIface::receive(CANFrame& out_frame, uint64_t& out_ts_monotoni
     return 1;
 }
 
+/*
+  default batched receive, popping one frame at a time
+ */
+uint8_t AP_HAL::CANIface::receive_batch(CanRxItem *items, uint8_t max)
+{
+    uint8_t n = 0;
+    while (n < max && receive(items[n].frame, items[n].timestamp_us, items[n].flags) > 0) {
+        n++;
+    }
+    return n;
+}
+
 /*
   parent class send handling for Forwarded frames
  */
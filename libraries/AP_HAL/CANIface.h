@@ -177,11 +177,31 @@ public:
     // must be called on child class
     virtual int16_t send(const CANFrame& frame, uint64_t tx_deadline, CanIOFlags flags);
 
-    // Non blocking receive frame that pops the frames received inside the buffer, return negative if error occurred, 
+    // Non blocking receive frame that pops the frames received inside the buffer, return negative if error occurred,
     // 0 if no frame available, 1 if successful
     // must be called on child class
     virtual int16_t receive(CANFrame& out_frame, uint64_t& out_ts_monotonic, CanIOFlags& out_flags);
 
+    // Non blocking batched receive, draining up to max frames into items in
+    // one call. Returns the number of frames fetched. The default
+    // implementation pops one frame at a time; HALs can override it to drain
+    // their RX queue under a single lock to cut per-frame overhead on loaded
+    // buses
+    virtual uint8_t receive_batch(CanRxItem *items, uint8_t max);
+
+    // a single hardware acceptance filter: a received extended frame is
+    // accepted if (rx_id & mask) == (id & mask) for any configured filter
+    typedef struct {
+        uint32_t id;
+        uint32_t mask;
+    } CanFilterConfig;
+
+    // configure the hardware acceptance filters for extended (29 bit)
+    // frames, so frames matching none of the filters stop costing interrupt
+    // servicing. Returns false if the HAL has no filter support or the list
+    // doesn't fit
+    virtual bool configureFilters(const CanFilterConfig *filter_configs, uint16_t num_configs) { return false; }
+
     //Return Total Error Count generated so far
     virtual uint32_t getErrorCount() const
     {
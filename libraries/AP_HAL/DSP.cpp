@@ -31,12 +31,13 @@ extern const AP_HAL::HAL &hal;
 #define SQRT_2_3 0.816496580927726f
 #define SQRT_6   2.449489742783178f
 
-DSP::FFTWindowState::FFTWindowState(uint16_t window_size, uint16_t sample_rate, uint8_t sliding_window_size) :
+DSP::FFTWindowState::FFTWindowState(uint16_t window_size, uint16_t sample_rate, uint8_t sliding_window_size, bool fixed_point) :
     _bin_resolution((float)sample_rate / (float)window_size),
     _bin_count(window_size / 2),
     _num_stored_freqs(window_size / 2 + 1),
     _window_size(window_size),
     _sliding_window_size(sliding_window_size),
+    _fixed_point(fixed_point),
     _current_slice(0)
 {
     // includes DC ad Nyquist components and needs to be large enough for intermediate steps
@@ -61,6 +61,8 @@ public:
         const uint16_t _window_size;
         // size of the FFT sliding window
         const uint8_t _sliding_window_size;
+        // true if the window is processed by a fixed-point engine
+        const bool _fixed_point;
         // FFT data
         float* _freq_bins;
         // derivative real data scratch space
@@ -88,10 +90,10 @@ public:
 
         void free_data_structures();
         virtual ~FFTWindowState();
-        FFTWindowState(uint16_t window_size, uint16_t sample_rate, uint8_t sliding_window_size);
+        FFTWindowState(uint16_t window_size, uint16_t sample_rate, uint8_t sliding_window_size, bool fixed_point = false);
     };
-    // initialise an FFT instance
-    virtual FFTWindowState* fft_init(uint16_t window_size, uint16_t sample_rate, uint8_t sliding_window_size = 0) = 0;
+    // initialise an FFT instance, optionally using a fixed-point engine where the backend supports one
+    virtual FFTWindowState* fft_init(uint16_t window_size, uint16_t sample_rate, uint8_t sliding_window_size = 0, bool fixed_point = false) = 0;
     // start an FFT analysis with an ObjectBuffer
     virtual void fft_start(FFTWindowState* state, FloatBuffer& samples, uint16_t advance) = 0;
     // perform remaining steps of an FFT analysis
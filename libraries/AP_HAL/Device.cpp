@@ -16,6 +16,7 @@
 #include "Device.h"
 
 #include <stdio.h>
+#include <string.h>
 #include <AP_Common/AP_Common.h>
 
 /*
@@ -191,6 +192,40 @@ bool AP_HAL::Device::read_registers(uint8_t first_reg, uint8_t *recv, uint32_t r
     return result;
 }
 
+/*
+  default chained transfer: one transfer per segment, holding
+  chip-select asserted across the chain where the bus supports forcing
+  it. DMA-capable implementations override this with a single transfer
+ */
+bool AP_HAL::Device::transfer_chained(const TransferSegment *segments, uint8_t num_segments)
+{
+    const bool cs_held = set_chip_select(true);
+    bool ret = true;
+    for (uint8_t i = 0; i < num_segments; i++) {
+        const TransferSegment &seg = segments[i];
+        if (seg.len == 0) {
+            continue;
+        }
+        if (seg.send != nullptr && seg.recv != nullptr) {
+            // exchange in place through the receive buffer
+            if (seg.send != seg.recv) {
+                memcpy(seg.recv, seg.send, seg.len);
+            }
+            ret = transfer_fullduplex(seg.recv, seg.len);
+        } else {
+            ret = transfer(seg.send, seg.send != nullptr ? seg.len : 0,
+                           seg.recv, seg.recv != nullptr ? seg.len : 0);
+        }
+        if (!ret) {
+            break;
+        }
+    }
+    if (cs_held) {
+        set_chip_select(false);
+    }
+    return ret;
+}
+
 bool AP_HAL::Device::transfer_bank(uint8_t bank, const uint8_t *send, uint32_t send_len,
                         uint8_t *recv, uint32_t recv_len)
 {
@@ -138,6 +138,27 @@ public:
         return transfer(send_recv, len, send_recv, len);
     }
 
+    // one element of a chained transfer. send may be nullptr to clock
+    // out zeros; recv may be nullptr to discard the bytes read back
+    struct TransferSegment {
+        const uint8_t *send;
+        uint8_t *recv;
+        uint32_t len;
+    };
+
+    /*
+     * Transfer a chain of segments as one bus transaction. On buses
+     * that frame transactions with chip-select the whole chain runs in
+     * a single chip-select window, so it must only be used with
+     * devices that accept multiple data phases per window (e.g. a
+     * register address followed by a burst read). DMA-capable
+     * implementations coalesce the chain into a single transfer; the
+     * default runs one transfer per segment.
+     *
+     * Return: true if the whole chain transferred successfully.
+     */
+    virtual bool transfer_chained(const TransferSegment *segments, uint8_t num_segments);
+
     /*
      * Sets the required flags before transaction starts
      * this is to be used by Wide SPI communication interfaces like
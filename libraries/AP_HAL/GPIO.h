@@ -108,6 +108,25 @@ public:
      */
     virtual bool wait_pin(uint8_t pin, INTERRUPT_TRIGGER_TYPE mode, uint32_t timeout_us) { return false; }
 
+    /*
+      optional pulse-period accumulation interface. When supported the
+      HAL measures the period between successive edges of the given
+      trigger type in interrupt or capture context, discards periods
+      outside [period_min_us, period_max_us] and accumulates the rest
+      for batched readout with read_pulse_periods(). This avoids a
+      callback per pulse for high-rate inputs such as RPM sensors
+     */
+    virtual bool attach_pulse_accumulator(uint8_t pin, INTERRUPT_TRIGGER_TYPE mode,
+                                          uint32_t period_min_us, uint32_t period_max_us) {
+        return false;
+    }
+    virtual bool detach_pulse_accumulator(uint8_t pin) { return false; }
+
+    // retrieve and reset the accumulated period sum and edge count
+    virtual bool read_pulse_periods(uint8_t pin, uint32_t &period_sum_us, uint32_t &period_count) {
+        return false;
+    }
+
     /* return true if USB cable is connected */
     virtual bool    usb_connected(void) = 0;
 
@@ -22,6 +22,8 @@
 #include "Device.h"
 #include "utility/OwnPtr.h"
 
+class ExpandingString;
+
 namespace AP_HAL {
 
 class I2CDevice : public Device {
@@ -99,6 +101,18 @@ public:
       get mask of bus numbers for all configured internal I2C buses
      */
     virtual uint32_t get_bus_mask_internal(void) const { return 0x01; }
+
+    /*
+      dump per-bus callback timing statistics for @SYS/i2c.txt
+     */
+    virtual void bus_info(ExpandingString &str) const {}
+
+    /*
+      fill utilization with the fraction of bus time consumed by
+      registered periodic callbacks on the given bus. Returns false if
+      the bus does not exist or no accounting is available
+     */
+    virtual bool get_bus_utilization(uint8_t bus, float &utilization) const { return false; }
 };
 
 /*
@@ -88,6 +88,13 @@ public:
     virtual const char *get_device_name(uint8_t idx) { return nullptr; }
 
     virtual void set_register_rw_callback(const char* name, AP_HAL::Device::RegisterRWCb cb) {}
+
+    /*
+      fill utilization with the fraction of bus time consumed by
+      registered periodic callbacks on the given bus. Returns false if
+      the bus does not exist or no accounting is available
+     */
+    virtual bool get_bus_utilization(uint8_t bus, float &utilization) const { return false; }
 };
 
 }
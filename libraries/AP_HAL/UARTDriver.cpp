@@ -91,6 +91,37 @@ size_t AP_HAL::UARTDriver::write(const uint8_t *buffer, size_t size)
     return _write(buffer, size);
 }
 
+/*
+  gather write. Not available on a locked port
+*/
+size_t AP_HAL::UARTDriver::writev(const WriteVector *vec, uint8_t count)
+{
+    if (lock_write_key != 0) {
+        return 0;
+    }
+    return _writev(vec, count);
+}
+
+/*
+  default backend gather write: per-segment _write() behind an
+  all-or-nothing space check so a packet is never half queued
+ */
+size_t AP_HAL::UARTDriver::_writev(const WriteVector *vec, uint8_t count)
+{
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        total += vec[i].len;
+    }
+    if (txspace() < total) {
+        return 0;
+    }
+    size_t written = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        written += _write(vec[i].data, vec[i].len);
+    }
+    return written;
+}
+
 size_t AP_HAL::UARTDriver::write(uint8_t c)
 {
     return write(&c, 1);
@@ -49,6 +49,19 @@ public:
     size_t write(const uint8_t *buffer, size_t size) override;
     size_t write(const char *str) override;
 
+    /*
+      gather write: queue a list of segments as a single atomic write,
+      either all segments are accepted or none are. This allows a
+      packet to be sent from its component pieces (eg. MAVLink header,
+      payload and CRC) without first assembling them into a contiguous
+      staging buffer
+     */
+    struct WriteVector {
+        const uint8_t *data;
+        uint16_t len;
+    };
+    size_t writev(const WriteVector *vec, uint8_t count);
+
     /*
       single and multi-byte read methods
      */
@@ -177,6 +190,8 @@ public:
         ByteTracker tx;
         ByteTracker rx;
         ByteTracker rx_dropped;
+        ByteTracker tx_gather;
+        ByteTracker rx_tick;
     };
 
     // request information on uart I/O for this uart, for @SYS/uarts.txt
@@ -240,6 +255,12 @@ protected:
      */
     virtual size_t _write(const uint8_t *buffer, size_t size) = 0;
 
+    /*
+      backend gather write method. The default implementation does a
+      per-segment _write() after an all-or-nothing space check
+     */
+    virtual size_t _writev(const WriteVector *vec, uint8_t count);
+
     /*
       backend read method
      */
@@ -26,11 +26,12 @@ public:
         return 1;
     }
     size_t write(const uint8_t *buffer, size_t size) override {
-        size_t n = 0;
-        while (size--) {
-            n += write(*buffer++);
+        if (_offs < _size) {
+            // single memcpy of whatever fits, rather than a write per byte
+            memcpy(&_str[_offs], buffer, MIN(size, _size - _offs));
         }
-        return n;
+        _offs += size;
+        return size;
     }
 
     size_t _offs;
@@ -152,6 +152,18 @@ public:
     // attempt to trap the processor, presumably to enter an attached debugger
     virtual bool trap() const { return false; }
 
+    // start or stop an in-flight sampling profiler, if the platform
+    // has one. Samples are written to the log for offline
+    // symbolization against the ELF
+    virtual bool profiler_control(bool start) { return false; }
+
+    /*
+      hardware CRC32 engine using the same reflected polynomial as
+      crc_crc32(). Returns false if no engine is available or it is
+      busy, in which case the caller should use the software table
+     */
+    virtual bool crc32_hw(const uint8_t *buf, uint32_t size, uint32_t &crc) { return false; }
+
     // request information on running threads
     virtual void thread_info(ExpandingString &str) {}
 
@@ -181,6 +193,9 @@ public:
     // request information on timer frequencies
     virtual void timer_info(ExpandingString &str) {}
 
+    // request information on effective ADC sample rates
+    virtual void adc_info(ExpandingString &str) {}
+
     // generate Random values
     virtual bool get_random_vals(uint8_t* data, size_t size) { return false; }
 
@@ -139,7 +139,14 @@ bool ByteBuffer::advance(uint32_t n)
     if (n > available()) {
         return false;
     }
-    head = (head + n) % size;
+    // head and n are both below size, so a single conditional
+    // subtraction wraps without the hardware division a modulo costs in
+    // this per-byte hot path
+    uint32_t h = head + n;
+    if (h >= size) {
+        h -= size;
+    }
+    head = h;
     return true;
 }
 
@@ -233,7 +240,12 @@ bool ByteBuffer::commit(uint32_t len)
         return false; //Someone broke the agreement
     }
 
-    tail = (tail + len) % size;
+    // conditional subtraction wraps without a division, see advance()
+    uint32_t t = tail + len;
+    if (t >= size) {
+        t -= size;
+    }
+    tail = t;
     return true;
 }
 
@@ -276,5 +288,10 @@ int16_t ByteBuffer::peek(uint32_t ofs) const
     if (ofs >= available()) {
         return -1;
     }
-    return buf[(head+ofs)%size];
+    // conditional subtraction wraps without a division, see advance()
+    uint32_t idx = head + ofs;
+    if (idx >= size) {
+        idx -= size;
+    }
+    return buf[idx];
 }
@@ -461,6 +461,54 @@ private:
     HAL_Semaphore sem;
 };
 
+/*
+  single-writer mailbox holding the latest copy of an object of fixed
+  size. Unlike ObjectBuffer_TS no lock is taken on either side: the
+  writer publishes under a sequence counter (odd while a write is in
+  progress) and readers retry on a torn copy, so a low-priority reader
+  can never stall the writer and vice versa. Only one thread may
+  write; any number of threads may read
+ */
+template <class T>
+class ObjectMailbox {
+public:
+    // publish a new value, writer thread only
+    void write(const T &object) {
+        const uint32_t seq = _seq.load(std::memory_order_relaxed);
+        // mark a write as being in progress. The release fence keeps
+        // the data writes below from being reordered before this store
+        _seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        _object = object;
+        _seq.store(seq + 2, std::memory_order_release);
+    }
+
+    // copy out the latest value. Returns false if a consistent copy
+    // could not be made, which can only happen if the writer is
+    // publishing continuously
+    bool read(T &object) const {
+        for (uint8_t retries = 0; retries < 4; retries++) {
+            const uint32_t seq = _seq.load(std::memory_order_acquire);
+            if (seq & 1U) {
+                // write in progress
+                continue;
+            }
+            object = _object;
+            // the acquire fence orders the copy above before the
+            // re-check of the sequence counter
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (_seq.load(std::memory_order_relaxed) == seq) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    std::atomic<uint32_t> _seq{0};
+    T _object;
+};
+
 /*
   ring buffer class for objects of fixed size with pointer
   access. Note that this is not thread safe, buf offers efficient
@@ -503,7 +551,7 @@ public:
         if (space() == 0) {
             return false;
         }
-        _buffer[(_head+_count)%_size] = object;
+        _buffer[wrap_index(_head+_count)] = object;
         _count++;
         return true;
     }
@@ -515,7 +563,7 @@ public:
         if (is_empty()) {
             return false;
         }
-        _head = (_head+1) % _size;
+        _head = wrap_index(_head+1);
         _count--;
         return true;
     }
@@ -579,10 +627,16 @@ public:
         if (i >= _count) {
             return nullptr;
         }
-        return &_buffer[(_head+i)%_size];
+        return &_buffer[wrap_index(_head+i)];
     }
 
 private:
+    // indexes are always below 2*_size, so a conditional subtraction
+    // wraps without the division a modulo would cost
+    uint16_t wrap_index(uint32_t i) const {
+        return i >= _size ? i - _size : i;
+    }
+
     T *_buffer;
     uint16_t _size;  // total buffer size
     uint16_t _count; // number in buffer now
@@ -55,6 +55,14 @@
 #define MSG_NOSIGNAL 0
 #endif
 
+// sendmmsg/recvmmsg are Linux syscalls; lwip and other BSD stacks get
+// a per-datagram fallback
+#if defined(__linux__) && !(AP_NETWORKING_BACKEND_CHIBIOS || AP_NETWORKING_BACKEND_PPP)
+#define AP_SOCKET_HAVE_MMSG 1
+#else
+#define AP_SOCKET_HAVE_MMSG 0
+#endif
+
 /*
   constructor
  */
@@ -308,6 +316,122 @@ ssize_t SOCKET_CLASS_NAME::send(const void *buf, size_t size) const
     return CALL_PREFIX(send)(fd, buf, size, MSG_NOSIGNAL);
 }
 
+/*
+  send a batch of datagrams, one kernel crossing on platforms with
+  sendmmsg. Returns the number of whole datagrams sent
+ */
+uint8_t SOCKET_CLASS_NAME::sendm(const Pkt *pkts, uint8_t count)
+{
+    if (fd == -1 || count == 0) {
+        return 0;
+    }
+    uint8_t sent = 0;
+#if AP_SOCKET_HAVE_MMSG
+    struct mmsghdr msgs[count];
+    struct iovec iov[count];
+    memset(msgs, 0, count*sizeof(msgs[0]));
+    for (uint8_t i=0; i<count; i++) {
+        iov[i].iov_base = pkts[i].data;
+        iov[i].iov_len = pkts[i].len;
+        msgs[i].msg_hdr.msg_iov = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+    const int ret = ::sendmmsg(fd, msgs, count, MSG_NOSIGNAL);
+    if (ret > 0) {
+        sent = ret;
+    }
+#else
+    // no batch syscall on this platform; one send per datagram
+    for (uint8_t i=0; i<count; i++) {
+        if (send(pkts[i].data, pkts[i].len) != (ssize_t)pkts[i].len) {
+            break;
+        }
+        sent++;
+    }
+#endif
+    if (sent > 0) {
+        batch_pkts += sent;
+        batch_calls++;
+    }
+    return sent;
+}
+
+/*
+  receive a batch of datagrams, one kernel crossing on platforms with
+  recvmmsg. Only the first datagram waits for up to timeout_ms
+ */
+uint8_t SOCKET_CLASS_NAME::recvm(Pkt *pkts, uint8_t count, uint32_t timeout_ms)
+{
+    if (fd == -1 || count == 0) {
+        return 0;
+    }
+    uint8_t received = 0;
+#if AP_SOCKET_HAVE_MMSG
+    if (!pollin(timeout_ms)) {
+        return 0;
+    }
+    struct mmsghdr msgs[count];
+    struct iovec iov[count];
+    uint32_t addrs[count][4];
+    memset(msgs, 0, count*sizeof(msgs[0]));
+    memset(addrs, 0, count*sizeof(addrs[0]));
+    for (uint8_t i=0; i<count; i++) {
+        iov[i].iov_base = pkts[i].data;
+        iov[i].iov_len = pkts[i].len;
+        msgs[i].msg_hdr.msg_iov = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+        msgs[i].msg_hdr.msg_name = &addrs[i][0];
+        msgs[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+    }
+    const int ret = ::recvmmsg(get_read_fd(), msgs, count, MSG_DONTWAIT, nullptr);
+    if (ret <= 0) {
+        return 0;
+    }
+    // for multicast sockets we must discard packets from ourselves,
+    // as in recv()
+    struct sockaddr_in send_addr {};
+    if (fd_in != -1) {
+        socklen_t send_len = sizeof(send_addr);
+        if (CALL_PREFIX(getsockname)(fd, (struct sockaddr *)&send_addr, &send_len) != 0) {
+            return 0;
+        }
+    }
+    for (int i=0; i<ret; i++) {
+        if (fd_in != -1) {
+            const struct sockaddr_in &sin = *(const struct sockaddr_in *)&addrs[i][0];
+            if (sin.sin_port == send_addr.sin_port &&
+                sin.sin_family == send_addr.sin_family &&
+                sin.sin_addr.s_addr == send_addr.sin_addr.s_addr) {
+                // packet we sent ourselves
+                continue;
+            }
+        }
+        if (received != i) {
+            // compact over a discarded packet
+            memcpy(pkts[received].data, pkts[i].data, msgs[i].msg_len);
+        }
+        pkts[received].len = msgs[i].msg_len;
+        memcpy(last_in_addr, addrs[i], sizeof(last_in_addr));
+        received++;
+    }
+#else
+    // no batch syscall on this platform; one recv per datagram
+    for (uint8_t i=0; i<count; i++) {
+        const ssize_t ret = recv(pkts[i].data, pkts[i].len, i==0?timeout_ms:0);
+        if (ret <= 0) {
+            break;
+        }
+        pkts[i].len = ret;
+        received++;
+    }
+#endif
+    if (received > 0) {
+        batch_pkts += received;
+        batch_calls++;
+    }
+    return received;
+}
+
 /*
   send some data with address as a uint32_t
  */
@@ -46,6 +46,25 @@ public:
     ssize_t sendto(const void *buf, size_t size, uint32_t address, uint16_t port);
     ssize_t recv(void *pkt, size_t size, uint32_t timeout_ms);
 
+    // element of a datagram batch for sendm()/recvm(). recvm()
+    // updates len with the received datagram length
+    struct Pkt {
+        void *data;
+        uint16_t len;
+    };
+
+    // send/receive up to count datagrams on a connected datagram
+    // socket, in a single kernel crossing where the platform supports
+    // it. Returns the number of whole datagrams processed. All
+    // receive buffers should be the same size
+    uint8_t sendm(const Pkt *pkts, uint8_t count);
+    uint8_t recvm(Pkt *pkts, uint8_t count, uint32_t timeout_ms);
+
+    // batch statistics; datagrams over calls gives the average batch
+    // size achieved
+    uint32_t batch_pkts = 0;
+    uint32_t batch_calls = 0;
+
     // return the IP address and port of the last received packet
     void last_recv_address(const char *&ip_addr, uint16_t &port) const;
 
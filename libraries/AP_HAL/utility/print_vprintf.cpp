@@ -81,20 +81,28 @@ void print_vprintf(AP_HAL::BetterStream *s, const char *fmt, va_list ap)
 
         for (;;) {
             /*
-             * Process non-format characters
+             * Process non-format characters, sending each run as a
+             * single block write rather than a write per character
              */
+            const char *literal = fmt;
             for (;;) {
                 c = *fmt++;
+                if (c && c != '%') {
+                    continue;
+                }
+                const size_t n = (fmt - 1) - literal;
+                if (n > 0) {
+                    s->write((const uint8_t *)literal, n);
+                }
                 if (!c) {
                     return;
                 }
-                if (c == '%') {
-                    c = *fmt++;
-                    if (c != '%') {
-                        break;
-                    }
+                c = *fmt++;
+                if (c != '%') {
+                    break;
                 }
-                s->write(c);
+                // literal '%'; start the next run at the second '%'
+                literal = fmt - 1;
             }
 
             flags = 0;
@@ -382,10 +390,9 @@ flt_oper:
                     }
                 }
 
-                while (size) {
-                    s->write(*pnt++);
-                    if (width) width -= 1;
-                    size -= 1;
+                if (size) {
+                    s->write((const uint8_t *)pnt, size);
+                    width = width > size ? width - size : 0;
                 }
                 goto tail;
             }
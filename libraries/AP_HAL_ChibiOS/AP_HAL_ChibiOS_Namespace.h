@@ -30,6 +30,7 @@ namespace ChibiOS {
     class Storage;
     class UARTDriver;
     class Util;
+    class SamplingProfiler;
     class Shared_DMA;
     class SoftSigReader;
     class SoftSigReaderInt;
@@ -18,6 +18,7 @@
 #include "ch.h"
 #include "hal.h"
 #include <AP_Math/AP_Math.h>
+#include <AP_Common/ExpandingString.h>
 
 #if HAL_USE_ADC == TRUE && !defined(HAL_DISABLE_ADC_DRIVER)
 
@@ -38,6 +39,17 @@ extern AP_IOMCU iomcu;
 #define STM32_ADC_DUAL_MODE                 FALSE
 #endif
 
+/*
+  optional hardware oversampling ratio, settable from hwdef. The ADC
+  accumulates this many conversions per sequence slot and shifts the
+  sum back to native scale, reducing noise at zero CPU and DMA
+  cost. Must be a power of two. Only supported on MCUs with ADCv3/v4
+  peripherals (G4/L4/H7)
+ */
+#ifndef HAL_ADC_OVERSAMPLE
+#define HAL_ADC_OVERSAMPLE 1
+#endif
+
 #define ANLOGIN_DEBUGGING 0
 
 // base voltage scaling for 12 bit 3.3V ADC
@@ -570,6 +582,27 @@ void AnalogIn::setup_adc(uint8_t index)
     adcgrpcfg[index].cr2 = ADC_CR2_SWSTART;
 #endif
 
+#if HAL_ADC_OVERSAMPLE > 1
+    static_assert((HAL_ADC_OVERSAMPLE & (HAL_ADC_OVERSAMPLE-1)) == 0, "HAL_ADC_OVERSAMPLE must be a power of two");
+    // the right-shift matches the ratio so oversampled results keep
+    // the native resolution scale
+#if defined(ADC_CFGR_RES_16BITS)
+    // ADCv4 OVSR holds the ratio minus one
+    static_assert(HAL_ADC_OVERSAMPLE <= 1024, "HAL_ADC_OVERSAMPLE too large for this MCU");
+    adcgrpcfg[index].cfgr2 = ADC_CFGR2_ROVSE |
+        ((HAL_ADC_OVERSAMPLE-1U) << ADC_CFGR2_OVSR_Pos) |
+        (__builtin_ctz(HAL_ADC_OVERSAMPLE) << ADC_CFGR2_OVSS_Pos);
+#elif defined(ADC_CFGR_RES_12BITS)
+    // ADCv3 OVSR holds log2 of the ratio minus one
+    static_assert(HAL_ADC_OVERSAMPLE <= 256, "HAL_ADC_OVERSAMPLE too large for this MCU");
+    adcgrpcfg[index].cfgr2 = ADC_CFGR2_ROVSE |
+        ((__builtin_ctz(HAL_ADC_OVERSAMPLE)-1U) << ADC_CFGR2_OVSR_Pos) |
+        (__builtin_ctz(HAL_ADC_OVERSAMPLE) << ADC_CFGR2_OVSS_Pos);
+#else
+#error "HAL_ADC_OVERSAMPLE is not supported on this MCU"
+#endif
+#endif // HAL_ADC_OVERSAMPLE
+
 #if STM32_ADC_DUAL_MODE
     adcgrpcfg[index].ccr = 0;
     if (index == 0) {
@@ -660,6 +693,8 @@ void AnalogIn::read_adc(uint8_t index, uint32_t *val)
     for (uint8_t i = 0; i < num_grp_channels; i++) {
         val[i] = sample_sum[index][i] / sample_count[index];
     }
+    // accumulate for the effective rate reported in @SYS/adc.txt
+    _sample_rate_accum[index] += sample_count[index];
     memset(sample_sum[index], 0, sizeof(uint32_t) * num_grp_channels);
     sample_count[index] = 0;
 #if HAL_WITH_MCU_MONITORING
@@ -767,6 +802,16 @@ void AnalogIn::_timer_tick(void)
     _servorail_voltage = iomcu.get_vservo_adc_count() * (VOLTAGE_SCALING * HAL_IOMCU_VSERVO_SCALAR);
 #endif
 
+    // update the effective per-channel sample rates at 1Hz
+    if (now - _sample_rate_last_us >= 1000000U) {
+        const float dt = (now - _sample_rate_last_us) * 1.0e-6;
+        for (uint8_t i=0; i<HAL_NUM_ANALOG_INPUTS; i++) {
+            _sample_rate_hz[i] = _sample_rate_accum[i] / dt;
+            _sample_rate_accum[i] = 0;
+        }
+        _sample_rate_last_us = now;
+    }
+
 #if HAL_WITH_MCU_MONITORING
     // 20Hz temperature and ref voltage
     static uint32_t last_mcu_temp_us;
@@ -933,4 +978,29 @@ void AnalogIn::update_power_flags(void)
     _accumulated_power_flags |= flags;
     _power_flags = flags;
 }
+
+/*
+  generate the @SYS/adc.txt report, showing the effective sample rate
+  each ADC is delivering per channel after DMA accumulation and any
+  hardware oversampling
+ */
+void AnalogIn::adc_info(ExpandingString &str)
+{
+    static const uint8_t adc_indexes[] = {
+        0,
+#if defined(HAL_ANALOG2_PINS)
+        1,
+#endif
+#if defined(HAL_ANALOG3_PINS)
+        2,
+#endif
+    };
+    str.printf("OVERSAMPLE=%u\n", unsigned(HAL_ADC_OVERSAMPLE));
+    for (const uint8_t index : adc_indexes) {
+        str.printf("ADC%u: %u channels %uHz/channel\n",
+                   unsigned(index+1),
+                   unsigned(get_num_grp_channels(index)),
+                   unsigned(_sample_rate_hz[index]));
+    }
+}
 #endif // HAL_USE_ADC
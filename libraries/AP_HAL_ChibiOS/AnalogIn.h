@@ -19,6 +19,8 @@
 
 #include "AP_HAL_ChibiOS.h"
 
+class ExpandingString;
+
 // available ADC channels for allocation
 #define ANALOG_MAX_CHANNELS 16
 
@@ -80,6 +82,9 @@ public:
     uint16_t power_status_flags(void) override { return _power_flags; }
     uint16_t accumulated_power_status_flags(void) const override { return _accumulated_power_flags; }
 
+    // generate @SYS/adc.txt
+    void adc_info(ExpandingString &str);
+
 #if HAL_WITH_MCU_MONITORING
     float mcu_temperature(void) override { return _mcu_temperature; }
     float mcu_voltage(void) override { return _mcu_voltage; }
@@ -127,6 +132,11 @@ private:
     static uint32_t *sample_sum[HAL_NUM_ANALOG_INPUTS];
     static uint32_t sample_count[HAL_NUM_ANALOG_INPUTS];
 
+    // effective per-channel sample rate of each ADC, for @SYS/adc.txt
+    uint32_t _sample_rate_accum[HAL_NUM_ANALOG_INPUTS];
+    uint32_t _sample_rate_hz[HAL_NUM_ANALOG_INPUTS];
+    uint32_t _sample_rate_last_us;
+
     HAL_Semaphore _semaphore;
 
 #if HAL_WITH_MCU_MONITORING
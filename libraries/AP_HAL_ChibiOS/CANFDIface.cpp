@@ -63,6 +63,10 @@
 
 //Message RAM Allocations in Word lengths
 
+// extended filter elements available to configureFilters(). The G4
+// fixed message RAM layout has room for exactly 8
+#define FDCAN_NUM_EXT_FILTERS 8U
+
 #if defined(STM32H7)
 #define MAX_FILTER_LIST_SIZE 78U            //78 element Standard Filter List elements or 40 element Extended Filter List
 #define FDCAN_NUM_RXFIFO0_SIZE 108U         //6 Frames
@@ -451,6 +455,25 @@ int16_t CANIface::receive(AP_HAL::CANFrame& out_frame, uint64_t& out_timestamp_u
     return AP_HAL::CANIface::receive(out_frame, out_timestamp_us, out_flags);
 }
 
+uint8_t CANIface::receive_batch(CanRxItem *items, uint8_t max)
+{
+    uint8_t n = 0;
+    {
+        CriticalSectionLocker lock;
+        if (!initialised_) {
+            return 0;
+        }
+        while (n < max && rx_queue_.pop(items[n])) {
+            n++;
+        }
+    }
+    // run the frame forwarding callbacks outside the critical section
+    for (uint8_t i = 0; i < n; i++) {
+        AP_HAL::CANIface::receive(items[i].frame, items[i].timestamp_us, items[i].flags);
+    }
+    return n;
+}
+
 bool CANIface::clock_init_ = false;
 bool CANIface::init(const uint32_t bitrate, const uint32_t fdbitrate)
 {
@@ -638,6 +661,62 @@ void CANIface::clear_rx()
     rx_queue_.clear();
 }
 
+/*
+  configure the hardware acceptance filters for extended (29 bit)
+  frames. Frames matching none of the filters are rejected before they
+  cost any interrupt servicing; standard (11 bit) frames are not
+  affected. The peripheral is briefly put back into configuration
+  mode, so this is intended to be called when the filter set changes,
+  not periodically
+ */
+bool CANIface::configureFilters(const CanFilterConfig* filter_configs, uint16_t num_configs)
+{
+    if (!initialised_ || filter_configs == nullptr ||
+        num_configs == 0 || num_configs > FDCAN_NUM_EXT_FILTERS) {
+        return false;
+    }
+
+    // enter configuration mode. The INIT ack can take up to a frame
+    // time while a reception or transmission in progress completes
+    can_->CCCR |= FDCAN_CCCR_INIT;
+    uint32_t while_start_ms = AP_HAL::millis();
+    while ((can_->CCCR & FDCAN_CCCR_INIT) == 0) {
+        if ((AP_HAL::millis() - while_start_ms) > REG_SET_TIMEOUT) {
+            return false;
+        }
+    }
+    can_->CCCR |= FDCAN_CCCR_CCE;
+
+    // write the extended filter elements: classic id+mask filters
+    // storing matches into Rx FIFO0
+    uint32_t *ram = (uint32_t *)MessageRam_.ExtendedFilterSA;
+    for (uint16_t i = 0; i < num_configs; i++) {
+        ram[i*2 + 0] = (1UL << 29) | (filter_configs[i].id & AP_HAL::CANFrame::MaskExtID);
+        ram[i*2 + 1] = (2UL << 30) | (filter_configs[i].mask & AP_HAL::CANFrame::MaskExtID);
+    }
+
+    // reject extended frames matching no filter
+#if defined(STM32G4)
+    can_->RXGFC = (can_->RXGFC & ~(FDCAN_RXGFC_LSE | FDCAN_RXGFC_ANFE)) |
+        (uint32_t(num_configs) << FDCAN_RXGFC_LSE_Pos) |
+        (0x2UL << FDCAN_RXGFC_ANFE_Pos);
+#else
+    can_->XIDFC = (((MessageRam_.ExtendedFilterSA - SRAMCAN_BASE) / 4U) << 2) |
+        (uint32_t(num_configs) << 16);
+    can_->GFC = (can_->GFC & ~FDCAN_GFC_ANFE) | (0x2UL << FDCAN_GFC_ANFE_Pos);
+#endif
+
+    // resume normal operation
+    can_->CCCR &= ~FDCAN_CCCR_INIT;
+    while_start_ms = AP_HAL::millis();
+    while ((can_->CCCR & FDCAN_CCCR_INIT) != 0) {
+        if ((AP_HAL::millis() - while_start_ms) > REG_SET_TIMEOUT) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void CANIface::setupMessageRam()
 {
 #if defined(STM32G4)
@@ -655,6 +734,12 @@ void CANIface::setupMessageRam()
 
     can_->RXESC = 0x777; //Support upto 64byte long frames
     can_->TXESC = 0x7; //Support upto 64byte long frames
+    // Extended filter list start address and element count, for configureFilters()
+    num_elements = FDCAN_NUM_EXT_FILTERS;
+    can_->XIDFC = (FDCANMessageRAMOffset_ << 2) | (num_elements << 16);
+    MessageRam_.ExtendedFilterSA = SRAMCAN_BASE + (FDCANMessageRAMOffset_ * 4U);
+    FDCANMessageRAMOffset_ += num_elements*2;
+
     // Rx FIFO 0 start address and element count
     num_elements = MIN((FDCAN_NUM_RXFIFO0_SIZE/FDCAN_FRAME_BUFFER_SIZE), 64U);
     if (num_elements) {
@@ -725,6 +810,7 @@ bool CANIface::readRxFIFO(uint8_t fifo_index)
         //Register Message Lost as a hardware error
         if ((can_->RXF0S & FDCAN_RXF0S_RF0L) != 0) {
             stats.rx_errors++;
+            stats.rx0_lost++;
         }
 
         if ((can_->RXF0S & FDCAN_RXF0S_F0FL) == 0) {
@@ -743,6 +829,7 @@ bool CANIface::readRxFIFO(uint8_t fifo_index)
         //Register Message Lost as a hardware error
         if ((can_->RXF1S & FDCAN_RXF1S_RF1L) != 0) {
             stats.rx_errors++;
+            stats.rx1_lost++;
         }
 
         if ((can_->RXF1S & FDCAN_RXF1S_F1FL) == 0) {
@@ -988,6 +1075,8 @@ void CANIface::get_stats(ExpandingString &str)
                "tx_abort:       %lu\n"
                "rx_received:    %lu\n"
                "rx_overflow:    %lu\n"
+               "rx0_lost:       %lu\n"
+               "rx1_lost:       %lu\n"
                "rx_errors:      %lu\n"
                "num_busoff_err: %lu\n"
                "num_events:     %lu\n"
@@ -1010,6 +1099,8 @@ void CANIface::get_stats(ExpandingString &str)
                stats.tx_abort,
                stats.rx_received,
                stats.rx_overflow,
+               stats.rx0_lost,
+               stats.rx1_lost,
                stats.rx_errors,
                stats.num_busoff_err,
                stats.num_events,
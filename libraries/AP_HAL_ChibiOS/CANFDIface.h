@@ -162,6 +162,8 @@ class ChibiOS::CANIface : public AP_HAL::CANIface
         uint32_t fdf_tx_requests;
         uint32_t fdf_tx_success;
         uint32_t fdf_rx_received;
+        uint32_t rx0_lost;
+        uint32_t rx1_lost;
     } stats;
 
 public:
@@ -184,11 +186,17 @@ public:
     int16_t send(const AP_HAL::CANFrame& frame, uint64_t tx_deadline,
                  CanIOFlags flags) override;
 
-    // Receive frame from Rx Buffer, returns negative on error, 0 on nothing available, 
+    // Receive frame from Rx Buffer, returns negative on error, 0 on nothing available,
     // 1 on successfully poping a frame
     int16_t receive(AP_HAL::CANFrame& out_frame, uint64_t& out_timestamp_us,
                     CanIOFlags& out_flags) override;
 
+    // batched receive, draining the Rx queue under a single critical section
+    uint8_t receive_batch(CanRxItem *items, uint8_t max) override;
+
+    // configure hardware acceptance filters for extended frames
+    bool configureFilters(const CanFilterConfig *filter_configs, uint16_t num_configs) override;
+
     // returns true if busoff state was detected and not handled yet
     bool is_busoff() const override
     {
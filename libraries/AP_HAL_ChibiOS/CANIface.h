@@ -163,11 +163,14 @@ public:
     int16_t send(const AP_HAL::CANFrame& frame, uint64_t tx_deadline,
                  CanIOFlags flags) override;
 
-    // Receive frame from Rx Buffer, returns negative on error, 0 on nothing available, 
+    // Receive frame from Rx Buffer, returns negative on error, 0 on nothing available,
     // 1 on successfully poping a frame
     int16_t receive(AP_HAL::CANFrame& out_frame, uint64_t& out_timestamp_us,
                     CanIOFlags& out_flags) override;
 
+    // batched receive, draining the Rx queue under a single critical section
+    uint8_t receive_batch(CanRxItem *items, uint8_t max) override;
+
     // In BxCAN the Busoff error is cleared automatically,
     // so always return false
     bool is_busoff() const override
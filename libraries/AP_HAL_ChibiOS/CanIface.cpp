@@ -392,6 +392,22 @@ int16_t CANIface::receive(AP_HAL::CANFrame& out_frame, uint64_t& out_timestamp_u
     return AP_HAL::CANIface::receive(out_frame, out_timestamp_us, out_flags);
 }
 
+uint8_t CANIface::receive_batch(CanRxItem *items, uint8_t max)
+{
+    uint8_t n = 0;
+    {
+        CriticalSectionLocker lock;
+        while (n < max && rx_queue_.pop(items[n])) {
+            n++;
+        }
+    }
+    // run the frame forwarding callbacks outside the critical section
+    for (uint8_t i = 0; i < n; i++) {
+        AP_HAL::CANIface::receive(items[i].frame, items[i].timestamp_us, items[i].flags);
+    }
+    return n;
+}
+
 bool CANIface::waitMsrINakBitStateChange(bool target_state)
 {
     const unsigned Timeout = 1000;
@@ -49,9 +49,21 @@ extern const AP_HAL::HAL& hal;
 // for understanding the underlying theory although we do not use spectral density here since time resolution is equally
 // important as frequency resolution. Referred to as [Heinz] throughout the code.
 
-// initialize the FFT state machine
-AP_HAL::DSP::FFTWindowState* DSP::fft_init(uint16_t window_size, uint16_t sample_rate, uint8_t sliding_window_size)
+// initialize the FFT state machine. A nullptr return for an unsupported window
+// size allows the caller to negotiate the window size downwards
+AP_HAL::DSP::FFTWindowState* DSP::fft_init(uint16_t window_size, uint16_t sample_rate, uint8_t sliding_window_size, bool fixed_point)
 {
+#if HAL_DSP_FIXED_POINT_FFT_ENABLED
+    if (fixed_point) {
+        DSP::FFTWindowStateARMQ15* fft_q15 = NEW_NOTHROW DSP::FFTWindowStateARMQ15(window_size, sample_rate, sliding_window_size);
+        if (fft_q15 == nullptr || fft_q15->_hanning_window == nullptr || fft_q15->_rfft_data == nullptr || fft_q15->_freq_bins == nullptr
+            || fft_q15->_derivative_freq_bins == nullptr || fft_q15->_q15_data == nullptr || fft_q15->_q15_rfft == nullptr) {
+            delete fft_q15;
+            return nullptr;
+        }
+        return fft_q15;
+    }
+#endif
     DSP::FFTWindowStateARM* fft = NEW_NOTHROW DSP::FFTWindowStateARM(window_size, sample_rate, sliding_window_size);
     if (fft == nullptr || fft->_hanning_window == nullptr || fft->_rfft_data == nullptr || fft->_freq_bins == nullptr || fft->_derivative_freq_bins == nullptr) {
         delete fft;
@@ -63,12 +75,25 @@ AP_HAL::DSP::FFTWindowState* DSP::fft_init(uint16_t window_size, uint16_t sample
 // start an FFT analysis
 void DSP::fft_start(FFTWindowState* state, FloatBuffer& samples, uint16_t advance)
 {
-    step_hanning((FFTWindowStateARM*)state, samples, advance);
+    step_hanning(state, samples, advance);
+#if HAL_DSP_FIXED_POINT_FFT_ENABLED
+    if (state->_fixed_point) {
+        step_float_to_q15((FFTWindowStateARMQ15*)state);
+    }
+#endif
 }
 
 // perform remaining steps of an FFT analysis
 uint16_t DSP::fft_analyse(AP_HAL::DSP::FFTWindowState* state, uint16_t start_bin, uint16_t end_bin, float noise_att_cutoff)
 {
+#if HAL_DSP_FIXED_POINT_FFT_ENABLED
+    if (state->_fixed_point) {
+        FFTWindowStateARMQ15* fft_q15 = (FFTWindowStateARMQ15*)state;
+        step_arm_rfft_q15(fft_q15);
+        step_arm_cmplx_mag_f32(fft_q15, start_bin, end_bin, noise_att_cutoff);
+        return step_calc_frequencies_f32(fft_q15, start_bin, end_bin);
+    }
+#endif
     FFTWindowStateARM* fft = (FFTWindowStateARM*)state;
     step_arm_cfft_f32(fft);
     step_bitreversal(fft);
@@ -113,11 +138,55 @@ DSP::FFTWindowStateARM::FFTWindowStateARM(uint16_t window_size, uint16_t sample_
         arm_rfft_1024_fast_init_f32(&_fft_instance);
         break;
 #endif
+    default:
+        // no tables are linked for this window size, free the buffers so that
+        // fft_init() fails and the caller can negotiate the window size down
+        free_data_structures();
+        break;
     }
 }
 
 DSP::FFTWindowStateARM::~FFTWindowStateARM() {}
 
+#if HAL_DSP_FIXED_POINT_FFT_ENABLED
+// gyro samples are in rad/s so need to be scaled into the q15 range of +-1.
+// 1/64 keeps anything up to ~3600deg/s from saturating; the absolute scale
+// does not matter for peak tracking since the noise reference energy is
+// calibrated through the same path
+static const float Q15_INPUT_SCALE = 1.0f / 64.0f;
+
+// create an instance of the fixed-point FFT state machine
+DSP::FFTWindowStateARMQ15::FFTWindowStateARMQ15(uint16_t window_size, uint16_t sample_rate, uint8_t sliding_window_size)
+    : AP_HAL::DSP::FFTWindowState::FFTWindowState(window_size, sample_rate, sliding_window_size, true)
+{
+    if (_freq_bins == nullptr || _hanning_window == nullptr || _rfft_data == nullptr || _derivative_freq_bins == nullptr) {
+        GCS_SEND_TEXT(MAV_SEVERITY_WARNING, "Failed to allocate %u bytes for window %u for DSP",
+            unsigned(sizeof(float) * (window_size * 3 + 2)), unsigned(window_size));
+        return;
+    }
+
+    // unlike the float path the generic init is used, the q15 twiddle tables
+    // are half the size and there are no per-size init functions
+    if (arm_rfft_init_q15(&_fft_instance, window_size, 0, 1) != ARM_MATH_SUCCESS) {
+        // leave _q15_data as nullptr so that fft_init() fails and the
+        // caller can negotiate the window size down
+        return;
+    }
+
+    _q15_data = (q15_t*)hal.util->malloc_type(sizeof(q15_t) * window_size, DSP_MEM_REGION);
+    // the q15 RFFT requires an output buffer of twice the window size
+    _q15_rfft = (q15_t*)hal.util->malloc_type(sizeof(q15_t) * window_size * 2, DSP_MEM_REGION);
+}
+
+DSP::FFTWindowStateARMQ15::~FFTWindowStateARMQ15()
+{
+    hal.util->free_type(_q15_data, sizeof(q15_t) * _window_size, DSP_MEM_REGION);
+    _q15_data = nullptr;
+    hal.util->free_type(_q15_rfft, sizeof(q15_t) * _window_size * 2, DSP_MEM_REGION);
+    _q15_rfft = nullptr;
+}
+#endif // HAL_DSP_FIXED_POINT_FFT_ENABLED
+
 extern "C" {
     void stage_rfft_f32(arm_rfft_fast_instance_f32 *S, float32_t *p, float32_t *pOut);
     void arm_cfft_radix8by2_f32(arm_cfft_instance_f32 *S, float32_t *p1);
@@ -127,7 +196,7 @@ extern "C" {
 }
 
 // step 1: filter the incoming samples through a Hanning window
-void DSP::step_hanning(FFTWindowStateARM* fft, FloatBuffer& samples, uint16_t advance)
+void DSP::step_hanning(FFTWindowState* fft, FloatBuffer& samples, uint16_t advance)
 {
     TIMER_START(_hanning_timer);
 
@@ -209,8 +278,37 @@ void DSP::step_stage_rfft_f32(FFTWindowStateARM* fft)
     TIMER_END(_stage_rfft_f32_timer);
 }
 
+#if HAL_DSP_FIXED_POINT_FFT_ENABLED
+// step 1 (fixed point): scale the windowed samples into q15
+void DSP::step_float_to_q15(FFTWindowStateARMQ15* fft)
+{
+    arm_scale_f32(fft->_freq_bins, Q15_INPUT_SCALE, fft->_freq_bins, fft->_window_size);
+    arm_float_to_q15(fft->_freq_bins, fft->_q15_data, fft->_window_size);
+}
+
+// steps 2-4 (fixed point): compute the real FFT in q15 and convert the result
+// back to float so that the magnitude and frequency estimation steps can be
+// shared with the float pipeline. On F4 this takes roughly half the cycles of
+// steps 2-4 of the float pipeline at the same window size
+void DSP::step_arm_rfft_q15(FFTWindowStateARMQ15* fft)
+{
+    arm_rfft_q15(&fft->_fft_instance, fft->_q15_data, fft->_q15_rfft);
+
+    // the q15 RFFT internally downshifts by log2(N) bits to avoid overflow,
+    // undo that and the input scaling so that the bin energies are comparable
+    // with those of the float pipeline
+    arm_q15_to_float(fft->_q15_rfft, fft->_rfft_data, fft->_window_size + 2);
+    const float scale = float(fft->_window_size) / Q15_INPUT_SCALE;
+    arm_scale_f32(fft->_rfft_data, scale, fft->_rfft_data, fft->_window_size + 2);
+
+    // the q15 RFFT emits DC and Nyquist as full complex pairs whereas
+    // stage_rfft_f32 packs the Nyquist real component at index 1
+    fft->_rfft_data[1] = fft->_rfft_data[fft->_window_size];
+}
+#endif // HAL_DSP_FIXED_POINT_FFT_ENABLED
+
 // step 5: find the magnitudes of the complex data
-void DSP::step_arm_cmplx_mag_f32(FFTWindowStateARM* fft, uint16_t start_bin, uint16_t end_bin, float noise_att_cutoff)
+void DSP::step_arm_cmplx_mag_f32(FFTWindowState* fft, uint16_t start_bin, uint16_t end_bin, float noise_att_cutoff)
 {
     TIMER_START(_arm_cmplx_mag_f32_timer);
 
@@ -236,7 +334,7 @@ void DSP::step_arm_cmplx_mag_f32(FFTWindowStateARM* fft, uint16_t start_bin, uin
 }
 
 // step 6: find the bin with the highest energy and interpolate the required frequency
-uint16_t DSP::step_calc_frequencies_f32(FFTWindowStateARM* fft, uint16_t start_bin, uint16_t end_bin)
+uint16_t DSP::step_calc_frequencies_f32(FFTWindowState* fft, uint16_t start_bin, uint16_t end_bin)
 {
     TIMER_START(_step_calc_frequencies);
     // 4us H7
@@ -262,7 +360,7 @@ static const float CANDAN_FACTOR = tanf(PI_N) / PI_N;
 
 // Interpolate center frequency using http://users.metu.edu.tr/ccandan//pub_dir/FineDopplerEst_IEEE_SPL_June2011.pdf
 // This is slightly less accurate than Quinn, but much cheaper to calculate
-float DSP::calculate_candans_estimator(const FFTWindowStateARM* fft, uint16_t k_max) const
+float DSP::calculate_candans_estimator(const FFTWindowState* fft, uint16_t k_max) const
 {
     if (k_max <= 1 || k_max == fft->_bin_count) {
         return 0.0f;
@@ -25,11 +25,22 @@
 
 #define DEBUG_FFT   0
 
+// q15 fixed-point FFT engine. The q15 twiddle and bit-reversal tables cost flash
+// on every board that links them so this is only enabled by default on F4 where
+// the float RFFT is the CPU bottleneck; other boards can opt in from hwdef
+#ifndef HAL_DSP_FIXED_POINT_FFT_ENABLED
+#if defined(STM32F4)
+#define HAL_DSP_FIXED_POINT_FFT_ENABLED 1
+#else
+#define HAL_DSP_FIXED_POINT_FFT_ENABLED 0
+#endif
+#endif
+
 // ChibiOS implementation of FFT analysis to run on STM32 processors
 class ChibiOS::DSP : public AP_HAL::DSP {
 public:
     // initialise an FFT instance
-    virtual FFTWindowState* fft_init(uint16_t window_size, uint16_t sample_rate, uint8_t sliding_window_size) override;
+    virtual FFTWindowState* fft_init(uint16_t window_size, uint16_t sample_rate, uint8_t sliding_window_size, bool fixed_point) override;
     // start an FFT analysis with an ObjectBuffer
     virtual void fft_start(FFTWindowState* state, FloatBuffer& samples, uint16_t advance) override;
     // perform remaining steps of an FFT analysis
@@ -47,6 +58,26 @@ public:
         arm_rfft_fast_instance_f32 _fft_instance;
     };
 
+#if HAL_DSP_FIXED_POINT_FFT_ENABLED
+    // STM32-based FFT state using the CMSIS q15 fixed-point RFFT. The transform
+    // itself runs in q15, the magnitude and frequency estimation steps are
+    // shared with the float pipeline by converting the result back to float
+    class FFTWindowStateARMQ15 : public AP_HAL::DSP::FFTWindowState {
+        friend class ChibiOS::DSP;
+    public:
+        FFTWindowStateARMQ15(uint16_t window_size, uint16_t sample_rate, uint8_t sliding_window_size);
+        virtual ~FFTWindowStateARMQ15();
+
+    private:
+        // underlying CMSIS data structure for fixed-point FFT analysis
+        arm_rfft_instance_q15 _fft_instance;
+        // q15 copy of the windowed input samples
+        q15_t* _q15_data = nullptr;
+        // q15 FFT output, the q15 RFFT does not work in place
+        q15_t* _q15_rfft = nullptr;
+    };
+#endif
+
 protected:
     void vector_max_float(const float* vin, uint16_t len, float* maxValue, uint16_t* maxIndex) const override {
         uint32_t mindex;
@@ -67,14 +98,19 @@ protected:
 
 private:
     // following are the six independent steps for calculating an FFT
-    void step_hanning(FFTWindowStateARM* fft, FloatBuffer& samples, uint16_t advance);
+    void step_hanning(FFTWindowState* fft, FloatBuffer& samples, uint16_t advance);
     void step_arm_cfft_f32(FFTWindowStateARM* fft);
     void step_bitreversal(FFTWindowStateARM* fft);
     void step_stage_rfft_f32(FFTWindowStateARM* fft);
-    void step_arm_cmplx_mag_f32(FFTWindowStateARM* fft, uint16_t start_bin, uint16_t end_bin, float noise_att_cutoff);
-    uint16_t step_calc_frequencies_f32(FFTWindowStateARM* fft, uint16_t start_bin, uint16_t end_bin);
+    void step_arm_cmplx_mag_f32(FFTWindowState* fft, uint16_t start_bin, uint16_t end_bin, float noise_att_cutoff);
+    uint16_t step_calc_frequencies_f32(FFTWindowState* fft, uint16_t start_bin, uint16_t end_bin);
     // candan's frequency interpolator
-    float calculate_candans_estimator(const FFTWindowStateARM* fft, uint16_t k) const;
+    float calculate_candans_estimator(const FFTWindowState* fft, uint16_t k) const;
+#if HAL_DSP_FIXED_POINT_FFT_ENABLED
+    // fixed-point counterparts of steps 1 and 2-4
+    void step_float_to_q15(FFTWindowStateARMQ15* fft);
+    void step_arm_rfft_q15(FFTWindowStateARMQ15* fft);
+#endif
 
 #if DEBUG_FFT
     class StepTimer {
@@ -17,6 +17,7 @@
 #include "Device.h"
 
 #include <AP_HAL/AP_HAL.h>
+#include <AP_Common/ExpandingString.h>
 #include <stdio.h>
 
 #if HAL_USE_I2C == TRUE || HAL_USE_SPI == TRUE || HAL_USE_WSPI == TRUE
@@ -30,10 +31,20 @@
 #define HAL_DEVICE_THREAD_STACK 1024
 #endif
 
+// number of periodic callback nodes in the shared pool. Exceeding
+// this is not an error, further registrations come from the heap
+#ifndef HAL_DEVICE_NUM_CALLBACKS
+#define HAL_DEVICE_NUM_CALLBACKS 24
+#endif
+
 using namespace ChibiOS;
 
 extern const AP_HAL::HAL& hal;
 
+#if !defined(HAL_BOOTLOADER_BUILD)
+AP_PoolAllocator DeviceBus::callback_pool{"BusCB", sizeof(DeviceBus::callback_info), HAL_DEVICE_NUM_CALLBACKS};
+#endif
+
 DeviceBus::DeviceBus(uint8_t _thread_priority) :
         thread_priority(_thread_priority)
 {
@@ -57,25 +68,44 @@ void DeviceBus::bus_thread(void *arg)
 
     while (true) {
         uint64_t now = AP_HAL::micros64();
-        DeviceBus::callback_info *callback;
 
-        // find a callback to run
-        for (callback = binfo->callbacks; callback; callback = callback->next) {
-            if (now >= callback->next_usec) {
-                while (now >= callback->next_usec) {
-                    callback->next_usec += callback->period_usec;
+        // run due callbacks most-overdue first, so a fast device is
+        // not held behind a slow device that happens to be earlier in
+        // the callback list
+        while (true) {
+            DeviceBus::callback_info *due = nullptr;
+            for (auto *callback : binfo->callbacks) {
+                if (now >= callback->next_usec &&
+                    (due == nullptr || callback->next_usec < due->next_usec)) {
+                    due = callback;
                 }
+            }
+            if (due == nullptr) {
+                break;
+            }
+            while (now >= due->next_usec) {
+                due->next_usec += due->period_usec;
+            }
+            const uint32_t start_us = AP_HAL::micros();
+            {
                 // call it with semaphore held
                 WITH_SEMAPHORE(binfo->semaphore);
-                callback->cb();
+                due->cb();
+            }
+            const uint32_t time_taken_us = AP_HAL::micros() - start_us;
+            due->tick_count++;
+            due->elapsed_us += time_taken_us;
+            if (time_taken_us > due->max_us) {
+                due->max_us = time_taken_us;
             }
+            now = AP_HAL::micros64();
         }
 
         // work out when next loop is needed
         uint64_t next_needed = 0;
         now = AP_HAL::micros64();
 
-        for (callback = binfo->callbacks; callback; callback = callback->next) {
+        for (auto *callback : binfo->callbacks) {
             if (next_needed == 0 ||
                 callback->next_usec < next_needed) {
                 next_needed = callback->next_usec;
@@ -136,7 +166,12 @@ AP_HAL::Device::PeriodicHandle DeviceBus::register_periodic_callback(uint32_t pe
             AP_HAL::panic("Failed to create bus thread %s", name);
         }
     }
-    DeviceBus::callback_info *callback = NEW_NOTHROW DeviceBus::callback_info;
+    callback_pool.init();
+    auto *callback = (DeviceBus::callback_info *)callback_pool.alloc();
+    if (callback == nullptr) {
+        // more devices than pool blocks; fall back to the heap
+        callback = NEW_NOTHROW DeviceBus::callback_info;
+    }
     if (callback == nullptr) {
         return nullptr;
     }
@@ -145,8 +180,7 @@ AP_HAL::Device::PeriodicHandle DeviceBus::register_periodic_callback(uint32_t pe
     callback->next_usec = AP_HAL::micros64() + period_usec;
 
     // add to linked list of callbacks on thread
-    callback->next = callbacks;
-    callbacks = callback;
+    callbacks.push_front(callback);
 
     return callback;
 }
@@ -170,6 +204,39 @@ bool DeviceBus::adjust_timer(AP_HAL::Device::PeriodicHandle h, uint32_t period_u
     return true;
 }
 
+/*
+  dump per-callback timing statistics, one line per registered
+  periodic callback
+ */
+void DeviceBus::bus_info(ExpandingString &str) const
+{
+    for (const auto *cb : callbacks) {
+        const uint32_t avg_us = cb->tick_count > 0 ? cb->elapsed_us / cb->tick_count : 0;
+        str.printf("  period=%8luus ticks=%8lu avg=%5luus max=%5luus\n",
+                   (unsigned long)cb->period_usec,
+                   (unsigned long)cb->tick_count,
+                   (unsigned long)avg_us,
+                   (unsigned long)cb->max_us);
+    }
+}
+
+/*
+  fraction of bus thread time consumed by the registered periodic
+  callbacks. Callbacks on one bus run sequentially from the same
+  thread, so the per-callback average runtimes divided by their
+  periods sum to the load on the bus
+ */
+float DeviceBus::utilization(void) const
+{
+    float total = 0;
+    for (const auto *cb : callbacks) {
+        if (cb->tick_count > 0 && cb->period_usec > 0) {
+            total += (float(cb->elapsed_us) / cb->tick_count) / float(cb->period_usec);
+        }
+    }
+    return total;
+}
+
 /*
   setup to use DMA-safe bouncebuffers for device transfers
  */
@@ -28,6 +28,12 @@
 #include "Scheduler.h"
 #include "shared_dma.h"
 #include "hwdef/common/bouncebuffer.h"
+#include <AP_Common/AP_IntrusiveList.h>
+#if !defined(HAL_BOOTLOADER_BUILD)
+#include <AP_Common/AP_PoolAllocator.h>
+#endif
+
+class ExpandingString;
 
 namespace ChibiOS {
 
@@ -53,13 +59,31 @@ public:
                             uint8_t *&buf_rx, uint16_t rx_len) WARN_IF_UNUSED;
     void bouncebuffer_finish(const uint8_t *buf_tx, uint8_t *buf_rx, uint16_t rx_len);
 
+    // dump per-callback timing statistics
+    void bus_info(ExpandingString &str) const;
+
+    // fraction of bus thread time consumed by the registered periodic
+    // callbacks, from the measured per-callback timing
+    float utilization(void) const;
+
 private:
     struct callback_info {
         struct callback_info *next;
         AP_HAL::Device::PeriodicCb cb;
         uint32_t period_usec;
         uint64_t next_usec;
-    } *callbacks;
+        // timing accounting for @SYS/i2c.txt
+        uint32_t tick_count;
+        uint32_t elapsed_us;
+        uint32_t max_us;
+    };
+    AP_IntrusiveList<callback_info> callbacks;
+
+#if !defined(HAL_BOOTLOADER_BUILD)
+    // fixed pool the callback nodes are drawn from, shared between
+    // all buses so device registration does not touch the main heap
+    static AP_PoolAllocator callback_pool;
+#endif
     uint8_t thread_priority;
     thread_t* thread_ctx;
     bool thread_started;
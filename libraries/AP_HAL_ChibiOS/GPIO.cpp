@@ -48,6 +48,15 @@ struct gpio_entry {
     uint16_t isr_quota;
     uint8_t isr_disabled_ticks;
     AP_HAL::GPIO::INTERRUPT_TRIGGER_TYPE isr_mode;
+#if AP_GPIO_DEFERRED_IRQ_ENABLED
+    uint16_t max_irq_latency_us; // worst edge-capture to dispatch latency
+#endif
+    // pulse-period accumulation state (attach_pulse_accumulator)
+    uint32_t period_sum_us;
+    uint32_t period_count;
+    uint32_t last_edge_us;
+    uint32_t period_min_us;
+    uint32_t period_max_us;
 };
 
 #ifdef HAL_GPIO_PINS
@@ -301,6 +310,23 @@ extern const AP_HAL::HAL& hal;
 
 static void pal_interrupt_cb(void *arg);
 static void pal_interrupt_cb_functor(void *arg);
+static void pal_interrupt_cb_accum(void *arg);
+
+#if AP_GPIO_DEFERRED_IRQ_ENABLED
+/*
+  pending pin events captured in the ISR for dispatch on the gpio_irq
+  thread. Filled under system lock from interrupt context
+ */
+static struct pin_event {
+    struct gpio_entry *g;
+    uint32_t timestamp_us;
+    uint8_t pin_state;
+} irq_events[16];
+static uint8_t irq_events_head;
+static uint8_t irq_events_tail;
+static uint32_t irq_events_dropped;
+static thread_t *irq_thread_ctx;
+#endif
 
 /*
    Attach an interrupt handler to a GPIO pin number. The pin number
@@ -314,6 +340,16 @@ bool GPIO::attach_interrupt(uint8_t pin,
     if (!g) {
         return false;
     }
+#if AP_GPIO_DEFERRED_IRQ_ENABLED
+    if (!irq_thread_started && fn) {
+        irq_thread_started = true;
+        // if thread creation fails the ISR falls back to calling the
+        // handler directly
+        hal.scheduler->thread_create(FUNCTOR_BIND_MEMBER(&GPIO::irq_thread, void),
+                                     "gpio_irq", 768,
+                                     AP_HAL::Scheduler::PRIORITY_TIMER, 1);
+    }
+#endif
     g->isr_disabled_ticks = 0;
     g->isr_quota = 0;
     if (!_attach_interrupt(g->pal_line,
@@ -393,6 +429,63 @@ bool GPIO::_attach_interrupt(ioline_t line, palcallback_t cb, void *p, uint8_t m
     return ret;
 }
 
+/*
+  attach a pulse-period accumulator to a pin. Periods between
+  successive edges are summed in interrupt context with no event
+  queueing or thread wakeup, and read out in batches with
+  read_pulse_periods(). Periods outside [period_min_us, period_max_us]
+  are treated as signal bounce or gaps and discarded
+ */
+bool GPIO::attach_pulse_accumulator(uint8_t pin, INTERRUPT_TRIGGER_TYPE mode,
+                                    uint32_t period_min_us, uint32_t period_max_us)
+{
+    struct gpio_entry *g = gpio_by_pin_num(pin, false);
+    if (!g) {
+        return false;
+    }
+    g->isr_disabled_ticks = 0;
+    g->isr_quota = 0;
+    g->period_sum_us = 0;
+    g->period_count = 0;
+    g->last_edge_us = 0;
+    g->period_min_us = period_min_us;
+    g->period_max_us = period_max_us;
+    if (!_attach_interrupt(g->pal_line,
+                           palcallback_t(pal_interrupt_cb_accum),
+                           g,
+                           mode)) {
+        return false;
+    }
+    g->isr_mode = mode;
+    return true;
+}
+
+bool GPIO::detach_pulse_accumulator(uint8_t pin)
+{
+    struct gpio_entry *g = gpio_by_pin_num(pin, false);
+    if (!g) {
+        return false;
+    }
+    g->isr_mode = INTERRUPT_NONE;
+    return _attach_interrupt(g->pal_line, palcallback_t(nullptr), nullptr, INTERRUPT_NONE);
+}
+
+// retrieve and reset the accumulated period sum and edge count
+bool GPIO::read_pulse_periods(uint8_t pin, uint32_t &period_sum_us, uint32_t &period_count)
+{
+    struct gpio_entry *g = gpio_by_pin_num(pin, false);
+    if (!g) {
+        return false;
+    }
+    osalSysLock();
+    period_sum_us = g->period_sum_us;
+    period_count = g->period_count;
+    g->period_sum_us = 0;
+    g->period_count = 0;
+    osalSysUnlock();
+    return true;
+}
+
 #endif // PAL_USE_CALLBACKS == TRUE
 
 bool GPIO::usb_connected(void)
@@ -476,9 +569,89 @@ static void pal_interrupt_cb_functor(void *arg)
         }
         g->isr_quota--;
     }
+#if AP_GPIO_DEFERRED_IRQ_ENABLED
+    if (irq_thread_ctx != nullptr) {
+        // queue the event for dispatch on the gpio_irq thread,
+        // keeping ISR residency to edge timestamp capture only
+        osalSysLockFromISR();
+        const uint8_t next = (irq_events_tail + 1) % ARRAY_SIZE(irq_events);
+        if (next == irq_events_head) {
+            irq_events_dropped++;
+        } else {
+            irq_events[irq_events_tail].g = g;
+            irq_events[irq_events_tail].timestamp_us = now;
+            irq_events[irq_events_tail].pin_state = palReadLine(g->pal_line);
+            irq_events_tail = next;
+        }
+        chEvtSignalI(irq_thread_ctx, EVENT_MASK(0));
+        osalSysUnlockFromISR();
+        return;
+    }
+#endif
     (g->fn)(g->pin_num, palReadLine(g->pal_line), now);
 }
 
+/*
+  pulse-period accumulator ISR. Keeps only a few instructions in
+  interrupt context and never wakes the dispatch thread, so high-rate
+  inputs such as RPM sensors cost almost nothing per pulse
+ */
+static void pal_interrupt_cb_accum(void *arg)
+{
+    const uint32_t now = AP_HAL::micros();
+
+    struct gpio_entry *g = (gpio_entry *)arg;
+    if (g == nullptr) {
+        return;
+    }
+    const uint32_t dt = now - g->last_edge_us;
+    const bool have_last_edge = g->last_edge_us != 0;
+    g->last_edge_us = now;
+    if (!have_last_edge) {
+        // first edge after attach; no period yet
+        return;
+    }
+    if (dt < g->period_min_us || dt > g->period_max_us) {
+        // signal bounce or a gap in the signal
+        return;
+    }
+    g->period_sum_us += dt;
+    g->period_count++;
+}
+
+#if AP_GPIO_DEFERRED_IRQ_ENABLED
+/*
+  dispatch thread for deferred GPIO interrupt callbacks. Handlers get
+  the timestamp captured in the ISR so edge timing is unaffected by
+  dispatch latency, which is tracked per pin
+ */
+void GPIO::irq_thread(void)
+{
+    irq_thread_ctx = chThdGetSelfX();
+    while (true) {
+        chEvtWaitAnyTimeout(ALL_EVENTS, chTimeMS2I(100));
+        while (true) {
+            chSysLock();
+            if (irq_events_head == irq_events_tail) {
+                chSysUnlock();
+                break;
+            }
+            const struct pin_event ev = irq_events[irq_events_head];
+            irq_events_head = (irq_events_head + 1) % ARRAY_SIZE(irq_events);
+            chSysUnlock();
+
+            const uint32_t latency_us = AP_HAL::micros() - ev.timestamp_us;
+            if (latency_us > ev.g->max_irq_latency_us) {
+                ev.g->max_irq_latency_us = MIN(latency_us, UINT16_MAX);
+            }
+            if (ev.g->fn) {
+                (ev.g->fn)(ev.g->pin_num, ev.pin_state, ev.timestamp_us);
+            }
+        }
+    }
+}
+#endif // AP_GPIO_DEFERRED_IRQ_ENABLED
+
 #endif // PAL_USE_CALLBACKS == TRUE
 
 /*
@@ -612,6 +785,16 @@ void GPIO::set_mode(uint8_t pin, uint32_t mode)
 */
 void GPIO::timer_tick()
 {
+#if AP_GPIO_DEFERRED_IRQ_ENABLED
+    // report overflow of the deferred dispatch queue; edges are never
+    // silently lost without it being visible
+    static uint32_t last_dropped;
+    if (irq_events_dropped != last_dropped) {
+        last_dropped = irq_events_dropped;
+        GCS_SEND_TEXT(MAV_SEVERITY_ERROR, "GPIO IRQ queue overflow (%u)",
+                      unsigned(irq_events_dropped));
+    }
+#endif
     // allow 100k interrupts/second max for GPIO interrupt sources, which is
     // 10k per 100ms call to timer_tick()
 #if HAVE_GPIO_PINS
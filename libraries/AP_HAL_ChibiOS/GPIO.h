@@ -18,6 +18,20 @@
 
 #include "AP_HAL_ChibiOS.h"
 
+/*
+  run GPIO interrupt callbacks on a high priority thread with the
+  timestamp captured in the ISR, rather than in interrupt
+  context. This keeps heavy handlers (camera feedback, RPM capture)
+  from adding jitter to everything else while preserving edge timing
+ */
+#ifndef AP_GPIO_DEFERRED_IRQ_ENABLED
+#if defined(IOMCU_FW) || defined(HAL_BOOTLOADER_BUILD) || PAL_USE_CALLBACKS != TRUE
+#define AP_GPIO_DEFERRED_IRQ_ENABLED 0
+#else
+#define AP_GPIO_DEFERRED_IRQ_ENABLED 1
+#endif
+#endif
+
 /*
   pin types for alternative configuration
  */
@@ -53,6 +67,12 @@ public:
     bool    attach_interrupt(uint8_t pin,
                              irq_handler_fn_t fn,
                              INTERRUPT_TRIGGER_TYPE mode) override;
+
+    /* Pulse-period accumulation - batched edge timing without a callback per pulse */
+    bool    attach_pulse_accumulator(uint8_t pin, INTERRUPT_TRIGGER_TYPE mode,
+                                     uint32_t period_min_us, uint32_t period_max_us) override;
+    bool    detach_pulse_accumulator(uint8_t pin) override;
+    bool    read_pulse_periods(uint8_t pin, uint32_t &period_sum_us, uint32_t &period_count) override;
 #endif // PAL_USE_CALLBACKS == TRUE
 
     /* return true if USB cable is connected */
@@ -99,6 +119,12 @@ private:
     bool _usb_connected;
     bool _ext_started;
 
+#if AP_GPIO_DEFERRED_IRQ_ENABLED
+    // thread running the deferred interrupt callbacks
+    void irq_thread(void);
+    bool irq_thread_started;
+#endif
+
     bool _attach_interruptI(ioline_t line, palcallback_t cb, void *p, uint8_t mode);
     bool _attach_interrupt(ioline_t line, palcallback_t cb, void *p, uint8_t mode);
 #ifdef HAL_PIN_ALT_CONFIG
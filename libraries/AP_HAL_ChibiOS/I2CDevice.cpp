@@ -18,6 +18,7 @@
 
 #include <AP_HAL/AP_HAL.h>
 #include <AP_Math/AP_Math.h>
+#include <AP_Common/ExpandingString.h>
 #include "Util.h"
 #include "GPIO.h"
 
@@ -479,6 +480,32 @@ uint32_t I2CDeviceManager::get_bus_mask_internal(void) const
     return get_bus_mask() & HAL_I2C_INTERNAL_MASK;
 }
 
+/*
+  dump per-bus callback timing statistics for @SYS/i2c.txt
+ */
+void I2CDeviceManager::bus_info(ExpandingString &str) const
+{
+    str.printf("I2CV1\n");
+    for (uint8_t i = 0; i < ARRAY_SIZE(I2CD); i++) {
+        str.printf("I2C%u clock=%lukHz\n", unsigned(i + HAL_I2C_BUS_BASE),
+                   (unsigned long)(businfo[i].busclock / 1000));
+        businfo[i].bus_info(str);
+    }
+}
+
+/*
+  get the fraction of bus time consumed by periodic callbacks on a bus
+*/
+bool I2CDeviceManager::get_bus_utilization(uint8_t bus, float &utilization) const
+{
+    bus -= HAL_I2C_BUS_BASE;
+    if (bus >= ARRAY_SIZE(I2CD)) {
+        return false;
+    }
+    utilization = businfo[bus].utilization();
+    return true;
+}
+
 /*
   get mask of bus numbers for all configured external I2C buses
 */
@@ -146,6 +146,16 @@ public:
       get mask of bus numbers for all configured internal I2C buses
      */
     uint32_t get_bus_mask_internal(void) const override;
+
+    /*
+      dump per-bus callback timing statistics for @SYS/i2c.txt
+     */
+    void bus_info(ExpandingString &str) const override;
+
+    /*
+      get the fraction of bus time consumed by periodic callbacks on a bus
+     */
+    bool get_bus_utilization(uint8_t bus, float &utilization) const override;
 };
 }
 
@@ -4,7 +4,10 @@
 
 #define LOG_IDS_FROM_HAL_CHIBIOS \
     LOG_MON_MSG,                 \
-    LOG_WDOG_MSG
+    LOG_WDOG_MSG,                \
+    LOG_WDBB_MSG,                \
+    LOG_MEMF_MSG,                \
+    LOG_PROF_MSG
 
 // @LoggerMessage: MON
 // @Description: Main loop performance monitoring message.
@@ -70,8 +73,58 @@ struct PACKED log_WDOG {
     char thread_name4[4];
 };
 
+// @LoggerMessage: WDBB
+// @Description: Watchdog black box, main loop samples leading up to the reset
+// @Field: TimeUS: Time since system startup
+// @Field: SMS: sample time in milliseconds since the boot that was reset
+// @Field: Dly: main loop delay at sample time
+// @Field: Tsk: scheduler task running at sample time
+// @Field: Sem: true if a semaphore was held at sample time
+struct PACKED log_WDBB {
+    LOG_PACKET_HEADER;
+    uint64_t time_us;
+    uint32_t sample_ms;
+    uint16_t loop_delay_ms;
+    int8_t scheduler_task;
+    uint8_t semaphore_held;
+};
+
+// @LoggerMessage: MEMF
+// @Description: Heap free memory and fragmentation, one instance per heap
+// @Field: TimeUS: Time since system startup
+// @Field: Heap: heap index
+// @Field: Free: total free bytes
+// @Field: Lrg: largest free fragment in bytes
+// @Field: Frag: number of free fragments
+struct PACKED log_MEMF {
+    LOG_PACKET_HEADER;
+    uint64_t time_us;
+    uint8_t heap;
+    uint32_t free_bytes;
+    uint32_t largest;
+    uint16_t fragments;
+};
+
+// @LoggerMessage: PROF
+// @Description: Sampling profiler program-counter sample
+// @Field: TimeUS: time the sample was captured
+// @Field: PC: program counter of the interrupted context
+// @Field: TN: name of the interrupted thread
+struct PACKED log_PROF {
+    LOG_PACKET_HEADER;
+    uint64_t time_us;
+    uint32_t pc;
+    char thread_name4[4];
+};
+
 #define LOG_STRUCTURE_FROM_HAL_CHIBIOS                                  \
     { LOG_MON_MSG, sizeof(log_MON),                                     \
       "MON","QIbIHHHHHII","TimeUS,Dly,Tsk,IErr,IErrCnt,IErrLn,MM,MC,SmLn,SPICnt,I2CCnt", "s----------", "F----------", false }, \
     { LOG_WDOG_MSG, sizeof(log_WDOG),                                   \
-     "WDOG","QbIHHHHHHHIBIIn","TimeUS,Tsk,IE,IEC,IEL,MvMsg,MvCmd,SmLn,FL,FT,FA,FP,ICSR,LR,TN", "s--------------", "F--------------", false },
+     "WDOG","QbIHHHHHHHIBIIn","TimeUS,Tsk,IE,IEC,IEL,MvMsg,MvCmd,SmLn,FL,FT,FA,FP,ICSR,LR,TN", "s--------------", "F--------------", false }, \
+    { LOG_WDBB_MSG, sizeof(log_WDBB),                                   \
+     "WDBB","QIHbB","TimeUS,SMS,Dly,Tsk,Sem", "sss--", "FCC--", false }, \
+    { LOG_MEMF_MSG, sizeof(log_MEMF),                                   \
+     "MEMF","QBIIH","TimeUS,Heap,Free,Lrg,Frag", "s#bb-", "F----", false }, \
+    { LOG_PROF_MSG, sizeof(log_PROF),                                   \
+     "PROF","QIn","TimeUS,PC,TN", "s--", "F--", false },
@@ -69,12 +69,9 @@ bool RCInput::new_input()
     if (!_init) {
         return false;
     }
-    bool valid;
-    {
-        WITH_SEMAPHORE(rcin_mutex);
-        valid = _rcin_timestamp_last_signal != _last_read;
-        _last_read = _rcin_timestamp_last_signal;
-    }
+    update_frame();
+    const bool valid = last_frame.timestamp_us != _last_read;
+    _last_read = last_frame.timestamp_us;
 
     return valid;
 }
@@ -84,20 +81,20 @@ uint8_t RCInput::num_channels()
     if (!_init) {
         return 0;
     }
-    return _num_channels;
+    update_frame();
+    return last_frame.num_channels;
 }
 
 uint16_t RCInput::read(uint8_t channel)
 {
-    if (!_init || (channel >= MIN(RC_INPUT_MAX_CHANNELS, _num_channels))) {
+    if (!_init) {
         return 0;
     }
-    uint16_t v;
-    {
-        WITH_SEMAPHORE(rcin_mutex);
-        v = _rc_values[channel];
+    update_frame();
+    if (channel >= MIN(RC_INPUT_MAX_CHANNELS, last_frame.num_channels)) {
+        return 0;
     }
-    return v;
+    return last_frame.values[channel];
 }
 
 uint8_t RCInput::read(uint16_t* periods, uint8_t len)
@@ -109,10 +106,8 @@ uint8_t RCInput::read(uint16_t* periods, uint8_t len)
     if (len > RC_INPUT_MAX_CHANNELS) {
         len = RC_INPUT_MAX_CHANNELS;
     }
-    {
-        WITH_SEMAPHORE(rcin_mutex);
-        memcpy(periods, _rc_values, len*sizeof(periods[0]));
-    }
+    update_frame();
+    memcpy(periods, last_frame.values, len*sizeof(periods[0]));
     return len;
 }
 
@@ -153,13 +148,13 @@ void RCInput::_timer_tick(void)
 #endif
 
     if (rcprot.new_input()) {
-        WITH_SEMAPHORE(rcin_mutex);
-        _rcin_timestamp_last_signal = AP_HAL::micros();
-        _num_channels = rcprot.num_channels();
-        _num_channels = MIN(_num_channels, RC_INPUT_MAX_CHANNELS);
-        rcprot.read(_rc_values, _num_channels);
-        _rssi = rcprot.get_RSSI();
-        _rx_link_quality = rcprot.get_rx_link_quality();
+        RCFrame frame {};
+        frame.timestamp_us = AP_HAL::micros();
+        frame.num_channels = MIN(rcprot.num_channels(), RC_INPUT_MAX_CHANNELS);
+        rcprot.read(frame.values, frame.num_channels);
+        frame.rssi = rcprot.get_RSSI();
+        frame.rx_link_quality = rcprot.get_rx_link_quality();
+        rcin_mailbox.write(frame);
     }
 
 #endif  // AP_RCPROTOCOL_ENABLED
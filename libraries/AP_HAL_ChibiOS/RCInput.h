@@ -19,6 +19,7 @@
 #include "AP_HAL_ChibiOS.h"
 #include "Semaphores.h"
 
+#include <AP_HAL/utility/RingBuffer.h>
 #include <AP_RCProtocol/AP_RCProtocol.h>
 
 #if HAL_USE_ICU == TRUE
@@ -46,23 +47,42 @@ public:
     void pulse_input_enable(bool enable) override;
 
     int16_t get_rssi(void) override {
-        return _rssi;
+        update_frame();
+        return last_frame.rssi;
     }
     int16_t get_rx_link_quality(void) override {
-        return _rx_link_quality;
+        update_frame();
+        return last_frame.rx_link_quality;
     }
 
     void _timer_tick(void);
 
 private:
-    uint16_t _rc_values[RC_INPUT_MAX_CHANNELS] = {0};
-
-    uint64_t _last_read;
-    uint8_t _num_channels;
-    Semaphore rcin_mutex;
-    int16_t _rssi = -1;
-    int16_t _rx_link_quality = -1;
-    uint32_t _rcin_timestamp_last_signal;
+    // snapshot of the last decoded RC frame, published from the RC
+    // protocol thread through a lock-free mailbox so a reader can
+    // never stall the protocol thread and vice versa
+    struct RCFrame {
+        uint16_t values[RC_INPUT_MAX_CHANNELS];
+        uint8_t num_channels;
+        int16_t rssi;
+        int16_t rx_link_quality;
+        uint32_t timestamp_us;
+    };
+    ObjectMailbox<RCFrame> rcin_mailbox;
+
+    // consumer-side copy of the last consistent frame
+    RCFrame last_frame {{0}, 0, -1, -1, 0};
+
+    // refresh last_frame from the mailbox, keeping the previous copy
+    // if the writer is mid-publish
+    void update_frame(void) {
+        RCFrame frame;
+        if (rcin_mailbox.read(frame)) {
+            last_frame = frame;
+        }
+    }
+
+    uint32_t _last_read;
     bool _init;
 
     bool pulse_input_enabled;
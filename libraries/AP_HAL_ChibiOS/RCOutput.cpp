@@ -1006,6 +1006,10 @@ bool RCOutput::setup_group_DMA(pwm_group &group, uint32_t bitrate, uint32_t bit_
         }
         group.dma_buffer_len = buffer_length;
     }
+#if HAL_SERIALLED_ENABLED
+    // any cached serial LED pulse train is no longer valid
+    group.serial_led_encoded = false;
+#endif
     // reset the pulse time inside the lock
     group.dshot_pulse_time_us = group.dshot_pulse_send_time_us = pulse_time_us;
 
@@ -1376,6 +1380,11 @@ void RCOutput::push(void)
     }
     corked = false;
     memcpy(period, period_corked, sizeof(period));
+#if HAL_DSHOT_ENABLED
+    // mark when the new setpoints were handed to us so the rcout
+    // thread can account the latency to the pulses going out
+    last_push_us = rcout_micros();
+#endif
     push_local();
 #if HAL_WITH_IO_MCU
     if (iomcu_enabled) {
@@ -1504,6 +1513,21 @@ void RCOutput::dshot_send_groups(rcout_timer_t cycle_start_us, rcout_timer_t tim
         // got a new command
     }
 
+    // account the latency from push() to the pulses going out. Only
+    // the first send of a cycle is correlated with a push(), synthetic
+    // sends at higher dshot rates are not
+    const rcout_timer_t push_us = last_push_us;
+    if (push_us != 0) {
+        last_push_us = 0;
+        const uint32_t latency_us = rcout_micros() - push_us;
+        output_latency_sum_us += latency_us;
+        output_latency_count++;
+        output_latency_max_us = MAX(output_latency_max_us, latency_us);
+        if (output_latency_min_us == 0 || latency_us < output_latency_min_us) {
+            output_latency_min_us = latency_us;
+        }
+    }
+
     for (auto &group : pwm_group_list) {
         bool pulse_sent = false;
         // send a dshot command
@@ -2068,6 +2092,10 @@ bool RCOutput::serial_write_byte(uint8_t b)
     pwm_group &group = *serial_group;
 
     memset(group.dma_buffer, 0, DSHOT_BUFFER_LENGTH);
+#if HAL_SERIALLED_ENABLED
+    // the DMA buffer no longer holds an encoded LED pulse train
+    group.serial_led_encoded = false;
+#endif
     fill_DMA_buffer_byte(group.dma_buffer+group.serial.chan, 4, b, group.bit_width_mul*BYTE_BITS);
 
     group.in_serial_dma = true;
@@ -2599,6 +2627,11 @@ bool RCOutput::set_serial_led_num_LEDs(const uint16_t chan, uint8_t num_leds, ou
 // Fill the group DMA buffer with data to be output
 void RCOutput::fill_DMA_buffer_serial_led(pwm_group& group)
 {
+    if (group.serial_led_encoded) {
+        // the buffer still holds the pulse train for the current
+        // colors; no need to re-encode a static pattern
+        return;
+    }
     memset(group.dma_buffer, 0, group.dma_buffer_len);
     for (uint8_t j = 0; j < 4; j++) {
         if (group.serial_led_data[j] == nullptr) {
@@ -2636,6 +2669,7 @@ void RCOutput::fill_DMA_buffer_serial_led(pwm_group& group)
             }
         }
     }
+    group.serial_led_encoded = true;
 }
 
 /*
@@ -2797,11 +2831,17 @@ void RCOutput::serial_led_set_single_rgb_data(pwm_group& group, uint8_t idx, uin
     switch (group.current_mode) {
         case MODE_PROFILED:
         case MODE_NEOPIXEL:
-        case MODE_NEOPIXELRGB:
-            group.serial_led_data[idx][led].red = red;
-            group.serial_led_data[idx][led].green = green;
-            group.serial_led_data[idx][led].blue = blue;
+        case MODE_NEOPIXELRGB: {
+            SerialLed &data = group.serial_led_data[idx][led];
+            if (data.red != red || data.green != green || data.blue != blue) {
+                data.red = red;
+                data.green = green;
+                data.blue = blue;
+                // colors changed, the encoded buffer is now stale
+                group.serial_led_encoded = false;
+            }
             break;
+        }
         default:
             break;
     }
@@ -2864,9 +2904,24 @@ void RCOutput::timer_info(ExpandingString &str)
             target_freq = protocol_bitrate(group.current_mode) * NEOP_BIT_WIDTH_TICKS;
         }
         const uint32_t prescaler = calculate_bitrate_prescaler(group.pwm_drv->clock, target_freq, at_least_freq);
-        str.printf("TIM%-2u CLK=%4uMhz MODE=%5s FREQ=%8u TGT=%8u\n", group.timer_id, unsigned(group.pwm_drv->clock / 1000000),
+        str.printf("TIM%-2u CLK=%4uMhz MODE=%5s FREQ=%8u TGT=%8u", group.timer_id, unsigned(group.pwm_drv->clock / 1000000),
             get_output_mode_string(group.current_mode),
             unsigned(group.pwm_drv->clock / (prescaler + 1)), unsigned(target_freq));
+#ifdef HAL_WITH_BIDIR_DSHOT
+        if (group.bdshot.telem_decode_count > 0) {
+            str.printf(" DEC_AVG=%2uus DEC_MAX=%2uus",
+                unsigned(group.bdshot.telem_decode_us / group.bdshot.telem_decode_count),
+                unsigned(group.bdshot.telem_decode_max_us));
+        }
+#endif
+        str.printf("\n");
+    }
+    if (output_latency_count > 0) {
+        str.printf("PUSH2PULSE AVG=%3uus MIN=%3uus MAX=%3uus N=%u\n",
+            unsigned(output_latency_sum_us / output_latency_count),
+            unsigned(output_latency_min_us),
+            unsigned(output_latency_max_us),
+            unsigned(output_latency_count));
     }
 #endif
 }
@@ -386,6 +386,9 @@ private:
         enum output_mode led_mode;
         volatile bool serial_led_pending;
         volatile bool prepared_send;
+        // true when the DMA buffer already holds the encoded pulse train
+        // for the current colors, allowing re-encoding to be skipped
+        bool serial_led_encoded;
         HAL_Semaphore serial_led_mutex;
         // structure to hold serial LED data until it can be transferred
         // to the DMA buffer
@@ -422,7 +425,14 @@ private:
             uint8_t prev_telem_chan;
             Shared_DMA *curr_ic_dma_handle; // a shortcut to avoid logic errors involving the wrong lock
             uint16_t telempsc;
-            dmar_uint_t dma_buffer_copy[GCR_TELEMETRY_BIT_LEN];
+            // copy of the capture buffer, allocated from fast (DTCM)
+            // memory where available so that the GCR decode runs
+            // cache-resident rather than out of main SRAM
+            dmar_uint_t *dma_buffer_copy;
+            // time spent decoding telemetry, surfaced via @SYS/timers.txt
+            uint32_t telem_decode_us;
+            uint32_t telem_decode_count;
+            uint32_t telem_decode_max_us;
 #if RCOU_DSHOT_TIMING_DEBUG
             uint16_t telem_rate[4];
             uint16_t telem_err_rate[4];
@@ -599,6 +609,16 @@ private:
     // force triggering of groups, this is used by the rate thread to ensure output occurs
     bool force_trigger;
 
+#if HAL_DSHOT_ENABLED
+    // latency from a push() to the pulses for that push going out,
+    // reported in timer_info for @SYS/timers.txt
+    rcout_timer_t last_push_us;
+    uint32_t output_latency_sum_us;
+    uint32_t output_latency_min_us;
+    uint32_t output_latency_max_us;
+    uint32_t output_latency_count;
+#endif
+
 #if HAL_DSHOT_ENABLED
     // dshot commands
     // RingBuffer to store outgoing request.
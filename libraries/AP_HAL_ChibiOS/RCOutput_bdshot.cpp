@@ -177,6 +177,16 @@ bool RCOutput::bdshot_setup_group_ic_DMA(pwm_group &group)
         }
     }
 
+    // allocate the capture copy buffer from fast memory where available
+    // so that the GCR decode works on cache-resident (DTCM) data. On
+    // MCUs without a fast region this falls back to the main heap
+    if (!group.bdshot.dma_buffer_copy) {
+        group.bdshot.dma_buffer_copy = (dmar_uint_t *)hal.util->malloc_type(GCR_TELEMETRY_BUFFER_LEN, AP_HAL::Util::MEM_FAST);
+        if (!group.bdshot.dma_buffer_copy) {
+            goto ic_dma_fail;
+        }
+    }
+
     // now allocate the starting channel
     for (uint8_t i = 0; i < 4; i++) {
         if (group.chan[i] != CHAN_DISABLED && group.bdshot.ic_dma_handle[i] != nullptr) {
@@ -271,12 +281,21 @@ void RCOutput::bdshot_prepare_for_next_pulse(pwm_group& group)
     if (group.dshot_state == DshotState::RECV_COMPLETE) {
         uint8_t chan = group.chan[group.bdshot.prev_telem_chan];
         uint32_t now = AP_HAL::millis();
+        const rcout_timer_t decode_start_us = rcout_micros();
         if (bdshot_decode_dshot_telemetry(group, group.bdshot.prev_telem_chan)) {
             _bdshot.erpm_clean_frames[chan]++;
             _active_escs_mask |= (1<<chan); // we know the ESC is functional at this point
         } else {
             _bdshot.erpm_errors[chan]++;
         }
+        // account for time spent decoding telemetry, this is a
+        // surprisingly large cost at high dshot rates
+        const uint32_t decode_us = uint32_t(rcout_micros() - decode_start_us);
+        group.bdshot.telem_decode_us += decode_us;
+        group.bdshot.telem_decode_count++;
+        if (decode_us > group.bdshot.telem_decode_max_us) {
+            group.bdshot.telem_decode_max_us = decode_us;
+        }
         // reset statistics periodically
         if (now - _bdshot.erpm_last_stats_ms[chan] > 5000) {
             _bdshot.erpm_clean_frames[chan] = 0;
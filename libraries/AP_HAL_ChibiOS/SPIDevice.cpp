@@ -311,6 +311,48 @@ bool SPIDevice::transfer(const uint8_t *send, uint32_t send_len,
     return ret;
 }
 
+/*
+  transfer a chain of segments as a single DMA job with one chip-select
+  window. The segments are gathered into one contiguous buffer so the
+  bus only wakes the thread once for the whole chain
+ */
+bool SPIDevice::transfer_chained(const TransferSegment *segments, uint8_t num_segments)
+{
+    if (!bus.semaphore.check_owner()) {
+        return false;
+    }
+    uint32_t total_len = 0;
+    for (uint8_t i = 0; i < num_segments; i++) {
+        total_len += segments[i].len;
+    }
+    if (total_len == 0) {
+        return true;
+    }
+    uint8_t buf[total_len];
+    uint32_t ofs = 0;
+    for (uint8_t i = 0; i < num_segments; i++) {
+        const TransferSegment &seg = segments[i];
+        if (seg.send != nullptr) {
+            memcpy(&buf[ofs], seg.send, seg.len);
+        } else {
+            memset(&buf[ofs], 0, seg.len);
+        }
+        ofs += seg.len;
+    }
+    bool ret = do_transfer(buf, buf, total_len);
+    if (ret) {
+        ofs = 0;
+        for (uint8_t i = 0; i < num_segments; i++) {
+            const TransferSegment &seg = segments[i];
+            if (seg.recv != nullptr) {
+                memcpy(seg.recv, &buf[ofs], seg.len);
+            }
+            ofs += seg.len;
+        }
+    }
+    return ret;
+}
+
 bool SPIDevice::transfer_fullduplex(const uint8_t *send, uint8_t *recv, uint32_t len)
 {
     if (!bus.semaphore.check_owner()) {
@@ -508,6 +550,20 @@ void SPIDeviceManager::set_register_rw_callback(const char* name, AP_HAL::Device
 
 }
 
+/*
+  get the fraction of bus time consumed by periodic callbacks on a bus
+ */
+bool SPIDeviceManager::get_bus_utilization(uint8_t bus, float &utilization) const
+{
+    for (SPIBus *busp = buses; busp; busp = (SPIBus *)busp->next) {
+        if (busp->bus == bus) {
+            utilization = busp->utilization();
+            return true;
+        }
+    }
+    return false;
+}
+
 
 #ifdef HAL_SPI_CHECK_CLOCK_FREQ
 
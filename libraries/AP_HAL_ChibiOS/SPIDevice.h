@@ -106,6 +106,9 @@ public:
     /* See AP_HAL::SPIDevice::transfer_fullduplex() */
     bool transfer_fullduplex(uint8_t *send_recv, uint32_t len) override;
 
+    /* See AP_HAL::Device::transfer_chained() */
+    bool transfer_chained(const TransferSegment *segments, uint8_t num_segments) override;
+
     /*
         Links the bank select callback to the spi bus, so that even when
         used outside of the driver bank selection can be done.
@@ -184,6 +187,11 @@ public:
 
     void set_register_rw_callback(const char* name, AP_HAL::Device::RegisterRWCb cb) override;
 
+    /*
+      get the fraction of bus time consumed by periodic callbacks on a bus
+     */
+    bool get_bus_utilization(uint8_t bus, float &utilization) const override;
+
 private:
     static SPIDesc device_table[];
     SPIBus *buses;
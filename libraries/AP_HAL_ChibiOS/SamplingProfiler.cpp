@@ -0,0 +1,138 @@
+/*
+ * This file is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This file is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "SamplingProfiler.h"
+
+#if HAL_SAMPLING_PROFILER_ENABLED
+
+#include <AP_HAL/AP_HAL.h>
+#include <AP_Logger/AP_Logger.h>
+#include <GCS_MAVLink/GCS.h>
+#include "LogStructure.h"
+
+using namespace ChibiOS;
+
+extern const AP_HAL::HAL& hal;
+
+/*
+  timer interrupt, capture the program counter of the interrupted
+  context. The virtual timer callback runs in the system timer
+  interrupt which stacks the interrupted context's registers on the
+  process stack when it preempts thread mode, so the PC is at offset 6
+  in the exception frame. When the timer preempted another interrupt
+  the frame still holds the last interrupted thread, so time spent in
+  interrupt handlers is attributed to the thread they preempted, which
+  is acceptable for a statistical profile
+ */
+void SamplingProfiler::timer_cb(virtual_timer_t *vt, void *arg)
+{
+    SamplingProfiler *p = (SamplingProfiler *)arg;
+
+    chSysLockFromISR();
+    if (p->running) {
+        chVTSetI(vt, chTimeUS2I(1000000U / PROFILER_RATE_HZ), timer_cb, arg);
+    }
+    chSysUnlockFromISR();
+
+    uint32_t psp;
+    __asm volatile ("mrs %0, psp" : "=r" (psp));
+    if (psp == 0 || (psp & 3U) != 0) {
+        return;
+    }
+
+    const uint16_t next_head = (p->head + 1) % PROFILER_NUM_SAMPLES;
+    if (next_head == p->tail) {
+        // the IO thread is not keeping up
+        p->dropped++;
+        return;
+    }
+    struct sample &s = p->samples[p->head];
+    s.time_us = AP_HAL::micros();
+    s.pc = ((const uint32_t *)psp)[6];
+    const char *name = chRegGetThreadNameX(chThdGetSelfX());
+    for (uint8_t i=0; i<sizeof(s.thread_name4); i++) {
+        s.thread_name4[i] = name ? name[i] : 0;
+        if (name && name[i] == 0) {
+            name = nullptr;
+        }
+    }
+    p->head = next_head;
+}
+
+/*
+  write buffered samples to the log. Called from the IO thread
+ */
+void SamplingProfiler::drain(void)
+{
+#if HAL_LOGGING_ENABLED
+    if (head == tail) {
+        return;
+    }
+    AP_Logger *logger = AP_Logger::get_singleton();
+    if (logger == nullptr) {
+        return;
+    }
+    const uint64_t now64 = AP_HAL::micros64();
+    uint8_t count = 0;
+    while (tail != head && count++ < 64) {
+        const struct sample &s = samples[tail];
+        struct log_PROF pkt {
+            LOG_PACKET_HEADER_INIT(LOG_PROF_MSG),
+            // extend the 32 bit capture time to 64 bits; samples are
+            // never buffered for anywhere near a 32 bit wrap
+            time_us   : now64 - uint32_t(now64 - s.time_us),
+            pc        : s.pc,
+        };
+        memcpy(pkt.thread_name4, s.thread_name4, sizeof(pkt.thread_name4));
+        logger->WriteBlock(&pkt, sizeof(pkt));
+        tail = (tail + 1) % PROFILER_NUM_SAMPLES;
+    }
+#endif
+}
+
+/*
+  start or stop sampling
+ */
+bool SamplingProfiler::control(bool start)
+{
+    if (!start) {
+        if (running) {
+            running = false;
+            chVTReset(&timer);
+            GCS_SEND_TEXT(MAV_SEVERITY_INFO, "Profiler: stopped (%u dropped)", unsigned(dropped));
+        }
+        return true;
+    }
+    if (running) {
+        return true;
+    }
+    if (samples == nullptr) {
+        samples = NEW_NOTHROW struct sample[PROFILER_NUM_SAMPLES];
+        if (samples == nullptr) {
+            return false;
+        }
+    }
+    if (!io_registered) {
+        hal.scheduler->register_io_process(FUNCTOR_BIND_MEMBER(&SamplingProfiler::drain, void));
+        io_registered = true;
+    }
+    head = tail = 0;
+    dropped = 0;
+    running = true;
+    chVTSet(&timer, chTimeUS2I(1000000U / PROFILER_RATE_HZ), timer_cb, this);
+    GCS_SEND_TEXT(MAV_SEVERITY_INFO, "Profiler: sampling at %uHz", unsigned(PROFILER_RATE_HZ));
+    return true;
+}
+
+#endif // HAL_SAMPLING_PROFILER_ENABLED
@@ -0,0 +1,63 @@
+/*
+ * This file is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This file is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "AP_HAL_ChibiOS.h"
+#include <ch.h>
+
+#ifndef HAL_SAMPLING_PROFILER_ENABLED
+#define HAL_SAMPLING_PROFILER_ENABLED 0
+#endif
+
+#if HAL_SAMPLING_PROFILER_ENABLED
+
+/*
+  statistical sampling profiler. A virtual timer captures the program
+  counter of the interrupted context at PROFILER_RATE_HZ into a ring
+  buffer which is drained to PROF log messages from the IO thread. The
+  PC samples are symbolized offline against the matching ELF, giving a
+  flame-graph style profile of where cycles go in flight without a
+  debugger attached.
+ */
+class ChibiOS::SamplingProfiler {
+public:
+    // start or stop sampling. Returns false if start fails
+    bool control(bool start);
+
+private:
+    static const uint16_t PROFILER_RATE_HZ = 1000;
+    static const uint16_t PROFILER_NUM_SAMPLES = 256;
+
+    struct sample {
+        uint32_t time_us;
+        uint32_t pc;
+        char thread_name4[4];
+    };
+
+    static void timer_cb(virtual_timer_t *vt, void *arg);
+    void drain(void);
+
+    virtual_timer_t timer;
+    struct sample *samples;
+    // head is only written from the timer interrupt, tail only from
+    // the IO thread
+    volatile uint16_t head;
+    volatile uint16_t tail;
+    volatile bool running;
+    bool io_registered;
+    uint32_t dropped;
+};
+
+#endif // HAL_SAMPLING_PROFILER_ENABLED
@@ -408,6 +408,28 @@ bool Scheduler::in_expected_delay(void) const
 }
 
 #if HAL_MONITOR_THREAD_ENABLED
+#if HAL_LOGGING_ENABLED
+/*
+  watchdog black box: a ring of main loop state samples kept in the
+  noinit part of the .ram0 section so it survives a watchdog
+  reset. The backup registers only give us the final state before the
+  reset; this gives the few seconds of history leading up to it. It is
+  written to the log as WDBB messages on the boot after a watchdog
+ */
+struct blackbox_sample {
+    uint32_t time_ms;
+    uint16_t loop_delay_ms;
+    int8_t scheduler_task;
+    uint8_t semaphore_held;
+};
+static struct {
+    uint32_t magic;
+    uint32_t head;
+    struct blackbox_sample samples[32];
+} blackbox __attribute__((section(".ram0")));
+#define BLACKBOX_MAGIC 0x57444242 // 'WDBB'
+#endif // HAL_LOGGING_ENABLED
+
 void Scheduler::_monitor_thread(void *arg)
 {
     Scheduler *sched = (Scheduler *)arg;
@@ -419,6 +441,24 @@ void Scheduler::_monitor_thread(void *arg)
     bool using_watchdog = AP_BoardConfig::watchdog_enabled();
 #if HAL_LOGGING_ENABLED
     uint8_t log_wd_counter = 0;
+#if CH_CFG_USE_HEAP == TRUE
+    uint8_t log_mem_counter = 0;
+#endif
+
+    // take a copy of the previous boot's black box before we start
+    // overwriting it, then reset the ring for this boot
+    static struct blackbox_sample last_samples[ARRAY_SIZE(blackbox.samples)];
+    uint32_t last_head = 0;
+    bool have_blackbox = false;
+    if (hal.util->was_watchdog_reset() &&
+        blackbox.magic == BLACKBOX_MAGIC &&
+        blackbox.head < ARRAY_SIZE(blackbox.samples)) {
+        memcpy(last_samples, blackbox.samples, sizeof(last_samples));
+        last_head = blackbox.head;
+        have_blackbox = true;
+    }
+    memset(&blackbox, 0, sizeof(blackbox));
+    blackbox.magic = BLACKBOX_MAGIC;
 #endif
 
     while (true) {
@@ -432,6 +472,20 @@ void Scheduler::_monitor_thread(void *arg)
 
         uint32_t now = AP_HAL::millis();
         uint32_t loop_delay = now - sched->last_watchdog_pat_ms;
+
+#if HAL_LOGGING_ENABLED
+        // record a sample in the watchdog black box
+        {
+            const AP_HAL::Util::PersistentData &pd = hal.util->persistent_data;
+            struct blackbox_sample &s = blackbox.samples[blackbox.head];
+            s.time_ms = now;
+            s.loop_delay_ms = MIN(loop_delay, 0xFFFFU);
+            s.scheduler_task = pd.scheduler_task;
+            s.semaphore_held = pd.semaphore_line != 0;
+            blackbox.head = (blackbox.head + 1) % ARRAY_SIZE(blackbox.samples);
+        }
+#endif
+
         if (loop_delay >= 200) {
             // the main loop has been stuck for at least
             // 200ms. Starting logging the main loop state
@@ -479,6 +533,31 @@ void Scheduler::_monitor_thread(void *arg)
         }
 #endif
 
+#if HAL_LOGGING_ENABLED && CH_CFG_USE_HEAP == TRUE
+    if (log_mem_counter++ == 10 && AP_Logger::get_singleton() && AP::logger().logging_started()) {
+        // log free memory and fragmentation of each heap at 1Hz, so
+        // fragmentation-induced allocation failures can be seen
+        // developing rather than only at the point of failure
+        log_mem_counter = 0;
+        memory_heap_t *heaps;
+        const struct memory_region *regions;
+        const uint8_t num_heaps = malloc_get_heaps(&heaps, &regions);
+        for (uint8_t i=0; i<num_heaps; i++) {
+            size_t totalp = 0, largest = 0;
+            const size_t nfrags = chHeapStatus(i == 0 ? nullptr : &heaps[i], &totalp, &largest);
+            const struct log_MEMF memf{
+                LOG_PACKET_HEADER_INIT(LOG_MEMF_MSG),
+                time_us    : AP_HAL::micros64(),
+                heap       : i,
+                free_bytes : uint32_t(totalp),
+                largest    : uint32_t(largest),
+                fragments  : uint16_t(MIN(nfrags, 0xFFFFU))
+            };
+            AP::logger().WriteBlock(&memf, sizeof(memf));
+        }
+    }
+#endif
+
 #if HAL_LOGGING_ENABLED
     if (log_wd_counter++ == 10 && hal.util->was_watchdog_reset()) {
         log_wd_counter = 0;
@@ -504,6 +583,27 @@ void Scheduler::_monitor_thread(void *arg)
         memcpy(wdog.thread_name4, pd.thread_name4, ARRAY_SIZE(wdog.thread_name4));
 
         AP::logger().WriteCriticalBlock(&wdog, sizeof(wdog));
+
+        if (have_blackbox) {
+            // dump the previous boot's black box once, oldest sample first
+            have_blackbox = false;
+            for (uint8_t i = 0; i < ARRAY_SIZE(last_samples); i++) {
+                const struct blackbox_sample &s = last_samples[(last_head + i) % ARRAY_SIZE(last_samples)];
+                if (s.time_ms == 0) {
+                    // the ring never wrapped
+                    continue;
+                }
+                const struct log_WDBB wdbb{
+                    LOG_PACKET_HEADER_INIT(LOG_WDBB_MSG),
+                    time_us        : AP_HAL::micros64(),
+                    sample_ms      : s.time_ms,
+                    loop_delay_ms  : s.loop_delay_ms,
+                    scheduler_task : s.scheduler_task,
+                    semaphore_held : s.semaphore_held
+                };
+                AP::logger().WriteCriticalBlock(&wdbb, sizeof(wdbb));
+            }
+        }
     }
 #endif // HAL_LOGGING_ENABLED
 
@@ -251,11 +251,23 @@ void Storage::_timer_tick(void)
     }
     if (_dirty_mask.empty()) {
         _last_empty_ms = AP_HAL::millis();
+#ifdef STORAGE_FLASH_PAGE
+        if (_initialisedType == StorageBackend::Flash) {
+            // reclaim any sector left full by a sector switch while
+            // we have nothing else to do. Doing the erase here, while
+            // idle and disarmed, means a write never has to do it
+            // synchronously when both sectors fill up
+            _flash.process_pending_erase();
+        }
+#endif
         return;
     }
 
-    // write out the first dirty line. We don't write more
-    // than one to keep the latency of this call to a minimum
+    // write out the first run of dirty lines. Coalescing adjacent
+    // dirty lines into one write lets the backends amortise their
+    // per-transaction costs (journal headers on flash, bus
+    // transactions on FRAM, the fsync on microSD), which matters a
+    // lot for bulk updates such as mission upload
     uint16_t i;
     for (i=0; i<CH_STORAGE_NUM_LINES; i++) {
         if (_dirty_mask.get(i)) {
@@ -266,18 +278,26 @@ void Storage::_timer_tick(void)
         // this shouldn't be possible
         return;
     }
+    uint16_t nlines = 1;
+    while (i+nlines < CH_STORAGE_NUM_LINES &&
+           nlines < CH_STORAGE_MAX_WRITE_LINES &&
+           _dirty_mask.get(i+nlines)) {
+        nlines++;
+    }
+    const uint32_t offset = uint32_t(CH_STORAGE_LINE_SIZE)*i;
+    const uint32_t nbytes = uint32_t(CH_STORAGE_LINE_SIZE)*nlines;
 
     {
-        // take a copy of the line we are writing with a semaphore held
+        // take a copy of the lines we are writing with a semaphore held
         WITH_SEMAPHORE(sem);
-        memcpy(tmpline, &_buffer[CH_STORAGE_LINE_SIZE*i], CH_STORAGE_LINE_SIZE);
+        memcpy(tmpline, &_buffer[offset], nbytes);
     }
 
     bool write_ok = false;
 
 #if HAL_WITH_RAMTRON
     if (_initialisedType == StorageBackend::FRAM) {
-        if (fram.write(CH_STORAGE_LINE_SIZE*i, tmpline, CH_STORAGE_LINE_SIZE)) {
+        if (fram.write(offset, tmpline, nbytes)) {
             write_ok = true;
         }
     }
@@ -285,11 +305,10 @@ void Storage::_timer_tick(void)
 
 #ifdef USE_POSIX
     if ((_initialisedType == StorageBackend::SDCard) && log_fd != -1) {
-        uint32_t offset = CH_STORAGE_LINE_SIZE*i;
-        if (AP::FS().lseek(log_fd, offset, SEEK_SET) != offset) {
+        if (AP::FS().lseek(log_fd, offset, SEEK_SET) != (off_t)offset) {
             return;
         }
-        if (AP::FS().write(log_fd, &_buffer[offset], CH_STORAGE_LINE_SIZE) != CH_STORAGE_LINE_SIZE) {
+        if (AP::FS().write(log_fd, tmpline, nbytes) != (ssize_t)nbytes) {
             return;
         }
         if (AP::FS().fsync(log_fd) != 0) {
@@ -302,7 +321,7 @@ void Storage::_timer_tick(void)
 #ifdef STORAGE_FLASH_PAGE
     if (_initialisedType == StorageBackend::Flash) {
         // save to storage backend
-        if (_flash_write(i)) {
+        if (_flash_write(i, nlines)) {
             write_ok = true;
         }
     }
@@ -310,14 +329,18 @@ void Storage::_timer_tick(void)
 
     if (write_ok) {
         WITH_SEMAPHORE(sem);
-        // while holding the semaphore we check if the copy of the
+        // while holding the semaphore we check if the copy of each
         // line is different from the original line. If it is
         // different then someone has re-dirtied the line while we
         // were writing it, in which case we should not mark it
         // clean. If it matches then we know we can mark the line as
         // clean
-        if (memcmp(tmpline, &_buffer[CH_STORAGE_LINE_SIZE*i], CH_STORAGE_LINE_SIZE) == 0) {
-            _dirty_mask.clear(i);
+        for (uint16_t j=0; j<nlines; j++) {
+            if (memcmp(&tmpline[CH_STORAGE_LINE_SIZE*j],
+                       &_buffer[offset + CH_STORAGE_LINE_SIZE*j],
+                       CH_STORAGE_LINE_SIZE) == 0) {
+                _dirty_mask.clear(i+j);
+            }
         }
     }
 }
@@ -345,13 +368,13 @@ void Storage::_flash_load(void)
 }
 
 /*
-  write one storage line. This also updates _dirty_mask.
+  write a run of storage lines. This also updates _dirty_mask.
 */
-bool Storage::_flash_write(uint16_t line)
+bool Storage::_flash_write(uint16_t line, uint16_t nlines)
 {
 #ifdef STORAGE_FLASH_PAGE
     EXPECT_DELAY_MS(1);
-    return _flash.write(line*CH_STORAGE_LINE_SIZE, CH_STORAGE_LINE_SIZE);
+    return _flash.write(line*CH_STORAGE_LINE_SIZE, nlines*CH_STORAGE_LINE_SIZE);
 #else
     return false;
 #endif
@@ -44,6 +44,16 @@
 #define CH_STORAGE_LINE_SIZE (1<<CH_STORAGE_LINE_SHIFT)
 #define CH_STORAGE_NUM_LINES (CH_STORAGE_SIZE/CH_STORAGE_LINE_SIZE)
 
+// maximum bytes written per _timer_tick; adjacent dirty lines are
+// coalesced into a single backend write up to this size so that bulk
+// updates (eg. mission upload) amortise per-transaction costs
+#define CH_STORAGE_MAX_WRITE 256
+#if CH_STORAGE_MAX_WRITE < CH_STORAGE_LINE_SIZE
+#define CH_STORAGE_MAX_WRITE_LINES 1
+#else
+#define CH_STORAGE_MAX_WRITE_LINES (CH_STORAGE_MAX_WRITE/CH_STORAGE_LINE_SIZE)
+#endif
+
 static_assert(CH_STORAGE_SIZE % CH_STORAGE_LINE_SIZE == 0,
               "Storage is not multiple of line size");
 
@@ -80,7 +90,7 @@ private:
     uint8_t _buffer[CH_STORAGE_SIZE] __attribute__((aligned(4)));
     Bitmask<CH_STORAGE_NUM_LINES> _dirty_mask;
     HAL_Semaphore sem;
-    uint8_t tmpline[CH_STORAGE_LINE_SIZE];
+    uint8_t tmpline[CH_STORAGE_MAX_WRITE_LINES*CH_STORAGE_LINE_SIZE];
 
     bool _flash_write_data(uint8_t sector, uint32_t offset, const uint8_t *data, uint16_t length);
     bool _flash_read_data(uint8_t sector, uint32_t offset, uint8_t *data, uint16_t length);
@@ -105,7 +115,7 @@ private:
 #endif
 
     void _flash_load(void);
-    bool _flash_write(uint16_t line);
+    bool _flash_write(uint16_t line, uint16_t nlines);
 
 #if HAL_WITH_RAMTRON
     AP_RAMTRON fram;
@@ -163,17 +163,32 @@ void UARTDriver::uart_rx_thread(void* arg)
         hal.scheduler->delay_microseconds(1000);
     }
 
+    uint8_t first_driver = 0;
+
     while (true) {
         hal.scheduler->delay_microseconds(1000);
 
-        for (uint8_t i=0; i<UART_MAX_DRIVERS; i++) {
+        for (uint8_t n=0; n<UART_MAX_DRIVERS; n++) {
+            // rotate the service order each pass so a port with a lot
+            // of pending data cannot consistently delay the ports that
+            // come after it in the table
+            const uint8_t i = (first_driver + n) % UART_MAX_DRIVERS;
             if (serial_drivers[i] == nullptr) {
                 continue;
             }
             if (serial_drivers[i]->_rx_initialised) {
+#if HAL_UART_STATS_ENABLED
+                const uint32_t start_us = AP_HAL::micros();
+                serial_drivers[i]->_rx_timer_tick();
+                const uint32_t tick_us = AP_HAL::micros() - start_us;
+                serial_drivers[i]->_rx_stats_tick_us += tick_us;
+                serial_drivers[i]->_rx_stats_tick_max_us = MAX(serial_drivers[i]->_rx_stats_tick_max_us, tick_us);
+#else
                 serial_drivers[i]->_rx_timer_tick();
+#endif
             }
         }
+        first_driver = (first_driver + 1) % UART_MAX_DRIVERS;
     }
 }
 
@@ -790,6 +805,57 @@ size_t UARTDriver::_write(const uint8_t *buffer, size_t size)
     return ret;
 }
 
+/* queue a list of segments as a single atomic write, taking the write
+   mutex once rather than per segment */
+size_t UARTDriver::_writev(const AP_HAL::UARTDriver::WriteVector *vec, uint8_t count)
+{
+    if (!_tx_initialised) {
+        return 0;
+    }
+
+    WITH_SEMAPHORE(_write_mutex);
+
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        total += vec[i].len;
+    }
+    if (_writebuf.space() < total) {
+        // all-or-nothing so the reader never sees a partial packet
+        return 0;
+    }
+    /*
+      reserve the ring space for the whole packet up front and copy
+      the segments straight into it, handling the ring wraparound
+      ourselves. This publishes the packet with a single commit rather
+      than a ring-state update per segment
+     */
+    ByteBuffer::IoVec iovec[2];
+    const uint8_t nvec = _writebuf.reserve(iovec, total);
+    uint8_t seg = 0;
+    uint32_t seg_ofs = 0;
+    for (uint8_t i = 0; i < nvec; i++) {
+        uint8_t *dst = iovec[i].data;
+        uint32_t n = iovec[i].len;
+        while (n > 0 && seg < count) {
+            const uint32_t c = MIN(n, vec[seg].len - seg_ofs);
+            memcpy(dst, &vec[seg].data[seg_ofs], c);
+            dst += c;
+            n -= c;
+            seg_ofs += c;
+            if (seg_ofs == vec[seg].len) {
+                seg++;
+                seg_ofs = 0;
+            }
+        }
+    }
+    _writebuf.commit(total);
+    _tx_stats_gather_bytes += total;
+    if (unbuffered_writes) {
+        chEvtSignal(uart_thread_ctx, EVT_TRANSMIT_DATA_READY);
+    }
+    return total;
+}
+
 /*
   wait for data to arrive, or a timeout. Return true if data has
   arrived, false on timeout
@@ -1729,13 +1795,15 @@ void UARTDriver::uart_info(ExpandingString &str, StatsTracker &stats, const uint
     const uint32_t tx_bytes = stats.tx.update(_tx_stats_bytes);
     const uint32_t rx_bytes = stats.rx.update(_rx_stats_bytes);
     const uint32_t rx_dropped_bytes = stats.rx_dropped.update(_rx_stats_dropped_bytes);
+    const uint32_t tx_gather_bytes = stats.tx_gather.update(_tx_stats_gather_bytes);
+    const uint32_t rx_tick_us = stats.rx_tick.update(_rx_stats_tick_us);
 
     if (sdef.is_usb) {
         str.printf("OTG%u  ", unsigned(sdef.instance));
     } else {
         str.printf("UART%u ", unsigned(sdef.instance));
     }
-    str.printf("TX%c=%8u RX%c=%8u TXBD=%6u RXBD=%6u RXDRP=%8u"
+    str.printf("TX%c=%8u RX%c=%8u TXBD=%6u RXBD=%6u RXDRP=%8u GTX=%8u SRV=%8u SRVMX=%4u"
 #if CH_CFG_USE_EVENTS == TRUE
                 " FE=%lu OE=%lu NE=%lu"
 #endif
@@ -1747,6 +1815,9 @@ void UARTDriver::uart_info(ExpandingString &str, StatsTracker &stats, const uint
                unsigned((tx_bytes * 10000) / dt_ms),
                unsigned((rx_bytes * 10000) / dt_ms),
                unsigned(rx_dropped_bytes),
+               unsigned(tx_gather_bytes),
+               unsigned(rx_tick_us),
+               unsigned(_rx_stats_tick_max_us),
 #if CH_CFG_USE_EVENTS == TRUE
                _rx_stats_framing_errors,
                _rx_stats_overrun_errors,
@@ -223,6 +223,12 @@ private:
     uint32_t _tx_stats_bytes;
     uint32_t _rx_stats_bytes;
     uint32_t _rx_stats_dropped_bytes;
+    uint32_t _tx_stats_gather_bytes;
+#if HAL_UART_STATS_ENABLED
+    // time spent servicing this port in the shared RX thread
+    uint32_t _rx_stats_tick_us;
+    uint32_t _rx_stats_tick_max_us;
+#endif
 
     // we remember config options from set_options to apply on sdStart()
     uint32_t _cr1_options;
@@ -284,6 +290,7 @@ protected:
     void _end() override;
     void _flush() override;
     size_t _write(const uint8_t *buffer, size_t size) override;
+    size_t _writev(const WriteVector *vec, uint8_t count) override;
     ssize_t _read(uint8_t *buffer, uint16_t count) override;
     uint32_t _available() override;
     bool _discard_input() override;
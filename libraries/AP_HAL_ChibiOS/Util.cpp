@@ -23,6 +23,7 @@
 #include <sysperf.h>
 #include "RCOutput.h"
 #include "UARTDriver.h"
+#include "AnalogIn.h"
 #include "hwdef/common/stm32_util.h"
 #include "hwdef/common/watchdog.h"
 #include "hwdef/common/flash.h"
@@ -412,10 +413,11 @@ __RAMFUNC__ void Util::thread_info(ExpandingString &str)
 #if HAL_ENABLE_THREAD_STATISTICS
         time_measurement_t stats = tp->stats;
         if (tp->stats.best > 0) { // not run
-            str.printf("%-13.13s PRI=%3u sp=%p STACK=%4u/%4u LOAD=%4.1f%%%s\n",
+            str.printf("%-13.13s PRI=%3u sp=%p STACK=%4u/%4u LOAD=%4.1f%% WORST=%4uus%s\n",
                         tp->name, unsigned(tp->realprio), tp->wabase,
                         unsigned(stack_free(tp->wabase)), unsigned(total_stack),
                         100.0f * float(stats.cumulative) / float(cumulative_cycles),
+                        unsigned(RTC2US(STM32_HSECLK, stats.worst)),
                         // more than a loop slice is bad for everyone else, warn on
                         // more than a 200Hz slice so that only the worst offenders are identified
                         // also don't do this for the main or idle threads
@@ -461,6 +463,15 @@ bool Util::get_system_load(float& avg_load, float& peak_load) const
 }
 
 
+#if HAL_SAMPLING_PROFILER_ENABLED
+// start or stop the sampling profiler
+bool Util::profiler_control(bool start)
+{
+    static ChibiOS::SamplingProfiler profiler;
+    return profiler.control(start);
+}
+#endif
+
 #if CH_CFG_USE_SEMAPHORES
 // request information on dma contention
 void Util::dma_info(ExpandingString &str)
@@ -481,14 +492,17 @@ void Util::mem_info(ExpandingString &str)
     const struct memory_region *regions;
     uint8_t num_heaps = malloc_get_heaps(&heaps, &regions);
 
-    str.printf("MemInfoV1\n");
+    str.printf("MemInfoV2\n");
     for (uint8_t i=0; i<num_heaps; i++) {
         size_t totalp=0, largest=0;
-        // get memory available on main heap
-        chHeapStatus(i == 0 ? nullptr : &heaps[i], &totalp, &largest);
-        str.printf("START=0x%08x LEN=%3uk FREE=%6u LRG=%6u TYPE=%1u\n",
+        // get memory available on main heap, and the free fragment
+        // count, as largest/free shrinking while FRAGS grows is the
+        // signature of fragmentation-induced allocation failure
+        const size_t nfrags = chHeapStatus(i == 0 ? nullptr : &heaps[i], &totalp, &largest);
+        str.printf("START=0x%08x LEN=%3uk FREE=%6u LRG=%6u FRAGS=%4u TYPE=%1u\n",
                    unsigned(regions[i].address), unsigned(regions[i].size/1024),
-                   unsigned(totalp), unsigned(largest), unsigned(regions[i].flags));
+                   unsigned(totalp), unsigned(largest), unsigned(nfrags),
+                   unsigned(regions[i].flags));
     }
 }
 #endif
@@ -702,6 +716,71 @@ void Util::timer_info(ExpandingString &str)
 }
 #endif
 
+#if HAL_USE_ADC == TRUE && !defined(HAL_DISABLE_ADC_DRIVER)
+// request information on effective ADC sample rates
+void Util::adc_info(ExpandingString &str)
+{
+    ((ChibiOS::AnalogIn *)hal.analogin)->adc_info(str);
+}
+#endif
+
+#if defined(STM32F7) || defined(STM32H7)
+// single hardware CRC engine, shared on a first-come basis
+static HAL_Semaphore crc_unit_sem;
+
+/*
+  hardware CRC32 over a block of memory, producing the same result as
+  crc_crc32(). The engine is configured for the reflected zlib
+  polynomial by bit-reversing input words and the output register, so
+  a caller can freely mix hardware and software updates of the same
+  running crc
+ */
+bool Util::crc32_hw(const uint8_t *buf, uint32_t size, uint32_t &crc)
+{
+    if (!crc_unit_sem.take_nonblocking()) {
+        // engine busy in another thread, caller falls back to software
+        return false;
+    }
+
+#if defined(STM32H7)
+    rccEnableAHB4(RCC_AHB4ENR_CRCEN, true);
+#else
+    rccEnableAHB1(RCC_AHB1ENR_CRCEN, true);
+#endif
+
+    CRC->POL = 0x04C11DB7;
+    // load the current running crc, bit-reversed to match REV_OUT
+    CRC->INIT = __RBIT(crc);
+    // byte-reversed input to start with, for leading unaligned bytes
+    CRC->CR = CRC_CR_RESET | CRC_CR_REV_OUT | CRC_CR_REV_IN_0;
+
+    while (size > 0 && (uintptr_t(buf) & 3U) != 0) {
+        *(volatile uint8_t *)&CRC->DR = *buf++;
+        size--;
+    }
+
+    // bulk of the data a word at a time with full word bit-reversal
+    CRC->CR = CRC_CR_REV_OUT | CRC_CR_REV_IN_0 | CRC_CR_REV_IN_1;
+    while (size >= 4) {
+        CRC->DR = *(const uint32_t *)buf;
+        buf += 4;
+        size -= 4;
+    }
+
+    // trailing bytes
+    CRC->CR = CRC_CR_REV_OUT | CRC_CR_REV_IN_0;
+    while (size > 0) {
+        *(volatile uint8_t *)&CRC->DR = *buf++;
+        size--;
+    }
+
+    crc = CRC->DR;
+
+    crc_unit_sem.give();
+    return true;
+}
+#endif // STM32F7 || STM32H7
+
 /**
  * This method will generate random values with set size. It will fall back to AP_Math's get_random16()
  * if True RNG fails or enough entropy is not present.
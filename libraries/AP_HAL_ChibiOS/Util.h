@@ -21,6 +21,7 @@
 #include "AP_HAL_ChibiOS.h"
 #include <ch.h>
 #include <AP_Logger/AP_Logger_config.h>
+#include "SamplingProfiler.h"
 
 class ExpandingString;
 
@@ -102,6 +103,21 @@ public:
 #if HAL_USE_PWM == TRUE
     void timer_info(ExpandingString &str) override;
 #endif
+
+#if HAL_SAMPLING_PROFILER_ENABLED
+    // start or stop the sampling profiler
+    bool profiler_control(bool start) override;
+#endif
+
+#if HAL_USE_ADC == TRUE && !defined(HAL_DISABLE_ADC_DRIVER)
+    void adc_info(ExpandingString &str) override;
+#endif
+
+#if defined(STM32F7) || defined(STM32H7)
+    // hardware CRC32 engine, compatible with crc_crc32()
+    bool crc32_hw(const uint8_t *buf, uint32_t size, uint32_t &crc) override;
+#endif
+
     // returns random values
     bool get_random_vals(uint8_t* data, size_t size) override;
 
@@ -75,10 +75,8 @@ void Scheduler::init()
 
     hal.console->printf("%s:%d running with CONFIG_FREERTOS_HZ=%d\n", __PRETTY_FUNCTION__, __LINE__,CONFIG_FREERTOS_HZ);
 
-    // keep main tasks that need speed on CPU 0
-    // pin potentially slow stuff to CPU 1, as we have disabled the WDT on that core.
-    #define FASTCPU 0
-    #define SLOWCPU 1
+    // keep main tasks that need speed on FASTCPU
+    // pin potentially slow stuff to SLOWCPU, as we have disabled the WDT on that core.
 
     // pin main thread to Core 0, and we'll also pin other heavy-tasks to core 1, like wifi-related.
     if (xTaskCreatePinnedToCore(_main_thread, "APM_MAIN", Scheduler::MAIN_SS, this, Scheduler::MAIN_PRIO, &_main_task_handle,FASTCPU) != pdPASS) {
@@ -162,22 +160,24 @@ bool Scheduler::thread_create(AP_HAL::MemberProc proc, const char *name, uint32_
     *tproc = proc;
 
     uint8_t thread_priority = IO_PRIO;
+    uint8_t thread_core = SLOWCPU;
     static const struct {
         priority_base base;
         uint8_t p;
+        uint8_t core;
     } priority_map[] = {
-        { PRIORITY_BOOST, IO_PRIO},
-        { PRIORITY_MAIN, MAIN_PRIO},
-        { PRIORITY_SPI, SPI_PRIORITY},
-        { PRIORITY_I2C, I2C_PRIORITY},
-        { PRIORITY_CAN, IO_PRIO},
-        { PRIORITY_TIMER, TIMER_PRIO},
-        { PRIORITY_RCIN, RCIN_PRIO},
-        { PRIORITY_IO, IO_PRIO},
-        { PRIORITY_UART, UART_PRIO},
-        { PRIORITY_NET, WIFI_PRIO1},
-        { PRIORITY_STORAGE, STORAGE_PRIO},
-        { PRIORITY_SCRIPTING, UART_PRIO},
+        { PRIORITY_BOOST, IO_PRIO, FASTCPU},
+        { PRIORITY_MAIN, MAIN_PRIO, FASTCPU},
+        { PRIORITY_SPI, SPI_PRIORITY, FASTCPU},
+        { PRIORITY_I2C, I2C_PRIORITY, FASTCPU},
+        { PRIORITY_CAN, IO_PRIO, SLOWCPU},
+        { PRIORITY_TIMER, TIMER_PRIO, FASTCPU},
+        { PRIORITY_RCIN, RCIN_PRIO, SLOWCPU},
+        { PRIORITY_IO, IO_PRIO, SLOWCPU},
+        { PRIORITY_UART, UART_PRIO, FASTCPU},
+        { PRIORITY_NET, WIFI_PRIO1, SLOWCPU},
+        { PRIORITY_STORAGE, STORAGE_PRIO, SLOWCPU},
+        { PRIORITY_SCRIPTING, UART_PRIO, SLOWCPU},
     };
     for (uint8_t i=0; i<ARRAY_SIZE(priority_map); i++) {
         if (priority_map[i].base == base) {
@@ -185,6 +185,7 @@ bool Scheduler::thread_create(AP_HAL::MemberProc proc, const char *name, uint32_
             printf("%s:%d \n", __PRETTY_FUNCTION__, __LINE__);
 #endif
             thread_priority = constrain_int16(priority_map[i].p + priority, 1, 25);
+            thread_core = priority_map[i].core;
             break;
         }
     }
@@ -192,8 +193,11 @@ bool Scheduler::thread_create(AP_HAL::MemberProc proc, const char *name, uint32_
     #define EXTRA_THREAD_SPACE 1024
     uint32_t actual_stack_size = requested_stack_size+EXTRA_THREAD_SPACE;
 
+    // pin the thread to the core matching its base priority, so
+    // sensor sampling threads cannot end up competing with the WiFi
+    // stack for SLOWCPU during network bursts
     tskTaskControlBlock* xhandle;
-    BaseType_t xReturned = xTaskCreate(thread_create_trampoline, name, actual_stack_size, tproc, thread_priority, &xhandle);
+    BaseType_t xReturned = xTaskCreatePinnedToCore(thread_create_trampoline, name, actual_stack_size, tproc, thread_priority, &xhandle, thread_core);
     if (xReturned != pdPASS) {
         free(tproc);
         return false;
@@ -96,6 +96,12 @@ public:
     static const int IO_SS        = 1024*3.5;   // APM_IO
     static const int STORAGE_SS   = 1024*2;     // APM_STORAGE
 
+    // core-affinity map: flight-critical sampling and control are
+    // pinned to FASTCPU, networking and slow IO share SLOWCPU with
+    // the WiFi stack (which also has the WDT disabled)
+    static const int FASTCPU = 0;
+    static const int SLOWCPU = 1;
+
 private:
     AP_HAL::HAL::Callbacks *callbacks;
     AP_HAL::Proc _failsafe;
@@ -336,6 +336,9 @@ void _usage(void)
     printf("\tcpu affinity:\n");
     printf("\t                   --cpu-affinity 1 (single cpu) or 1,3 (multiple cpus) or 1-3 (range of cpus)\n");
     printf("\t                   -c 1 (single cpu) or 1,3 (multiple cpus) or 1-3 (range of cpus)\n");
+    printf("\tmain loop SCHED_DEADLINE runtime budget as a percentage of the loop period\n");
+    printf("\t(requires root; combine with an exclusive cpuset rather than --cpu-affinity):\n");
+    printf("\t                   --sched-deadline 80\n");
 }
 
 void HAL_Linux::run(int argc, char* const argv[], Callbacks* callbacks) const
@@ -355,6 +358,7 @@ void HAL_Linux::run(int argc, char* const argv[], Callbacks* callbacks) const
         CMDLINE_SERIAL7,
         CMDLINE_SERIAL8,
         CMDLINE_SERIAL9,
+        CMDLINE_SCHED_DEADLINE,
     };
 
     int opt;
@@ -385,6 +389,7 @@ void HAL_Linux::run(int argc, char* const argv[], Callbacks* callbacks) const
         {"module-directory",    true,  0, 'M'},
         {"defaults",            true,  0, 'd'},
         {"cpu-affinity",        true,  0, 'c'},
+        {"sched-deadline",      true,  0, CMDLINE_SCHED_DEADLINE},
         {"help",                false,  0, 'h'},
         {0, false, 0, 0}
     };
@@ -454,6 +459,15 @@ void HAL_Linux::run(int argc, char* const argv[], Callbacks* callbacks) const
             }
             Linux::Scheduler::from(scheduler)->set_cpu_affinity(cpu_affinity);
             break;
+        case CMDLINE_SCHED_DEADLINE: {
+            const int pct = atoi(gopt.optarg);
+            if (pct < 1 || pct > 100) {
+                fprintf(stderr, "Invalid deadline runtime percentage: %s\n", gopt.optarg);
+                exit(1);
+            }
+            Linux::Scheduler::from(scheduler)->set_deadline_pct(pct);
+            break;
+        }
         case 'h':
             _usage();
             exit(0);
@@ -0,0 +1,140 @@
+#include "SHMDevice.h"
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <AP_HAL/AP_HAL.h>
+#include <AP_Math/AP_Math.h>
+
+SHMDevice::SHMDevice(const char *name)
+{
+    _name = strdup(name);
+}
+
+SHMDevice::~SHMDevice()
+{
+    free(_name);
+}
+
+bool SHMDevice::open()
+{
+    if (_name == nullptr) {
+        return false;
+    }
+    _fd = shm_open(_name, O_RDWR|O_CREAT, 0666);
+    if (_fd == -1) {
+        return false;
+    }
+    if (ftruncate(_fd, sizeof(SHMLayout)) == -1) {
+        close();
+        return false;
+    }
+    _shm = (SHMLayout *)mmap(nullptr, sizeof(SHMLayout),
+                             PROT_READ|PROT_WRITE, MAP_SHARED, _fd, 0);
+    if (_shm == MAP_FAILED) {
+        _shm = nullptr;
+        close();
+        return false;
+    }
+    if (__atomic_load_n(&_shm->magic, __ATOMIC_ACQUIRE) != shm_magic) {
+        // first one in initialises the region; the magic is published
+        // last so a consumer never sees half-initialised rings
+        memset(&_shm->tx, 0, sizeof(_shm->tx));
+        memset(&_shm->rx, 0, sizeof(_shm->rx));
+        _shm->size = ring_size;
+        __atomic_store_n(&_shm->magic, shm_magic, __ATOMIC_RELEASE);
+    } else if (_shm->size != ring_size) {
+        // stale region from an incompatible build
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool SHMDevice::close()
+{
+    if (_shm != nullptr) {
+        munmap(_shm, sizeof(SHMLayout));
+        _shm = nullptr;
+    }
+    if (_fd != -1) {
+        ::close(_fd);
+        _fd = -1;
+    }
+    // the region itself persists so a consumer can outlive us
+    return true;
+}
+
+/*
+  wake any consumer waiting on the ring's futex word
+ */
+void SHMDevice::wake(SHMRing &ring)
+{
+    __atomic_fetch_add(&ring.futex, 1, __ATOMIC_RELEASE);
+    syscall(SYS_futex, &ring.futex, FUTEX_WAKE, INT32_MAX, nullptr, nullptr, 0);
+}
+
+ssize_t SHMDevice::write(const uint8_t *buf, uint16_t n)
+{
+    if (_shm == nullptr) {
+        return -1;
+    }
+    SHMRing &ring = _shm->tx;
+    const uint32_t head = __atomic_load_n(&ring.head, __ATOMIC_ACQUIRE);
+    const uint32_t tail = ring.tail;
+    // indexes are free-running counters; the producer never lets
+    // tail-head exceed ring_size
+    const uint32_t space = ring_size - (tail - head);
+    if (space == 0) {
+        // never block the autopilot thread on a slow consumer
+        return -1;
+    }
+    const uint32_t count = MIN(uint32_t(n), space);
+    const uint32_t ofs = tail % ring_size;
+    const uint32_t n1 = MIN(count, ring_size - ofs);
+    memcpy(&ring.data[ofs], buf, n1);
+    if (count > n1) {
+        memcpy(&ring.data[0], &buf[n1], count - n1);
+    }
+    __atomic_store_n(&ring.tail, tail + count, __ATOMIC_RELEASE);
+    wake(ring);
+    return count;
+}
+
+ssize_t SHMDevice::read(uint8_t *buf, uint16_t n)
+{
+    if (_shm == nullptr) {
+        return -1;
+    }
+    SHMRing &ring = _shm->rx;
+    const uint32_t tail = __atomic_load_n(&ring.tail, __ATOMIC_ACQUIRE);
+    const uint32_t head = ring.head;
+    const uint32_t avail = tail - head;
+    if (avail == 0) {
+        return 0;
+    }
+    const uint32_t count = MIN(uint32_t(n), avail);
+    const uint32_t ofs = head % ring_size;
+    const uint32_t n1 = MIN(count, ring_size - ofs);
+    memcpy(buf, &ring.data[ofs], n1);
+    if (count > n1) {
+        memcpy(&buf[n1], &ring.data[0], count - n1);
+    }
+    __atomic_store_n(&ring.head, head + count, __ATOMIC_RELEASE);
+    // a producer may be waiting for space
+    wake(ring);
+    return count;
+}
+
+void SHMDevice::set_blocking(bool blocking)
+{
+    // always non-blocking
+}
+
+void SHMDevice::set_speed(uint32_t speed)
+{
+}
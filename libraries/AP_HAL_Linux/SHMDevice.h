@@ -0,0 +1,53 @@
+#pragma once
+
+#include "SerialDevice.h"
+
+/*
+  shared memory ring transport for consumers running on the same SoC,
+  avoiding the kernel crossings of a localhost socket. Device path
+  syntax is shm:/name, where /name is a POSIX shared memory object
+  created on open if needed.
+
+  The region holds one single-producer single-consumer byte ring per
+  direction. Each ring has a futex word that this side increments and
+  wakes whenever it moves its index, so a consumer can FUTEX_WAIT on
+  it instead of polling. The autopilot side never waits.
+ */
+class SHMDevice: public SerialDevice {
+public:
+    SHMDevice(const char *name);
+    virtual ~SHMDevice();
+
+    virtual bool open() override;
+    virtual bool close() override;
+    virtual void set_blocking(bool blocking) override;
+    virtual void set_speed(uint32_t speed) override;
+    virtual ssize_t write(const uint8_t *buf, uint16_t n) override;
+    virtual ssize_t read(uint8_t *buf, uint16_t n) override;
+
+private:
+    static constexpr uint32_t ring_size = 65536U;
+    static constexpr uint32_t shm_magic = 0x53484d31; // "SHM1"
+
+    struct SHMRing {
+        // free-running byte counters; head is advanced by the
+        // consumer, tail by the producer, tail-head never exceeds
+        // ring_size
+        uint32_t head;
+        uint32_t tail;
+        uint32_t futex; // incremented and woken on any index change
+        uint8_t data[ring_size];
+    };
+    struct SHMLayout {
+        uint32_t magic;
+        uint32_t size; // ring_size, for compatibility checking
+        SHMRing tx; // autopilot -> consumer
+        SHMRing rx; // consumer -> autopilot
+    };
+
+    void wake(SHMRing &ring);
+
+    char *_name;
+    int _fd = -1;
+    SHMLayout *_shm;
+};
@@ -3,14 +3,17 @@
 #include <algorithm>
 #include <errno.h>
 #include <poll.h>
+#include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <sys/mman.h>
+#include <sys/syscall.h>
 #include <sys/time.h>
 #include <unistd.h>
 
 #include <AP_HAL/AP_HAL.h>
 #include <AP_Math/AP_Math.h>
+#include <AP_Scheduler/AP_Scheduler.h>
 #include <AP_Vehicle/AP_Vehicle_Type.h>
 
 #include "RCInput.h"
@@ -23,6 +26,31 @@ using namespace Linux;
 
 extern const AP_HAL::HAL& hal;
 
+#if defined(__NR_sched_setattr) && AP_SCHEDULER_ENABLED
+#define AP_LINUX_HAVE_SCHED_DEADLINE 1
+// sched_setattr() has no glibc wrapper
+struct sched_attr {
+    uint32_t size;
+    uint32_t sched_policy;
+    uint64_t sched_flags;
+    int32_t  sched_nice;
+    uint32_t sched_priority;
+    uint64_t sched_runtime;
+    uint64_t sched_deadline;
+    uint64_t sched_period;
+};
+#ifndef SCHED_DEADLINE
+#define SCHED_DEADLINE 6
+#endif
+#ifndef SCHED_FLAG_DL_OVERRUN
+#define SCHED_FLAG_DL_OVERRUN 0x04
+#endif
+#else
+#define AP_LINUX_HAVE_SCHED_DEADLINE 0
+#endif
+
+volatile uint32_t Scheduler::_deadline_xruns;
+
 #define APM_LINUX_MAX_PRIORITY          20
 #define APM_LINUX_TIMER_PRIORITY        15
 #define APM_LINUX_UART_PRIORITY         14
@@ -81,6 +109,51 @@ void Scheduler::init_realtime()
     }
 }
 
+// count main loop budget overruns; the kernel delivers SIGXCPU to
+// the thread when SCHED_FLAG_DL_OVERRUN is set and the runtime is
+// exhausted before the deadline
+void Scheduler::_deadline_xrun_handler(int signum)
+{
+    _deadline_xruns++;
+}
+
+/*
+  switch the main thread to SCHED_DEADLINE with the loop period as
+  period and deadline and the requested percentage of it as runtime
+  budget. Called from the main thread at the end of initialization,
+  when the loop rate is known. Requires root and, on a partitioned
+  system, an exclusive cpuset for the autopilot
+ */
+void Scheduler::init_deadline()
+{
+#if AP_LINUX_HAVE_SCHED_DEADLINE
+    if (_deadline_pct == 0) {
+        return;
+    }
+    const uint64_t period_ns = AP::scheduler().get_loop_period_us() * 1000ULL;
+    struct sched_attr attr {};
+    attr.size = sizeof(attr);
+    attr.sched_policy = SCHED_DEADLINE;
+    attr.sched_flags = SCHED_FLAG_DL_OVERRUN;
+    attr.sched_runtime = period_ns * _deadline_pct / 100;
+    attr.sched_deadline = period_ns;
+    attr.sched_period = period_ns;
+
+    signal(SIGXCPU, _deadline_xrun_handler);
+
+    if (syscall(__NR_sched_setattr, 0, &attr, 0) != 0) {
+        // admission control rejects the reservation if the thread is
+        // restricted to a subset of a root domain; use an exclusive
+        // cpuset rather than --cpu-affinity with SCHED_DEADLINE
+        fprintf(stderr, "Scheduler: failed to set SCHED_DEADLINE: %s\n",
+                strerror(errno));
+        return;
+    }
+    printf("Main loop using SCHED_DEADLINE runtime=%uus period=%uus\n",
+           unsigned(attr.sched_runtime / 1000), unsigned(period_ns / 1000));
+#endif
+}
+
 void Scheduler::init_cpu_affinity()
 {
     if (!CPU_COUNT(&_cpu_affinity)) {
@@ -249,6 +322,20 @@ void Scheduler::_timer_task()
         _failsafe();
     }
 
+#if AP_LINUX_HAVE_SCHED_DEADLINE
+    // report main loop deadline overruns at most once every 5s
+    const uint32_t xruns = _deadline_xruns;
+    if (xruns != _last_reported_xruns) {
+        const uint64_t now = AP_HAL::millis64();
+        if (now - _last_xrun_report_msec > 5000) {
+            hal.console->printf("Main loop deadline overruns: %u\n",
+                                unsigned(xruns));
+            _last_reported_xruns = xruns;
+            _last_xrun_report_msec = now;
+        }
+    }
+#endif
+
     _in_timer_proc = false;
 }
 
@@ -317,6 +404,8 @@ void Scheduler::set_system_initialized()
 
     _initialized = true;
 
+    init_deadline();
+
     _wait_all_threads();
 }
 
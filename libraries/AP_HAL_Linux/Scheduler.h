@@ -60,6 +60,18 @@ public:
      */
     void set_cpu_affinity(const cpu_set_t &cpu_affinity) { _cpu_affinity = cpu_affinity; }
 
+    /*
+      set the SCHED_DEADLINE runtime budget for the main loop as a
+      percentage of the loop period. Zero (the default) leaves the
+      main loop on SCHED_FIFO. Applied at the end of initialization
+      once the loop rate is known
+     */
+    void set_deadline_pct(uint8_t pct) { _deadline_pct = pct; }
+
+    // number of times the main loop has overrun its SCHED_DEADLINE
+    // runtime budget
+    uint32_t get_deadline_xruns() const { return _deadline_xruns; }
+
 private:
     class SchedulerThread : public PeriodicThread {
     public:
@@ -78,6 +90,9 @@ private:
 
     void     init_cpu_affinity();
 
+    void     init_deadline();
+    static void _deadline_xrun_handler(int signum);
+
     void _wait_all_threads();
 
     void     _debug_stack();
@@ -117,6 +132,14 @@ private:
 
     Semaphore _io_semaphore;
     cpu_set_t _cpu_affinity;
+
+    // main loop SCHED_DEADLINE runtime budget, percent of the loop
+    // period, 0 for SCHED_FIFO. The xrun count is static as it is
+    // incremented from the SIGXCPU handler
+    uint8_t _deadline_pct;
+    static volatile uint32_t _deadline_xruns;
+    uint32_t _last_reported_xruns;
+    uint64_t _last_xrun_report_msec;
 };
 
 }
@@ -20,6 +20,7 @@
 #include <AP_HAL/AP_HAL.h>
 
 #include "ConsoleDevice.h"
+#include "SHMDevice.h"
 #include "TCPServerDevice.h"
 #include "UARTDevice.h"
 #include "UDPDevice.h"
@@ -125,6 +126,7 @@ void UARTDriver::_deallocate_buffers()
         - /dev/ttyO1
         - tcp:*:1243:wait
         - udp:192.168.2.15:1243
+        - shm:/ap_serial0
 */
 AP_HAL::OwnPtr<SerialDevice> UARTDriver::_parseDevicePath(const char *arg)
 {
@@ -132,6 +134,9 @@ AP_HAL::OwnPtr<SerialDevice> UARTDriver::_parseDevicePath(const char *arg)
 
     if (stat(arg, &st) == 0 && S_ISCHR(st.st_mode)) {
         return AP_HAL::OwnPtr<SerialDevice>(NEW_NOTHROW UARTDevice(arg));
+    } else if (strncmp(arg, "shm:", 4) == 0) {
+        // shared memory ring for consumers on the same SoC
+        return AP_HAL::OwnPtr<SerialDevice>(NEW_NOTHROW SHMDevice(arg+4));
     } else if (strncmp(arg, "tcp:", 4) != 0 &&
                strncmp(arg, "udp:", 4) != 0 &&
                strncmp(arg, "udpin:", 6)) {
@@ -40,16 +40,29 @@ void DeviceBus::bus_thread(void)
         uint64_t now = AP_HAL::micros64();
         DeviceBus::callback_info *callback;
 
-        // find a callback to run
-        for (callback = callbacks; callback; callback = callback->next) {
-            if (now >= callback->next_usec) {
-                while (now >= callback->next_usec) {
-                    callback->next_usec += callback->period_usec;
+        // run due callbacks most-overdue first, so a fast device is
+        // not held behind a slow device that happens to be earlier in
+        // the callback list
+        while (true) {
+            DeviceBus::callback_info *due = nullptr;
+            for (callback = callbacks; callback; callback = callback->next) {
+                if (now >= callback->next_usec &&
+                    (due == nullptr || callback->next_usec < due->next_usec)) {
+                    due = callback;
                 }
+            }
+            if (due == nullptr) {
+                break;
+            }
+            while (now >= due->next_usec) {
+                due->next_usec += due->period_usec;
+            }
+            {
                 // call it with semaphore held
                 WITH_SEMAPHORE(semaphore);
-                callback->cb();
+                due->cb();
             }
+            now = AP_HAL::micros64();
         }
 
         // work out when next loop is needed
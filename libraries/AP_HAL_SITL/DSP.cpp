@@ -36,8 +36,8 @@ extern const AP_HAL::HAL& hal;
 // for understanding the underlying theory although we do not use spectral density here since time resolution is equally
 // important as frequency resolution. Referred to as [Heinz] throughout the code.
 
-// initialize the FFT state machine
-AP_HAL::DSP::FFTWindowState* DSP::fft_init(uint16_t window_size, uint16_t sample_rate, uint8_t sliding_window_size)
+// initialize the FFT state machine. fixed_point is ignored, SITL always uses the float engine
+AP_HAL::DSP::FFTWindowState* DSP::fft_init(uint16_t window_size, uint16_t sample_rate, uint8_t sliding_window_size, bool fixed_point)
 {
     DSP::FFTWindowStateSITL* fft = NEW_NOTHROW DSP::FFTWindowStateSITL(window_size, sample_rate, sliding_window_size);
     if (fft == nullptr || fft->_hanning_window == nullptr || fft->_rfft_data == nullptr || fft->_freq_bins == nullptr || fft->_derivative_freq_bins == nullptr) {
@@ -148,11 +148,23 @@ void SITL_State::wait_clock(uint64_t wait_time_usec)
                 }
             }
 #endif
-            // most devices can't sleep for 10us - so this is also
-            // essentially a yield.  At 30x speedup a 10us wall-clock
-            // sleep here can equate to your thread sleeping for 300us
-            // of simulated time
-            usleep(10);
+            // sleep for an estimate of the remaining wall-clock time
+            // rather than polling at a fixed 10us. Long sleeps, such
+            // as worker threads waiting tens of milliseconds, then
+            // cost a single wakeup instead of thousands, which is
+            // what limits the number of SITL instances that can share
+            // a core in swarm testing. The estimate is bounded so we
+            // still notice the simulation clock being stepped faster
+            // than the target speedup
+            uint64_t sleep_us = uint64_t((wait_time_usec - AP_HAL::micros64()) / speedup);
+            if (sleep_us < 10) {
+                // most devices can't sleep for 10us - so this is
+                // essentially a yield
+                sleep_us = 10;
+            } else if (sleep_us > 1000) {
+                sleep_us = 1000;
+            }
+            usleep(sleep_us);
         }
     }
     // check the outbound TCP queue size.  If it is too long then
@@ -82,6 +82,9 @@ public:
     // name parameter
     SITL::SerialDevice *create_serial_sim(const char *name, const char *arg, const uint8_t portNumber);
 
+    // access to the simulation model, null until the model is created
+    SITL::Aircraft *get_sitl_model(void) const { return sitl_model; }
+
     // simulated airspeed, sonar and battery monitor
     float sonar_pin_voltage;    // pin 0
     float airspeed_pin_voltage[AIRSPEED_MAX_SENSORS]; // pin 1
@@ -13,6 +13,7 @@
 #include <malloc.h>
 #endif
 #include <AP_RCProtocol/AP_RCProtocol.h>
+#include <SITL/SIM_Aircraft.h>
 #ifdef UBSAN_ENABLED
 #include <fcntl.h>
 #include <sanitizer/asan_interface.h>
@@ -145,6 +146,18 @@ void Scheduler::delay_microseconds(uint16_t usec)
 
 void Scheduler::delay(uint16_t ms)
 {
+    // a long delay on the main thread is a pure wait for simulated
+    // time to pass, as at boot or between autotest stages. Drop the
+    // wall-clock pacing so the physics runs flat out until the wait
+    // is over; pacing only shapes wall-clock time so simulation
+    // results do not change
+    SITL::Aircraft *model = _sitlState->get_sitl_model();
+    const bool fast_forward = ms >= 50 && model != nullptr &&
+        model->get_speedup() > 1 && in_main_thread();
+    if (fast_forward) {
+        model->set_fast_forward(true);
+    }
+
     uint32_t start = AP_HAL::millis();
     uint32_t now = start;
     do {
@@ -156,6 +169,10 @@ void Scheduler::delay(uint16_t ms)
         }
         now = AP_HAL::millis();
     } while (now - start < ms);
+
+    if (fast_forward) {
+        model->set_fast_forward(false);
+    }
 }
 
 void Scheduler::register_timer_process(AP_HAL::MemberProc proc)
@@ -146,7 +146,24 @@ void AP_IOMCU::thread_main(void)
 
         eventmask_t mask = chEvtWaitAnyTimeout(~0, chTimeMS2I(10));
 
-        // check for pending IO events
+        // check for pending IO events. Safety state changes are handled
+        // first so they are not delayed behind a PWM exchange
+        if (mask & EVENT_MASK(IOEVENT_FORCE_SAFETY_OFF)) {
+            if (!write_register(PAGE_SETUP, PAGE_REG_SETUP_FORCE_SAFETY_OFF, FORCE_SAFETY_MAGIC)) {
+                event_failed(mask);
+                continue;
+            }
+        }
+        mask &= ~EVENT_MASK(IOEVENT_FORCE_SAFETY_OFF);
+
+        if (mask & EVENT_MASK(IOEVENT_FORCE_SAFETY_ON)) {
+            if (!write_register(PAGE_SETUP, PAGE_REG_SETUP_FORCE_SAFETY_ON, FORCE_SAFETY_MAGIC)) {
+                event_failed(mask);
+                continue;
+            }
+        }
+        mask &= ~EVENT_MASK(IOEVENT_FORCE_SAFETY_ON);
+
         if (mask & EVENT_MASK(IOEVENT_SEND_PWM_OUT)) {
             send_servo_out();
         }
@@ -189,22 +206,6 @@ void AP_IOMCU::thread_main(void)
         }
         mask &= ~EVENT_MASK(IOEVENT_MIXING);
 
-        if (mask & EVENT_MASK(IOEVENT_FORCE_SAFETY_OFF)) {
-            if (!write_register(PAGE_SETUP, PAGE_REG_SETUP_FORCE_SAFETY_OFF, FORCE_SAFETY_MAGIC)) {
-                event_failed(mask);
-                continue;
-            }
-        }
-        mask &= ~EVENT_MASK(IOEVENT_FORCE_SAFETY_OFF);
-
-        if (mask & EVENT_MASK(IOEVENT_FORCE_SAFETY_ON)) {
-            if (!write_register(PAGE_SETUP, PAGE_REG_SETUP_FORCE_SAFETY_ON, FORCE_SAFETY_MAGIC)) {
-                event_failed(mask);
-                continue;
-            }
-        }
-        mask &= ~EVENT_MASK(IOEVENT_FORCE_SAFETY_ON);
-
         if (mask & EVENT_MASK(IOEVENT_SET_RATES)) {
             if (!write_register(PAGE_SETUP, PAGE_REG_SETUP_ALTRATE, rate.freq) ||
                 !write_register(PAGE_SETUP, PAGE_REG_SETUP_PWM_RATE_MASK, rate.chmask)) {
@@ -394,8 +395,36 @@ void AP_IOMCU::send_servo_out()
         uint32_t now = AP_HAL::micros();
         if (now - last_servo_out_us >= 2000 || AP_BoardConfig::io_dshot()) {
             // don't send data at more than 500Hz except when using dshot which is more timing sensitive
+
+            // oneshot and dshot rely on a write every cycle to trigger
+            // output, but for normal PWM only the registers that changed
+            // need to be exchanged. A periodic full write keeps the IOMCU
+            // FMU failsafe (200ms) happy when the outputs are static
+            if (!rate.oneshot_enabled && !AP_BoardConfig::io_dshot() &&
+                now - last_full_servo_out_us < 50000U) {
+                uint8_t first = n, last = 0;
+                for (uint8_t i = 0; i < n; i++) {
+                    if (pwm_out.pwm[i] != pwm_out.pwm_sent[i]) {
+                        first = MIN(first, i);
+                        last = i;
+                    }
+                }
+                if (first == n) {
+                    // nothing has changed since the last exchange
+                    return;
+                }
+                const uint8_t count = last - first + 1;
+                if (write_registers(PAGE_DIRECT_PWM, first, count, &pwm_out.pwm[first])) {
+                    memcpy(&pwm_out.pwm_sent[first], &pwm_out.pwm[first], count * sizeof(uint16_t));
+                    last_servo_out_us = now;
+                }
+                return;
+            }
+
             if (write_registers(PAGE_DIRECT_PWM, 0, n, pwm_out.pwm)) {
+                memcpy(pwm_out.pwm_sent, pwm_out.pwm, n * sizeof(uint16_t));
                 last_servo_out_us = now;
+                last_full_servo_out_us = now;
             }
         }
     }
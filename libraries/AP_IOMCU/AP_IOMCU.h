@@ -267,6 +267,8 @@ private:
     struct {
         uint8_t num_channels;
         uint16_t pwm[IOMCU_MAX_RC_CHANNELS];
+        // last values sent to the IOMCU, for delta exchange
+        uint16_t pwm_sent[IOMCU_MAX_RC_CHANNELS];
         uint16_t safety_mask;
         uint16_t failsafe_pwm[IOMCU_MAX_RC_CHANNELS];
         uint8_t failsafe_pwm_set;
@@ -316,6 +318,9 @@ private:
     uint8_t heater_duty_cycle;
 
     uint32_t last_servo_out_us;
+    // time of the last full PWM page write, delta exchanges are used
+    // in between
+    uint32_t last_full_servo_out_us;
 
     bool corked;
     bool do_shutdown;
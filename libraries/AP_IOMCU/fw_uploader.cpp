@@ -225,16 +225,7 @@ bool AP_IOMCU::send(uint8_t c)
  */
 bool AP_IOMCU::send(const uint8_t *p, uint32_t count)
 {
-    bool ret = true;
-
-    while (count--) {
-        ret = send(*p++);
-        if (!ret) {
-            break;
-        }
-    }
-
-    return ret;
+    return uart.write(p, count) == count;
 }
 
 /*
@@ -271,9 +262,8 @@ bool AP_IOMCU::sync()
     drain();
 
     /* complete any pending program operation */
-    for (uint32_t i = 0; i < (PROG_MULTI_MAX + 6); i++) {
-        send(0);
-    }
+    const uint8_t zeros[PROG_MULTI_MAX + 6] {};
+    send(zeros, sizeof(zeros));
 
     send(PROTO_GET_SYNC);
     send(PROTO_EOC);
@@ -1094,19 +1094,21 @@ bool AP_IOMCU_FW::handle_code_write()
             // no input when override is active
             break;
         }
-        if (rx_io_packet.count > sizeof(reg_direct_pwm.pwm)/2) {
+        if (rx_io_packet.offset + rx_io_packet.count > sizeof(reg_direct_pwm.pwm)/2) {
             return false;
         }
-        /* copy channel data */
-        uint16_t i = 0, num_values = rx_io_packet.count;
+        /* copy channel data, honouring the offset so the FMU can send
+           just the channels which have changed */
+        uint16_t i = rx_io_packet.offset, j = 0, num_values = rx_io_packet.count;
         while ((i < IOMCU_MAX_RC_CHANNELS) && (num_values > 0)) {
             /* XXX range-check value? */
-            if (rx_io_packet.regs[i] != PWM_IGNORE_THIS_CHANNEL) {
-                reg_direct_pwm.pwm[i] = rx_io_packet.regs[i];
+            if (rx_io_packet.regs[j] != PWM_IGNORE_THIS_CHANNEL) {
+                reg_direct_pwm.pwm[i] = rx_io_packet.regs[j];
             }
 
             num_values--;
             i++;
+            j++;
         }
         fmu_data_received_time = last_ms;
         chEvtSignalI(thread_ctx, IOEVENT_PWM);
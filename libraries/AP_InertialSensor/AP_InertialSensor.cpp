@@ -2411,6 +2411,22 @@ bool AP_InertialSensor::setup_throttle_gyro_harmonic_notch(float center_freq_hz,
 
     return false;
 }
+
+// prime all gyro notch filter banks from the current filtered gyro so that
+// option or parameter changes made while disarmed do not produce a settle
+// transient at takeoff. Called from the arming path while the vehicle is
+// stationary so the filtered gyro is a good steady-state level
+void AP_InertialSensor::warm_start_notch_filters(void)
+{
+    for (auto &notch : harmonic_notches) {
+        if (!notch.params.enabled()) {
+            continue;
+        }
+        for (uint8_t i = 0; i < get_gyro_count(); i++) {
+            notch.filter[i].warm_start(_gyro_filtered[i]);
+        }
+    }
+}
 #endif  // AP_INERTIALSENSOR_HARMONICNOTCH_ENABLED
 
 /*
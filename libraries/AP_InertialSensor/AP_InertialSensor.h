@@ -248,6 +248,13 @@ public:
 
     // write out harmonic notch log messages
     void write_notch_log_messages() const;
+
+#if AP_INERTIALSENSOR_HARMONICNOTCH_ENABLED
+    // prime all gyro notch filter banks from the current filtered gyro so
+    // that option or parameter changes made while disarmed do not produce a
+    // settle transient at takeoff. Called from the arming path
+    void warm_start_notch_filters(void);
+#endif
 #endif
 
     // indicate which bit in LOG_BITMASK indicates raw logging enabled
@@ -385,6 +392,9 @@ public:
         // twenty seconds.
         AP_Int16 samples_per_msg;
         AP_Int8 push_interval_ms;
+        // decimation ratios for the pre-filter and post-filter taps, 1 = log every sample
+        AP_Int8 _pre_filter_decimation;
+        AP_Int8 _post_filter_decimation;
 
         // end Parameters
 
@@ -426,6 +436,13 @@ public:
         uint16_t data_read_offset; // units: samples
         uint32_t last_sent_ms;
 
+        // decimation ratio of the tap currently being captured
+        uint8_t active_decimation() const {
+            return MAX(1, post_filter ? _post_filter_decimation.get() : _pre_filter_decimation.get());
+        }
+        // count of samples still to be skipped before the next one is stored
+        uint8_t decimation_counter;
+
         // all samples are multiplied by this
         uint16_t multiplier; // initialised as part of init()
 
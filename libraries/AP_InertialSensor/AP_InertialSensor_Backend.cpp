@@ -379,6 +379,116 @@ void AP_InertialSensor_Backend::_notify_new_gyro_raw_sample(uint8_t instance,
     update_primary();
 }
 
+/*
+  handle a contiguous block of gyro samples from a FIFO burst. This is
+  equivalent to calling _notify_new_gyro_raw_sample() once per sample
+  with sample_us=0, but takes the sample semaphore once per block of
+  samples instead of once per sample and keeps the delta angle and
+  filter state updates in one tight loop over the block, which matters
+  at 8kHz sample rates
+ */
+void AP_InertialSensor_Backend::_notify_new_gyro_raw_samples(uint8_t instance,
+                                                             const Vector3f *gyro,
+                                                             uint8_t n_samples)
+{
+    if (has_been_killed(instance) || n_samples == 0) {
+        return;
+    }
+
+    for (uint8_t i=0; i<n_samples; i++) {
+        _update_sensor_rate(_imu._sample_gyro_count[instance], _imu._sample_gyro_start_us[instance],
+                            _imu._gyro_raw_sample_rates[instance]);
+    }
+
+    // don't accept below 40Hz
+    if (_imu._gyro_raw_sample_rates[instance] < 40) {
+        return;
+    }
+
+    // FIFO sensors produce data at a very predictable overall rate, so
+    // the measured sample rate provides deltaT for the whole block
+    const float dt = 1.0f / _imu._gyro_raw_sample_rates[instance];
+
+    const uint64_t last_sample_us = _imu._gyro_last_sample_us[instance];
+    const uint64_t sample_us = AP_HAL::micros64();
+    _imu._gyro_last_sample_us[instance] = sample_us;
+
+#if AP_MODULE_SUPPORTED
+    // call gyro_sample hook if any
+    for (uint8_t i=0; i<n_samples; i++) {
+        AP_Module::call_hook_gyro_sample(instance, dt, gyro[i]);
+    }
+#endif
+
+    // push gyros if optical flow present
+    if (hal.opticalflow) {
+        for (uint8_t i=0; i<n_samples; i++) {
+            hal.opticalflow->push_gyro(gyro[i].x, gyro[i].y, dt);
+        }
+    }
+
+    // zero accumulator if sensor was unhealthy for 0.1s
+    bool zero_accumulator = (sample_us - last_sample_us > 100000U);
+
+    while (n_samples > 0) {
+        // filtered results are copied out so raw logging runs without
+        // holding the sample semaphore
+        Vector3f filtered[8];
+        const uint8_t n = MIN(n_samples, (uint8_t)ARRAY_SIZE(filtered));
+
+        {
+            WITH_SEMAPHORE(_sem);
+
+            for (uint8_t i=0; i<n; i++) {
+                if (zero_accumulator) {
+                    // first sample after an unhealthy gap contributes
+                    // no delta angle
+                    zero_accumulator = false;
+                    _imu._delta_angle_acc[instance].zero();
+                    _imu._delta_angle_acc_dt[instance] = 0;
+                    _imu._last_delta_angle[instance].zero();
+                    _imu._last_raw_gyro[instance] = gyro[i];
+                    apply_gyro_filters(instance, gyro[i]);
+                    filtered[i] = _imu._gyro_filtered[instance];
+                    continue;
+                }
+
+                // compute delta angle and coning correction as in
+                // _notify_new_gyro_raw_sample()
+                const Vector3f delta_angle = (gyro[i] + _imu._last_raw_gyro[instance]) * 0.5f * dt;
+                Vector3f delta_coning = (_imu._delta_angle_acc[instance] +
+                                         _imu._last_delta_angle[instance] * (1.0f / 6.0f));
+                delta_coning = delta_coning % delta_angle;
+                delta_coning *= 0.5f;
+
+                // integrate delta angle accumulator
+                _imu._delta_angle_acc[instance] += delta_angle + delta_coning;
+                _imu._delta_angle_acc_dt[instance] += dt;
+
+                // save previous delta angle for coning correction
+                _imu._last_delta_angle[instance] = delta_angle;
+                _imu._last_raw_gyro[instance] = gyro[i];
+
+                // apply gyro filters and sample for FFT
+                apply_gyro_filters(instance, gyro[i]);
+
+                filtered[i] = _imu._gyro_filtered[instance];
+            }
+
+            _imu._new_gyro_data[instance] = true;
+        }
+
+        for (uint8_t i=0; i<n; i++) {
+            log_gyro_raw(instance, sample_us, gyro[i], filtered[i]);
+        }
+
+        gyro += n;
+        n_samples -= n;
+    }
+
+    update_primary();
+}
+
 /*
   handle a delta-angle sample from the backend. This assumes FIFO
   style sampling and the sample should not be rotated or corrected for
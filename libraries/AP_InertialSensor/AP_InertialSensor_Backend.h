@@ -211,6 +211,12 @@ protected:
     // sensors, and should be set to zero for FIFO based sensors
     void _notify_new_gyro_raw_sample(uint8_t instance, const Vector3f &accel, uint64_t sample_us=0) __RAMFUNC__;
 
+    // block version of _notify_new_gyro_raw_sample() for FIFO based
+    // sensors: samples must be rotated and corrected
+    // (_rotate_and_correct_gyro) and contiguous. Amortises the sample
+    // semaphore and bookkeeping over the whole burst
+    void _notify_new_gyro_raw_samples(uint8_t instance, const Vector3f *gyro, uint8_t n_samples) __RAMFUNC__;
+
     // alternative interface using delta-angles. Rotation and correction is handled inside this function
     void _notify_new_delta_angle(uint8_t instance, const Vector3f &dangle);
     
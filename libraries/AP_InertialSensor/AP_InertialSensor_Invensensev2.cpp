@@ -80,7 +80,7 @@ AP_InertialSensor_Invensensev2::AP_InertialSensor_Invensensev2(AP_InertialSensor
 AP_InertialSensor_Invensensev2::~AP_InertialSensor_Invensensev2()
 {
     if (_fifo_buffer != nullptr) {
-        hal.util->free_type(_fifo_buffer, INV2_FIFO_BUFFER_LEN * INV2_SAMPLE_SIZE, AP_HAL::Util::MEM_DMA_SAFE);
+        hal.util->free_type(_fifo_buffer, INV2_FIFO_BUFFER_LEN * INV2_SAMPLE_SIZE + 1, AP_HAL::Util::MEM_DMA_SAFE);
     }
     _dev->deregister_bankselect_callback();
     //delete _auxiliary_bus;
@@ -245,8 +245,9 @@ void AP_InertialSensor_Invensensev2::start()
     _fifo_accel_scale = _accel_scale / _accel_fifo_downsample_rate;
     _fifo_gyro_scale = GYRO_SCALE / _gyro_fifo_downsample_rate;
     
-    // allocate fifo buffer
-    _fifo_buffer = (uint8_t *)hal.util->malloc_type(INV2_FIFO_BUFFER_LEN * INV2_SAMPLE_SIZE, AP_HAL::Util::MEM_DMA_SAFE);
+    // allocate fifo buffer, with one byte of headroom so the register
+    // address can share the buffer and FIFO data can be read in place
+    _fifo_buffer = (uint8_t *)hal.util->malloc_type(INV2_FIFO_BUFFER_LEN * INV2_SAMPLE_SIZE + 1, AP_HAL::Util::MEM_DMA_SAFE);
     if (_fifo_buffer == nullptr) {
         AP_HAL::panic("Invensense: Unable to allocate FIFO buffer");
     }
@@ -456,7 +457,9 @@ void AP_InertialSensor_Invensensev2::_read_fifo()
 {
     uint8_t n_samples;
     uint16_t bytes_read;
-    uint8_t *rx = _fifo_buffer;
+    // byte 0 of the fifo buffer is headroom for the register address
+    // on the in-place SPI read below
+    uint8_t *rx = &_fifo_buffer[1];
     bool need_reset = false;
 
     if (!_block_read(INV2REG_FIFO_COUNTH, rx, 2)) {
@@ -494,26 +497,26 @@ void AP_InertialSensor_Invensensev2::_read_fifo()
     }
     while (n_samples > 0) {
         uint8_t n = MIN(n_samples, INV2_FIFO_BUFFER_LEN);
-        if (!_dev->set_chip_select(true)) {
+        if (_dev->bus_type() == AP_HAL::Device::BUS_TYPE_I2C) {
             if (!_block_read(INV2REG_FIFO_R_W, rx, n * INV2_SAMPLE_SIZE)) {
                 goto check_registers;
             }
         } else {
-            // this ensures we keep things nicely setup for DMA
-            uint8_t reg = GET_REG(INV2REG_FIFO_R_W) | 0x80;
-            if (!_dev->transfer_bank(GET_BANK(INV2REG_FIFO_R_W), &reg, 1, nullptr, 0)) {
-                _dev->set_chip_select(false);
+            if (!_select_bank(GET_BANK(INV2REG_FIFO_R_W))) {
                 goto check_registers;
             }
+            // run the transfer in the fifo buffer itself so it is
+            // passed all the way down to the SPI DMA handling with no
+            // copying; byte 0 is headroom for the register address
+            _fifo_buffer[0] = GET_REG(INV2REG_FIFO_R_W) | 0x80;
+            // transfer will also be sending data, make sure that data is zero
             memset(rx, 0, n * INV2_SAMPLE_SIZE);
-            if (!_dev->transfer_fullduplex(rx, n * INV2_SAMPLE_SIZE)) {
+            if (!_dev->transfer_fullduplex(_fifo_buffer, n * INV2_SAMPLE_SIZE + 1)) {
                 if (!hal.scheduler->in_expected_delay()) {
                     debug("INV2: error in fifo read %u bytes\n", n * INV2_SAMPLE_SIZE);
                 }
-                _dev->set_chip_select(false);
                 goto check_registers;
             }
-            _dev->set_chip_select(false);
         }
 
         if (_fast_sampling) {
@@ -485,6 +485,10 @@ bool AP_InertialSensor_Invensensev3::accumulate_samples(const FIFOData *data, ui
 #if INV3_ENABLE_FIFO_LOGGING
     const uint64_t tstart = AP_HAL::micros64();
 #endif
+    // gyro samples are gathered into one contiguous block so the burst
+    // can be handed to the backend in a single call
+    Vector3f gyros[INV3_FIFO_BUFFER_LEN];
+
     for (uint8_t i = 0; i < n_samples; i++) {
         const FIFOData &d = data[i];
 
@@ -493,12 +497,14 @@ bool AP_InertialSensor_Invensensev3::accumulate_samples(const FIFOData *data, ui
         // ICM45686 - TMST_FIELD_EN bit 3 : 1
         // ICM42688 - HEADER_TIMESTAMP_FSYNC bit 2-3 : 10
         if ((d.header & 0xFC) != 0x68) { // ACCEL_EN | GYRO_EN | TMST_FIELD_EN
-            // no or bad data
+            // no or bad data; deliver the good samples gathered so far
+            _notify_new_gyro_raw_samples(gyro_instance, gyros, i);
             return false;
         }
 
         Vector3f accel{float(d.accel[0]), float(d.accel[1]), float(d.accel[2])};
-        Vector3f gyro{float(d.gyro[0]), float(d.gyro[1]), float(d.gyro[2])};
+        Vector3f &gyro = gyros[i];
+        gyro = Vector3f{float(d.gyro[0]), float(d.gyro[1]), float(d.gyro[2])};
 
         accel *= accel_scale;
         gyro *= gyro_scale;
@@ -509,15 +515,14 @@ bool AP_InertialSensor_Invensensev3::accumulate_samples(const FIFOData *data, ui
 
         const float temp = d.temperature * temp_sensitivity + temp_zero;
 
-        // these four calls are about 40us
         _rotate_and_correct_accel(accel_instance, accel);
         _rotate_and_correct_gyro(gyro_instance, gyro);
 
         _notify_new_accel_raw_sample(accel_instance, accel, 0);
-        _notify_new_gyro_raw_sample(gyro_instance, gyro);
 
         temp_filtered = temp_filter.apply(temp);
     }
+    _notify_new_gyro_raw_samples(gyro_instance, gyros, n_samples);
     return true;
 }
 
@@ -546,20 +551,26 @@ bool AP_InertialSensor_Invensensev3::accumulate_highres_samples(const FIFODataHi
 #if INV3_ENABLE_FIFO_LOGGING
     const uint64_t tstart = AP_HAL::micros64();
 #endif
+    // gyro samples are gathered into one contiguous block so the burst
+    // can be handed to the backend in a single call
+    Vector3f gyros[INV3_FIFO_BUFFER_LEN];
+
     for (uint8_t i = 0; i < n_samples; i++) {
         const FIFODataHighRes &d = data[i];
 
         // we have a header to confirm we don't have FIFO corruption! no more mucking
         // about with the temperature registers
         if ((d.header & 0xFC) != 0x78) { // ACCEL_EN | GYRO_EN | HIRES_EN | TMST_FIELD_EN
-            // no or bad data
+            // no or bad data; deliver the good samples gathered so far
+            _notify_new_gyro_raw_samples(gyro_instance, gyros, i);
             return false;
         }
 
         Vector3f accel{uint20_to_float(d.accel[1], d.accel[0], d.ax),
             uint20_to_float(d.accel[3], d.accel[2], d.ay),
             uint20_to_float(d.accel[5], d.accel[4], d.az)};
-        Vector3f gyro{uint20_to_float(d.gyro[1], d.gyro[0], d.gx),
+        Vector3f &gyro = gyros[i];
+        gyro = Vector3f{uint20_to_float(d.gyro[1], d.gyro[0], d.gx),
             uint20_to_float(d.gyro[3], d.gyro[2], d.gy),
             uint20_to_float(d.gyro[5], d.gyro[4], d.gz)};
 
@@ -571,15 +582,14 @@ bool AP_InertialSensor_Invensensev3::accumulate_highres_samples(const FIFODataHi
 #endif
         const float temp = d.temperature * temp_sensitivity + temp_zero;
 
-        // these four calls are about 40us
         _rotate_and_correct_accel(accel_instance, accel);
         _rotate_and_correct_gyro(gyro_instance, gyro);
 
         _notify_new_accel_raw_sample(accel_instance, accel, 0);
-        _notify_new_gyro_raw_sample(gyro_instance, gyro);
 
         temp_filtered = temp_filter.apply(temp);
     }
+    _notify_new_gyro_raw_samples(gyro_instance, gyros, n_samples);
     return true;
 }
 #endif
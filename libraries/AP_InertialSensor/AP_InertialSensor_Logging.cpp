@@ -7,6 +7,7 @@
 
 #include <AP_AHRS/AP_AHRS.h>
 #include <AP_Logger/AP_Logger.h>
+#include <AP_Math/crc.h>
 
 // Write ACC data packet: raw accel data
 void AP_InertialSensor_Backend::Write_ACC(const uint8_t instance, const uint64_t sample_us, const Vector3f &accel) const
@@ -136,6 +137,9 @@ bool AP_InertialSensor::BatchSampler::Write_ISBD() const
     memcpy(pkt.x, &data_x[data_read_offset], sizeof(pkt.x));
     memcpy(pkt.y, &data_y[data_read_offset], sizeof(pkt.y));
     memcpy(pkt.z, &data_z[data_read_offset], sizeof(pkt.z));
+    // frame the sample payload with a CRC so analysis tools can reject
+    // blocks corrupted on the way to or from the storage
+    pkt.crc = crc16_ccitt((const uint8_t *)pkt.x, sizeof(pkt.x) + sizeof(pkt.y) + sizeof(pkt.z), 0xFFFF);
 
     return AP::logger().WriteBlock_first_succeed(&pkt, sizeof(pkt));
 }
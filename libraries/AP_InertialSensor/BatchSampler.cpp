@@ -42,6 +42,20 @@ const AP_Param::GroupInfo AP_InertialSensor::BatchSampler::var_info[] = {
     // @Increment: 1
     AP_GROUPINFO("BAT_LGCT", 5, AP_InertialSensor::BatchSampler, samples_per_msg,   32),
 
+    // @Param: BAT_PREDEC
+    // @DisplayName: pre-filter logging decimation
+    // @Description: Store every Nth sample when capturing pre-filter batches. Decimation reduces logging bandwidth at the cost of spectrum range, a batch covers N times as much flight time with a Nyquist frequency reduced by N. Samples are dropped rather than averaged so the retained samples are unmodified sensor data.
+    // @Range: 1 32
+    // @User: Advanced
+    AP_GROUPINFO("BAT_PREDEC", 6, AP_InertialSensor::BatchSampler, _pre_filter_decimation, 1),
+
+    // @Param: BAT_PSTDEC
+    // @DisplayName: post-filter logging decimation
+    // @Description: Store every Nth sample when capturing post-filter batches. Decimation reduces logging bandwidth at the cost of spectrum range, a batch covers N times as much flight time with a Nyquist frequency reduced by N. Samples are dropped rather than averaged so the retained samples are unmodified filter output.
+    // @Range: 1 32
+    // @User: Advanced
+    AP_GROUPINFO("BAT_PSTDEC", 7, AP_InertialSensor::BatchSampler, _post_filter_decimation, 1),
+
     AP_GROUPEND
 };
 
@@ -127,6 +141,9 @@ void AP_InertialSensor::BatchSampler::rotate_to_next_sensor()
         post_filter = false;
     }
 
+    // start each batch with a fresh decimation phase
+    decimation_counter = 0;
+
     if (type == IMU_SENSOR_TYPE_ACCEL) {
         // we have logged accelerometers, now log gyros:
         type = IMU_SENSOR_TYPE_GYRO;
@@ -217,6 +234,9 @@ void AP_InertialSensor::BatchSampler::push_data_to_log()
             }
             break;
         }
+        // report the effective rate of the stored samples so analysis
+        // tools see the correct bin frequencies
+        sample_rate /= active_decimation();
         if (!Write_ISBH(sample_rate)) {
             // buffer full?
             return;
@@ -277,6 +297,12 @@ void AP_InertialSensor::BatchSampler::sample(uint8_t _instance, AP_InertialSenso
     if (!should_log(_instance, _type)) {
         return;
     }
+    // decimate the active tap, storing one sample in every active_decimation()
+    if (decimation_counter > 0) {
+        decimation_counter--;
+        return;
+    }
+    decimation_counter = active_decimation() - 1;
     if (data_write_offset == 0) {
         measurement_started_us = sample_us;
     }
@@ -102,6 +102,7 @@ static_assert(sizeof(log_ISBH) < 256, "log_ISBH is over-size");
 // @Field: x: x-axis sample value
 // @Field: y: y-axis sample value
 // @Field: z: z-axis sample value
+// @Field: CRC: CRC16-CCITT of the sample payload, allows corrupt blocks to be rejected during analysis
 struct PACKED log_ISBD {
     LOG_PACKET_HEADER;
     uint64_t time_us;
@@ -110,6 +111,7 @@ struct PACKED log_ISBD {
     int16_t x[32];
     int16_t y[32];
     int16_t z[32];
+    uint16_t crc;
 };
 static_assert(sizeof(log_ISBD) < 256, "log_ISBD is over-size");
 
@@ -135,10 +137,10 @@ struct PACKED log_Vibe {
     { LOG_GYR_MSG, sizeof(log_GYR), \
       "GYR", "QBQfff",        "TimeUS,I,SampleUS,GyrX,GyrY,GyrZ", "s#sEEE", "F-F000" , true }, \
     { LOG_IMU_MSG, sizeof(log_IMU), \
-      "IMU",  "QBffffffIIfBBHH", "TimeUS,I,GyrX,GyrY,GyrZ,AccX,AccY,AccZ,EG,EA,T,GH,AH,GHz,AHz", "s#EEEooo--O--zz", "F-000000-----00" , true }, \
+      "IMU",  "QBffffffIIfBBHH", "TimeUS,I,GyrX,GyrY,GyrZ,AccX,AccY,AccZ,EG,EA,T,GH,AH,GHz,AHz", "s#EEEooo--O--zz", "F-000000-----00" , true, true }, \
     { LOG_VIBE_MSG, sizeof(log_Vibe), \
       "VIBE", "QBfffI", "TimeUS,IMU,VibeX,VibeY,VibeZ,Clip", "s#ooo-", "F-000-" , true }, \
     { LOG_ISBH_MSG, sizeof(log_ISBH), \
       "ISBH", "QHBBHHQf", "TimeUS,N,type,instance,mul,smp_cnt,SampleUS,smp_rate", "s-----sz", "F-----F-" },  \
     { LOG_ISBD_MSG, sizeof(log_ISBD), \
-      "ISBD", "QHHaaa", "TimeUS,N,seqno,x,y,z", "s--ooo", "F--???" },
+      "ISBD", "QHHaaaH", "TimeUS,N,seqno,x,y,z,CRC", "s--ooo-", "F--???-" },
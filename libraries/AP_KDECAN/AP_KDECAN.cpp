@@ -79,10 +79,9 @@ void AP_KDECAN::update()
 
 AP_KDECAN_Driver::AP_KDECAN_Driver() : CANSensor("KDECAN")
 {
+    // receiving and sending both run on the CANSensor thread, with
+    // periodic_update() providing the transmit scheduling
     register_driver(AP_CAN::Protocol::KDECAN);
-
-    // start thread for receiving and sending CAN frames. Tests show we use about 640 bytes of stack
-    hal.scheduler->thread_create(FUNCTOR_BIND_MEMBER(&AP_KDECAN_Driver::loop, void), "kdecan", 2048, AP_HAL::Scheduler::PRIORITY_CAN, 0);
 }
 
 // parse inbound frames
@@ -176,12 +175,8 @@ void AP_KDECAN_Driver::update(const uint8_t num_poles)
 
     _output.is_new = true;
 
-#if AP_KDECAN_USE_EVENTS
-    if (_output.thread_ctx != nullptr) {
-        // trigger the thread to wake up immediately
-        chEvtSignal(_output.thread_ctx, 1);
-    }
-#endif
+    // trigger the CANSensor thread to wake up immediately
+    wake_thread();
 
 #if AP_KDECAN_DEBUG
     static uint32_t last_send_ms = 0;
@@ -196,72 +191,53 @@ void AP_KDECAN_Driver::update(const uint8_t num_poles)
 #endif
 }
 
-void AP_KDECAN_Driver::loop()
+// transmit scheduling, run at 400Hz from the CANSensor thread
+void AP_KDECAN_Driver::periodic_update()
 {
-    uint16_t pwm[ARRAY_SIZE(_output.pwm)] {};
-
-#if AP_KDECAN_USE_EVENTS
-    _output.thread_ctx = chThdGetSelfX();
-#endif
-
-    uint8_t broadcast_esc_info_boot_spam_count = 3;
-    uint32_t broadcast_esc_info_next_interval_ms = 100; // spam a few at boot at this rate
-
-    while (true) {
-#if AP_KDECAN_USE_EVENTS
-        // sleep until we get new data, but also wake up at 400Hz to send the old data again
-        chEvtWaitAnyTimeout(ALL_EVENTS, chTimeUS2I(2500));
- #else
-        hal.scheduler->delay_microseconds(2500); // 400Hz
-#endif
-
-        const uint32_t now_ms = AP_HAL::millis();
+    const uint32_t now_ms = AP_HAL::millis();
 
-        // This should run at 400Hz
-        {
-            WITH_SEMAPHORE(_output.sem);
-            if (_output.is_new) {
-                _output.last_new_ms = now_ms;
-                _output.is_new = false;
-                memcpy(&pwm, &_output.pwm, sizeof(pwm));
-
-            } else if (_output.last_new_ms && now_ms - _output.last_new_ms > 1000) {
-                // if we haven't gotten any PWM updates for a bit, zero it
-                // out so we don't just keep sending the same values forever
-                memset(&pwm, 0, sizeof(pwm));
-                _output.last_new_ms = 0;
-            }
+    {
+        WITH_SEMAPHORE(_output.sem);
+        if (_output.is_new) {
+            _output.last_new_ms = now_ms;
+            _output.is_new = false;
+            memcpy(&_output.sent_pwm, &_output.pwm, sizeof(_output.sent_pwm));
+
+        } else if (_output.last_new_ms && now_ms - _output.last_new_ms > 1000) {
+            // if we haven't gotten any PWM updates for a bit, zero it
+            // out so we don't just keep sending the same values forever
+            memset(&_output.sent_pwm, 0, sizeof(_output.sent_pwm));
+            _output.last_new_ms = 0;
         }
+    }
 
-        for (uint8_t i=0; i<ARRAY_SIZE(_output.pwm); i++) {
-            if ((_init.detected_bitmask & (1UL<<i)) != 0) {
-                send_packet_uint16(SET_PWM_OBJ_ADDR, (i + ESC_NODE_ID_FIRST), 1000, pwm[i]);
-            }
+    for (uint8_t i=0; i<ARRAY_SIZE(_output.pwm); i++) {
+        if ((_init.detected_bitmask & (1UL<<i)) != 0) {
+            send_packet_uint16(SET_PWM_OBJ_ADDR, (i + ESC_NODE_ID_FIRST), 1000, _output.sent_pwm[i]);
         }
+    }
 
 #if HAL_WITH_ESC_TELEM
-        // broadcast as request-telemetry msg to everyone
-        if (_init.detected_bitmask != 0 && now_ms - _telemetry.timer_ms >= TELEMETRY_INTERVAL_MS) {
-            if (send_packet(TELEMETRY_OBJ_ADDR, BROADCAST_NODE_ID, 10000)) {
-                _telemetry.timer_ms = now_ms;
-            }
+    // broadcast as request-telemetry msg to everyone
+    if (_init.detected_bitmask != 0 && now_ms - _telemetry.timer_ms >= TELEMETRY_INTERVAL_MS) {
+        if (send_packet(TELEMETRY_OBJ_ADDR, BROADCAST_NODE_ID, 10000)) {
+            _telemetry.timer_ms = now_ms;
         }
+    }
 #endif // HAL_WITH_ESC_TELEM
 
-        if ((_init.detected_bitmask == 0 || broadcast_esc_info_boot_spam_count > 0) && (now_ms - _init.detected_bitmask_ms >= broadcast_esc_info_next_interval_ms)) {
-            // broadcast an "anyone there?" quick at boot but then 1Hz forever until we see at least 1 esc respond
-            if (broadcast_esc_info_boot_spam_count > 0) {
-                broadcast_esc_info_boot_spam_count--;
-            } else {
-                broadcast_esc_info_next_interval_ms = 1000;
-            }
-
-            if (send_packet(ESC_INFO_OBJ_ADDR, BROADCAST_NODE_ID, 100000)) {
-                _init.detected_bitmask_ms = now_ms;
-            }
+    if ((_init.detected_bitmask == 0 || _init.esc_info_boot_spam_count > 0) && (now_ms - _init.detected_bitmask_ms >= _init.esc_info_next_interval_ms)) {
+        // broadcast an "anyone there?" quick at boot but then 1Hz forever until we see at least 1 esc respond
+        if (_init.esc_info_boot_spam_count > 0) {
+            _init.esc_info_boot_spam_count--;
+        } else {
+            _init.esc_info_next_interval_ms = 1000;
         }
 
-    } // while true
+        if (send_packet(ESC_INFO_OBJ_ADDR, BROADCAST_NODE_ID, 100000)) {
+            _init.detected_bitmask_ms = now_ms;
+        }
+    }
 }
 
 bool AP_KDECAN_Driver::send_packet_uint16(const uint8_t address, const uint8_t dest_id, const uint32_t timeout_us, const uint16_t data)
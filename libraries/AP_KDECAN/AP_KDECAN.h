@@ -29,12 +29,6 @@
 #include <AP_Param/AP_Param.h>
 #include <AP_ESC_Telem/AP_ESC_Telem_Backend.h>
 
-#define AP_KDECAN_USE_EVENTS (defined(CH_CFG_USE_EVENTS) && CH_CFG_USE_EVENTS == TRUE)
-
-#if AP_KDECAN_USE_EVENTS
-#include <ch.h>
-#endif
-
 #define DEFAULT_NUM_POLES 14
 
 #define KDECAN_MAX_NUM_ESCS 8
@@ -59,11 +53,15 @@ private:
     bool send_packet_uint16(const uint8_t address, const uint8_t dest_id, const uint32_t timeout_us, const uint16_t data);
     bool send_packet(const uint8_t address, const uint8_t dest_id, const uint32_t timeout_us, const uint8_t *data = nullptr, const uint8_t data_len = 0);
 
-    void loop();
+    // transmit scheduling, run at 400Hz from the CANSensor thread
+    uint32_t periodic_interval_us() const override { return 2500; }
+    void periodic_update() override;
 
     struct {
         uint32_t detected_bitmask;
         uint32_t detected_bitmask_ms;
+        uint8_t esc_info_boot_spam_count = 3;
+        uint32_t esc_info_next_interval_ms = 100; // spam a few at boot at this rate
     } _init;
 
     struct {
@@ -71,9 +69,8 @@ private:
         bool is_new;
         uint32_t last_new_ms;
         uint16_t pwm[NUM_SERVO_CHANNELS];
-#if AP_KDECAN_USE_EVENTS
-        thread_t *thread_ctx;
-#endif
+        // last values taken by the transmit scheduler
+        uint16_t sent_pwm[NUM_SERVO_CHANNELS];
     } _output;
 
 #if HAL_WITH_ESC_TELEM
@@ -258,11 +258,11 @@ void AP_L1_Control::update_waypoint(const Location &prev_WP, const Location &nex
 
     // Calculate the NE position of WP B relative to WP A
     Vector2f AB = prev_WP.get_distance_NE(next_WP);
-    float AB_length = AB.length();
+    const float AB_length = AB.length();
 
     // Check for AB zero length and track directly to the destination
     // if too small
-    if (AB.length() < 1.0e-6f) {
+    if (AB_length < 1.0e-6f) {
         AB = _current_loc.get_distance_NE(next_WP);
         if (AB.length() < 1.0e-6f) {
             AB = Vector2f(cosf(get_yaw()), sinf(get_yaw()));
@@ -395,7 +395,8 @@ void AP_L1_Control::update_loiter(const Location &center_WP, float radius, int8_
     // if too close to the waypoint, use the velocity vector
     // if the velocity vector is too small, use the heading vector
     Vector2f A_air_unit;
-    if (A_air.length() > 0.1f) {
+    const float A_air_length = A_air.length();
+    if (A_air_length > 0.1f) {
         A_air_unit = A_air.normalized();
     } else {
         if (_groundspeed_vector.length() < 0.1f) {
@@ -420,7 +421,7 @@ void AP_L1_Control::update_loiter(const Location &center_WP, float radius, int8_
 
     // Calculate radial position and velocity errors
     float xtrackVelCirc = -ltrackVelCap; // Radial outbound velocity - reuse previous radial inbound velocity
-    float xtrackErrCirc = A_air.length() - radius; // Radial distance from the loiter circle
+    float xtrackErrCirc = A_air_length - radius; // Radial distance from the loiter circle
 
     // keep crosstrack error for reporting
     _crosstrack_error = xtrackErrCirc;
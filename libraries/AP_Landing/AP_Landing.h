@@ -192,6 +192,19 @@ private:
         bool has_aborted_due_to_slope_recalc:1;
     } type_slope_flags;
 
+    // approach geometry cached by type_slope_setup_landing_glide_slope().
+    // The aim point depends only on the waypoints and the groundspeed
+    // (which carries the wind correction), so it is rebuilt when those
+    // change rather than on every loop of the approach
+    struct {
+        bool valid;
+        Location prev_WP_loc;
+        Location next_WP_loc;
+        float groundspeed;
+        Location aim_point;
+        int32_t target_altitude_offset_cm;
+    } type_slope_geometry;
+
     void type_slope_do_land(const AP_Mission::Mission_Command& cmd, const float relative_altitude);
     void type_slope_verify_abort_landing(const Location &prev_WP_loc, Location &next_WP_loc, bool &throttle_suppressed);
     bool type_slope_verify_land(const Location &prev_WP_loc, Location &next_WP_loc, const Location &current_loc,
@@ -200,6 +213,7 @@ private:
     void type_slope_adjust_landing_slope_for_rangefinder_bump(AP_FixedWing::Rangefinder_State &rangefinder_state, Location &prev_WP_loc, Location &next_WP_loc, const Location &current_loc, const float wp_distance, int32_t &target_altitude_offset_cm);
 
     void type_slope_setup_landing_glide_slope(const Location &prev_WP_loc, const Location &next_WP_loc, const Location &current_loc, int32_t &target_altitude_offset_cm);
+    void type_slope_build_approach_geometry(const Location &prev_WP_loc, const Location &next_WP_loc, const float groundspeed);
     int32_t type_slope_get_target_airspeed_cm(void);
     void type_slope_check_if_need_to_abort(const AP_FixedWing::Rangefinder_State &rangefinder_state);
     int32_t type_slope_constrain_roll(const int32_t desired_roll_cd, const int32_t level_roll_limit_cd);
@@ -181,6 +181,7 @@ void AP_Landing_Deepstall::do_land(const AP_Mission::Mission_Command& cmd, const
     ds_PID.reset();
     L1_xtrack_i = 0.0f;
     hold_level = false; // come out of yaw lock
+    predict_cache_valid = false;
 
     // load the landing point in, the rest of path building is deferred for a better wind estimate
     memcpy(&landing_point, &cmd.content.location, sizeof(Location));
@@ -240,14 +241,18 @@ bool AP_Landing_Deepstall::verify_land(const Location &prev_WP_loc, Location &ne
         }
         stage = DEEPSTALL_STAGE_WAIT_FOR_BREAKOUT;
         loiter_sum_cd = 0; // reset the loiter counter
+        build_approach_path(false);
         FALLTHROUGH;
         }
     case DEEPSTALL_STAGE_WAIT_FOR_BREAKOUT:
         // rebuild the approach path if we have done less then a full circle to allow it to be
         // more into the wind as the estimator continues to refine itself, and allow better
         // compensation on windy days. This is limited to a single full circle though, as on
-        // a no wind day you could be in this loop forever otherwise.
-        if (loiter_sum_cd < 36000) {
+        // a no wind day you could be in this loop forever otherwise. The path is a pure
+        // function of the wind and the landing point, so only rebuild once the estimate has
+        // moved enough to change the answer
+        if (loiter_sum_cd < 36000 &&
+            (landing.ahrs.wind_estimate() - approach_wind).xy().length() > DEEPSTALL_WIND_CHANGE_MS) {
             build_approach_path(false);
         }
         if (!verify_breakout(current_loc, arc_entry, height - approach_alt_offset)) {
@@ -508,6 +513,7 @@ void AP_Landing_Deepstall::build_approach_path(bool use_current_heading)
     float loiter_radius = landing.nav_controller->loiter_radius(landing.aparm.loiter_radius);
 
     Vector3f wind = landing.ahrs.wind_estimate();
+    approach_wind = wind;
     // TODO: Support a user defined approach heading
     target_heading_deg = use_current_heading ? landing.ahrs.get_yaw_deg() : (degrees(atan2f(-wind.y, -wind.x)));
 
@@ -552,48 +558,60 @@ void AP_Landing_Deepstall::build_approach_path(bool use_current_heading)
 
 float AP_Landing_Deepstall::predict_travel_distance(const Vector3f wind, const float height, const bool print)
 {
-    bool reverse = false;
+    // the trigonometry below depends only on the wind and the approach
+    // heading, while the height just scales the result, so the factors
+    // are cached and only recomputed once the wind estimate or heading
+    // have moved. This is called every loop on approach
+    if (!predict_cache_valid ||
+        !is_equal(target_heading_deg, predict_heading_deg) ||
+        (wind - predict_wind).xy().length() > DEEPSTALL_WIND_CHANGE_MS) {
+        bool reverse = false;
 
-    float course = radians(target_heading_deg);
+        float course = radians(target_heading_deg);
 
-    // a forward speed of 0 will result in a divide by 0
-    float forward_speed_ms = MAX(forward_speed, 0.1f);
+        // a forward speed of 0 will result in a divide by 0
+        float forward_speed_ms = MAX(forward_speed, 0.1f);
 
-    Vector2f wind_vec(wind.x, wind.y); // work with the 2D component of wind
-    float wind_length = MAX(wind_vec.length(), 0.05f); // always assume a slight wind to avoid divide by 0
-    Vector2f course_vec(cosf(course), sinf(course));
+        Vector2f wind_vec(wind.x, wind.y); // work with the 2D component of wind
+        float wind_length = MAX(wind_vec.length(), 0.05f); // always assume a slight wind to avoid divide by 0
+        Vector2f course_vec(cosf(course), sinf(course));
 
-    float offset = course - atan2f(-wind.y, -wind.x);
+        float offset = course - atan2f(-wind.y, -wind.x);
 
-    // estimator for how far the aircraft will travel while entering the stall
-    float stall_distance = slope_a * wind_length * cosf(offset) + slope_b;
+        // estimator for how far the aircraft will travel while entering the stall
+        cached_stall_distance = slope_a * wind_length * cosf(offset) + slope_b;
 
-    float theta = acosf(constrain_float((wind_vec * course_vec) / wind_length, -1.0f, 1.0f));
-    if ((course_vec % wind_vec) > 0) {
-        reverse = true;
-        theta *= -1;
-    }
+        float theta = acosf(constrain_float((wind_vec * course_vec) / wind_length, -1.0f, 1.0f));
+        if ((course_vec % wind_vec) > 0) {
+            reverse = true;
+            theta *= -1;
+        }
 
-    float cross_component = sinf(theta) * wind_length;
-    float estimated_crab_angle = asinf(constrain_float(cross_component / forward_speed_ms, -1.0f, 1.0f));
-    if (reverse) {
-        estimated_crab_angle *= -1;
-    }
+        float cross_component = sinf(theta) * wind_length;
+        float estimated_crab_angle = asinf(constrain_float(cross_component / forward_speed_ms, -1.0f, 1.0f));
+        if (reverse) {
+            estimated_crab_angle *= -1;
+        }
+
+        cached_estimated_forward = cosf(estimated_crab_angle) * forward_speed_ms + cosf(theta) * wind_length;
 
-    float estimated_forward = cosf(estimated_crab_angle) * forward_speed_ms + cosf(theta) * wind_length;
+        predict_wind = wind;
+        predict_heading_deg = target_heading_deg;
+        predict_cache_valid = true;
+    }
 
     if (is_positive(down_speed)) {
-        predicted_travel_distance = (estimated_forward * height / down_speed) + stall_distance;
+        predicted_travel_distance = (cached_estimated_forward * height / down_speed) + cached_stall_distance;
     } else {
         // if we don't have a sane downward speed in a deepstall (IE not zero, and not
         // an ascent) then just provide the stall_distance as a reasonable approximation
-        predicted_travel_distance = stall_distance;
+        predicted_travel_distance = cached_stall_distance;
     }
 
     if(print) {
         // allow printing the travel distances on the final entry as its used for tuning
         GCS_SEND_TEXT(MAV_SEVERITY_INFO, "Deepstall: Entry: %0.1f (m) Travel: %0.1f (m)",
-                                         (double)stall_distance, (double)predicted_travel_distance);
+                                         (double)cached_stall_distance, (double)predicted_travel_distance);
     }
 
     return predicted_travel_distance;
@@ -79,6 +79,12 @@ private:
     float predicted_travel_distance; // distance the aircraft is perdicted to travel during deepstall
     bool hold_level; // locks the target yaw rate of the aircraft to 0, serves to hold the aircraft level at all times
     float approach_alt_offset;     // approach altitude offset
+    Vector3f approach_wind;        // wind estimate used for the last approach path build
+    Vector3f predict_wind;         // wind used for the cached travel distance factors
+    float predict_heading_deg;     // approach heading used for the cached travel distance factors
+    float cached_stall_distance;   // wind dependent distance travelled while entering the stall
+    float cached_estimated_forward; // wind dependent forward speed over the ground while stalled
+    bool predict_cache_valid;      // true when the cached factors match the current wind and heading
 
     //public AP_Landing interface
     void do_land(const AP_Mission::Mission_Command& cmd, const float relative_altitude);
@@ -109,6 +115,8 @@ private:
     float update_steering(void);
 
     #define DEEPSTALL_LOITER_ALT_TOLERANCE 5.0f
+    // wind estimate change that forces a rebuild of the approach path and travel distance
+    #define DEEPSTALL_WIND_CHANGE_MS 0.5f
 };
 
 #endif  // HAL_LANDING_DEEPSTALL_ENABLED
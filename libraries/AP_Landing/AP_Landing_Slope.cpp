@@ -29,10 +29,14 @@
 //  - this is just here to encourage the build system to supply the "legacy build defines".  The actual dependecy is in the AP_LandingGear.h and AP_LandingGear_config.h headers
 #endif
 
+// groundspeed change that forces a rebuild of the cached approach geometry
+#define TYPE_SLOPE_GROUNDSPEED_CHANGE_MS 0.5f
+
 void AP_Landing::type_slope_do_land(const AP_Mission::Mission_Command& cmd, const float relative_altitude)
 {
     initial_slope = 0;
     slope = 0;
+    type_slope_geometry.valid = false;
 
     // once landed, post some landing statistics to the GCS
     type_slope_flags.post_stats = false;
@@ -255,6 +259,44 @@ bool AP_Landing::type_slope_request_go_around(void)
   which can lead to erratic pitch control
  */
 void AP_Landing::type_slope_setup_landing_glide_slope(const Location &prev_WP_loc, const Location &next_WP_loc, const Location &current_loc, int32_t &target_altitude_offset_cm)
+{
+    // current ground speed
+    float groundspeed = ahrs.groundspeed();
+    if (groundspeed < 0.5f) {
+        groundspeed = 0.5f;
+    }
+
+    // the aim point is a pure function of the waypoints and the
+    // groundspeed, so only rebuild it when one of those changes rather
+    // than on every loop of the approach. The groundspeed carries the
+    // wind correction; small changes don't move the flare point enough
+    // to matter
+    if (!type_slope_geometry.valid ||
+        !prev_WP_loc.same_loc_as(type_slope_geometry.prev_WP_loc) ||
+        !next_WP_loc.same_loc_as(type_slope_geometry.next_WP_loc) ||
+        fabsf(groundspeed - type_slope_geometry.groundspeed) > TYPE_SLOPE_GROUNDSPEED_CHANGE_MS) {
+        type_slope_build_approach_geometry(prev_WP_loc, next_WP_loc, groundspeed);
+    }
+
+    const Location &loc = type_slope_geometry.aim_point;
+    target_altitude_offset_cm = type_slope_geometry.target_altitude_offset_cm;
+
+    // calculate the proportion we are to the target
+    float land_proportion = current_loc.line_path_proportion(prev_WP_loc, loc);
+
+    // now setup the glide slope for landing
+    set_target_altitude_proportion_fn(loc, 1.0f - land_proportion);
+
+    // stay within the range of the start and end locations in altitude
+    constrain_target_altitude_location_fn(loc, prev_WP_loc);
+}
+
+/*
+  rebuild the cached aim point for the landing approach. This is the
+  expensive part of the glide slope calculation and is only done when
+  the waypoints or the groundspeed change
+ */
+void AP_Landing::type_slope_build_approach_geometry(const Location &prev_WP_loc, const Location &next_WP_loc, const float groundspeed)
 {
     float total_distance = prev_WP_loc.get_distance(next_WP_loc);
 
@@ -267,12 +309,6 @@ void AP_Landing::type_slope_setup_landing_glide_slope(const Location &prev_WP_lo
     // height we need to sink for this WP
     float sink_height = (loc_alt_AMSL_cm(prev_WP_loc) - loc_alt_AMSL_cm(next_WP_loc))*0.01f;
 
-    // current ground speed
-    float groundspeed = ahrs.groundspeed();
-    if (groundspeed < 0.5f) {
-        groundspeed = 0.5f;
-    }
-
     // calculate time to lose the needed altitude
     float sink_time = total_distance / groundspeed;
     if (sink_time < 0.5f) {
@@ -331,17 +367,13 @@ void AP_Landing::type_slope_setup_landing_glide_slope(const Location &prev_WP_lo
     loc.offset_bearing(land_bearing_cd * 0.01f, land_projection);
     loc.offset_up_m(-slope * land_projection);
 
-    // setup the offset_cm for set_target_altitude_proportion()
-    target_altitude_offset_cm = loc.alt - loc_alt_AMSL_cm(prev_WP_loc);
-
-    // calculate the proportion we are to the target
-    float land_proportion = current_loc.line_path_proportion(prev_WP_loc, loc);
-
-    // now setup the glide slope for landing
-    set_target_altitude_proportion_fn(loc, 1.0f - land_proportion);
-
-    // stay within the range of the start and end locations in altitude
-    constrain_target_altitude_location_fn(loc, prev_WP_loc);
+    type_slope_geometry.valid = true;
+    type_slope_geometry.prev_WP_loc = prev_WP_loc;
+    type_slope_geometry.next_WP_loc = next_WP_loc;
+    type_slope_geometry.groundspeed = groundspeed;
+    type_slope_geometry.aim_point = loc;
+    // the offset_cm for set_target_altitude_proportion()
+    type_slope_geometry.target_altitude_offset_cm = loc.alt - loc_alt_AMSL_cm(prev_WP_loc);
 }
 
 int32_t AP_Landing::type_slope_get_target_airspeed_cm(void)
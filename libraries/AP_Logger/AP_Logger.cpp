@@ -203,6 +203,25 @@ const AP_Param::GroupInfo AP_Logger::var_info[] = {
     // @RebootRequired: True
     AP_GROUPINFO("_MAX_FILES", 12, AP_Logger, _params.max_log_files, MAX_LOG_FILES),
 
+#if HAL_LOGGING_BLOCK_ENABLED
+    // @Param: _BLK_CRITONLY
+    // @DisplayName: Block backend critical messages only
+    // @Description: When enabled the block backend only stores critical messages (such as mode changes, errors and watchdog data) and low-rate infrastructure messages, leaving the bulk streaming sensor data to the other backends. This gives blackbox durability on flash without paying erase latency on the bulk path.
+    // @Values: 0:Disabled,1:Enabled
+    // @User: Advanced
+    AP_GROUPINFO("_BLK_CRITONLY", 13, AP_Logger, _params.blk_critonly, 0),
+#endif
+
+#if AP_LOGGER_FILE_DIRECT_IO_ENABLED
+    // @Param: _FILE_DIRECT
+    // @DisplayName: Use unbuffered log file writes
+    // @Description: When enabled log files are opened with O_DIRECT, bypassing the kernel page cache. This avoids the multi-hundred-millisecond stalls the page cache writeback can impose on a busy SD card at the cost of slightly higher average write times. Write latency can be monitored with the FIOS log message.
+    // @Values: 0:Disabled,1:Enabled
+    // @User: Advanced
+    // @RebootRequired: True
+    AP_GROUPINFO("_FILE_DIRECT", 14, AP_Logger, _params.file_direct_io, 0),
+#endif
+
     AP_GROUPEND
 };
 
@@ -216,6 +235,10 @@ AP_Logger::AP_Logger()
     }
 
     _singleton = this;
+
+    // mark every msg_type as unused until init() installs the
+    // structure list
+    memset(_structure_index, 0xFF, sizeof(_structure_index));
 }
 
 void AP_Logger::init(const AP_Int32 &log_bitmask, const struct LogStructure *structures, uint8_t num_types)
@@ -235,6 +258,7 @@ void AP_Logger::init(const AP_Int32 &log_bitmask, const struct LogStructure *str
 #endif
     _num_types = num_types;
     _structures = structures;
+    build_structure_index();
 
     // the "main" logging type needs to come before mavlink so that
     // index 0 is correct
@@ -1267,16 +1291,31 @@ AP_Logger::log_write_fmt *AP_Logger::msg_fmt_for_name(const char *name, const ch
     return f;
 }
 
+/*
+  build the direct msg_type index used by structure_for_msg_type(),
+  replacing a linear scan of the structure table
+ */
+void AP_Logger::build_structure_index(void)
+{
+    memset(_structure_index, 0xFF, sizeof(_structure_index));
+    for (uint16_t i=0; i<_num_types; i++) {
+        const uint8_t msg_type = structure(i)->msg_type;
+        if (_structure_index[msg_type] == 0xFF) {
+            // on a duplicate the first entry wins, matching the scan
+            // this replaces. Duplicates are caught at boot by
+            // validate_structures() on SITL
+            _structure_index[msg_type] = i;
+        }
+    }
+}
+
 const struct LogStructure *AP_Logger::structure_for_msg_type(const uint8_t msg_type) const
 {
-    for (uint16_t i=0; i<_num_types;i++) {
-        const struct LogStructure *s = structure(i);
-        if (s->msg_type == msg_type) {
-            // in use
-            return s;
-        }
+    const uint8_t idx = _structure_index[msg_type];
+    if (idx == 0xFF || idx >= _num_types) {
+        return nullptr;
     }
-    return nullptr;
+    return structure(idx);
 }
 
 const struct AP_Logger::log_write_fmt *AP_Logger::log_write_fmt_for_msg_type(const uint8_t msg_type) const
@@ -1295,12 +1334,8 @@ const struct AP_Logger::log_write_fmt *AP_Logger::log_write_fmt_for_msg_type(con
 bool AP_Logger::msg_type_in_use(const uint8_t msg_type) const
 {
     // check static list of messages (e.g. from LOG_COMMON_STRUCTURES)
-    // check the write format types to see if we've used this one
-    for (uint16_t i=0; i<_num_types;i++) {
-        if (structure(i)->msg_type == msg_type) {
-            // in use
-            return true;
-        }
+    if (_structure_index[msg_type] != 0xFF) {
+        return true;
     }
 
     struct log_write_fmt *f;
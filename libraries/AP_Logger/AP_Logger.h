@@ -206,7 +206,10 @@ public:
 
     // initialisation
     void init(const AP_Int32 &log_bitmask, const struct LogStructure *structure, uint8_t num_types);
-    void set_num_types(uint8_t num_types) { _num_types = num_types; }
+    void set_num_types(uint8_t num_types) {
+        _num_types = num_types;
+        build_structure_index();
+    }
 
     bool CardInserted(void);
     bool _log_pause;
@@ -360,6 +363,8 @@ public:
         AP_Float blk_ratemax;
         AP_Float disarm_ratemax;
         AP_Int16 max_log_files;
+        AP_Int8 blk_critonly;
+        AP_Int8 file_direct_io;
     } _params;
 
     const struct LogStructure *structure(uint16_t num) const;
@@ -471,6 +476,12 @@ private:
 
     const struct LogStructure *structure_for_msg_type(uint8_t msg_type) const;
 
+    // direct index from msg_type to structure table slot, 0xFF means
+    // no static structure for that msg_type. Rebuilt whenever the
+    // structure list changes
+    uint8_t _structure_index[256];
+    void build_structure_index(void);
+
     // return a msg_type which is not currently in use (or -1 if none available)
     int16_t find_free_msg_type() const;
 
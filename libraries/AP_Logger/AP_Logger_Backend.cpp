@@ -461,12 +461,134 @@ bool AP_Logger_Backend::WritePrioritisedBlock(const void *pBuffer, uint16_t size
         }
     }
 
+    if (!is_critical && !_writing_startup_messages && critical_only()) {
+        // this backend is reserved for crash-critical data; drop bulk
+        // streaming sensor messages but let low-rate infrastructure
+        // messages (FMT, PARM, MODE etc) through so that the log
+        // remains self-describing
+        const uint8_t *msgbuf = (const uint8_t *)pBuffer;
+        const uint8_t msgid = msgbuf[2];
+        if (!_streaming_checked.get(msgid)) {
+            const auto *mtype = _front.structure_for_msg_type(msgid);
+            if ((mtype != nullptr && mtype->streaming) || writev_streaming) {
+                _streaming_types.set(msgid);
+            }
+            _streaming_checked.set(msgid);
+        }
+        if (_streaming_types.get(msgid)) {
+            return false;
+        }
+    }
+
     if (!ensure_format_emitted(pBuffer, size)) {
         return false;
     }
 
+#if AP_LOGGER_DELTA_ENCODING_ENABLED
+    return write_delta_encoded(pBuffer, size, is_critical);
+#else
     return _WritePrioritisedBlock(pBuffer, size, is_critical);
+#endif
+}
+
+#if AP_LOGGER_DELTA_ENCODING_ENABLED
+// append a LEB128 varint to buf at ofs
+static void emit_varint(uint8_t *buf, uint16_t &ofs, uint16_t v)
+{
+    while (v >= 0x80) {
+        buf[ofs++] = 0x80 | (v & 0x7F);
+        v >>= 7;
+    }
+    buf[ofs++] = v;
+}
+
+/*
+  write a record, delta-encoding it against the previous record of the
+  same type where the type is flagged for it. The cache is only
+  updated after a successful backend write so the decoder's chain of
+  previous records always matches what is in the log
+ */
+bool AP_Logger_Backend::write_delta_encoded(const void *pBuffer, uint16_t size, bool is_critical)
+{
+    const uint8_t *msg = (const uint8_t *)pBuffer;
+    if (size <= LOG_PACKET_HEADER_LEN || msg[0] != HEAD_BYTE1 || msg[1] != HEAD_BYTE2) {
+        return _WritePrioritisedBlock(pBuffer, size, is_critical);
+    }
+    DeltaState &ds = _delta_state[msg[2]];
+    if (ds.mode == 0) {
+        ds.mode = 1;
+        for (uint8_t i = 0; i < num_types(); i++) {
+            const auto *s = structure(i);
+            if (s->msg_type == msg[2]) {
+                ds.mode = s->delta_encode ? 2 : 1;
+                break;
+            }
+        }
+    }
+    if (ds.mode != 2) {
+        return _WritePrioritisedBlock(pBuffer, size, is_critical);
+    }
+
+    const uint8_t *body = &msg[LOG_PACKET_HEADER_LEN];
+    const uint16_t body_len = size - LOG_PACKET_HEADER_LEN;
+    if (ds.prev == nullptr) {
+        ds.prev = (uint8_t *)calloc(1, body_len);
+    }
+    if (ds.prev == nullptr || !ds.prev_valid) {
+        // no baseline, write the full record to establish one
+        if (_WritePrioritisedBlock(pBuffer, size, is_critical)) {
+            if (ds.prev != nullptr) {
+                memcpy(ds.prev, body, body_len);
+                ds.prev_valid = true;
+            }
+            return true;
+        }
+        return false;
+    }
+
+    // encode the XOR difference as (zero_run, literal_run, literals)
+    uint8_t enc[LOG_PACKET_MAX_LEN];
+    uint16_t enc_len = LOG_PACKET_HEADER_LEN;
+    enc[0] = HEAD_BYTE1;
+    enc[1] = HEAD_BYTE2_DELTA;
+    enc[2] = msg[2];
+    uint16_t pos = 0;
+    while (pos < body_len && enc_len + 2 < size) {
+        uint16_t zeros = 0;
+        while (pos + zeros < body_len && body[pos + zeros] == ds.prev[pos + zeros]) {
+            zeros++;
+        }
+        uint16_t lits = 0;
+        while (pos + zeros + lits < body_len && body[pos + zeros + lits] != ds.prev[pos + zeros + lits]) {
+            lits++;
+        }
+        emit_varint(enc, enc_len, zeros);
+        emit_varint(enc, enc_len, lits);
+        if (enc_len + lits >= size) {
+            break;
+        }
+        for (uint16_t i = 0; i < lits; i++) {
+            enc[enc_len++] = body[pos + zeros + i] ^ ds.prev[pos + zeros + i];
+        }
+        pos += zeros + lits;
+    }
+
+    bool written;
+    if (pos == body_len && enc_len < size) {
+        written = _WritePrioritisedBlock(enc, enc_len, is_critical);
+    } else {
+        // no saving over the fixed-size form
+        written = _WritePrioritisedBlock(pBuffer, size, is_critical);
+    }
+    if (written) {
+        memcpy(ds.prev, body, body_len);
+    } else {
+        // the decoder will not see this record, so the chain is broken
+        ds.prev_valid = false;
+    }
+    return written;
 }
+#endif // AP_LOGGER_DELTA_ENCODING_ENABLED
 
 bool AP_Logger_Backend::ShouldLog(bool is_critical)
 {
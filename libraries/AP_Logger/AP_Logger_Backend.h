@@ -199,6 +199,10 @@ protected:
     virtual bool WritesOK() const = 0;
     virtual bool StartNewLogOK() const;
 
+    // true if this backend should only receive critical and low-rate
+    // infrastructure messages, not bulk streaming sensor data
+    virtual bool critical_only() const { return false; }
+
     // called by PrepForArming to actually start logging
     virtual void PrepForArming_start_logging(void) {
         start_new_log();
@@ -278,6 +282,25 @@ private:
     bool emit_format_for_type(LogMessages a_type);
     Bitmask<256> _formats_written;
 
+    // caches of the streaming attribute of message types, used when
+    // critical_only() to avoid costly calls to structure_for_msg_type
+    Bitmask<256> _streaming_checked;
+    Bitmask<256> _streaming_types;
+
+#if AP_LOGGER_DELTA_ENCODING_ENABLED
+    // delta encoding of flagged message types, see the decoder
+    // contract in LogStructure.h. The cache holds the body of the
+    // last record of each type known to have reached this backend
+    bool write_delta_encoded(const void *pBuffer, uint16_t size, bool is_critical);
+    struct DeltaState {
+        uint8_t *prev;
+        bool prev_valid;
+        // 0: not yet looked up, 1: type not flagged, 2: type flagged
+        uint8_t mode;
+    };
+    DeltaState _delta_state[256];
+#endif
+
     uint8_t msg_id;  // the ID of the next MSG message that will be logged
 };
 
@@ -9,6 +9,7 @@
 #include "AP_Logger_Block.h"
 #include "AP_Logger.h"
 #include <AP_HAL/AP_HAL.h>
+#include <AP_Math/AP_Math.h>
 #include <stdio.h>
 #include <AP_RTC/AP_RTC.h>
 #include <GCS_MAVLink/GCS.h>
@@ -111,7 +112,12 @@ void AP_Logger_Block::FinishWrite(void)
             chip_full = true;
             return;
         }
-        SectorErase(get_block(df_PageAdr));
+        if (pre_erased_blocks > 0) {
+            // already erased ahead of time by erase_ahead()
+            pre_erased_blocks--;
+        } else {
+            timed_block_erase(get_block(df_PageAdr), true);
+        }
     }
 }
 
@@ -304,7 +310,12 @@ void AP_Logger_Block::periodic_1Hz()
         // setup rate limiting if log rate max > 0Hz or log pause of streaming entries is requested
         rate_limiter = NEW_NOTHROW AP_Logger_RateLimiter(_front, _front._params.blk_ratemax, _front._params.disarm_ratemax);
     }
-    
+
+    if (log_write_started && erase_stats.count != erase_stats.last_logged_count) {
+        Write_DFES();
+        erase_stats.last_logged_count = erase_stats.count;
+    }
+
     if (!io_thread_alive()) {
         if (warning_decimation_counter == 0 && _initialised) {
             // we don't print this error unless we did initialise. When _initialised is set to true
@@ -902,9 +913,88 @@ void AP_Logger_Block::io_timer(void)
         WITH_SEMAPHORE(sem);
 
         write_log_page();
+
+    // otherwise use the idle cycle to keep blocks erased ahead of the
+    // write point
+    } else if (log_write_started) {
+        WITH_SEMAPHORE(sem);
+
+        erase_ahead();
     }
 }
 
+// erase a block, gathering latency statistics for the DFES message
+void AP_Logger_Block::timed_block_erase(uint32_t BlockAdr, bool inline_erase)
+{
+    const uint32_t start_us = AP_HAL::micros();
+    SectorErase(BlockAdr);
+    const uint32_t dt_us = AP_HAL::micros() - start_us;
+
+    erase_stats.count++;
+    erase_stats.last_us = dt_us;
+    erase_stats.total_us += dt_us;
+    if (dt_us > erase_stats.max_us) {
+        erase_stats.max_us = dt_us;
+    }
+    if (inline_erase) {
+        erase_stats.inline_count++;
+    }
+}
+
+/*
+  maintain a pool of pre-erased blocks ahead of the write point, sized
+  from the measured write rate, so that the erase on a ring wrap does
+  not stall the io thread while buffered log data is waiting
+ */
+void AP_Logger_Block::erase_ahead(void)
+{
+    // aim for a second of logging at the current page rate, at least
+    // one block and no more than four
+    const uint8_t target = MIN(1 + page_rate / df_PagePerBlock, 4);
+    if (pre_erased_blocks >= target) {
+        return;
+    }
+
+    // never erase ahead into blocks the current file's header could
+    // occupy; FinishWrite() latches chip_full before getting there
+    if (df_Write_FilePage > df_NumPages - (uint32_t(pre_erased_blocks) + 2) * df_PagePerBlock) {
+        return;
+    }
+
+    const uint32_t total_blocks = df_NumPages / df_PagePerBlock;
+    const uint32_t next_block = (get_block(df_PageAdr) + 1 + pre_erased_blocks) % total_blocks;
+    const uint32_t first_page = next_block * df_PagePerBlock + 1;
+
+    // if we are wrapping over an existing log, force the oldest to be
+    // recalculated; the inline check in FinishWrite() only sees
+    // already-erased pages once we have been here
+    if (_cached_oldest_log > 0) {
+        uint16_t log_num = StartRead(first_page);
+        if (log_num != 0xFFFF && log_num >= _cached_oldest_log) {
+            _cached_oldest_log = 0;
+        }
+    }
+
+    timed_block_erase(next_block, false);
+    pre_erased_blocks++;
+}
+
+// write out the DFES erase statistics message
+void AP_Logger_Block::Write_DFES(void)
+{
+    const struct log_DFES pkt {
+        LOG_PACKET_HEADER_INIT(LOG_DF_ERASE_STATS),
+        time_us      : AP_HAL::micros64(),
+        count        : erase_stats.count,
+        inline_count : erase_stats.inline_count,
+        last_us      : erase_stats.last_us,
+        max_us       : erase_stats.max_us,
+        avg_us       : uint32_t(erase_stats.total_us / erase_stats.count),
+        pre_erased   : pre_erased_blocks,
+    };
+    WriteBlock(&pkt, sizeof(pkt));
+}
+
 // write out a page of log data
 void AP_Logger_Block::write_log_page()
 {
@@ -922,6 +1012,15 @@ void AP_Logger_Block::write_log_page()
     }
     FinishWrite();
     df_Write_FilePage++;
+
+    // track the page write rate for erase_ahead() pool sizing
+    pages_this_second++;
+    const uint32_t now = AP_HAL::millis();
+    if (now - page_rate_start_ms >= 1000) {
+        page_rate = pages_this_second;
+        pages_this_second = 0;
+        page_rate_start_ms = now;
+    }
 }
 
 void AP_Logger_Block::flash_test()
@@ -40,6 +40,7 @@ protected:
     void periodic_1Hz() override;
     void periodic_10Hz(const uint32_t now) override;
     bool WritesOK() const override;
+    bool critical_only() const override { return _front._params.blk_critonly != 0; }
 
     // get the current sector from the current page
     uint32_t get_sector(uint32_t current_page) const {
@@ -108,6 +109,24 @@ private:
     // page to wipe from in the case of corruption
     uint32_t df_EraseFrom;
 
+    // number of whole blocks erased ahead of the write point by
+    // erase_ahead(), so the erase on a ring wrap is normally a no-op
+    uint8_t pre_erased_blocks;
+    // pages written in the current measurement window, used to size
+    // the pre-erased pool from the write rate
+    uint16_t pages_this_second;
+    uint32_t page_rate_start_ms;
+    uint16_t page_rate;
+    // erase latency statistics, reported in the DFES log message
+    struct {
+        uint32_t count;
+        uint32_t inline_count;
+        uint32_t last_logged_count;
+        uint32_t last_us;
+        uint32_t max_us;
+        uint64_t total_us;
+    } erase_stats;
+
     // offset from adding FMT messages to log data
     bool adding_fmt_headers;
 
@@ -162,6 +181,12 @@ private:
     // callback on IO thread
     bool io_thread_alive() const;
     void write_log_page();
+
+    // erase a block, gathering latency statistics
+    void timed_block_erase(uint32_t BlockAdr, bool inline_erase);
+    // top up the pool of pre-erased blocks ahead of the write point
+    void erase_ahead(void);
+    void Write_DFES(void);
 };
 
 #endif  // HAL_LOGGING_BLOCK_ENABLED
@@ -22,6 +22,7 @@
 
 #include "AP_Logger.h"
 #include "AP_Logger_File.h"
+#include "LZ4.h"
 
 #include <AP_Common/AP_Common.h>
 #include <AP_InternalError/AP_InternalError.h>
@@ -38,6 +39,12 @@ extern const AP_HAL::HAL& hal;
 
 #define LOGGER_PAGE_SIZE 1024UL
 
+#if AP_LOGGER_FILE_DIRECT_IO_ENABLED
+// O_DIRECT transfers must be aligned to the logical block size of the
+// underlying device; 4096 covers modern SD cards and eMMC
+#define AP_LOGGER_FILE_DIRECT_BLOCK 4096U
+#endif
+
 #define MB_to_B 1000000
 #define B_to_MB 0.000001
 
@@ -94,6 +101,23 @@ void AP_Logger_File::Init()
 
     DEV_PRINTF("AP_Logger_File: buffer size=%u\n", (unsigned)bufsize);
 
+#if AP_LOGGER_FILE_COMPRESSION_ENABLED
+    _comp_buf = (uint8_t *)hal.util->malloc_type(LZ4::compress_bound(_writebuf_chunk), AP_HAL::Util::MEM_FILESYSTEM);
+    if (_comp_buf == nullptr) {
+        // fall back to uncompressed logging
+        DEV_PRINTF("AP_Logger_File: no memory for compression\n");
+    }
+#endif
+
+#if AP_LOGGER_FILE_DIRECT_IO_ENABLED
+    if (_front._params.file_direct_io != 0 &&
+        posix_memalign((void **)&_direct_buf, AP_LOGGER_FILE_DIRECT_BLOCK, AP_LOGGER_FILE_DIRECT_BLOCK) != 0) {
+        // fall back to buffered logging
+        _direct_buf = nullptr;
+        DEV_PRINTF("AP_Logger_File: no memory for direct IO\n");
+    }
+#endif
+
     _initialised = true;
 
     const char* custom_dir = hal.util->get_custom_log_directory();
@@ -178,6 +202,32 @@ void AP_Logger_File::periodic_1Hz()
         // setup rate limiting if log rate max > 0Hz or log pause of streaming entries is requested
         rate_limiter = NEW_NOTHROW AP_Logger_RateLimiter(_front, _front._params.file_ratemax, _front._params.disarm_ratemax);
     }
+
+    if (_write_fd != -1 && _write_lat_last_us != 0) {
+        Write_FIOS();
+    }
+}
+
+/*
+  log filesystem write latency so page cache or card stalls show up in
+  post-flight analysis. Max covers the last reporting period
+ */
+void AP_Logger_File::Write_FIOS(void)
+{
+    const struct log_FIOS pkt {
+        LOG_PACKET_HEADER_INIT(LOG_FILE_IO_STATS),
+        time_us : AP_HAL::micros64(),
+        last_us : _write_lat_last_us,
+        avg_us  : uint32_t(_write_lat_avg_us),
+        max_us  : _write_lat_max_us,
+#if AP_LOGGER_FILE_DIRECT_IO_ENABLED
+        direct  : _direct_io,
+#else
+        direct  : 0,
+#endif
+    };
+    WriteBlock(&pkt, sizeof(pkt));
+    _write_lat_max_us = 0;
 }
 
 void AP_Logger_File::periodic_fullrate()
@@ -716,7 +766,22 @@ void AP_Logger_File::stop_logging(void)
     if (_write_fd != -1) {
         int fd = _write_fd;
         _write_fd = -1;
+#if AP_LOGGER_FILE_COMPRESSION_ENABLED
+        if (_comp_buf != nullptr) {
+            // close out the LZ4 frame
+            uint8_t mark[LZ4::END_MARK_SIZE];
+            AP::FS().write(fd, mark, LZ4::end_mark(mark));
+        }
+#endif
         AP::FS().close(fd);
+#if AP_LOGGER_FILE_DIRECT_IO_ENABLED
+        if (_direct_io) {
+            // the direct path only writes whole blocks; flush the
+            // remaining tail through a buffered descriptor
+            flush_direct_tail();
+            _direct_io = false;
+        }
+#endif
     }
     if (have_sem) {
         write_fd_semaphore.give();
@@ -828,7 +893,27 @@ void AP_Logger_File::start_new_log(void)
     ensure_log_directory_exists();
 
     EXPECT_DELAY_MS(3000);
+#if AP_LOGGER_FILE_DIRECT_IO_ENABLED
+    _direct_io = (_direct_buf != nullptr);
+#if AP_LOGGER_FILE_COMPRESSION_ENABLED
+    if (_comp_buf != nullptr) {
+        // compressed chunks are not block aligned
+        _direct_io = false;
+    }
+#endif
+    if (_direct_io) {
+        _write_fd = AP::FS().open(_write_filename, O_WRONLY|O_CREAT|O_TRUNC|O_DIRECT);
+        if (_write_fd == -1) {
+            // the filesystem may not support direct IO
+            _direct_io = false;
+        }
+    }
+    if (!_direct_io) {
+        _write_fd = AP::FS().open(_write_filename, O_WRONLY|O_CREAT|O_TRUNC);
+    }
+#else
     _write_fd = AP::FS().open(_write_filename, O_WRONLY|O_CREAT|O_TRUNC);
+#endif
     _cached_oldest_log = 0;
 
     if (_write_fd == -1) {
@@ -845,7 +930,22 @@ void AP_Logger_File::start_new_log(void)
     _last_write_ms = AP_HAL::millis();
     _open_error_ms = 0;
     _write_offset = 0;
+    _prealloc_limit = 0;
+    _write_lat_last_us = 0;
+    _write_lat_max_us = 0;
+    _write_lat_avg_us = 0;
     _writebuf.clear();
+#if AP_LOGGER_FILE_COMPRESSION_ENABLED
+    if (_comp_buf != nullptr) {
+        // the frame header is how ground tools detect a compressed log
+        uint8_t hdr[LZ4::FRAME_HEADER_SIZE];
+        if (AP::FS().write(_write_fd, hdr, LZ4::frame_header(hdr)) == LZ4::FRAME_HEADER_SIZE) {
+            _write_offset = LZ4::FRAME_HEADER_SIZE;
+        }
+        _comp_len = _comp_sent = 0;
+        _comp_last_fsync_ofs = 0;
+    }
+#endif
     write_fd_semaphore.give();
 
     // now update lastlog.txt with the new log number
@@ -907,6 +1007,35 @@ void AP_Logger_File::flush(void)
 #endif // APM_BUILD_TYPE(APM_BUILD_Replay) || APM_BUILD_TYPE(APM_BUILD_UNKNOWN)
 #endif
 
+/*
+  extend the log file in large chunks ahead of the write head, so FAT
+  cluster allocation happens on idle io_timer cycles rather than
+  stalling a write while the card garbage collects
+ */
+void AP_Logger_File::allocate_ahead(void)
+{
+    // extend in 256k chunks, refreshing when half consumed
+    const uint32_t prealloc_chunk = 256U * 1024U;
+    if (_prealloc_unsupported ||
+        _write_offset + prealloc_chunk / 2 < _prealloc_limit) {
+        return;
+    }
+    if (!write_fd_semaphore.take_nonblocking()) {
+        return;
+    }
+    if (_write_fd != -1) {
+        last_io_operation = "allocate_ahead";
+        if (AP::FS().allocate_ahead(_write_fd, prealloc_chunk)) {
+            _prealloc_limit = _write_offset + prealloc_chunk;
+        } else {
+            // backend has no preallocation support, don't keep asking
+            _prealloc_unsupported = true;
+        }
+        last_io_operation = "";
+    }
+    write_fd_semaphore.give();
+}
+
 void AP_Logger_File::io_timer(void)
 {
     uint32_t tnow = AP_HAL::millis();
@@ -936,12 +1065,15 @@ void AP_Logger_File::io_timer(void)
 
     uint32_t nbytes = _writebuf.available();
     if (nbytes == 0) {
+        // use the idle cycle to extend the file ahead of the write head
+        allocate_ahead();
         return;
     }
-    if (nbytes < _writebuf_chunk && 
+    if (nbytes < _writebuf_chunk &&
         tnow - _last_write_time < 2000UL) {
         // write in _writebuf_chunk-sized chunks, but always write at
         // least once per 2 seconds if data is available
+        allocate_ahead();
         return;
     }
 
@@ -960,11 +1092,26 @@ void AP_Logger_File::io_timer(void)
     }
 #endif
     _last_write_time = tnow;
+
+#if AP_LOGGER_FILE_DIRECT_IO_ENABLED
+    if (_direct_io) {
+        io_timer_write_direct(tnow);
+        return;
+    }
+#endif
+
     if (nbytes > _writebuf_chunk) {
         // be kind to the filesystem layer
         nbytes = _writebuf_chunk;
     }
 
+#if AP_LOGGER_FILE_COMPRESSION_ENABLED
+    if (_comp_buf != nullptr) {
+        io_timer_write_compressed(nbytes, tnow);
+        return;
+    }
+#endif
+
     uint32_t size;
     const uint8_t *head = _writebuf.readptr(size);
     nbytes = MIN(nbytes, size);
@@ -992,7 +1139,9 @@ void AP_Logger_File::io_timer(void)
         nbytes = bytes_until_fsync; // write exactly enough to sync
     }
 
+    const uint32_t lat_start_us = AP_HAL::micros();
     ssize_t nwritten = AP::FS().write(_write_fd, head, nbytes);
+    const uint32_t lat_us = AP_HAL::micros() - lat_start_us;
     last_io_operation = "";
     if (nwritten <= 0) {
         if (errno == ENOSPC) {
@@ -1017,6 +1166,12 @@ void AP_Logger_File::io_timer(void)
         _write_offset += nwritten;
         _writebuf.advance(nwritten);
 
+        _write_lat_last_us = lat_us;
+        if (lat_us > _write_lat_max_us) {
+            _write_lat_max_us = lat_us;
+        }
+        _write_lat_avg_us = 0.9f * _write_lat_avg_us + 0.1f * lat_us;
+
         // we know nwritten > 0 so we won't sync if bytes_until_fsync == 0
         if ((uint32_t)nwritten == bytes_until_fsync) {
             last_io_operation = "fsync";
@@ -1040,6 +1195,159 @@ void AP_Logger_File::io_timer(void)
     write_fd_semaphore.give();
 }
 
+#if AP_LOGGER_FILE_DIRECT_IO_ENABLED
+/*
+  O_DIRECT variant of the io_timer write path. The kernel requires
+  block aligned buffers, offsets and lengths, so data is staged into
+  the aligned bounce buffer and written one whole block at a time; the
+  final partial block is flushed by flush_direct_tail() when logging
+  stops
+ */
+void AP_Logger_File::io_timer_write_direct(uint32_t tnow)
+{
+    if (_writebuf.available() < AP_LOGGER_FILE_DIRECT_BLOCK) {
+        // wait for a full block; the tail is written on close
+        return;
+    }
+    last_io_operation = "write";
+    if (!write_fd_semaphore.take(1)) {
+        return;
+    }
+    if (_write_fd == -1) {
+        write_fd_semaphore.give();
+        return;
+    }
+    _writebuf.peekbytes(_direct_buf, AP_LOGGER_FILE_DIRECT_BLOCK);
+    const uint32_t lat_start_us = AP_HAL::micros();
+    const ssize_t nwritten = AP::FS().write(_write_fd, _direct_buf, AP_LOGGER_FILE_DIRECT_BLOCK);
+    const uint32_t lat_us = AP_HAL::micros() - lat_start_us;
+    last_io_operation = "";
+    if (nwritten != (ssize_t)AP_LOGGER_FILE_DIRECT_BLOCK) {
+        // a short write would leave the file offset unaligned, so any
+        // failure leaves the ring buffer untouched for a retry
+        if (errno == ENOSPC) {
+            DEV_PRINTF("Out of space for logging\n");
+            stop_logging();
+            _open_error_ms = AP_HAL::millis(); // prevent logging starting again for 5s
+        } else if ((tnow - _last_write_ms)/1000U > unsigned(_front._params.file_timeout)) {
+            last_io_operation = "close";
+            AP::FS().close(_write_fd);
+            last_io_operation = "";
+            _write_fd = -1;
+            printf("Failed to write to File: %s\n", strerror(errno));
+        }
+        _last_write_failed = true;
+    } else {
+        _last_write_failed = false;
+        _last_write_ms = tnow;
+        _write_offset += nwritten;
+        _writebuf.advance(nwritten);
+        // no fsync is needed as direct writes bypass the page cache
+        _write_lat_last_us = lat_us;
+        if (lat_us > _write_lat_max_us) {
+            _write_lat_max_us = lat_us;
+        }
+        _write_lat_avg_us = 0.9f * _write_lat_avg_us + 0.1f * lat_us;
+    }
+    write_fd_semaphore.give();
+}
+
+/*
+  write out the remaining tail of the ring buffer that is shorter than
+  a direct IO block. Done through a buffered descriptor, as the tail
+  is the only unaligned write in the life of the log
+ */
+void AP_Logger_File::flush_direct_tail(void)
+{
+    uint32_t n = _writebuf.available();
+    if (n == 0 || _write_filename == nullptr) {
+        return;
+    }
+    const int fd = AP::FS().open(_write_filename, O_WRONLY);
+    if (fd == -1) {
+        return;
+    }
+    if (AP::FS().lseek(fd, _write_offset, SEEK_SET) == (int32_t)_write_offset) {
+        while ((n = _writebuf.available()) > 0) {
+            n = MIN(n, AP_LOGGER_FILE_DIRECT_BLOCK);
+            _writebuf.peekbytes(_direct_buf, n);
+            if (AP::FS().write(fd, _direct_buf, n) != (ssize_t)n) {
+                break;
+            }
+            _write_offset += n;
+            _writebuf.advance(n);
+        }
+    }
+    AP::FS().close(fd);
+}
+#endif // AP_LOGGER_FILE_DIRECT_IO_ENABLED
+
+#if AP_LOGGER_FILE_COMPRESSION_ENABLED
+/*
+  compressed variant of the io_timer write path. Each chunk drained
+  from the ring is compressed as an independent LZ4 block; the ring is
+  only advanced once the whole block has reached the filesystem, so a
+  short write resumes from the held compressed data
+ */
+void AP_Logger_File::io_timer_write_compressed(uint32_t nbytes, uint32_t tnow)
+{
+    last_io_operation = "write";
+    if (!write_fd_semaphore.take(1)) {
+        return;
+    }
+    if (_write_fd == -1) {
+        write_fd_semaphore.give();
+        return;
+    }
+
+    if (_comp_sent == _comp_len) {
+        uint32_t size;
+        const uint8_t *head = _writebuf.readptr(size);
+        nbytes = MIN(nbytes, size);
+        _comp_raw_len = nbytes;
+        _comp_len = LZ4::compress_block(head, nbytes, _comp_buf);
+        _comp_sent = 0;
+    }
+
+    const ssize_t nwritten = AP::FS().write(_write_fd, &_comp_buf[_comp_sent], _comp_len - _comp_sent);
+    last_io_operation = "";
+    if (nwritten <= 0) {
+        if (errno == ENOSPC) {
+            DEV_PRINTF("Out of space for logging\n");
+            stop_logging();
+            _open_error_ms = AP_HAL::millis(); // prevent logging starting again for 5s
+        } else if ((tnow - _last_write_ms)/1000U > unsigned(_front._params.file_timeout)) {
+            // see the uncompressed path for reasoning
+            last_io_operation = "close";
+            AP::FS().close(_write_fd);
+            last_io_operation = "";
+            _write_fd = -1;
+            printf("Failed to write to File: %s\n", strerror(errno));
+        }
+        _last_write_failed = true;
+    } else {
+        _last_write_failed = false;
+        _last_write_ms = tnow;
+        _write_offset += nwritten;
+        _comp_sent += nwritten;
+        if (_comp_sent == _comp_len) {
+            _writebuf.advance(_comp_raw_len);
+            _comp_len = _comp_sent = 0;
+            // periodic sync; the uncompressed path uses
+            // bytes_until_fsync boundaries instead
+            if (_write_offset - _comp_last_fsync_ofs >= 32768U) {
+                _comp_last_fsync_ofs = _write_offset;
+                last_io_operation = "fsync";
+                AP::FS().fsync(_write_fd);
+                last_io_operation = "";
+            }
+        }
+    }
+
+    write_fd_semaphore.give();
+}
+#endif // AP_LOGGER_FILE_COMPRESSION_ENABLED
+
 bool AP_Logger_File::io_thread_alive() const
 {
     if (!hal.scheduler->is_system_initialized()) {
@@ -116,6 +116,36 @@ private:
     const uint16_t _writebuf_chunk = HAL_LOGGER_WRITE_CHUNK_SIZE;
     uint32_t _last_write_time;
 
+    // extend the file ahead of the write head on idle io_timer cycles
+    void allocate_ahead(void);
+    uint32_t _prealloc_limit;
+    bool _prealloc_unsupported;
+
+    // write latency gauge, reported in the FIOS log message
+    void Write_FIOS(void);
+    uint32_t _write_lat_last_us;
+    uint32_t _write_lat_max_us;
+    float _write_lat_avg_us;
+
+#if AP_LOGGER_FILE_DIRECT_IO_ENABLED
+    // O_DIRECT write path; the kernel requires aligned buffers,
+    // offsets and lengths so whole blocks are staged in _direct_buf
+    void io_timer_write_direct(uint32_t tnow);
+    void flush_direct_tail(void);
+    uint8_t *_direct_buf;
+    bool _direct_io;
+#endif
+
+#if AP_LOGGER_FILE_COMPRESSION_ENABLED
+    // streaming LZ4 compression of the output file
+    void io_timer_write_compressed(uint32_t nbytes, uint32_t tnow);
+    uint8_t *_comp_buf;
+    uint32_t _comp_len;
+    uint32_t _comp_sent;
+    uint32_t _comp_raw_len;
+    uint32_t _comp_last_fsync_ofs;
+#endif
+
     /* construct a file name given a log number. Caller must free. */
     char *_log_file_name(const uint16_t log_num) const;
     char *_lastlog_file_name() const;
@@ -51,6 +51,26 @@
 #define HAL_LOGGER_FILE_CONTENTS_ENABLED HAL_LOGGING_FILESYSTEM_ENABLED && !AP_FILESYSTEM_LITTLEFS_ENABLED
 #endif
 
+// optional LZ4 streaming compression of file backend logs. Disabled by
+// default as ground tools must decompress a log before reading it
+#ifndef AP_LOGGER_FILE_COMPRESSION_ENABLED
+#define AP_LOGGER_FILE_COMPRESSION_ENABLED 0
+#endif
+
+// optional O_DIRECT (unbuffered) writes for the file backend,
+// bypassing the kernel page cache to avoid writeback latency
+// spikes. Only useful on boards with a POSIX filesystem
+#ifndef AP_LOGGER_FILE_DIRECT_IO_ENABLED
+#define AP_LOGGER_FILE_DIRECT_IO_ENABLED (CONFIG_HAL_BOARD == HAL_BOARD_LINUX)
+#endif
+
+// optional delta encoding of flagged high-rate messages, see the
+// decoder contract in LogStructure.h. Disabled by default as ground
+// tools must understand the encoded records
+#ifndef AP_LOGGER_DELTA_ENCODING_ENABLED
+#define AP_LOGGER_DELTA_ENCODING_ENABLED 0
+#endif
+
 #if AP_FILESYSTEM_LITTLEFS_ENABLED && HAL_LOGGING_BLOCK_ENABLED
 #error LittleFS requires block logging to be disabled
 #endif
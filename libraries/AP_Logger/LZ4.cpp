@@ -0,0 +1,188 @@
+/*
+  minimal LZ4 frame compressor, see LZ4.h
+ */
+#include "LZ4.h"
+
+#if AP_LOGGER_FILE_COMPRESSION_ENABLED
+
+#include <string.h>
+
+#define LZ4_MINMATCH 4
+// the last match must start at least this far before the end of block
+#define LZ4_MFLIMIT 12
+// the last bytes of a block are always literals
+#define LZ4_LASTLITERALS 5
+
+#define LZ4_HASH_BITS 12
+
+// match candidate table, positions+1 into the current block. A single
+// shared table is fine as blocks are compressed one at a time from the
+// logger IO thread; a stale entry only costs a missed match
+static uint16_t match_table[1U << LZ4_HASH_BITS];
+
+static uint32_t read32(const uint8_t *p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static uint32_t lz4_hash(uint32_t v)
+{
+    return (v * 2654435761U) >> (32 - LZ4_HASH_BITS);
+}
+
+/*
+  XXH32, needed only for the one byte frame header checksum
+ */
+static uint32_t xxh32(const uint8_t *p, uint32_t len)
+{
+    static const uint32_t P1 = 2654435761U;
+    static const uint32_t P2 = 2246822519U;
+    static const uint32_t P3 = 3266489917U;
+    static const uint32_t P4 = 668265263U;
+    static const uint32_t P5 = 374761393U;
+    uint32_t h = P5 + len;
+    while (len >= 4) {
+        h += read32(p) * P3;
+        h = ((h << 17) | (h >> 15)) * P4;
+        p += 4;
+        len -= 4;
+    }
+    while (len > 0) {
+        h += *p++ * P5;
+        h = ((h << 11) | (h >> 21)) * P1;
+        len--;
+    }
+    h ^= h >> 15;
+    h *= P2;
+    h ^= h >> 13;
+    h *= P3;
+    h ^= h >> 16;
+    return h;
+}
+
+uint32_t LZ4::frame_header(uint8_t *dst)
+{
+    // magic number
+    dst[0] = 0x04;
+    dst[1] = 0x22;
+    dst[2] = 0x4D;
+    dst[3] = 0x18;
+    // FLG: version 01, independent blocks, no checksums or content size
+    dst[4] = 0x60;
+    // BD: 64KB max block size
+    dst[5] = 0x40;
+    // single byte header checksum
+    dst[6] = (xxh32(&dst[4], 2) >> 8) & 0xFF;
+    return FRAME_HEADER_SIZE;
+}
+
+uint32_t LZ4::end_mark(uint8_t *dst)
+{
+    memset(dst, 0, END_MARK_SIZE);
+    return END_MARK_SIZE;
+}
+
+// emit a length using the 15/255 extension scheme, returning the new
+// output position
+static uint8_t *emit_length(uint8_t *op, uint32_t len)
+{
+    while (len >= 255) {
+        *op++ = 255;
+        len -= 255;
+    }
+    *op++ = len;
+    return op;
+}
+
+uint32_t LZ4::compress_block(const uint8_t *src, uint32_t src_len, uint8_t *dst)
+{
+    uint8_t *op = &dst[4];
+    const uint8_t *ip = src;
+    const uint8_t *anchor = src;
+    const uint8_t *iend = &src[src_len];
+
+    memset(match_table, 0, sizeof(match_table));
+
+    if (src_len > LZ4_MFLIMIT) {
+        const uint8_t *mflimit = iend - LZ4_MFLIMIT;
+        const uint8_t *matchlimit = iend - LZ4_LASTLITERALS;
+
+        while (ip < mflimit) {
+            const uint32_t seq = read32(ip);
+            const uint32_t h = lz4_hash(seq);
+            const uint16_t cand = match_table[h];
+            match_table[h] = (ip - src) + 1;
+            if (cand == 0 || read32(&src[cand - 1]) != seq) {
+                ip++;
+                continue;
+            }
+            const uint8_t *match = &src[cand - 1];
+
+            // extend the match, leaving the last bytes as literals
+            uint32_t mlen = LZ4_MINMATCH;
+            while (&ip[mlen] < matchlimit && match[mlen] == ip[mlen]) {
+                mlen++;
+            }
+
+            // token with literal and match length nibbles
+            const uint32_t litlen = ip - anchor;
+            uint8_t *token = op++;
+            if (litlen >= 15) {
+                *token = 15U << 4;
+                op = emit_length(op, litlen - 15);
+            } else {
+                *token = litlen << 4;
+            }
+            memcpy(op, anchor, litlen);
+            op += litlen;
+
+            // little-endian match offset
+            const uint16_t offset = ip - match;
+            *op++ = offset & 0xFF;
+            *op++ = offset >> 8;
+
+            if (mlen - LZ4_MINMATCH >= 15) {
+                *token |= 15;
+                op = emit_length(op, mlen - LZ4_MINMATCH - 15);
+            } else {
+                *token |= mlen - LZ4_MINMATCH;
+            }
+
+            ip += mlen;
+            anchor = ip;
+        }
+    }
+
+    // remaining literals
+    const uint32_t litlen = iend - anchor;
+    uint8_t *token = op++;
+    if (litlen >= 15) {
+        *token = 15U << 4;
+        op = emit_length(op, litlen - 15);
+    } else {
+        *token = litlen << 4;
+    }
+    memcpy(op, anchor, litlen);
+    op += litlen;
+
+    uint32_t block_len = op - &dst[4];
+    if (block_len >= src_len) {
+        // incompressible, store the block raw with the uncompressed flag
+        memcpy(&dst[4], src, src_len);
+        block_len = src_len;
+        dst[0] = block_len & 0xFF;
+        dst[1] = (block_len >> 8) & 0xFF;
+        dst[2] = (block_len >> 16) & 0xFF;
+        dst[3] = 0x80;
+    } else {
+        dst[0] = block_len & 0xFF;
+        dst[1] = (block_len >> 8) & 0xFF;
+        dst[2] = (block_len >> 16) & 0xFF;
+        dst[3] = 0;
+    }
+    return block_len + 4;
+}
+
+#endif // AP_LOGGER_FILE_COMPRESSION_ENABLED
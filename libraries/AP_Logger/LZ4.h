@@ -0,0 +1,47 @@
+#pragma once
+
+#include "AP_Logger_config.h"
+
+#if AP_LOGGER_FILE_COMPRESSION_ENABLED
+
+#include <stdint.h>
+
+/*
+  minimal LZ4 compressor for streaming log compression. The output is
+  a standard LZ4 frame (magic 0x184D2204, independent 64KB-max blocks,
+  no checksums) so the reference lz4 tool and any ground station with
+  lz4 support can decompress a log back to the raw .BIN stream. The
+  frame magic at the start of the file is also how tools detect that a
+  log is compressed.
+ */
+class LZ4
+{
+public:
+    // worst case output size of compress_block() for an incompressible
+    // input, including the block length prefix
+    static uint32_t compress_bound(uint32_t size) {
+        return size + size / 255 + 16;
+    }
+
+    // write the frame header to dst, which must have room for
+    // FRAME_HEADER_SIZE bytes. Returns the number of bytes written
+    static const uint8_t FRAME_HEADER_SIZE = 7;
+    static uint32_t frame_header(uint8_t *dst);
+
+    // write the end-of-frame marker to dst, which must have room for
+    // END_MARK_SIZE bytes. Returns the number of bytes written
+    static const uint8_t END_MARK_SIZE = 4;
+    static uint32_t end_mark(uint8_t *dst);
+
+    /*
+      compress one independent block of at most 65535 bytes, emitting
+      the 4 byte block length prefix followed by the block data.
+      Incompressible input is stored uncompressed, so the output never
+      exceeds compress_bound(src_len). Returns the total number of
+      bytes written to dst. Not thread-safe: the match table is shared
+      by all callers
+     */
+    static uint32_t compress_block(const uint8_t *src, uint32_t src_len, uint8_t *dst);
+};
+
+#endif // AP_LOGGER_FILE_COMPRESSION_ENABLED
@@ -125,6 +125,23 @@ const struct MultiplierStructure log_Multipliers[] = {
 #define HEAD_BYTE1  0xA3    // Decimal 163
 #define HEAD_BYTE2  0x95    // Decimal 149
 
+/*
+  decoder contract for delta-encoded records
+  (AP_LOGGER_DELTA_ENCODING_ENABLED):
+
+  message types flagged with delta_encode in their LogStructure entry
+  may be written as HEAD_BYTE1, HEAD_BYTE2_DELTA, msgid followed by a
+  token stream instead of the fixed-size body. The stream is pairs of
+  LEB128 varints (zero_run, literal_run), each pair followed by
+  literal_run bytes, and ends once the runs sum to the body length
+  known from FMT. Expanding the stream gives the XOR difference
+  against the body of the previous record of the same type in the
+  same log; the first record of a type, and the first after any
+  record of that type failed to reach the backend, is always written
+  in the normal full form
+ */
+#define HEAD_BYTE2_DELTA 0x96   // Decimal 150
+
 #include <AP_Beacon/LogStructure.h>
 #include <AP_DAL/LogStructure.h>
 #include <AP_NavEKF2/LogStructure.h>
@@ -173,6 +190,7 @@ struct LogStructure {
     const char *units;
     const char *multipliers;
     bool streaming; // can be rate limited
+    bool delta_encode; // may be delta-encoded against the previous record
 };
 
 // maximum lengths of fields in LogStructure, including trailing nulls
@@ -235,6 +253,26 @@ struct PACKED log_DSF {
     uint32_t buf_space_avg;
 };
 
+struct PACKED log_DFES {
+    LOG_PACKET_HEADER;
+    uint64_t time_us;
+    uint32_t count;
+    uint32_t inline_count;
+    uint32_t last_us;
+    uint32_t max_us;
+    uint32_t avg_us;
+    uint8_t pre_erased;
+};
+
+struct PACKED log_FIOS {
+    LOG_PACKET_HEADER;
+    uint64_t time_us;
+    uint32_t last_us;
+    uint32_t avg_us;
+    uint32_t max_us;
+    uint8_t direct;
+};
+
 struct PACKED log_Event {
     LOG_PACKET_HEADER;
     uint64_t time_us;
@@ -324,6 +362,8 @@ struct PACKED log_MAV {
     uint16_t stream_slowdown_ms;
     uint16_t times_full;
     uint32_t GCS_SYSID_last_seen_ms;
+    uint16_t max_lag_hard_ms;
+    uint16_t max_lag_bulk_ms;
 };
 
 struct PACKED log_RSSI {
@@ -487,6 +527,8 @@ struct PACKED log_TERRAIN {
     uint16_t pending;
     uint16_t loaded;
     float reference_offset;
+    uint16_t prefetch_index;
+    uint32_t reads;
 };
 
 struct PACKED log_ARSP {
@@ -553,6 +595,7 @@ struct PACKED log_Performance {
     uint32_t i2c_count;
     uint32_t i2c_isr_count;
     uint32_t extra_loop_us;
+    uint32_t task_yields;
     uint64_t rtc;
 };
 
@@ -731,6 +774,24 @@ struct PACKED log_VER {
 // @Field: FMx: Maximum free space in write buffer in last time period
 // @Field: FAv: Average free space in write buffer in last time period
 
+// @LoggerMessage: DFES
+// @Description: Block logging erase statistics
+// @Field: TimeUS: Time since system startup
+// @Field: N: Total number of block erases
+// @Field: NInl: Erases that had to run inline in the write path
+// @Field: Last: Duration of the most recent erase
+// @Field: Max: Longest erase seen
+// @Field: Avg: Average erase duration
+// @Field: Pool: Number of blocks currently erased ahead of the write point
+
+// @LoggerMessage: FIOS
+// @Description: File logging write latency statistics
+// @Field: TimeUS: Time since system startup
+// @Field: Last: Duration of the most recent filesystem write
+// @Field: Avg: Smoothed average write duration
+// @Field: Max: Longest write in the last reporting period
+// @Field: Dir: 1 if the log is open for direct (unbuffered) IO
+
 // @LoggerMessage: ERR
 // @Description: Specifically coded error messages
 // @Field: TimeUS: Time since system startup
@@ -780,6 +841,8 @@ struct PACKED log_VER {
 // @Field: ss: stream slowdown is the number of ms being added to each message to fit within bandwidth
 // @Field: tf: times buffer was full when a message was going to be sent
 // @Field: mgs: time MAV_GCS_SYSID heartbeat (or manual control) last seen
+// @Field: lgh: worst lateness of hard-deadline stream buckets since last MAV message
+// @Field: lgb: worst lateness of bulk stream buckets since last MAV message
 
 // @LoggerMessage: MAVC
 // @Description: MAVLink command we have just executed
@@ -884,6 +947,7 @@ struct PACKED log_VER {
 // @Field: I2CC: Number of i2c transactions processed
 // @Field: I2CI: Number of i2c interrupts serviced
 // @Field: Ex: number of microseconds being added to each loop to address scheduler overruns
+// @Field: Yld: number of times a task voluntarily yielded after exceeding its time budget
 // @Field: R: RTC time, time since Unix epoch
 
 // @LoggerMessage: POWR
@@ -1053,6 +1117,8 @@ struct PACKED log_VER {
 // @Field: Pending: Number of tile requests outstanding
 // @Field: Loaded: Number of tiles in memory
 // @Field: ROfs: terrain reference offset for arming altitude
+// @Field: PFIdx: mission item index the prefetcher has reached, 0 when complete
+// @Field: Reads: total grid blocks read from disk
 
 // @LoggerMessage: TSYN
 // @Description: Time synchronisation response information
@@ -1203,14 +1269,14 @@ LOG_RTC_MESSAGE \
     LOG_STRUCTURE_FROM_BEACON                                       \
     LOG_STRUCTURE_FROM_PROXIMITY                                    \
     { LOG_PERFORMANCE_MSG, sizeof(log_Performance),                     \
-      "PM",  "QHHHIIHHIIIIIIQ", "TimeUS,LR,NLon,NL,MaxT,Mem,Load,ErrL,InE,ErC,SPIC,I2CC,I2CI,Ex,R", "sz---b%------ss", "F----0A------FF" }, \
+      "PM",  "QHHHIIHHIIIIIIIQ", "TimeUS,LR,NLon,NL,MaxT,Mem,Load,ErrL,InE,ErC,SPIC,I2CC,I2CI,Ex,Yld,R", "sz---b%------s-s", "F----0A------F-F" }, \
     { LOG_SRTL_MSG, sizeof(log_SRTL), \
       "SRTL", "QBHHBfff", "TimeUS,Active,NumPts,MaxPts,Action,N,E,D", "s----mmm", "F----000" }, \
 LOG_STRUCTURE_FROM_AVOIDANCE \
     { LOG_SIMSTATE_MSG, sizeof(log_AHRS), \
       "SIM","QccCfLLffff","TimeUS,Roll,Pitch,Yaw,Alt,Lat,Lng,Q1,Q2,Q3,Q4", "sddhmDU----", "FBBB0GG0000", true }, \
     { LOG_TERRAIN_MSG, sizeof(log_TERRAIN), \
-      "TERR","QBLLHffHHf","TimeUS,Status,Lat,Lng,Spacing,TerrH,CHeight,Pending,Loaded,ROfs", "s-DU-mm--m", "F-GG-00--0", true }, \
+      "TERR","QBLLHffHHfHI","TimeUS,Status,Lat,Lng,Spacing,TerrH,CHeight,Pending,Loaded,ROfs,PFIdx,Reads", "s-DU-mm--m--", "F-GG-00--0--", true }, \
 LOG_STRUCTURE_FROM_ESC_TELEM \
 LOG_STRUCTURE_FROM_SERVO_TELEM \
     { LOG_PIDR_MSG, sizeof(log_PID), \
@@ -1242,10 +1308,14 @@ LOG_STRUCTURE_FROM_RPM \
 LOG_STRUCTURE_FROM_FENCE \
     { LOG_DF_FILE_STATS, sizeof(log_DSF), \
       "DSF", "QIHIIII", "TimeUS,Dp,Blk,Bytes,FMn,FMx,FAv", "s--b---", "F--0---" }, \
+    { LOG_DF_ERASE_STATS, sizeof(log_DFES), \
+      "DFES", "QIIIIIB", "TimeUS,N,NInl,Last,Max,Avg,Pool", "s--sss-", "F--FFF-" }, \
+    { LOG_FILE_IO_STATS, sizeof(log_FIOS), \
+      "FIOS", "QIIIB", "TimeUS,Last,Avg,Max,Dir", "ssss-", "FFFF-" }, \
     { LOG_RALLY_MSG, sizeof(log_Rally), \
       "RALY", "QBBLLhB", "TimeUS,Tot,Seq,Lat,Lng,Alt,Flags", "s--DUm-", "F--GG0-" },  \
     { LOG_MAV_MSG, sizeof(log_MAV),   \
-      "MAV", "QBHHHBHHI",   "TimeUS,chan,txp,rxp,rxdp,flags,ss,tf,mgs", "s#----s-s", "F-000-C-C" },   \
+      "MAV", "QBHHHBHHIHH",   "TimeUS,chan,txp,rxp,rxdp,flags,ss,tf,mgs,lgh,lgb", "s#----s-sss", "F-000-C-CCC" },   \
 LOG_STRUCTURE_FROM_VISUALODOM \
     { LOG_OPTFLOW_MSG, sizeof(log_Optflow), \
       "OF",   "QBffff",   "TimeUS,Qual,flowX,flowY,bodyX,bodyY", "s-EEEE", "F-0000" , true }, \
@@ -1343,6 +1413,8 @@ enum LogMessages : uint8_t {
     LOG_IDS_FROM_BEACON,
     LOG_IDS_FROM_PROXIMITY,
     LOG_DF_FILE_STATS,
+    LOG_DF_ERASE_STATS,
+    LOG_FILE_IO_STATS,
     LOG_SRTL_MSG,
     LOG_PERFORMANCE_MSG,
     LOG_OPTFLOW_MSG,
@@ -183,11 +183,32 @@ const Matrix3f AP_GeodesicGrid::_mid_inverses[10]{
      { 0.618034f,  0.000000f, -1.000000f}},
 };
 
+/* This was generated with
+ * libraries/AP_Math/tools/geodesic_grid/geodesic_grid.py */
+const Vector3f AP_GeodesicGrid::_triangle_centroids[10]{
+    {-0.934172f,  0.000000f, -0.356822f},
+    {-0.577350f, -0.577350f, -0.577350f},
+    {-0.356822f, -0.934172f,  0.000000f},
+    { 0.000000f, -0.356822f, -0.934172f},
+    { 0.356822f, -0.934172f,  0.000000f},
+    { 0.577350f, -0.577350f, -0.577350f},
+    { 0.934172f,  0.000000f, -0.356822f},
+    { 0.577350f,  0.577350f, -0.577350f},
+    { 0.000000f,  0.356822f, -0.934172f},
+    {-0.577350f,  0.577350f, -0.577350f},
+};
+
 int AP_GeodesicGrid::section(const Vector3f &v, bool inclusive)
 {
-    int i = _triangle_index(v, inclusive);
+    int i = _triangle_index_fast(v);
     if (i < 0) {
-        return -1;
+        /* v is too close to an edge or vertex (or is null): fall back to the
+         * exhaustive search, which resolves those cases with respect to
+         * inclusive. */
+        i = _triangle_index(v, inclusive);
+        if (i < 0) {
+            return -1;
+        }
     }
 
     int j = _subtriangle_index(i, v, inclusive);
@@ -303,6 +324,45 @@ int AP_GeodesicGrid::_from_neighbor_umbrella(int idx,
     }
 }
 
+int AP_GeodesicGrid::_triangle_index_fast(const Vector3f &v)
+{
+    /* The perpendicular bisector plane of two adjacent triangles' centroids
+     * contains their shared edge, so the triangle crossed by v is the one
+     * whose centroid makes the greatest dot product with it. The centroids
+     * come in antipodal pairs, so ten dot products classify all twenty
+     * triangles. */
+    float best_dot = 0;
+    int best = 0;
+    for (int k = 0; k < 10; k++) {
+        const float d = _triangle_centroids[k] * v;
+        const bool better = fabsf(d) > fabsf(best_dot);
+        best = better ? k : best;
+        best_dot = better ? d : best_dot;
+    }
+
+    int i = best;
+    if (is_negative(best_dot)) {
+        i += 10;
+    }
+
+    /* Confirm the winner with its change-of-basis matrix: if any coefficient
+     * is zero or negative, then v crosses (or is too close to) one of the
+     * triangle's edges and the exhaustive search is required to resolve it
+     * with respect to the inclusive parameter of section(). The null vector
+     * is rejected here as well. */
+    auto w = _inverses[i % 10] * v;
+    if (i > 9) {
+        w = -w;
+    }
+    if (is_zero(w.x) || is_negative(w.x) ||
+        is_zero(w.y) || is_negative(w.y) ||
+        is_zero(w.z) || is_negative(w.z)) {
+        return -1;
+    }
+
+    return i;
+}
+
 int AP_GeodesicGrid::_triangle_index(const Vector3f &v, bool inclusive)
 {
     /* w holds the coordinates of v with respect to the basis comprised by the
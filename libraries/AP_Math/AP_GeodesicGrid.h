@@ -178,6 +178,16 @@ private:
      */
     static const Matrix3f _mid_inverses[10];
 
+    /**
+     * Unit vectors pointing at the centroids of the first ten icosahedron
+     * triangles. The centroid of T_(i+10) is the opposite of the i-th entry.
+     *
+     * Because the perpendicular bisector plane of two adjacent triangles'
+     * centroids contains their shared edge, the triangle crossed by a vector
+     * is the one whose centroid makes the greatest dot product with it.
+     */
+    static const Vector3f _triangle_centroids[10];
+
     /**
      * The representation of the neighbor umbrellas of T_0.
      *
@@ -274,6 +284,22 @@ private:
      */
     static int _triangle_index(const Vector3f &v, bool inclusive);
 
+    /**
+     * Find which icosahedron's triangle is crossed by \p v with ten dot
+     * products against #_triangle_centroids.
+     *
+     * This is cheaper than #_triangle_index(), but vectors that cross a
+     * triangle's edge or vertex (to within the floating point tolerance) are
+     * not resolved.
+     *
+     * @param v[in] The vector to be verified.
+     *
+     * @return The index of the triangle. The value -1 is returned if \p v is
+     * the null vector or is too close to an edge, in which case
+     * #_triangle_index() must be used.
+     */
+    static int _triangle_index_fast(const Vector3f &v);
+
     /**
      * Find which sub-triangle of the icosahedron's triangle pointed by \p
      * triangle_index is crossed by \p v.
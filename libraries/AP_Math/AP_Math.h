@@ -117,6 +117,11 @@ void mat_mul(const T *A, const T *B, T *C, uint16_t n);
 template <typename T>
 bool mat_inverse(const T *x, T *y, uint16_t dim) WARN_IF_UNUSED;
 
+// matrix inverse with compile-time dimension, selecting the unrolled small
+// matrix code without runtime dispatch. Only N from 2 to 4 is provided
+template <uint16_t N, typename T>
+bool mat_inverse(const T *x, T *y) WARN_IF_UNUSED;
+
 // matrix identity
 template <typename T>
 void mat_identity(T *x, uint16_t dim);
@@ -97,7 +97,25 @@ static void BM_GeodesicGridSections(benchmark::State& state)
     }
 }
 
+static void BM_GeodesicGridTriangleEdges(benchmark::State& state)
+{
+    auto& t = triangles[state.range(0)];
+
+    /* Vectors crossing an icosahedron triangle's edge aren't resolved by the
+     * centroid classifier and fall back to the exhaustive search, so this is
+     * the worst case for AP_GeodesicGrid::section(). */
+    Vector3f v = t[0] + t[1];
+
+    while (state.KeepRunning()) {
+        int s = AP_GeodesicGrid::section(v, true);
+        gbenchmark_escape(&s);
+    }
+}
+
 /* Benchmark each section */
 BENCHMARK(BM_GeodesicGridSections)->DenseRange(0, 79);
 
+/* Benchmark the fallback path on each icosahedron triangle */
+BENCHMARK(BM_GeodesicGridTriangleEdges)->DenseRange(0, 19);
+
 BENCHMARK_MAIN();
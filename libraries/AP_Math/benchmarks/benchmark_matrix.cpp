@@ -21,4 +21,114 @@ static void BM_MatrixMultiplication(benchmark::State& state)
 
 BENCHMARK(BM_MatrixMultiplication);
 
+static void BM_MatrixVectorMultiplication(benchmark::State& state)
+{
+    Matrix3f m(Vector3f(1.0f, 2.0f, 3.0f),
+               Vector3f(4.0f, 5.0f, 6.0f),
+               Vector3f(7.0f, 8.0f, 9.0f));
+    Vector3f v(1.0f, 2.0f, 3.0f);
+
+    while (state.KeepRunning()) {
+        Vector3f r = m * v;
+        gbenchmark_escape(&r);
+    }
+}
+
+BENCHMARK(BM_MatrixVectorMultiplication);
+
+static void BM_MatrixMulTranspose(benchmark::State& state)
+{
+    Matrix3f m(Vector3f(1.0f, 2.0f, 3.0f),
+               Vector3f(4.0f, 5.0f, 6.0f),
+               Vector3f(7.0f, 8.0f, 9.0f));
+    Vector3f v(1.0f, 2.0f, 3.0f);
+
+    while (state.KeepRunning()) {
+        Vector3f r = m.mul_transpose(v);
+        gbenchmark_escape(&r);
+    }
+}
+
+BENCHMARK(BM_MatrixMulTranspose);
+
+static void BM_QuaternionEarthToBody(benchmark::State& state)
+{
+    Quaternion q;
+    q.from_euler(0.1f, 0.2f, 0.3f);
+
+    while (state.KeepRunning()) {
+        Vector3f v(1.0f, 2.0f, 3.0f);
+        q.earth_to_body(v);
+        gbenchmark_escape(&v);
+    }
+}
+
+BENCHMARK(BM_QuaternionEarthToBody);
+
+static void BM_MatInverse3RunTime(benchmark::State& state)
+{
+    const float m[9] {2.0f, 0.5f, 0.1f,
+                      0.5f, 3.0f, 0.2f,
+                      0.1f, 0.2f, 4.0f};
+    float inv[9];
+
+    while (state.KeepRunning()) {
+        bool ok = mat_inverse(m, inv, 3);
+        gbenchmark_escape(&ok);
+        gbenchmark_escape(inv);
+    }
+}
+
+BENCHMARK(BM_MatInverse3RunTime);
+
+static void BM_MatInverse3CompileTime(benchmark::State& state)
+{
+    const float m[9] {2.0f, 0.5f, 0.1f,
+                      0.5f, 3.0f, 0.2f,
+                      0.1f, 0.2f, 4.0f};
+    float inv[9];
+
+    while (state.KeepRunning()) {
+        bool ok = mat_inverse<3>(m, inv);
+        gbenchmark_escape(&ok);
+        gbenchmark_escape(inv);
+    }
+}
+
+BENCHMARK(BM_MatInverse3CompileTime);
+
+static void BM_MatInverse4RunTime(benchmark::State& state)
+{
+    const float m[16] {4.0f, 0.5f, 0.1f, 0.2f,
+                       0.5f, 3.0f, 0.2f, 0.1f,
+                       0.1f, 0.2f, 2.0f, 0.3f,
+                       0.2f, 0.1f, 0.3f, 5.0f};
+    float inv[16];
+
+    while (state.KeepRunning()) {
+        bool ok = mat_inverse(m, inv, 4);
+        gbenchmark_escape(&ok);
+        gbenchmark_escape(inv);
+    }
+}
+
+BENCHMARK(BM_MatInverse4RunTime);
+
+static void BM_MatInverse4CompileTime(benchmark::State& state)
+{
+    const float m[16] {4.0f, 0.5f, 0.1f, 0.2f,
+                       0.5f, 3.0f, 0.2f, 0.1f,
+                       0.1f, 0.2f, 2.0f, 0.3f,
+                       0.2f, 0.1f, 0.3f, 5.0f};
+    float inv[16];
+
+    while (state.KeepRunning()) {
+        bool ok = mat_inverse<4>(m, inv);
+        gbenchmark_escape(&ok);
+        gbenchmark_escape(inv);
+    }
+}
+
+BENCHMARK(BM_MatInverse4CompileTime);
+
 BENCHMARK_MAIN();
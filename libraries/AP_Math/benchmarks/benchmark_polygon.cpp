@@ -0,0 +1,100 @@
+#include <AP_gbenchmark.h>
+
+#include <AP_Math/AP_Math.h>
+
+const AP_HAL::HAL& hal = AP_HAL::get_HAL();
+
+/*
+ * These benchmarks exercise the polygon kernels that dominate the object
+ * avoidance path planners' cost: BendyRuler's margin checks and Dijkstra's
+ * visibility graph generation reduce to Polygon_outside,
+ * Polygon_closest_distance_line and Polygon_intersects calls against the
+ * loaded fences.  The scenarios are regular polygon fences of increasing
+ * vertex counts so planner cost can be tracked per fence complexity.
+ */
+
+#define MAX_FENCE_POINTS 256
+
+static unsigned make_fence(unsigned n, float radius, Vector2f *points)
+{
+    if (n > MAX_FENCE_POINTS) {
+        n = MAX_FENCE_POINTS;
+    }
+    for (unsigned i = 0; i < n; i++) {
+        const float theta = 2.0f * M_PI * i / n;
+        points[i] = Vector2f{radius * cosf(theta), radius * sinf(theta)};
+    }
+    return n;
+}
+
+static void BM_PolygonOutside(benchmark::State& state)
+{
+    Vector2f points[MAX_FENCE_POINTS];
+    const unsigned n = make_fence(state.range(0), 100.0f, points);
+
+    /* point inside the fence: the full crossing-count scan runs */
+    const Vector2f p{10.0f, 20.0f};
+
+    while (state.KeepRunning()) {
+        bool outside = Polygon_outside(p, points, n);
+        gbenchmark_escape(&outside);
+    }
+}
+
+BENCHMARK(BM_PolygonOutside)->RangeMultiplier(2)->Range(4, MAX_FENCE_POINTS);
+
+static void BM_PolygonOutsideBounded(benchmark::State& state)
+{
+    Vector2f points[MAX_FENCE_POINTS];
+    const unsigned n = make_fence(state.range(0), 100.0f, points);
+
+    Vector2f bounds_min, bounds_max;
+    Polygon_bounds(points, n, bounds_min, bounds_max);
+
+    /* point far from the fence: the bounding box rejects it early */
+    const Vector2f p{1000.0f, 2000.0f};
+
+    while (state.KeepRunning()) {
+        bool outside = Polygon_outside(p, points, n, bounds_min, bounds_max);
+        gbenchmark_escape(&outside);
+    }
+}
+
+BENCHMARK(BM_PolygonOutsideBounded)->RangeMultiplier(2)->Range(4, MAX_FENCE_POINTS);
+
+static void BM_PolygonIntersects(benchmark::State& state)
+{
+    Vector2f points[MAX_FENCE_POINTS];
+    const unsigned n = make_fence(state.range(0), 100.0f, points);
+
+    /* path segment inside the fence: every edge is tested */
+    const Vector2f p1{-50.0f, -10.0f};
+    const Vector2f p2{50.0f, 10.0f};
+    Vector2f intersection;
+
+    while (state.KeepRunning()) {
+        bool intersects = Polygon_intersects(points, n, p1, p2, intersection);
+        gbenchmark_escape(&intersects);
+    }
+}
+
+BENCHMARK(BM_PolygonIntersects)->RangeMultiplier(2)->Range(4, MAX_FENCE_POINTS);
+
+static void BM_PolygonClosestDistanceLine(benchmark::State& state)
+{
+    Vector2f points[MAX_FENCE_POINTS];
+    const unsigned n = make_fence(state.range(0), 100.0f, points);
+
+    /* path segment inside the fence, off-centre so the margin is non-trivial */
+    const Vector2f p1{-50.0f, -10.0f};
+    const Vector2f p2{50.0f, 60.0f};
+
+    while (state.KeepRunning()) {
+        float dist = Polygon_closest_distance_line(points, n, p1, p2);
+        gbenchmark_escape(&dist);
+    }
+}
+
+BENCHMARK(BM_PolygonClosestDistanceLine)->RangeMultiplier(2)->Range(4, MAX_FENCE_POINTS);
+
+BENCHMARK_MAIN();
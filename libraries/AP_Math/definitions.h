@@ -28,6 +28,18 @@
   #define MATH_CHECK_INDEXES 0
 #endif
 
+// AP_MATH_SIMD_ENABLED selects NEON intrinsic implementations of the hot
+// Matrix3f multiply kernels in matrix3.cpp. The intrinsic forms evaluate
+// the same sums in the same order as the scalar code, so results are
+// bit-identical; enabled by default wherever NEON is available
+#ifndef AP_MATH_SIMD_ENABLED
+  #if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define AP_MATH_SIMD_ENABLED 1
+  #else
+    #define AP_MATH_SIMD_ENABLED 0
+  #endif
+#endif
+
 #define CDEG_TO_RAD     (M_PI / 18000.0f)
 #define RAD_TO_CDEG     (18000.0f / M_PI)
 #define DEG_TO_RAD      (M_PI / 180.0f)
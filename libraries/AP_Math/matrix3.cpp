@@ -20,6 +20,10 @@
 
 #include "AP_Math.h"
 
+#if AP_MATH_SIMD_ENABLED
+#include <arm_neon.h>
+#endif
+
 // create a rotation matrix given some euler angles
 // this is based on https://github.com/ArduPilot/Datasheets/blob/main/References/EulerAngles.pdf
 template <typename T>
@@ -252,6 +256,81 @@ void Matrix3<T>::from_axis_angle(const Vector3<T> &v, T theta)
 }
 
 
+#if AP_MATH_SIMD_ENABLED
+/*
+  NEON specialisations of the multiply kernels for the float
+  instantiation. Each result lane is accumulated in the same order as
+  the scalar code above (first + second, then third), using separate
+  multiply and add so the compiler cannot contract to a fused
+  multiply-add, which keeps the results bit-identical to the scalar
+  build. The 4th lane of each load stays inside the object being read
+  and is discarded on store.
+ */
+
+// load the three rows of a matrix into 4-lane vectors. The trailing
+// lane of the last row is duplicated rather than read past the object
+static inline void neon_load_rows(const Matrix3<float> &m, float32x4_t &ra, float32x4_t &rb, float32x4_t &rc)
+{
+    ra = vld1q_f32(&m.a.x);
+    rb = vld1q_f32(&m.b.x);
+    rc = vcombine_f32(vld1_f32(&m.c.x), vld1_dup_f32(&m.c.z));
+}
+
+// store the first three lanes of a vector into a Vector3f
+static inline Vector3<float> neon_store3(float32x4_t r)
+{
+    float out[4];
+    vst1q_f32(out, r);
+    return Vector3<float>(out[0], out[1], out[2]);
+}
+
+// multiplication by a vector
+template <>
+Vector3<float> Matrix3<float>::operator *(const Vector3<float> &v) const
+{
+    // de-interleave the first two rows to get column vectors, then
+    // finish the third lane of each column from row c
+    const float32x2x3_t mt = vld3_f32(&a.x);
+    const float32x4_t c0 = vcombine_f32(mt.val[0], vld1_dup_f32(&c.x));
+    const float32x4_t c1 = vcombine_f32(mt.val[1], vld1_dup_f32(&c.y));
+    const float32x4_t c2 = vcombine_f32(mt.val[2], vld1_dup_f32(&c.z));
+    float32x4_t r = vmulq_n_f32(c0, v.x);
+    r = vaddq_f32(r, vmulq_n_f32(c1, v.y));
+    r = vaddq_f32(r, vmulq_n_f32(c2, v.z));
+    return neon_store3(r);
+}
+
+// multiplication of transpose by a vector
+template <>
+Vector3<float> Matrix3<float>::mul_transpose(const Vector3<float> &v) const
+{
+    float32x4_t ra, rb, rc;
+    neon_load_rows(*this, ra, rb, rc);
+    float32x4_t r = vmulq_n_f32(ra, v.x);
+    r = vaddq_f32(r, vmulq_n_f32(rb, v.y));
+    r = vaddq_f32(r, vmulq_n_f32(rc, v.z));
+    return neon_store3(r);
+}
+
+// multiplication by another Matrix3<float>
+template <>
+Matrix3<float> Matrix3<float>::operator *(const Matrix3<float> &m) const
+{
+    float32x4_t ma, mb, mc;
+    neon_load_rows(m, ma, mb, mc);
+    Matrix3<float> temp;
+    const Vector3<float> *rows[3] { &a, &b, &c };
+    Vector3<float> *out[3] { &temp.a, &temp.b, &temp.c };
+    for (uint8_t i=0; i<3; i++) {
+        float32x4_t r = vmulq_n_f32(ma, rows[i]->x);
+        r = vaddq_f32(r, vmulq_n_f32(mb, rows[i]->y));
+        r = vaddq_f32(r, vmulq_n_f32(mc, rows[i]->z));
+        *out[i] = neon_store3(r);
+    }
+    return temp;
+}
+#endif // AP_MATH_SIMD_ENABLED
+
 // define for float and double
 template class Matrix3<float>;
 template class Matrix3<double>;
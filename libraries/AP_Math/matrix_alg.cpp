@@ -228,6 +228,38 @@ static bool mat_inverseN(const T* A, T* inv, uint16_t n)
     return ret;
 }
 
+/*
+ *    fast matrix inverse code only for 2x2 square matrix
+ *
+ *    @param     m,           input 2x2 matrix
+ *    @param     invOut,      Output inverted 2x2 matrix
+ *    @returns                false = matrix is Singular, true = matrix inversion successful
+ */
+template<typename T>
+static bool inverse2x2(const T m[], T invOut[])
+{
+    T det = m[0] * m[3] - m[1] * m[2];
+    if (is_zero(det) || isinf(det)) {
+        return false;
+    }
+
+    T invdet = 1 / det;
+
+    // use a temporary so inversion in place is safe
+    const T inv[4] {
+        m[3] * invdet,
+        -m[1] * invdet,
+        -m[2] * invdet,
+        m[0] * invdet
+    };
+
+    for (uint16_t i = 0; i < 4; i++) {
+        invOut[i] = inv[i];
+    }
+
+    return true;
+}
+
 /*
  *    fast matrix inverse code only for 3x3 square matrix
  *
@@ -432,12 +464,35 @@ template<typename T>
 bool mat_inverse(const T x[], T y[], uint16_t dim)
 {
     switch(dim){
+    case 2: return inverse2x2(x,y);
     case 3: return inverse3x3(x,y);
     case 4: return inverse4x4(x,y);
     default: return mat_inverseN(x,y,dim);
     }
 }
 
+/*
+ *    matrix inverse with the dimension known at compile time, so the unrolled
+ *    small matrix code is selected without the runtime dispatch above. Only
+ *    dimensions up to 4 are provided; use the runtime form for larger
+ *    matrices
+ *
+ *    @param     x,     input NxN matrix
+ *    @param     y,     Output inverted NxN matrix
+ *    @returns          false = matrix is Singular, true = matrix inversion successful
+ */
+template<uint16_t N, typename T>
+bool mat_inverse(const T x[], T y[])
+{
+    static_assert(N >= 2 && N <= 4, "compile-time mat_inverse only supports 2x2 to 4x4");
+    if (N == 2) {
+        return inverse2x2(x,y);
+    } else if (N == 3) {
+        return inverse3x3(x,y);
+    }
+    return inverse4x4(x,y);
+}
+
 template <typename T>
 void mat_mul(const T *A, const T *B, T *C, uint16_t n)
 {
@@ -467,3 +522,11 @@ template void mat_identity<float>(float x[], uint16_t dim);
 template bool mat_inverse<double>(const double x[], double y[], uint16_t dim);
 template void mat_mul<double>(const double *A, const double *B, double *C, uint16_t n);
 template void mat_identity<double>(double x[], uint16_t dim);
+
+template bool mat_inverse<2,float>(const float x[], float y[]);
+template bool mat_inverse<3,float>(const float x[], float y[]);
+template bool mat_inverse<4,float>(const float x[], float y[]);
+
+template bool mat_inverse<2,double>(const double x[], double y[]);
+template bool mat_inverse<3,double>(const double x[], double y[]);
+template bool mat_inverse<4,double>(const double x[], double y[]);
@@ -119,11 +119,52 @@ bool Polygon_complete(const Vector2<T> *V, unsigned n)
     return (n >= 4 && V[n-1] == V[0]);
 }
 
+/*
+ *  calculate the axis-aligned bounding box of a polygon
+ */
+template <typename T>
+void Polygon_bounds(const Vector2<T> *V, unsigned n, Vector2<T> &bounds_min, Vector2<T> &bounds_max)
+{
+    if (n == 0) {
+        bounds_min.zero();
+        bounds_max.zero();
+        return;
+    }
+    bounds_min = V[0];
+    bounds_max = V[0];
+    for (unsigned i=1; i<n; i++) {
+        bounds_min.x = MIN(bounds_min.x, V[i].x);
+        bounds_min.y = MIN(bounds_min.y, V[i].y);
+        bounds_max.x = MAX(bounds_max.x, V[i].x);
+        bounds_max.y = MAX(bounds_max.y, V[i].y);
+    }
+}
+
+/*
+ *  Polygon_outside() with a precomputed bounding box early-out.  A
+ *  point outside the bounding box cannot be inside the polygon, so
+ *  the per-edge crossing test is only run for nearby points
+ */
+template <typename T>
+bool Polygon_outside(const Vector2<T> &P, const Vector2<T> *V, unsigned n,
+                     const Vector2<T> &bounds_min, const Vector2<T> &bounds_max)
+{
+    if (P.x < bounds_min.x || P.x > bounds_max.x ||
+        P.y < bounds_min.y || P.y > bounds_max.y) {
+        return true;
+    }
+    return Polygon_outside(P, V, n);
+}
+
 // Necessary to avoid linker errors
 template bool Polygon_outside<int32_t>(const Vector2l &P, const Vector2l *V, unsigned n);
 template bool Polygon_complete<int32_t>(const Vector2l *V, unsigned n);
+template void Polygon_bounds<int32_t>(const Vector2l *V, unsigned n, Vector2l &bounds_min, Vector2l &bounds_max);
+template bool Polygon_outside<int32_t>(const Vector2l &P, const Vector2l *V, unsigned n, const Vector2l &bounds_min, const Vector2l &bounds_max);
 template bool Polygon_outside<float>(const Vector2f &P, const Vector2f *V, unsigned n);
 template bool Polygon_complete<float>(const Vector2f *V, unsigned n);
+template void Polygon_bounds<float>(const Vector2f *V, unsigned n, Vector2f &bounds_min, Vector2f &bounds_max);
+template bool Polygon_outside<float>(const Vector2f &P, const Vector2f *V, unsigned n, const Vector2f &bounds_min, const Vector2f &bounds_max);
 
 /*
   determine if the polygon of N verticies defined by points V is
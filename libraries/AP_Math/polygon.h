@@ -24,6 +24,25 @@ bool        Polygon_outside(const Vector2<T> &P, const Vector2<T> *V, unsigned n
 template <typename T>
 bool        Polygon_complete(const Vector2<T> *V, unsigned n) WARN_IF_UNUSED;
 
+/*
+  calculate the axis-aligned bounding box of the polygon of n
+  vertices defined by points V.  Intended to be called once when a
+  polygon is loaded so the bounded Polygon_outside variant below can
+  reject distant points without walking the vertex list
+ */
+template <typename T>
+void        Polygon_bounds(const Vector2<T> *V, unsigned n, Vector2<T> &bounds_min, Vector2<T> &bounds_max);
+
+/*
+  as Polygon_outside() but takes the polygon's bounding box
+  (precomputed with Polygon_bounds()) and returns early when P lies
+  outside it, keeping the common far-from-fence case O(1) regardless
+  of vertex count
+ */
+template <typename T>
+bool        Polygon_outside(const Vector2<T> &P, const Vector2<T> *V, unsigned n,
+                            const Vector2<T> &bounds_min, const Vector2<T> &bounds_max) WARN_IF_UNUSED;
+
 /*
   determine if the polygon of N verticies defined by points V is
   intersected by a line from point p1 to point p2
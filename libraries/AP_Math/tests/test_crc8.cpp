@@ -10,5 +10,15 @@ TEST(CRC8, crc8_dvb_buffer)
     EXPECT_EQ(0x92, crc8_generic(buffer, 2, 0x31, 0xff));
 }
 
+TEST(CRC8, crc8_dvb_s2_table)
+{
+    // the table driven crc8_dvb_s2() must match the bitwise implementation
+    for (uint16_t crc = 0; crc < 256; crc++) {
+        for (uint16_t a = 0; a < 256; a++) {
+            EXPECT_EQ(crc8_dvb(uint8_t(crc), uint8_t(a), 0xD5), crc8_dvb_s2(uint8_t(crc), uint8_t(a)));
+        }
+    }
+}
+
 AP_GTEST_PANIC()
 AP_GTEST_MAIN()
@@ -61,6 +61,13 @@ protected:
             int subtriangle =
                     AP_GeodesicGrid::_subtriangle_index(triangle, p.v, false);
             ASSERT_EQ(expected_subtriangle, subtriangle);
+
+            /* The fast classifier must agree with the exhaustive search
+             * whenever it doesn't delegate to it. */
+            int fast_triangle = AP_GeodesicGrid::_triangle_index_fast(p.v);
+            if (fast_triangle >= 0) {
+                ASSERT_EQ(expected_triangle, fast_triangle);
+            }
         } else {
             int triangle = AP_GeodesicGrid::_triangle_index(p.v, false);
             if (triangle >= 0) {
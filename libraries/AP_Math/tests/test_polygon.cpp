@@ -53,6 +53,30 @@ TEST(Polygon, outside)
     }
 }
 
+TEST(Polygon, outside_bounded)
+{
+    // the bounded variant must agree with the unbounded one
+    for (const struct PB &pb : points_boundaries) {
+        Vector2f v[4];
+        memcpy(v, pb.boundary, sizeof(pb.boundary));
+        v[3] = v[0]; // close it
+        Vector2f bounds_min, bounds_max;
+        Polygon_bounds(v, 4, bounds_min, bounds_max);
+        EXPECT_EQ(pb.outside, Polygon_outside(pb.point, v, 4, bounds_min, bounds_max));
+    }
+}
+
+TEST(Polygon, bounds)
+{
+    const Vector2f v[] = {{0.0f,0.0f}, {0.0f,1.0f}, {1.0f,0.0f}, {0.0f,0.0f}};
+    Vector2f bounds_min, bounds_max;
+    Polygon_bounds(v, ARRAY_SIZE(v), bounds_min, bounds_max);
+    EXPECT_FLOAT_EQ(bounds_min.x, 0.0f);
+    EXPECT_FLOAT_EQ(bounds_min.y, 0.0f);
+    EXPECT_FLOAT_EQ(bounds_max.x, 1.0f);
+    EXPECT_FLOAT_EQ(bounds_max.y, 1.0f);
+}
+
 struct SquareBoundary {
     Vector2f point;
     Vector2f boundary[4];
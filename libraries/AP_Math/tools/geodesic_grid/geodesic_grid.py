@@ -130,6 +130,14 @@ described in AP_GeodesicGrid.h.
 """,
 )
 
+parser.add_argument(
+    '--centroids-gen',
+    action='store_true',
+    help="""
+Generate C++ code for the initialization of the member _triangle_centroids
+declared in AP_GeodesicGrid.h.
+""")
+
 parser.add_argument(
     '--inverses-gen',
     action='store_true',
@@ -279,6 +287,16 @@ if args.neighbor_umbrella_gen:
         ))
     print("};")
 
+if args.centroids_gen:
+    print("Header centroids code generation:")
+    print_code_gen_notice()
+    print("const Vector3f AP_GeodesicGrid::_triangle_centroids[10]{")
+    for i in range(10):
+        a, b, c = ico.triangles[i]
+        m = ((1.0 / 3.0) * (a + b + c)).normalized()
+        print("    {%9.6ff, %9.6ff, %9.6ff}," % (m.x, m.y, m.z))
+    print("};")
+
 if args.inverses_gen:
     print("Header inverses code generation:")
     print_code_gen_notice()
@@ -92,6 +92,18 @@ void AP_Mission::init()
     // command list will be cleared if they do not match
     check_eeprom_version();
 
+#if AP_MISSION_ID_CACHE_ENABLED
+    // build the in-RAM command ID index so mission scans avoid
+    // per-item storage reads. On allocation failure we simply fall
+    // back to reading IDs from storage
+    _id_cache = NEW_NOTHROW uint16_t[_commands_max]();
+    if (_id_cache != nullptr) {
+        for (uint16_t i = 1; i < (unsigned)_cmd_total; i++) {
+            _id_cache[i] = get_command_id_from_storage(i);
+        }
+    }
+#endif
+
     // initialize the jump tracking array
     init_jump_tracking();
 
@@ -971,11 +983,13 @@ bool AP_Mission::write_cmd_to_storage(uint16_t index, const Mission_Command& cmd
     // calculate where in storage the command should be placed
     uint16_t pos_in_storage = 4 + (index * AP_MISSION_EEPROM_COMMAND_SIZE);
 
+    // build the on-storage image of the command
+    uint8_t new_image[AP_MISSION_EEPROM_COMMAND_SIZE];
     if (cmd.id < 256) {
         // for commands below 256 we store up to 12 bytes
-        _storage.write_byte(pos_in_storage, cmd.id);
-        _storage.write_uint16(pos_in_storage+1, cmd.p1);
-        _storage.write_block(pos_in_storage+3, packed.bytes, 12);
+        new_image[0] = cmd.id;
+        memcpy(&new_image[1], &cmd.p1, 2);
+        memcpy(&new_image[3], packed.bytes, 12);
     } else {
         // if the command ID is above 256 we store a tag byte followed
         // by the 16 bit command ID. The tag byte is 1 for commands
@@ -986,12 +1000,29 @@ bool AP_Mission::write_cmd_to_storage(uint16_t index, const Mission_Command& cmd
         if (cmd.id == MAV_CMD_NAV_SCRIPT_TIME) {
             tag_byte = 1;
         }
-        _storage.write_byte(pos_in_storage, tag_byte);
-        _storage.write_uint16(pos_in_storage+1, cmd.id);
-        _storage.write_uint16(pos_in_storage+3, cmd.p1);
-        _storage.write_block(pos_in_storage+5, packed.bytes, 10);
+        new_image[0] = tag_byte;
+        memcpy(&new_image[1], &cmd.id, 2);
+        memcpy(&new_image[3], &cmd.p1, 2);
+        memcpy(&new_image[5], packed.bytes, 10);
+    }
+
+#if AP_MISSION_ID_CACHE_ENABLED
+    if (_id_cache != nullptr && index < _commands_max) {
+        _id_cache[index] = cmd.id;
+    }
+#endif
+
+    // skip the write if the command is identical to what is already
+    // stored, so re-uploading an unchanged item costs a read and
+    // compare only and does not mark the mission as changed
+    uint8_t old_image[AP_MISSION_EEPROM_COMMAND_SIZE];
+    if (_storage.read_block(old_image, pos_in_storage, sizeof(old_image)) &&
+        memcmp(old_image, new_image, sizeof(new_image)) == 0) {
+        return true;
     }
 
+    _storage.write_block(pos_in_storage, new_image, sizeof(new_image));
+
     // remember when the mission last changed
     if (index != 0) {
         // Update of home location is not a true change
@@ -2983,6 +3014,22 @@ const char *AP_Mission::Mission_Command::type() const
   get the command ID of a mission index. Caller should have checked the index is in range
  */
 uint16_t AP_Mission::get_command_id(uint16_t index) const
+{
+#if AP_MISSION_ID_CACHE_ENABLED
+    if (_id_cache != nullptr && index < _commands_max) {
+        const uint16_t id = _id_cache[index];
+        if (id != 0) {
+            return id;
+        }
+    }
+#endif
+    return get_command_id_from_storage(index);
+}
+
+/*
+  read the command ID of a mission index from storage
+ */
+uint16_t AP_Mission::get_command_id_from_storage(uint16_t index) const
 {
     const uint16_t pos_in_storage = 4 + (index * AP_MISSION_EEPROM_COMMAND_SIZE);
     uint8_t b[3] {};
@@ -959,6 +959,16 @@ private:
     // fast call to get command ID of a mission index
     uint16_t get_command_id(uint16_t index) const;
 
+    // read the command ID of a mission index from storage
+    uint16_t get_command_id_from_storage(uint16_t index) const;
+
+#if AP_MISSION_ID_CACHE_ENABLED
+    // in-RAM index of stored command IDs, built at init and kept
+    // up to date by write_cmd_to_storage(). Entry 0 means unknown,
+    // falling back to a storage read
+    uint16_t *_id_cache;
+#endif
+
     // memoisation of contains-relative:
     bool _contains_terrain_alt_items;  // true if the mission has terrain-relative items
     uint32_t _last_contains_relative_calculated_ms;  // will be equal to _last_change_time_ms if _contains_terrain_alt_items is up-to-date
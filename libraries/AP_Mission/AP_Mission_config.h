@@ -12,3 +12,10 @@
 #ifndef AP_MISSION_MAV_CMD_DO_SET_ROI_WPNEXT_OFFSET_ENABLED
 #define AP_MISSION_MAV_CMD_DO_SET_ROI_WPNEXT_OFFSET_ENABLED AP_MOUNT_ROI_WPNEXT_OFFSET_ENABLED
 #endif
+
+// cache mission command IDs in RAM so whole-mission scans (jump tag,
+// land start and contains_item lookups) avoid per-item storage
+// reads. Costs 2 bytes of heap per mission storage slot
+#ifndef AP_MISSION_ID_CACHE_ENABLED
+#define AP_MISSION_ID_CACHE_ENABLED (HAL_MEM_CLASS >= HAL_MEM_CLASS_300)
+#endif
@@ -308,9 +308,6 @@ void AP_Motors6DOF::output_armed_stabilizing()
         forward_thrust = _forward_in;
         lateral_thrust = _lateral_in;
 
-        float rpy_out[AP_MOTORS_MAX_NUM_MOTORS]; // buffer so we don't have to multiply coefficients multiple times.
-        float linear_out[AP_MOTORS_MAX_NUM_MOTORS]; // 3 linear DOF mix for each motor
-
         // initialize limits flags
         limit.set_all(false);
 
@@ -324,30 +321,18 @@ void AP_Motors6DOF::output_armed_stabilizing()
             limit.throttle_upper = true;
         }
 
-        // calculate roll, pitch and yaw for each motor
-        for (i=0; i<AP_MOTORS_MAX_NUM_MOTORS; i++) {
-            if (motor_enabled[i]) {
-                rpy_out[i] = roll_thrust * _roll_factor[i] +
-                             pitch_thrust * _pitch_factor[i] +
-                             yaw_thrust * _yaw_factor[i];
-
-            }
-        }
-
-        // calculate linear command for each motor
+        // calculate rotational and linear commands and the final
+        // output for each motor in a single pass
         // linear factors should be 0.0 or 1.0 for now
         for (i=0; i<AP_MOTORS_MAX_NUM_MOTORS; i++) {
             if (motor_enabled[i]) {
-                linear_out[i] = throttle_thrust * _throttle_factor[i] +
-                                forward_thrust * _forward_factor[i] +
-                                lateral_thrust * _lateral_factor[i];
-            }
-        }
-
-        // Calculate final output for each motor
-        for (i=0; i<AP_MOTORS_MAX_NUM_MOTORS; i++) {
-            if (motor_enabled[i]) {
-                _thrust_rpyt_out[i] = constrain_float(_motor_reverse[i]*(rpy_out[i] + linear_out[i]),-1.0f,1.0f);
+                const float rpy_out = roll_thrust * _roll_factor[i] +
+                                      pitch_thrust * _pitch_factor[i] +
+                                      yaw_thrust * _yaw_factor[i];
+                const float linear_out = throttle_thrust * _throttle_factor[i] +
+                                         forward_thrust * _forward_factor[i] +
+                                         lateral_thrust * _lateral_factor[i];
+                _thrust_rpyt_out[i] = constrain_float(_motor_reverse[i]*(rpy_out + linear_out),-1.0f,1.0f);
             }
         }
     }
@@ -410,9 +395,6 @@ void AP_Motors6DOF::output_armed_stabilizing_vectored()
     forward_thrust = _forward_in;
     lateral_thrust = _lateral_in;
 
-    float rpy_out[AP_MOTORS_MAX_NUM_MOTORS]; // buffer so we don't have to multiply coefficients multiple times.
-    float linear_out[AP_MOTORS_MAX_NUM_MOTORS]; // 3 linear DOF mix for each motor
-
     // initialize limits flags
     limit.set_all(false);
 
@@ -427,25 +409,20 @@ void AP_Motors6DOF::output_armed_stabilizing_vectored()
         limit.throttle_upper = true;
     }
 
-    // calculate roll, pitch and yaw for each motor
-    for (i=0; i<AP_MOTORS_MAX_NUM_MOTORS; i++) {
-        if (motor_enabled[i]) {
-            rpy_out[i] = roll_thrust * _roll_factor[i] +
-                         pitch_thrust * _pitch_factor[i] +
-                         yaw_thrust * _yaw_factor[i];
-        }
-    }
-
     float forward_coupling_limit = 1-_forwardVerticalCouplingFactor*float(fabsf(throttle_thrust));
     if (forward_coupling_limit < 0) {
         forward_coupling_limit = 0;
     }
     int8_t forward_coupling_direction[] = {-1,-1,1,1,0,0,0,0,0,0,0,0};
 
-    // calculate linear command for each motor
+    // calculate rotational and linear commands and the final output
+    // for each motor in a single pass
     // linear factors should be 0.0 or 1.0 for now
     for (i=0; i<AP_MOTORS_MAX_NUM_MOTORS; i++) {
         if (motor_enabled[i]) {
+            const float rpy_out = roll_thrust * _roll_factor[i] +
+                                  pitch_thrust * _pitch_factor[i] +
+                                  yaw_thrust * _yaw_factor[i];
 
             float forward_thrust_limited = forward_thrust;
 
@@ -458,16 +435,11 @@ void AP_Motors6DOF::output_armed_stabilizing_vectored()
                 }
             }
 
-            linear_out[i] = throttle_thrust * _throttle_factor[i] +
-                            forward_thrust_limited * _forward_factor[i] +
-                            lateral_thrust * _lateral_factor[i];
-        }
-    }
+            const float linear_out = throttle_thrust * _throttle_factor[i] +
+                                     forward_thrust_limited * _forward_factor[i] +
+                                     lateral_thrust * _lateral_factor[i];
 
-    // Calculate final output for each motor
-    for (i=0; i<AP_MOTORS_MAX_NUM_MOTORS; i++) {
-        if (motor_enabled[i]) {
-            _thrust_rpyt_out[i] = constrain_float(_motor_reverse[i]*(rpy_out[i] + linear_out[i]), -1.0f, 1.0f);
+            _thrust_rpyt_out[i] = constrain_float(_motor_reverse[i]*(rpy_out + linear_out), -1.0f, 1.0f);
         }
     }
 }
@@ -512,8 +484,13 @@ void AP_Motors6DOF::output_armed_stabilizing_vectored_6dof()
 
     throttle_thrust = constrain_float(throttle_thrust, -1.0f, _max_throttle);
 
-    // calculate roll, pitch and Throttle for each motor (only used by vertical thrusters)
+    // calculate roll, pitch and throttle (only used by vertical thrusters) and
+    // yaw/linear commands (only used for translational thrusters) for each motor
+    // the buffers must be kept because the maxima are not known until all motors
+    // have been mixed
+    // linear factors should be 0.0 or 1.0 for now
     rpt_max = 1; //Initialized to 1 so that normalization will only occur if value is saturated
+    yfl_max = 1; //Initialized to 1 so that normalization will only occur if value is saturated
     for (i=0; i<AP_MOTORS_MAX_NUM_MOTORS; i++) {
         if (motor_enabled[i]) {
             rpt_out[i] = roll_thrust * _roll_factor[i] +
@@ -522,14 +499,6 @@ void AP_Motors6DOF::output_armed_stabilizing_vectored_6dof()
             if (fabsf(rpt_out[i]) > rpt_max) {
                 rpt_max = fabsf(rpt_out[i]);
             }
-        }
-    }
-
-    // calculate linear/yaw command for each motor (only used for translational thrusters)
-    // linear factors should be 0.0 or 1.0 for now
-    yfl_max = 1; //Initialized to 1 so that normalization will only occur if value is saturated
-    for (i=0; i<AP_MOTORS_MAX_NUM_MOTORS; i++) {
-        if (motor_enabled[i]) {
             yfl_out[i] = yaw_thrust * _yaw_factor[i] +
                          forward_thrust * _forward_factor[i] +
                          lateral_thrust * _lateral_factor[i];
@@ -9,6 +9,8 @@
 
 extern const AP_HAL::HAL& hal;
 
+#define AP_MOUNT_SERVO_UPDATE_DT 0.02f  // update rate in seconds.  update() should be called at this rate
+
 // init - performs any required initialisation for this instance
 void AP_Mount_Servo::init()
 {
@@ -41,7 +43,50 @@ void AP_Mount_Servo::send_target_angles(const MountAngleTarget& angle_rad)
 {
     update_angle_outputs(mnt_target.angle_rad);
 
-    // write the results to the servos
+    // estimate the target velocity for feed-forward interpolation in update_fast()
+    const uint32_t now_us = AP_HAL::micros();
+    const float dt = (now_us - _last_target_us) * 1.0e-6f;
+    if (_last_target_us != 0 && is_positive(dt) && dt < 0.5f) {
+        Vector3f delta = _angle_bf_output_rad - _angle_bf_target_rad;
+        delta.z = wrap_PI(delta.z);
+        _angle_bf_velocity_rads = delta / dt;
+    } else {
+        _angle_bf_velocity_rads.zero();
+    }
+    _angle_bf_target_rad = _angle_bf_output_rad;
+    _last_target_us = now_us;
+
+    // if the fast loop is interpolating the outputs it also writes the
+    // servos; not all vehicles call update_fast()
+    if (_last_fast_update_us != 0 && now_us - _last_fast_update_us < 100000U) {
+        return;
+    }
+
+    write_servo_outputs();
+}
+
+// interpolate the 50Hz angle targets up to the servo output rate with
+// velocity feed-forward so fast tracking does not produce visible stepping
+void AP_Mount_Servo::update_fast()
+{
+    const uint32_t now_us = AP_HAL::micros();
+    _last_fast_update_us = now_us;
+
+    if (_last_target_us == 0) {
+        return;
+    }
+
+    // extrapolate the latest target forward using the target velocity,
+    // limited to two update intervals so a stale target cannot run away
+    const float dt = MIN((now_us - _last_target_us) * 1.0e-6f, 2.0f * AP_MOUNT_SERVO_UPDATE_DT);
+    _angle_bf_output_rad = _angle_bf_target_rad + _angle_bf_velocity_rads * dt;
+
+    write_servo_outputs();
+}
+
+// write the current body-frame output angles to the servos
+void AP_Mount_Servo::write_servo_outputs()
+{
     move_servo(_roll_idx, degrees(_angle_bf_output_rad.x)*10, _params.roll_angle_min*10, _params.roll_angle_max*10);
     move_servo(_tilt_idx, degrees(_angle_bf_output_rad.y)*10, _params.pitch_angle_min*10, _params.pitch_angle_max*10);
     move_servo(_pan_idx,  degrees(_angle_bf_output_rad.z)*10, _params.yaw_angle_min*10, _params.yaw_angle_max*10);
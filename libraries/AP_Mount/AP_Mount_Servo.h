@@ -31,6 +31,9 @@ public:
     // update mount position - should be called periodically
     void update() override;
 
+    // interpolate angle outputs up to the servo rate - called from the fast loop
+    void update_fast() override;
+
     // returns true if this mount can control its roll
     bool has_roll_control() const override;
 
@@ -61,6 +64,9 @@ private:
     ///  moves servo with the given function id to the specified angle.  all angles are in body-frame and degrees * 10
     void move_servo(uint8_t rc, int16_t angle, int16_t angle_min, int16_t angle_max);
 
+    // write the current body-frame output angles to the servos
+    void write_servo_outputs();
+
     /// Servo gimbals require stabilization, BrushlessPWM gimbals self-stabilize
     const bool requires_stabilization;
 
@@ -70,5 +76,13 @@ private:
     SRV_Channel::Function    _pan_idx;   // SRV_Channel mount pan  function index
 
     Vector3f _angle_bf_output_rad;  // final body frame output angle in radians
+
+    // interpolation of the 50Hz angle targets up to the servo rate.  when
+    // update_fast() is being called the fast loop extrapolates the latest
+    // target using the target velocity and writes the servos itself
+    Vector3f _angle_bf_target_rad;      // most recent body-frame target from update()
+    Vector3f _angle_bf_velocity_rads;   // rate of change of the body-frame target
+    uint32_t _last_target_us;           // system time the target was last updated
+    uint32_t _last_fast_update_us;      // system time update_fast was last called
 };
 #endif // HAL_MOUNT_SERVO_ENABLED
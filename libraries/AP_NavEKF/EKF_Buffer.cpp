@@ -8,6 +8,69 @@
 #include <string.h>
 #include <AP_InternalError/AP_InternalError.h>
 
+ekf_buffer_arena *ekf_buffer_arena::_active;
+
+// hand a pre-reserved block to the arena
+void ekf_buffer_arena::reserve(void *mem, uint32_t bytes)
+{
+    _mem = (uint8_t *)mem;
+    _capacity = (mem != nullptr) ? bytes : 0;
+    _used = 0;
+    _overflow = 0;
+}
+
+// carve an allocation out of the arena
+void *ekf_buffer_arena::allocate(uint32_t bytes)
+{
+    // keep subsequent allocations naturally aligned
+    bytes = (bytes + 3U) & ~3U;
+    if (_mem == nullptr || _capacity - _used < bytes) {
+        _overflow += bytes;
+        return nullptr;
+    }
+    void *ret = &_mem[_used];
+    _used += bytes;
+    return ret;
+}
+
+/*
+  allocate backing store for a buffer, preferring the active arena when
+  one is set. Arena memory is never returned, so a re-init reuses the
+  original allocation when the requested size still fits
+ */
+static void *ekf_buffer_allocate(void *old_buffer, bool &from_arena, uint32_t &alloc_bytes, uint32_t bytes)
+{
+    if (old_buffer != nullptr) {
+        if (from_arena) {
+            if (bytes <= alloc_bytes) {
+                memset(old_buffer, 0, bytes);
+                return old_buffer;
+            }
+            // too small; the arena chunk is abandoned
+        } else {
+            free(old_buffer);
+        }
+    }
+    ekf_buffer_arena *arena = ekf_buffer_arena::get_active();
+    if (arena != nullptr) {
+        void *mem = arena->allocate(bytes);
+        if (mem != nullptr) {
+            memset(mem, 0, bytes);
+            from_arena = true;
+            alloc_bytes = bytes;
+            return mem;
+        }
+        // arena exhausted; fall back to the heap so the core can
+        // still start, counted in the arena overflow report
+    }
+    void *mem = calloc(1, bytes);
+    if (mem != nullptr) {
+        from_arena = false;
+        alloc_bytes = bytes;
+    }
+    return mem;
+}
+
 // constructor
 ekf_ring_buffer::ekf_ring_buffer(uint8_t _elsize) :
     elsize(_elsize),
@@ -16,10 +79,7 @@ ekf_ring_buffer::ekf_ring_buffer(uint8_t _elsize) :
 
 bool ekf_ring_buffer::init(uint8_t _size)
 {
-    if (buffer) {
-        free(buffer);
-    }
-    buffer = calloc(_size, elsize);
+    buffer = ekf_buffer_allocate(buffer, from_arena, alloc_bytes, uint32_t(_size)*elsize);
     if (buffer == nullptr) {
         return false;
     }
@@ -118,7 +178,8 @@ void ekf_ring_buffer::reset()
 
 // constructor
 ekf_imu_buffer::ekf_imu_buffer(uint8_t _elsize) :
-    elsize(_elsize)
+    elsize(_elsize),
+    buffer(nullptr)
 {}
 
 /*
@@ -132,11 +193,8 @@ void *ekf_imu_buffer::get_offset(uint8_t idx) const
 // initialise buffer, returns false when allocation has failed
 bool ekf_imu_buffer::init(uint32_t size)
 {
-    if (buffer != nullptr) {
-        // allow for init twice
-        free(buffer);
-    }
-    buffer = calloc(size, elsize);
+    // allows for init twice
+    buffer = ekf_buffer_allocate(buffer, from_arena, alloc_bytes, size*elsize);
     if (buffer == nullptr) {
         return false;
     }
@@ -11,6 +11,44 @@ typedef struct {
     uint32_t    time_ms;
 } EKF_obs_element_t;
 
+/*
+  optional contiguous arena for the EKF ring buffers. When an arena is
+  made active the buffer init calls draw from its pre-reserved block
+  instead of the heap, so all buffers for all cores land in one region
+  (fast memory where available) and usage can be reported at boot.
+  Allocations are never returned to the arena; re-init reuses the
+  original allocation when the requested size still fits
+ */
+class ekf_buffer_arena
+{
+public:
+    // hand a pre-reserved block to the arena. The caller owns the
+    // allocation; a null block leaves the arena disabled
+    void reserve(void *mem, uint32_t bytes);
+
+    // carve an allocation out of the arena, returning nullptr when
+    // the block is exhausted or no block was reserved
+    void *allocate(uint32_t bytes);
+
+    uint32_t used(void) const { return _used; }
+    uint32_t capacity(void) const { return _capacity; }
+
+    // bytes requested after the arena filled, served from the heap instead
+    uint32_t overflow(void) const { return _overflow; }
+
+    // arena consulted by the buffer init calls; null selects the heap
+    static void set_active(ekf_buffer_arena *arena) { _active = arena; }
+    static ekf_buffer_arena *get_active(void) { return _active; }
+
+private:
+    uint8_t *_mem;
+    uint32_t _capacity;
+    uint32_t _used;
+    uint32_t _overflow;
+
+    static ekf_buffer_arena *_active;
+};
+
 // this class is to be used for observation buffers, the data is
 // pushed into buffer like any standard ring buffer return is based on
 // the sample time provided
@@ -52,6 +90,10 @@ private:
     // total number of elements in the buffer
     uint8_t count;
 
+    // bytes allocated for buffer and whether they came from an arena
+    uint32_t alloc_bytes;
+    bool from_arena;
+
     uint32_t time_ms(uint8_t idx) const;
     void *get_offset(uint8_t idx) const;
 };
@@ -139,6 +181,10 @@ protected:
     uint8_t _size,_oldest,_youngest;
     bool _filled;
 
+    // bytes allocated for buffer and whether they came from an arena
+    uint32_t alloc_bytes;
+    bool from_arena;
+
     void *get_offset(uint8_t idx) const;
 };
 
@@ -31,7 +31,6 @@ extern const AP_HAL::HAL& hal;
 #define ENABLE_EKF_TIMING 0
 
 NavEKF2_core::Matrix24 NavEKF2_core::KH;
-NavEKF2_core::Matrix24 NavEKF2_core::nextP;
 
 // constructor
 NavEKF2_core::NavEKF2_core(NavEKF2 *_frontend) :
@@ -959,6 +958,12 @@ void NavEKF2_core::CovariancePrediction()
 
     for (uint8_t i= 0; i<=stateIndexLim; i++) processNoise[i] = sq(processNoise[i]);
 
+    // nextP is a temporary only used between here and the CopyCovariances()
+    // call at the end of this function. KHP is a scratch matrix of the same
+    // size that is only used by the fusion steps, so save memory by using
+    // KHP as nextP, as is done in EKF3
+    auto &nextP = KHP;
+
     // set variables used to calculate covariance growth
     dvx = imuDataDelayed.delVel.x;
     dvy = imuDataDelayed.delVel.y;
@@ -1495,6 +1500,10 @@ void NavEKF2_core::ForceSymmetry()
 // copy covariances across from covariance prediction calculation
 void NavEKF2_core::CopyCovariances()
 {
+    // the predicted covariances were built in the KHP scratch matrix by
+    // CovariancePrediction()
+    const auto &nextP = KHP;
+
     // copy predicted covariances
     for (uint8_t i=0; i<=stateIndexLim; i++) {
         for (uint8_t j=0; j<=stateIndexLim; j++)
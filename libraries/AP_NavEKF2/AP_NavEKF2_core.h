@@ -789,7 +789,6 @@ private:
     static const uint32_t EXTNAV_BUFFER_LENGTH = 15;
 
     static Matrix24 KH;             // intermediate result used for covariance updates
-    static Matrix24 nextP;          // Predicted covariance matrix before addition of process noise to diagonals
 
     // Variables
     bool statesInitialised;         // boolean true when filter states have been initialised
@@ -13,6 +13,10 @@
 
 #include <new>
 
+#if EK3_FEATURE_FUSION_TIMING
+#include <AP_Common/ExpandingString.h>
+#endif
+
 /*
   parameter defaults for different types of vehicle. The
   APM_BUILD_DIRECTORY is taken from the main vehicle directory name
@@ -859,6 +863,17 @@ bool NavEKF3::InitialiseFilter(void)
         }
     }
 
+#if EK3_FEATURE_BUFFER_ARENA
+    // pre-reserve one contiguous block for all cores' ring buffers,
+    // preferring fast memory. Buffer inits draw from it while it is
+    // active; anything that does not fit falls back to the heap and
+    // shows up as overflow in the boot report
+    if (bufferArena.capacity() == 0) {
+        bufferArena.reserve(dal.malloc_type(EK3_BUFFER_ARENA_SIZE, AP_DAL::MemoryType::FAST), EK3_BUFFER_ARENA_SIZE);
+    }
+    ekf_buffer_arena::set_active(&bufferArena);
+#endif
+
     // Set up any cores that have been created
     // This specifies the IMU to be used and creates the data buffers
     // If we are unable to set up a core, return false and try again next time the function is called
@@ -871,6 +886,15 @@ bool NavEKF3::InitialiseFilter(void)
             }
         }
     }
+#if EK3_FEATURE_BUFFER_ARENA
+    ekf_buffer_arena::set_active(nullptr);
+    if (core_setup_success && !bufferArenaReported) {
+        bufferArenaReported = true;
+        GCS_SEND_TEXT(MAV_SEVERITY_INFO, "EKF3 buffer arena %u/%u used, %u overflow",
+                      unsigned(bufferArena.used()), unsigned(bufferArena.capacity()), unsigned(bufferArena.overflow()));
+    }
+#endif
+
     // exit with failure if any cores could not be setup
     if (!core_setup_success) {
         return false;
@@ -2237,3 +2261,14 @@ bool NavEKF3::InitialiseFilterBootstrap()
     }
     return ret;
 }
+
+#if EK3_FEATURE_FUSION_TIMING
+// append a per-fusion-step timing report for all cores to str, used by
+// @SYS/ekf3_timing.txt
+void NavEKF3::fusion_timing_info(ExpandingString &str) const
+{
+    for (uint8_t i=0; i<num_cores; i++) {
+        core[i].fusion_timing_info(str);
+    }
+}
+#endif
@@ -24,9 +24,15 @@
 #include <AP_Param/AP_Param.h>
 #include <AP_NavEKF/AP_Nav_Common.h>
 #include <AP_NavEKF/AP_NavEKF_Source.h>
+#include "AP_NavEKF3_feature.h"
+
+#if EK3_FEATURE_BUFFER_ARENA
+#include <AP_NavEKF/EKF_Buffer.h>
+#endif
 
 class NavEKF3_core;
 class EKFGSF_yaw;
+class ExpandingString;
 
 class NavEKF3 {
     friend class NavEKF3_core;
@@ -352,6 +358,12 @@ public:
     // write EKF information to on-board logs
     void Log_Write();
 
+#if EK3_FEATURE_FUSION_TIMING
+    // append a per-fusion-step timing report for all cores to str,
+    // used by @SYS/ekf3_timing.txt
+    void fusion_timing_info(ExpandingString &str) const;
+#endif
+
     // are we using (aka fusing) a non-compass yaw?
     bool using_noncompass_for_yaw() const;
 
@@ -568,6 +580,12 @@ private:
     // origin set by one of the cores
     Location common_EKF_origin;
     bool common_origin_valid;
+
+#if EK3_FEATURE_BUFFER_ARENA
+    // contiguous pre-reserved block all cores' ring buffers are allocated from
+    ekf_buffer_arena bufferArena;
+    bool bufferArenaReported;   // true when the boot usage report has been sent
+#endif
     
     // update the yaw reset data to capture changes due to a lane switch
     // new_primary - index of the ekf instance that we are about to switch to as the primary
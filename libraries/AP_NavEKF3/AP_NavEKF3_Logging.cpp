@@ -434,6 +434,10 @@ void NavEKF3_core::Log_Write(uint64_t time_us)
     Log_Write_State_Variances(time_us);
 
     Log_Write_Timing(time_us);
+
+#if EK3_FEATURE_FUSION_TIMING
+    Log_Write_FusionTiming(time_us);
+#endif
 }
 
 void NavEKF3_core::Log_Write_Timing(uint64_t time_us)
@@ -463,6 +467,40 @@ void NavEKF3_core::Log_Write_Timing(uint64_t time_us)
     AP::logger().WriteBlock(&xkt, sizeof(xkt));
 }
 
+#if EK3_FEATURE_FUSION_TIMING
+void NavEKF3_core::Log_Write_FusionTiming(uint64_t time_us)
+{
+    // log per-fusion-step timing every 5s, on the same cadence as XKT
+    if (AP::dal().millis() - lastFusionTimingLogTime_ms <= 5000) {
+        return;
+    }
+    lastFusionTimingLogTime_ms = AP::dal().millis();
+
+    const struct log_XKT2 xkt2{
+        LOG_PACKET_HEADER_INIT(LOG_XKT2_MSG),
+        time_us          : time_us,
+        core             : core_index,
+        covPredict_count : fusionTiming.covPredict.count - lastFusionTiming.covPredict.count,
+        covPredict_avg   : fusionTimingAvg(fusionTiming.covPredict, lastFusionTiming.covPredict),
+        covPredict_max   : float(fusionTiming.covPredict.max_us),
+        magFuse_count    : fusionTiming.magFuse.count - lastFusionTiming.magFuse.count,
+        magFuse_avg      : fusionTimingAvg(fusionTiming.magFuse, lastFusionTiming.magFuse),
+        magFuse_max      : float(fusionTiming.magFuse.max_us),
+        velPosFuse_count : fusionTiming.velPosFuse.count - lastFusionTiming.velPosFuse.count,
+        velPosFuse_avg   : fusionTimingAvg(fusionTiming.velPosFuse, lastFusionTiming.velPosFuse),
+        velPosFuse_max   : float(fusionTiming.velPosFuse.max_us),
+    };
+    lastFusionTiming = fusionTiming;
+
+    // the peak values only cover the logging window
+    fusionTiming.covPredict.max_us = 0;
+    fusionTiming.magFuse.max_us = 0;
+    fusionTiming.velPosFuse.max_us = 0;
+
+    AP::logger().WriteBlock(&xkt2, sizeof(xkt2));
+}
+#endif // EK3_FEATURE_FUSION_TIMING
+
 void NavEKF3_core::Log_Write_GSF(uint64_t time_us)
 {
     if (yawEstimator == nullptr) {
@@ -531,9 +531,60 @@ void NavEKF3_core::FuseMagnetometer()
         2.0f*magE*q3
     };
 
+#if EK3_FEATURE_MAG_CACHED_JACOBIAN
+    // cached-Jacobian fusion: the observation jacobian rows are sparse, with
+    // non-zero entries only for the attitude and magnetic field states, so
+    // compute P*H' for all three axes once from the covariance at the start
+    // of the fusion cycle and reuse it for both the innovation variances and
+    // the Kalman gains. The Y and Z gains then use a covariance that is stale
+    // by one or two sequential axis updates; the cache is refreshed every
+    // fusion cycle. These rows must match the observation jacobians set in
+    // the axis fusion loop below.
+    ftype H_ALL[3][24] = {};
+    // X axis
+    H_ALL[0][0] = SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2;
+    H_ALL[0][1] = SH_MAG[0];
+    H_ALL[0][2] = -SH_MAG[1];
+    H_ALL[0][3] = SH_MAG[2];
+    H_ALL[0][16] = SH_MAG[5] - SH_MAG[4] - SH_MAG[3] + SH_MAG[6];
+    H_ALL[0][17] = 2.0f*q0*q3 + 2.0f*q1*q2;
+    H_ALL[0][18] = 2.0f*q1*q3 - 2.0f*q0*q2;
+    H_ALL[0][19] = 1.0f;
+    // Y axis
+    H_ALL[1][0] = SH_MAG[2];
+    H_ALL[1][1] = SH_MAG[1];
+    H_ALL[1][2] = SH_MAG[0];
+    H_ALL[1][3] = 2.0f*magD*q2 - SH_MAG[8] - SH_MAG[7];
+    H_ALL[1][16] = 2.0f*q1*q2 - 2.0f*q0*q3;
+    H_ALL[1][17] = SH_MAG[4] - SH_MAG[3] - SH_MAG[5] + SH_MAG[6];
+    H_ALL[1][18] = 2.0f*q0*q1 + 2.0f*q2*q3;
+    H_ALL[1][20] = 1.0f;
+    // Z axis
+    H_ALL[2][0] = SH_MAG[1];
+    H_ALL[2][1] = -SH_MAG[2];
+    H_ALL[2][2] = SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2;
+    H_ALL[2][3] = SH_MAG[0];
+    H_ALL[2][16] = 2.0f*q0*q2 + 2.0f*q1*q3;
+    H_ALL[2][17] = 2.0f*q2*q3 - 2.0f*q0*q1;
+    H_ALL[2][18] = SH_MAG[3] - SH_MAG[4] - SH_MAG[5] + SH_MAG[6];
+    H_ALL[2][21] = 1.0f;
+
+    ftype PHt[3][24];
+    for (uint8_t axis=0; axis<3; axis++) {
+        const ftype *H = &H_ALL[axis][0];
+        for (uint8_t i=0; i<24; i++) {
+            PHt[axis][i] = P[i][0]*H[0] + P[i][1]*H[1] + P[i][2]*H[2] + P[i][3]*H[3] +
+                           P[i][16]*H[16] + P[i][17]*H[17] + P[i][18]*H[18] + P[i][19+axis];
+        }
+        varInnovMag[axis] = R_MAG +
+                            H[0]*PHt[axis][0] + H[1]*PHt[axis][1] + H[2]*PHt[axis][2] + H[3]*PHt[axis][3] +
+                            H[16]*PHt[axis][16] + H[17]*PHt[axis][17] + H[18]*PHt[axis][18] + PHt[axis][19+axis];
+    }
+#else
     // Calculate the innovation variance for each axis
     // X axis
     varInnovMag[0] = (P[19][19] + R_MAG + P[1][19]*SH_MAG[0] - P[2][19]*SH_MAG[1] + P[3][19]*SH_MAG[2] - P[16][19]*(SH_MAG[3] + SH_MAG[4] - SH_MAG[5] - SH_MAG[6]) + (2.0f*q0*q3 + 2.0f*q1*q2)*(P[19][17] + P[1][17]*SH_MAG[0] - P[2][17]*SH_MAG[1] + P[3][17]*SH_MAG[2] - P[16][17]*(SH_MAG[3] + SH_MAG[4] - SH_MAG[5] - SH_MAG[6]) + P[17][17]*(2.0f*q0*q3 + 2.0f*q1*q2) - P[18][17]*(2.0f*q0*q2 - 2.0f*q1*q3) + P[0][17]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)) - (2.0f*q0*q2 - 2.0f*q1*q3)*(P[19][18] + P[1][18]*SH_MAG[0] - P[2][18]*SH_MAG[1] + P[3][18]*SH_MAG[2] - P[16][18]*(SH_MAG[3] + SH_MAG[4] - SH_MAG[5] - SH_MAG[6]) + P[17][18]*(2.0f*q0*q3 + 2.0f*q1*q2) - P[18][18]*(2.0f*q0*q2 - 2.0f*q1*q3) + P[0][18]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)) + (SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)*(P[19][0] + P[1][0]*SH_MAG[0] - P[2][0]*SH_MAG[1] + P[3][0]*SH_MAG[2] - P[16][0]*(SH_MAG[3] + SH_MAG[4] - SH_MAG[5] - SH_MAG[6]) + P[17][0]*(2.0f*q0*q3 + 2.0f*q1*q2) - P[18][0]*(2.0f*q0*q2 - 2.0f*q1*q3) + P[0][0]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)) + P[17][19]*(2.0f*q0*q3 + 2.0f*q1*q2) - P[18][19]*(2.0f*q0*q2 - 2.0f*q1*q3) + SH_MAG[0]*(P[19][1] + P[1][1]*SH_MAG[0] - P[2][1]*SH_MAG[1] + P[3][1]*SH_MAG[2] - P[16][1]*(SH_MAG[3] + SH_MAG[4] - SH_MAG[5] - SH_MAG[6]) + P[17][1]*(2.0f*q0*q3 + 2.0f*q1*q2) - P[18][1]*(2.0f*q0*q2 - 2.0f*q1*q3) + P[0][1]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)) - SH_MAG[1]*(P[19][2] + P[1][2]*SH_MAG[0] - P[2][2]*SH_MAG[1] + P[3][2]*SH_MAG[2] - P[16][2]*(SH_MAG[3] + SH_MAG[4] - SH_MAG[5] - SH_MAG[6]) + P[17][2]*(2.0f*q0*q3 + 2.0f*q1*q2) - P[18][2]*(2.0f*q0*q2 - 2.0f*q1*q3) + P[0][2]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)) + SH_MAG[2]*(P[19][3] + P[1][3]*SH_MAG[0] - P[2][3]*SH_MAG[1] + P[3][3]*SH_MAG[2] - P[16][3]*(SH_MAG[3] + SH_MAG[4] - SH_MAG[5] - SH_MAG[6]) + P[17][3]*(2.0f*q0*q3 + 2.0f*q1*q2) - P[18][3]*(2.0f*q0*q2 - 2.0f*q1*q3) + P[0][3]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)) - (SH_MAG[3] + SH_MAG[4] - SH_MAG[5] - SH_MAG[6])*(P[19][16] + P[1][16]*SH_MAG[0] - P[2][16]*SH_MAG[1] + P[3][16]*SH_MAG[2] - P[16][16]*(SH_MAG[3] + SH_MAG[4] - SH_MAG[5] - SH_MAG[6]) + P[17][16]*(2.0f*q0*q3 + 2.0f*q1*q2) - P[18][16]*(2.0f*q0*q2 - 2.0f*q1*q3) + P[0][16]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)) + P[0][19]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2));
+#endif
     if (varInnovMag[0] >= R_MAG) {
         faultStatus.bad_xmag = false;
     } else {
@@ -544,8 +595,10 @@ void NavEKF3_core::FuseMagnetometer()
         return;
     }
 
+#if !EK3_FEATURE_MAG_CACHED_JACOBIAN
     // Y axis
     varInnovMag[1] = (P[20][20] + R_MAG + P[0][20]*SH_MAG[2] + P[1][20]*SH_MAG[1] + P[2][20]*SH_MAG[0] - P[17][20]*(SH_MAG[3] - SH_MAG[4] + SH_MAG[5] - SH_MAG[6]) - (2.0f*q0*q3 - 2.0f*q1*q2)*(P[20][16] + P[0][16]*SH_MAG[2] + P[1][16]*SH_MAG[1] + P[2][16]*SH_MAG[0] - P[17][16]*(SH_MAG[3] - SH_MAG[4] + SH_MAG[5] - SH_MAG[6]) - P[16][16]*(2.0f*q0*q3 - 2.0f*q1*q2) + P[18][16]*(2.0f*q0*q1 + 2.0f*q2*q3) - P[3][16]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)) + (2.0f*q0*q1 + 2.0f*q2*q3)*(P[20][18] + P[0][18]*SH_MAG[2] + P[1][18]*SH_MAG[1] + P[2][18]*SH_MAG[0] - P[17][18]*(SH_MAG[3] - SH_MAG[4] + SH_MAG[5] - SH_MAG[6]) - P[16][18]*(2.0f*q0*q3 - 2.0f*q1*q2) + P[18][18]*(2.0f*q0*q1 + 2.0f*q2*q3) - P[3][18]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)) - (SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)*(P[20][3] + P[0][3]*SH_MAG[2] + P[1][3]*SH_MAG[1] + P[2][3]*SH_MAG[0] - P[17][3]*(SH_MAG[3] - SH_MAG[4] + SH_MAG[5] - SH_MAG[6]) - P[16][3]*(2.0f*q0*q3 - 2.0f*q1*q2) + P[18][3]*(2.0f*q0*q1 + 2.0f*q2*q3) - P[3][3]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)) - P[16][20]*(2.0f*q0*q3 - 2.0f*q1*q2) + P[18][20]*(2.0f*q0*q1 + 2.0f*q2*q3) + SH_MAG[2]*(P[20][0] + P[0][0]*SH_MAG[2] + P[1][0]*SH_MAG[1] + P[2][0]*SH_MAG[0] - P[17][0]*(SH_MAG[3] - SH_MAG[4] + SH_MAG[5] - SH_MAG[6]) - P[16][0]*(2.0f*q0*q3 - 2.0f*q1*q2) + P[18][0]*(2.0f*q0*q1 + 2.0f*q2*q3) - P[3][0]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)) + SH_MAG[1]*(P[20][1] + P[0][1]*SH_MAG[2] + P[1][1]*SH_MAG[1] + P[2][1]*SH_MAG[0] - P[17][1]*(SH_MAG[3] - SH_MAG[4] + SH_MAG[5] - SH_MAG[6]) - P[16][1]*(2.0f*q0*q3 - 2.0f*q1*q2) + P[18][1]*(2.0f*q0*q1 + 2.0f*q2*q3) - P[3][1]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)) + SH_MAG[0]*(P[20][2] + P[0][2]*SH_MAG[2] + P[1][2]*SH_MAG[1] + P[2][2]*SH_MAG[0] - P[17][2]*(SH_MAG[3] - SH_MAG[4] + SH_MAG[5] - SH_MAG[6]) - P[16][2]*(2.0f*q0*q3 - 2.0f*q1*q2) + P[18][2]*(2.0f*q0*q1 + 2.0f*q2*q3) - P[3][2]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)) - (SH_MAG[3] - SH_MAG[4] + SH_MAG[5] - SH_MAG[6])*(P[20][17] + P[0][17]*SH_MAG[2] + P[1][17]*SH_MAG[1] + P[2][17]*SH_MAG[0] - P[17][17]*(SH_MAG[3] - SH_MAG[4] + SH_MAG[5] - SH_MAG[6]) - P[16][17]*(2.0f*q0*q3 - 2.0f*q1*q2) + P[18][17]*(2.0f*q0*q1 + 2.0f*q2*q3) - P[3][17]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)) - P[3][20]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2));
+#endif
     if (varInnovMag[1] >= R_MAG) {
         faultStatus.bad_ymag = false;
     } else {
@@ -556,8 +609,10 @@ void NavEKF3_core::FuseMagnetometer()
         return;
     }
 
+#if !EK3_FEATURE_MAG_CACHED_JACOBIAN
     // Z axis
     varInnovMag[2] = (P[21][21] + R_MAG + P[0][21]*SH_MAG[1] - P[1][21]*SH_MAG[2] + P[3][21]*SH_MAG[0] + P[18][21]*(SH_MAG[3] - SH_MAG[4] - SH_MAG[5] + SH_MAG[6]) + (2.0f*q0*q2 + 2.0f*q1*q3)*(P[21][16] + P[0][16]*SH_MAG[1] - P[1][16]*SH_MAG[2] + P[3][16]*SH_MAG[0] + P[18][16]*(SH_MAG[3] - SH_MAG[4] - SH_MAG[5] + SH_MAG[6]) + P[16][16]*(2.0f*q0*q2 + 2.0f*q1*q3) - P[17][16]*(2.0f*q0*q1 - 2.0f*q2*q3) + P[2][16]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)) - (2.0f*q0*q1 - 2.0f*q2*q3)*(P[21][17] + P[0][17]*SH_MAG[1] - P[1][17]*SH_MAG[2] + P[3][17]*SH_MAG[0] + P[18][17]*(SH_MAG[3] - SH_MAG[4] - SH_MAG[5] + SH_MAG[6]) + P[16][17]*(2.0f*q0*q2 + 2.0f*q1*q3) - P[17][17]*(2.0f*q0*q1 - 2.0f*q2*q3) + P[2][17]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)) + (SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)*(P[21][2] + P[0][2]*SH_MAG[1] - P[1][2]*SH_MAG[2] + P[3][2]*SH_MAG[0] + P[18][2]*(SH_MAG[3] - SH_MAG[4] - SH_MAG[5] + SH_MAG[6]) + P[16][2]*(2.0f*q0*q2 + 2.0f*q1*q3) - P[17][2]*(2.0f*q0*q1 - 2.0f*q2*q3) + P[2][2]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)) + P[16][21]*(2.0f*q0*q2 + 2.0f*q1*q3) - P[17][21]*(2.0f*q0*q1 - 2.0f*q2*q3) + SH_MAG[1]*(P[21][0] + P[0][0]*SH_MAG[1] - P[1][0]*SH_MAG[2] + P[3][0]*SH_MAG[0] + P[18][0]*(SH_MAG[3] - SH_MAG[4] - SH_MAG[5] + SH_MAG[6]) + P[16][0]*(2.0f*q0*q2 + 2.0f*q1*q3) - P[17][0]*(2.0f*q0*q1 - 2.0f*q2*q3) + P[2][0]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)) - SH_MAG[2]*(P[21][1] + P[0][1]*SH_MAG[1] - P[1][1]*SH_MAG[2] + P[3][1]*SH_MAG[0] + P[18][1]*(SH_MAG[3] - SH_MAG[4] - SH_MAG[5] + SH_MAG[6]) + P[16][1]*(2.0f*q0*q2 + 2.0f*q1*q3) - P[17][1]*(2.0f*q0*q1 - 2.0f*q2*q3) + P[2][1]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)) + SH_MAG[0]*(P[21][3] + P[0][3]*SH_MAG[1] - P[1][3]*SH_MAG[2] + P[3][3]*SH_MAG[0] + P[18][3]*(SH_MAG[3] - SH_MAG[4] - SH_MAG[5] + SH_MAG[6]) + P[16][3]*(2.0f*q0*q2 + 2.0f*q1*q3) - P[17][3]*(2.0f*q0*q1 - 2.0f*q2*q3) + P[2][3]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)) + (SH_MAG[3] - SH_MAG[4] - SH_MAG[5] + SH_MAG[6])*(P[21][18] + P[0][18]*SH_MAG[1] - P[1][18]*SH_MAG[2] + P[3][18]*SH_MAG[0] + P[18][18]*(SH_MAG[3] - SH_MAG[4] - SH_MAG[5] + SH_MAG[6]) + P[16][18]*(2.0f*q0*q2 + 2.0f*q1*q3) - P[17][18]*(2.0f*q0*q1 - 2.0f*q2*q3) + P[2][18]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2)) + P[2][21]*(SH_MAG[7] + SH_MAG[8] - 2.0f*magD*q2));
+#endif
     if (varInnovMag[2] >= R_MAG) {
         faultStatus.bad_zmag = false;
     } else {
@@ -601,6 +656,7 @@ void NavEKF3_core::FuseMagnetometer()
             H_MAG[21] = 0.0f;
             H_MAG_unit_index = 19;
 
+#if !EK3_FEATURE_MAG_CACHED_JACOBIAN
             // calculate Kalman gain
             const Vector5 SK_MX {
                 1.0f / varInnovMag[0],
@@ -609,6 +665,7 @@ void NavEKF3_core::FuseMagnetometer()
                 2.0f*q0*q2 - 2.0f*q1*q3,
                 2.0f*q0*q3 + 2.0f*q1*q2
             };
+#endif
 
             uint32_t kalman_mask = (1<<10)-1; // values to calculate in Kfusion (others are set to zero)
 
@@ -638,7 +695,11 @@ void NavEKF3_core::FuseMagnetometer()
             for (auto i=0; i<24; i++) {
                 ftype res = 0;
                 if (kalman_mask & (1<<i)) {
+#if EK3_FEATURE_MAG_CACHED_JACOBIAN
+                    res = PHt[0][i] / varInnovMag[0];
+#else
                     res = SK_MX[0]*(P[i][19] + P[i][1]*SH_MAG[0] - P[i][2]*SH_MAG[1] + P[i][3]*SH_MAG[2] + P[i][0]*SK_MX[2] - P[i][16]*SK_MX[1] + P[i][17]*SK_MX[4] - P[i][18]*SK_MX[3]);
+#endif
                 }
                 Kfusion[i] = res;
             }
@@ -662,6 +723,7 @@ void NavEKF3_core::FuseMagnetometer()
             H_MAG[21] = 0.0f;
             H_MAG_unit_index = 20;
 
+#if !EK3_FEATURE_MAG_CACHED_JACOBIAN
             // calculate Kalman gain
             const Vector5 SK_MY {
                 1.0f / varInnovMag[1],
@@ -670,6 +732,7 @@ void NavEKF3_core::FuseMagnetometer()
                 2.0f*q0*q3 - 2.0f*q1*q2,
                 2.0f*q0*q1 + 2.0f*q2*q3
             };
+#endif
 
             uint32_t kalman_mask = (1<<10)-1; // values to calculate in Kfusion (others are set to zero)
 
@@ -699,7 +762,11 @@ void NavEKF3_core::FuseMagnetometer()
             for (auto i=0; i<24; i++) {
                 ftype res = 0;
                 if (kalman_mask & (1<<i)) {
+#if EK3_FEATURE_MAG_CACHED_JACOBIAN
+                    res = PHt[1][i] / varInnovMag[1];
+#else
                     res = SK_MY[0]*(P[i][20] + P[i][0]*SH_MAG[2] + P[i][1]*SH_MAG[1] + P[i][2]*SH_MAG[0] - P[i][3]*SK_MY[2] - P[i][17]*SK_MY[1] - P[i][16]*SK_MY[3] + P[i][18]*SK_MY[4]);
+#endif
                 }
                 Kfusion[i] = res;
             }
@@ -724,6 +791,7 @@ void NavEKF3_core::FuseMagnetometer()
             H_MAG[21] = 1.0f;
             H_MAG_unit_index = 21;
 
+#if !EK3_FEATURE_MAG_CACHED_JACOBIAN
             // calculate Kalman gain
             const Vector5 SK_MZ {
                 1.0f / varInnovMag[2],
@@ -732,6 +800,7 @@ void NavEKF3_core::FuseMagnetometer()
                 2.0f*q0*q1 - 2.0f*q2*q3,
                 2.0f*q0*q2 + 2.0f*q1*q3
             };
+#endif
 
             uint32_t kalman_mask = (1<<10)-1; // values to calculate in Kfusion (others are set to zero)
 
@@ -761,7 +830,11 @@ void NavEKF3_core::FuseMagnetometer()
             for (auto i=0; i<24; i++) {
                 ftype res = 0;
                 if (kalman_mask & (1<<i)) {
+#if EK3_FEATURE_MAG_CACHED_JACOBIAN
+                    res = PHt[2][i] / varInnovMag[2];
+#else
                     res = SK_MZ[0]*(P[i][21] + P[i][0]*SH_MAG[1] - P[i][1]*SH_MAG[2] + P[i][3]*SH_MAG[0] + P[i][2]*SK_MZ[2] + P[i][18]*SK_MZ[1] + P[i][16]*SK_MZ[4] - P[i][17]*SK_MZ[3]);
+#endif
                 }
                 Kfusion[i] = res;
             }
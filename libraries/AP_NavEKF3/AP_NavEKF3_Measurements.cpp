@@ -1307,6 +1307,11 @@ void NavEKF3_core::learnInactiveBiases(void)
 #else
     const auto &ins = dal.ins();
 
+    // the corrected rates on the active IMU are common to all of the
+    // inactive IMU comparisons, so calculate them once outside the loops
+    const Vector3F filtered_gyro_active = ins.get_gyro(gyro_index_active).toftype() - (stateStruct.gyro_bias/dtEkfAvg);
+    const Vector3F filtered_accel_active = ins.get_accel(accel_index_active).toftype() - (stateStruct.accel_bias/dtEkfAvg);
+
     // learn gyro biases
     for (uint8_t i=0; i<INS_MAX_INSTANCES; i++) {
         if (!ins.use_gyro(i)) {
@@ -1320,7 +1325,6 @@ void NavEKF3_core::learnInactiveBiases(void)
             // get filtered gyro and use the difference between the
             // corrected gyro on the active IMU and the inactive IMU
             // to move the inactive bias towards the right value
-            Vector3F filtered_gyro_active = ins.get_gyro(gyro_index_active).toftype() - (stateStruct.gyro_bias/dtEkfAvg);
             Vector3F filtered_gyro_inactive = ins.get_gyro(i).toftype() - (inactiveBias[i].gyro_bias/dtEkfAvg);
             Vector3F error = filtered_gyro_active - filtered_gyro_inactive;
 
@@ -1349,7 +1353,6 @@ void NavEKF3_core::learnInactiveBiases(void)
             // get filtered accel and use the difference between the
             // corrected accel on the active IMU and the inactive IMU
             // to move the inactive bias towards the right value
-            Vector3F filtered_accel_active = ins.get_accel(accel_index_active).toftype() - (stateStruct.accel_bias/dtEkfAvg);
             Vector3F filtered_accel_inactive = ins.get_accel(i).toftype() - (inactiveBias[i].accel_bias/dtEkfAvg);
             Vector3F error = filtered_accel_active - filtered_accel_inactive;
 
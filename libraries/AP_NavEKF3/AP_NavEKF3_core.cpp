@@ -7,6 +7,10 @@
 #include <AP_Logger/AP_Logger.h>
 #include <AP_DAL/AP_DAL.h>
 
+#if EK3_FEATURE_FUSION_TIMING
+#include <AP_Common/ExpandingString.h>
+#endif
+
 // constructor
 NavEKF3_core::NavEKF3_core(NavEKF3 *_frontend, AP_DAL &_dal) :
     dal(_dal),
@@ -666,7 +670,13 @@ void NavEKF3_core::UpdateFilter(bool predict)
         UpdateStrapdownEquationsNED();
 
         // Predict the covariance growth
+#if EK3_FEATURE_FUSION_TIMING
+        uint32_t stage_start_us = AP_HAL::micros();
+#endif
         CovariancePrediction(nullptr);
+#if EK3_FEATURE_FUSION_TIMING
+        recordFusionTiming(fusionTiming.covPredict, stage_start_us);
+#endif
 
         // Run the IMU prediction step for the GSF yaw estimator algorithm
         // using IMU and optionally true airspeed data.
@@ -674,10 +684,22 @@ void NavEKF3_core::UpdateFilter(bool predict)
         runYawEstimatorPrediction();
 
         // Update states using  magnetometer or external yaw sensor data
+#if EK3_FEATURE_FUSION_TIMING
+        stage_start_us = AP_HAL::micros();
+#endif
         SelectMagFusion();
+#if EK3_FEATURE_FUSION_TIMING
+        recordFusionTiming(fusionTiming.magFuse, stage_start_us);
+#endif
 
         // Update states using GPS and altimeter data
+#if EK3_FEATURE_FUSION_TIMING
+        stage_start_us = AP_HAL::micros();
+#endif
         SelectVelPosFusion();
+#if EK3_FEATURE_FUSION_TIMING
+        recordFusionTiming(fusionTiming.velPosFuse, stage_start_us);
+#endif
 
         // Run the GPS velocity correction step for the GSF yaw estimator algorithm
         // and use the yaw estimate to reset the main EKF yaw if requested
@@ -1016,6 +1038,49 @@ void NavEKF3_core::calcOutputStates()
     }
 }
 
+#if EK3_FEATURE_FUSION_TIMING
+// add a sample for a fusion stage that started at start_us
+void NavEKF3_core::recordFusionTiming(FusionTimingStage &stage, uint32_t start_us)
+{
+    const uint32_t dt_us = AP_HAL::micros() - start_us;
+    stage.count++;
+    stage.total_us += dt_us;
+    if (dt_us > stage.max_us) {
+        stage.max_us = dt_us;
+    }
+}
+
+// average stage time in microseconds since the prev snapshot
+float NavEKF3_core::fusionTimingAvg(const FusionTimingStage &now, const FusionTimingStage &prev) const
+{
+    const uint32_t n = now.count - prev.count;
+    if (n == 0) {
+        return 0.0f;
+    }
+    return float(now.total_us - prev.total_us) / float(n);
+}
+
+// append a per-fusion-step timing report for this core to str
+void NavEKF3_core::fusion_timing_info(ExpandingString &str) const
+{
+    const struct {
+        const char *name;
+        const FusionTimingStage &stage;
+    } stages[] {
+        { "CovariancePrediction", fusionTiming.covPredict },
+        { "SelectMagFusion",      fusionTiming.magFuse },
+        { "SelectVelPosFusion",   fusionTiming.velPosFuse },
+    };
+    for (const auto &s : stages) {
+        const uint32_t avg_us = s.stage.count > 0 ? s.stage.total_us / s.stage.count : 0;
+        str.printf("EKF3[%u] %-21s n=%10lu avg=%4luus max=%4luus\n",
+                   unsigned(core_index), s.name,
+                   (unsigned long)s.stage.count, (unsigned long)avg_us,
+                   (unsigned long)s.stage.max_us);
+    }
+}
+#endif // EK3_FEATURE_FUSION_TIMING
+
 /*
  * Calculate the predicted state covariance matrix using algebraic equations generated using SymPy
  * See derivation/generate_1.py for derivation
@@ -1101,6 +1166,20 @@ void NavEKF3_core::CovariancePrediction(Vector3F *rotVarVecPtr)
         FuseDeclination(radians(20.0f));
     }
 
+#if EK3_FEATURE_SPARSE_COV_BLOCKS
+    // when the magnetometer states are inhibited but the wind states are still
+    // active, rows/columns 16..21 of P form a structurally zero block that
+    // fusion does not touch, so the prediction arithmetic for that band can be
+    // skipped. Zero the band on the inhibit transition; ConstrainVariances()
+    // keeps it zeroed on subsequent cycles.
+    const bool skipMagBand = inhibitMagStates && (stateIndexLim > 15);
+    if (skipMagBand && !lastInhibitMagStates) {
+        zeroStatesVarCov(16, 21);
+    }
+#else
+    const bool skipMagBand = false;
+#endif
+
     if (!inhibitMagStates) {
         ftype magEarthVar = sq(dt * constrain_ftype(frontend->_magEarthProcessNoise, 0.0f, 1.0f));
         ftype magBodyVar  = sq(dt * constrain_ftype(frontend->_magBodyProcessNoise, 0.0f, 1.0f));
@@ -1589,7 +1668,48 @@ void NavEKF3_core::CovariancePrediction(Vector3F *rotVarVecPtr)
             nextP[14][15] = P[14][15];
             nextP[15][15] = P[15][15];
 
+#if EK3_FEATURE_SIMD_COV_PREDICTION
             if (stateIndexLim > 15) {
+                // the earth field, body field and wind states (columns 16..23) are
+                // unchanged by the state transition, so each of rows 0..9 of nextP
+                // is the same linear combination of P rows for every column.
+                // Accumulating row by row keeps the inner loops unit-stride so the
+                // compiler can vectorise them across columns
+                ftype C[10][16] {};
+                C[0][0] = 1;      C[0][1] = -PS11;  C[0][2] = -PS12;  C[0][3] = -PS13;  C[0][10] = PS6;    C[0][11] = PS7;    C[0][12] = PS9;
+                C[1][0] = PS11;   C[1][1] = 1;      C[1][2] = PS13;   C[1][3] = -PS12;  C[1][10] = -PS34;  C[1][11] = PS9;    C[1][12] = -PS7;
+                C[2][0] = PS12;   C[2][1] = -PS13;  C[2][2] = 1;      C[2][3] = PS11;   C[2][10] = -PS9;   C[2][11] = -PS34;  C[2][12] = PS6;
+                C[3][0] = PS13;   C[3][1] = PS12;   C[3][2] = -PS11;  C[3][3] = 1;      C[3][10] = PS7;    C[3][11] = -PS6;   C[3][12] = -PS34;
+                C[4][0] = PS174;  C[4][1] = PS173;  C[4][2] = PS175;  C[4][3] = -PS176; C[4][4] = 1;       C[4][13] = PS43;   C[4][14] = PS172;  C[4][15] = -PS171;
+                C[5][0] = -PS202; C[5][1] = -PS204; C[5][2] = PS201;  C[5][3] = PS203;  C[5][5] = 1;       C[5][13] = -PS193; C[5][14] = PS75;   C[5][15] = PS190;
+                C[6][0] = PS216;  C[6][1] = PS217;  C[6][2] = -PS214; C[6][3] = PS215;  C[6][6] = 1;       C[6][13] = PS199;  C[6][14] = -PS197; C[6][15] = PS87;
+                C[7][4] = dt;     C[7][7] = 1;
+                C[8][5] = dt;     C[8][8] = 1;
+                C[9][6] = dt;     C[9][9] = 1;
+                const uint8_t jFirst = skipMagBand ? 22 : 16;
+                for (uint8_t r=0; r<10; r++) {
+                    for (uint8_t j=jFirst; j<=stateIndexLim; j++) {
+                        nextP[r][j] = 0;
+                    }
+                    for (uint8_t k=0; k<16; k++) {
+                        const ftype c = C[r][k];
+                        if (is_zero(c)) {
+                            continue;
+                        }
+                        for (uint8_t j=jFirst; j<=stateIndexLim; j++) {
+                            nextP[r][j] += c * P[k][j];
+                        }
+                    }
+                }
+                // rows 10 onwards pass through unchanged
+                for (uint8_t i=10; i<=stateIndexLim; i++) {
+                    for (uint8_t j=(i<jFirst)?jFirst:i; j<=stateIndexLim; j++) {
+                        nextP[i][j] = P[i][j];
+                    }
+                }
+            }
+#else
+            if ((stateIndexLim > 15) && !skipMagBand) {
                 nextP[0][16] = -PS11*P[1][16] - PS12*P[2][16] - PS13*P[3][16] + PS6*P[10][16] + PS7*P[11][16] + PS9*P[12][16] + P[0][16];
                 nextP[1][16] = PS11*P[0][16] - PS12*P[3][16] + PS13*P[2][16] - PS34*P[10][16] - PS7*P[12][16] + PS9*P[11][16] + P[1][16];
                 nextP[2][16] = PS11*P[3][16] + PS12*P[0][16] - PS13*P[1][16] - PS34*P[11][16] + PS6*P[12][16] - PS9*P[10][16] + P[2][16];
@@ -1707,63 +1827,67 @@ void NavEKF3_core::CovariancePrediction(Vector3F *rotVarVecPtr)
                 nextP[19][21] = P[19][21];
                 nextP[20][21] = P[20][21];
                 nextP[21][21] = P[21][21];
+            }
 
-                if (stateIndexLim > 21) {
-                    nextP[0][22] = -PS11*P[1][22] - PS12*P[2][22] - PS13*P[3][22] + PS6*P[10][22] + PS7*P[11][22] + PS9*P[12][22] + P[0][22];
-                    nextP[1][22] = PS11*P[0][22] - PS12*P[3][22] + PS13*P[2][22] - PS34*P[10][22] - PS7*P[12][22] + PS9*P[11][22] + P[1][22];
-                    nextP[2][22] = PS11*P[3][22] + PS12*P[0][22] - PS13*P[1][22] - PS34*P[11][22] + PS6*P[12][22] - PS9*P[10][22] + P[2][22];
-                    nextP[3][22] = -PS11*P[2][22] + PS12*P[1][22] + PS13*P[0][22] - PS34*P[12][22] - PS6*P[11][22] + PS7*P[10][22] + P[3][22];
-                    nextP[4][22] = -PS171*P[15][22] + PS172*P[14][22] + PS173*P[1][22] + PS174*P[0][22] + PS175*P[2][22] - PS176*P[3][22] + PS43*P[13][22] + P[4][22];
-                    nextP[5][22] = PS190*P[15][22] - PS193*P[13][22] + PS201*P[2][22] - PS202*P[0][22] + PS203*P[3][22] - PS204*P[1][22] + PS75*P[14][22] + P[5][22];
-                    nextP[6][22] = -PS197*P[14][22] + PS199*P[13][22] - PS214*P[2][22] + PS215*P[3][22] + PS216*P[0][22] + PS217*P[1][22] + PS87*P[15][22] + P[6][22];
-                    nextP[7][22] = P[4][22]*dt + P[7][22];
-                    nextP[8][22] = P[5][22]*dt + P[8][22];
-                    nextP[9][22] = P[6][22]*dt + P[9][22];
-                    nextP[10][22] = P[10][22];
-                    nextP[11][22] = P[11][22];
-                    nextP[12][22] = P[12][22];
-                    nextP[13][22] = P[13][22];
-                    nextP[14][22] = P[14][22];
-                    nextP[15][22] = P[15][22];
-                    nextP[16][22] = P[16][22];
-                    nextP[17][22] = P[17][22];
-                    nextP[18][22] = P[18][22];
-                    nextP[19][22] = P[19][22];
-                    nextP[20][22] = P[20][22];
-                    nextP[21][22] = P[21][22];
-                    nextP[22][22] = P[22][22];
-                    nextP[0][23] = -PS11*P[1][23] - PS12*P[2][23] - PS13*P[3][23] + PS6*P[10][23] + PS7*P[11][23] + PS9*P[12][23] + P[0][23];
-                    nextP[1][23] = PS11*P[0][23] - PS12*P[3][23] + PS13*P[2][23] - PS34*P[10][23] - PS7*P[12][23] + PS9*P[11][23] + P[1][23];
-                    nextP[2][23] = PS11*P[3][23] + PS12*P[0][23] - PS13*P[1][23] - PS34*P[11][23] + PS6*P[12][23] - PS9*P[10][23] + P[2][23];
-                    nextP[3][23] = -PS11*P[2][23] + PS12*P[1][23] + PS13*P[0][23] - PS34*P[12][23] - PS6*P[11][23] + PS7*P[10][23] + P[3][23];
-                    nextP[4][23] = -PS171*P[15][23] + PS172*P[14][23] + PS173*P[1][23] + PS174*P[0][23] + PS175*P[2][23] - PS176*P[3][23] + PS43*P[13][23] + P[4][23];
-                    nextP[5][23] = PS190*P[15][23] - PS193*P[13][23] + PS201*P[2][23] - PS202*P[0][23] + PS203*P[3][23] - PS204*P[1][23] + PS75*P[14][23] + P[5][23];
-                    nextP[6][23] = -PS197*P[14][23] + PS199*P[13][23] - PS214*P[2][23] + PS215*P[3][23] + PS216*P[0][23] + PS217*P[1][23] + PS87*P[15][23] + P[6][23];
-                    nextP[7][23] = P[4][23]*dt + P[7][23];
-                    nextP[8][23] = P[5][23]*dt + P[8][23];
-                    nextP[9][23] = P[6][23]*dt + P[9][23];
-                    nextP[10][23] = P[10][23];
-                    nextP[11][23] = P[11][23];
-                    nextP[12][23] = P[12][23];
-                    nextP[13][23] = P[13][23];
-                    nextP[14][23] = P[14][23];
-                    nextP[15][23] = P[15][23];
-                    nextP[16][23] = P[16][23];
-                    nextP[17][23] = P[17][23];
-                    nextP[18][23] = P[18][23];
-                    nextP[19][23] = P[19][23];
-                    nextP[20][23] = P[20][23];
-                    nextP[21][23] = P[21][23];
-                    nextP[22][23] = P[22][23];
-                    nextP[23][23] = P[23][23];
-                }
+            if (stateIndexLim > 21) {
+                nextP[0][22] = -PS11*P[1][22] - PS12*P[2][22] - PS13*P[3][22] + PS6*P[10][22] + PS7*P[11][22] + PS9*P[12][22] + P[0][22];
+                nextP[1][22] = PS11*P[0][22] - PS12*P[3][22] + PS13*P[2][22] - PS34*P[10][22] - PS7*P[12][22] + PS9*P[11][22] + P[1][22];
+                nextP[2][22] = PS11*P[3][22] + PS12*P[0][22] - PS13*P[1][22] - PS34*P[11][22] + PS6*P[12][22] - PS9*P[10][22] + P[2][22];
+                nextP[3][22] = -PS11*P[2][22] + PS12*P[1][22] + PS13*P[0][22] - PS34*P[12][22] - PS6*P[11][22] + PS7*P[10][22] + P[3][22];
+                nextP[4][22] = -PS171*P[15][22] + PS172*P[14][22] + PS173*P[1][22] + PS174*P[0][22] + PS175*P[2][22] - PS176*P[3][22] + PS43*P[13][22] + P[4][22];
+                nextP[5][22] = PS190*P[15][22] - PS193*P[13][22] + PS201*P[2][22] - PS202*P[0][22] + PS203*P[3][22] - PS204*P[1][22] + PS75*P[14][22] + P[5][22];
+                nextP[6][22] = -PS197*P[14][22] + PS199*P[13][22] - PS214*P[2][22] + PS215*P[3][22] + PS216*P[0][22] + PS217*P[1][22] + PS87*P[15][22] + P[6][22];
+                nextP[7][22] = P[4][22]*dt + P[7][22];
+                nextP[8][22] = P[5][22]*dt + P[8][22];
+                nextP[9][22] = P[6][22]*dt + P[9][22];
+                nextP[10][22] = P[10][22];
+                nextP[11][22] = P[11][22];
+                nextP[12][22] = P[12][22];
+                nextP[13][22] = P[13][22];
+                nextP[14][22] = P[14][22];
+                nextP[15][22] = P[15][22];
+                nextP[16][22] = P[16][22];
+                nextP[17][22] = P[17][22];
+                nextP[18][22] = P[18][22];
+                nextP[19][22] = P[19][22];
+                nextP[20][22] = P[20][22];
+                nextP[21][22] = P[21][22];
+                nextP[22][22] = P[22][22];
+                nextP[0][23] = -PS11*P[1][23] - PS12*P[2][23] - PS13*P[3][23] + PS6*P[10][23] + PS7*P[11][23] + PS9*P[12][23] + P[0][23];
+                nextP[1][23] = PS11*P[0][23] - PS12*P[3][23] + PS13*P[2][23] - PS34*P[10][23] - PS7*P[12][23] + PS9*P[11][23] + P[1][23];
+                nextP[2][23] = PS11*P[3][23] + PS12*P[0][23] - PS13*P[1][23] - PS34*P[11][23] + PS6*P[12][23] - PS9*P[10][23] + P[2][23];
+                nextP[3][23] = -PS11*P[2][23] + PS12*P[1][23] + PS13*P[0][23] - PS34*P[12][23] - PS6*P[11][23] + PS7*P[10][23] + P[3][23];
+                nextP[4][23] = -PS171*P[15][23] + PS172*P[14][23] + PS173*P[1][23] + PS174*P[0][23] + PS175*P[2][23] - PS176*P[3][23] + PS43*P[13][23] + P[4][23];
+                nextP[5][23] = PS190*P[15][23] - PS193*P[13][23] + PS201*P[2][23] - PS202*P[0][23] + PS203*P[3][23] - PS204*P[1][23] + PS75*P[14][23] + P[5][23];
+                nextP[6][23] = -PS197*P[14][23] + PS199*P[13][23] - PS214*P[2][23] + PS215*P[3][23] + PS216*P[0][23] + PS217*P[1][23] + PS87*P[15][23] + P[6][23];
+                nextP[7][23] = P[4][23]*dt + P[7][23];
+                nextP[8][23] = P[5][23]*dt + P[8][23];
+                nextP[9][23] = P[6][23]*dt + P[9][23];
+                nextP[10][23] = P[10][23];
+                nextP[11][23] = P[11][23];
+                nextP[12][23] = P[12][23];
+                nextP[13][23] = P[13][23];
+                nextP[14][23] = P[14][23];
+                nextP[15][23] = P[15][23];
+                nextP[16][23] = P[16][23];
+                nextP[17][23] = P[17][23];
+                nextP[18][23] = P[18][23];
+                nextP[19][23] = P[19][23];
+                nextP[20][23] = P[20][23];
+                nextP[21][23] = P[21][23];
+                nextP[22][23] = P[22][23];
+                nextP[23][23] = P[23][23];
             }
+#endif // EK3_FEATURE_SIMD_COV_PREDICTION
         }
     }
 
     // add the general state process noise variances
     if (stateIndexLim > 9) {
         for (uint8_t i=10; i<=stateIndexLim; i++) {
+            if (skipMagBand && i >= 16 && i <= 21) {
+                continue;
+            }
             nextP[i][i] = nextP[i][i] + processNoiseVariance[i-10];
         }
     }
@@ -1786,6 +1910,11 @@ void NavEKF3_core::CovariancePrediction(Vector3F *rotVarVecPtr)
     // covariance matrix is symmetrical, so copy diagonals and copy lower half in nextP
     // to lower and upper half in P
     for (uint8_t row = 0; row <= stateIndexLim; row++) {
+        if (skipMagBand && row >= 16 && row <= 21) {
+            // the inhibited magnetometer block was not predicted and is
+            // structurally zero, so leave it untouched
+            continue;
+        }
         // copy diagonals
         P[row][row] = nextP[row][row];
         // copy off diagonals
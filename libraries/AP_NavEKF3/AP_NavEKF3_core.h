@@ -121,6 +121,10 @@
 // maximum GPs ground course uncertainty allowed for yaw alignment (deg)
 #define GPS_VEL_YAW_ALIGN_MAX_ANG_ERR 15.0F
 
+#if EK3_FEATURE_FUSION_TIMING
+class ExpandingString;
+#endif
+
 class NavEKF3_core : public NavEKF_core_common
 {
 public:
@@ -474,6 +478,11 @@ public:
 
     void Log_Write(uint64_t time_us);
 
+#if EK3_FEATURE_FUSION_TIMING
+    // append a per-fusion-step timing report for this core to str
+    void fusion_timing_info(ExpandingString &str) const;
+#endif
+
     // returns true when the state estimates are significantly degraded by vibration
     bool isVibrationAffected() const { return badIMUdata; }
 
@@ -1598,6 +1607,34 @@ private:
     // timing statistics
     struct ekf_timing timing;
 
+#if EK3_FEATURE_FUSION_TIMING
+    // per-fusion-step timing. count and total_us accumulate from boot;
+    // max_us covers the window since the last XKT2 write. Written only
+    // by the EKF update thread; the @SYS report reads cross-thread with
+    // plain aligned 32-bit loads so no locking is needed
+    struct FusionTimingStage {
+        uint32_t count;
+        uint32_t total_us;
+        uint32_t max_us;
+    };
+    struct FusionTiming {
+        FusionTimingStage covPredict;
+        FusionTimingStage magFuse;
+        FusionTimingStage velPosFuse;
+    } fusionTiming;
+
+    // snapshot taken at the last XKT2 write, used for interval averages
+    struct FusionTiming lastFusionTiming;
+
+    // add a sample for a fusion stage that started at start_us
+    void recordFusionTiming(FusionTimingStage &stage, uint32_t start_us);
+
+    // average stage time in microseconds since the prev snapshot
+    float fusionTimingAvg(const FusionTimingStage &now, const FusionTimingStage &prev) const;
+
+    void Log_Write_FusionTiming(uint64_t time_us);
+#endif
+
     // when was attitude filter status last non-zero?
     uint32_t last_filter_ok_ms;
     
@@ -1642,6 +1679,9 @@ private:
     uint32_t lastUpdateTime_ms;
     uint32_t lastEkfStateVarLogTime_ms;
     uint32_t lastTimingLogTime_ms;
+#if EK3_FEATURE_FUSION_TIMING
+    uint32_t lastFusionTimingLogTime_ms;
+#endif
 
     // bits in EK3_AFFINITY
     enum ekf_affinity {
@@ -56,3 +56,61 @@
 #ifndef EK3_FEATURE_OPTFLOW_AGL_KF
 #define EK3_FEATURE_OPTFLOW_AGL_KF EK3_FEATURE_OPTFLOW_FUSION
 #endif
+
+// vectorisable covariance prediction for the magnetometer and wind columns
+// of the P matrix. These columns are not rotated by the error propagation so
+// they can be written as column loops the compiler auto-vectorises (NEON on
+// H7/F7, SSE on SITL) instead of the generated per-element expressions. The
+// result is the same sum evaluated in a different order, so this is opt-in
+// from hwdef (define EK3_FEATURE_SIMD_COV_PREDICTION 1) and the scalar
+// generated code remains the default for M4 and Replay bit-compare use.
+#ifndef EK3_FEATURE_SIMD_COV_PREDICTION
+#define EK3_FEATURE_SIMD_COV_PREDICTION 0
+#endif
+
+// skip covariance prediction arithmetic on the magnetometer state band
+// (rows/columns 16..21) while those states are inhibited but the wind states
+// remain active, e.g. fixed wing with compass learning denied. The band is
+// zeroed while inhibited and untouched by fusion, so the skipped block is
+// structurally zero and the filter output is unchanged. Opt-in from hwdef
+// for CPU-tight boards (define EK3_FEATURE_SPARSE_COV_BLOCKS 1)
+#ifndef EK3_FEATURE_SPARSE_COV_BLOCKS
+#define EK3_FEATURE_SPARSE_COV_BLOCKS 0
+#endif
+
+// cached-Jacobian magnetometer fusion. Computes P*H' for all three axes once
+// per fusion cycle and reuses it for the innovation variances and Kalman
+// gains instead of re-expanding the generated expressions per axis. The Y and
+// Z axis gains then see a covariance that is stale by one or two sequential
+// axis updates, refreshed every cycle, so this is opt-in from hwdef for
+// boards where mag fusion spikes push the loop over budget
+// (define EK3_FEATURE_MAG_CACHED_JACOBIAN 1)
+#ifndef EK3_FEATURE_MAG_CACHED_JACOBIAN
+#define EK3_FEATURE_MAG_CACHED_JACOBIAN 0
+#endif
+
+// allocate all EKF3 ring buffers for all lanes from one contiguous
+// block pre-reserved in fast memory at filter init, with a boot report
+// of usage, instead of individual heap allocations. Lets buffer depth
+// be tuned against DTCM deterministically and avoids fragmentation
+// when cores are set up at arm time. Opt-in from hwdef
+// (define EK3_FEATURE_BUFFER_ARENA 1); the block size can be tuned
+// with EK3_BUFFER_ARENA_SIZE
+#ifndef EK3_FEATURE_BUFFER_ARENA
+#define EK3_FEATURE_BUFFER_ARENA 0
+#endif
+
+// size in bytes of the pre-reserved ring buffer block, shared by all lanes
+#ifndef EK3_BUFFER_ARENA_SIZE
+#define EK3_BUFFER_ARENA_SIZE 16384
+#endif
+
+// per-fusion-step timing instrumentation. Times the covariance
+// prediction, magnetometer fusion and velocity/position fusion stages
+// each update so loop deadline misses can be attributed to a specific
+// fusion stage, logged as XKT2 and readable via @SYS/ekf3_timing.txt.
+// Adds two timer reads per stage per update, so opt-in from hwdef
+// (define EK3_FEATURE_FUSION_TIMING 1)
+#ifndef EK3_FEATURE_FUSION_TIMING
+#define EK3_FEATURE_FUSION_TIMING 0
+#endif
@@ -15,6 +15,7 @@
     LOG_XKFS_MSG, \
     LOG_XKQ_MSG,  \
     LOG_XKT_MSG,  \
+    LOG_XKT2_MSG, \
     LOG_XKTV_MSG, \
     LOG_XKV1_MSG, \
     LOG_XKV2_MSG, \
@@ -319,6 +320,33 @@ struct PACKED log_XKT {
     float delVelDT_max;
 };
 
+// @LoggerMessage: XKT2
+// @Description: EKF3 per-fusion-step timing, only written when EK3_FEATURE_FUSION_TIMING is enabled
+// @Field: TimeUS: Time since system startup
+// @Field: C: EKF core this message instance applies to
+// @Field: CPN: covariance prediction steps since the last message
+// @Field: CPAvg: average covariance prediction time over the interval
+// @Field: CPMx: peak covariance prediction time over the interval
+// @Field: MN: magnetometer fusion steps since the last message
+// @Field: MAvg: average magnetometer fusion time over the interval
+// @Field: MMx: peak magnetometer fusion time over the interval
+// @Field: VPN: velocity/position fusion steps since the last message
+// @Field: VPAvg: average velocity/position fusion time over the interval
+// @Field: VPMx: peak velocity/position fusion time over the interval
+struct PACKED log_XKT2 {
+    LOG_PACKET_HEADER;
+    uint64_t time_us;
+    uint8_t core;
+    uint32_t covPredict_count;
+    float covPredict_avg;
+    float covPredict_max;
+    uint32_t magFuse_count;
+    float magFuse_avg;
+    float magFuse_max;
+    uint32_t velPosFuse_count;
+    float velPosFuse_avg;
+    float velPosFuse_max;
+};
 
 // @LoggerMessage: XKFM
 // @Description: EKF3 diagnostic data for on-ground-and-not-moving check
@@ -456,7 +484,7 @@ struct PACKED log_XKV {
     { LOG_XKF0_MSG, sizeof(log_XKF0), \
       "XKF0","QBBccCCcccccccc","TimeUS,C,ID,rng,innov,SIV,TR,BPN,BPE,BPD,OFH,OFL,OFN,OFE,OFD", "s#-m---mmmmmmmm", "F--B---BBBBBBBB" , true }, \
     { LOG_XKF1_MSG, sizeof(log_XKF1), \
-      "XKF1","QBccCfffffffccce","TimeUS,C,Roll,Pitch,Yaw,VN,VE,VD,dPD,PN,PE,PD,GX,GY,GZ,OH", "s#ddhnnnnmmmkkkm", "F-BBB0000000BBBB" , true }, \
+      "XKF1","QBccCfffffffccce","TimeUS,C,Roll,Pitch,Yaw,VN,VE,VD,dPD,PN,PE,PD,GX,GY,GZ,OH", "s#ddhnnnnmmmkkkm", "F-BBB0000000BBBB" , true, true }, \
     { LOG_XKF2_MSG, sizeof(log_XKF2), \
       "XKF2","QBccccchhhhhhfff","TimeUS,C,AX,AY,AZ,VWN,VWE,MN,ME,MD,MX,MY,MZ,IDX,IDY,IS", "s#---nnGGGGGGoor", "F----BBCCCCCC000" , true }, \
     { LOG_XKF3_MSG, sizeof(log_XKF3), \
@@ -476,6 +504,8 @@ struct PACKED log_XKV {
     { LOG_XKQ_MSG, sizeof(log_XKQ), "XKQ", "QBffff", "TimeUS,C,Q1,Q2,Q3,Q4", "s#????", "F-????" , true }, \
     { LOG_XKT_MSG, sizeof(log_XKT),   \
       "XKT", "QBIffffffff", "TimeUS,C,Cnt,IMUMin,IMUMax,EKFMin,EKFMax,AngMin,AngMax,VMin,VMax", "s#sssssssss", "F-000000000", true }, \
+    { LOG_XKT2_MSG, sizeof(log_XKT2),   \
+      "XKT2", "QBIffIffIff", "TimeUS,C,CPN,CPAvg,CPMx,MN,MAvg,MMx,VPN,VPAvg,VPMx", "s#-ss-ss-ss", "F--FF-FF-FF", true }, \
     { LOG_XKTV_MSG, sizeof(log_XKTV),                         \
       "XKTV", "QBff", "TimeUS,C,TVS,TVD", "s#rr", "F-00", true }, \
     { LOG_XKV1_MSG, sizeof(log_XKV), \
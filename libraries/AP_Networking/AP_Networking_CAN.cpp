@@ -155,9 +155,21 @@ void AP_Networking_CAN::mcast_server(void)
                 continue;
             }
 
-            struct mcast_pkt pkt;
-            const ssize_t ret = mcast_sockets[bus]->recv((void*)&pkt, sizeof(pkt), 0);
-            if (ret > (ssize_t)MCAST_HDR_LENGTH && (size_t)ret <= sizeof(pkt)) {
+            // receive several datagrams per pass, one kernel
+            // crossing on platforms with recvmmsg
+            struct mcast_pkt pkts[4];
+            SocketAPM::Pkt batch[ARRAY_SIZE(pkts)];
+            for (uint8_t i=0; i<ARRAY_SIZE(batch); i++) {
+                batch[i].data = (void*)&pkts[i];
+                batch[i].len = sizeof(pkts[i]);
+            }
+            const uint8_t num_pkts = mcast_sockets[bus]->recvm(batch, ARRAY_SIZE(batch), 0);
+            for (uint8_t i=0; i<num_pkts; i++) {
+                struct mcast_pkt &pkt = pkts[i];
+                const ssize_t ret = batch[i].len;
+                if (ret <= (ssize_t)MCAST_HDR_LENGTH || (size_t)ret > sizeof(pkt)) {
+                    continue;
+                }
                 const uint8_t data_len = ret - MCAST_HDR_LENGTH;
                 bool is_canfd = false;
 #if HAL_CANFD_SUPPORTED
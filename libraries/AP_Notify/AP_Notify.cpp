@@ -44,6 +44,10 @@
 #include "DShotLED.h"
 #include "ProfiLED_IOMCU.h"
 
+#if HAL_LOGGING_ENABLED
+#include <AP_Logger/AP_Logger.h>
+#endif
+
 extern const AP_HAL::HAL& hal;
 
 AP_Notify *AP_Notify::_singleton;
@@ -419,10 +423,49 @@ void AP_Notify::update(void)
 {
     for (uint8_t i = 0; i < _num_devices; i++) {
         if (_devices[i] != nullptr) {
+#if HAL_LOGGING_ENABLED
+            const uint32_t start_us = AP_HAL::micros();
+#endif
             _devices[i]->update();
+#if HAL_LOGGING_ENABLED
+            const uint32_t cost_us = AP_HAL::micros() - start_us;
+            _stats_total_us += cost_us;
+            if (cost_us > _stats_worst_us) {
+                _stats_worst_us = MIN(cost_us, 0xFFFFU);
+                _stats_worst_dev = i;
+            }
+#endif
         }
     }
 
+#if HAL_LOGGING_ENABLED
+    // log per-device update cost at 1Hz
+    const uint32_t now_ms = AP_HAL::millis();
+    if (now_ms - _stats_last_ms >= 1000) {
+        _stats_last_ms = now_ms;
+        AP_Logger *logger = AP_Logger::get_singleton();
+        if (logger != nullptr && logger->logging_started()) {
+// @LoggerMessage: NTFY
+// @Description: Notify device update cost
+// @Field: TimeUS: Time since system startup
+// @Field: Tot: total time spent in notify device updates over the last interval
+// @Field: Wrst: worst single device update over the last interval
+// @Field: WDev: device index of the worst update
+            logger->WriteStreaming("NTFY", "TimeUS,Tot,Wrst,WDev",
+                                   "sss#",
+                                   "FFF-",
+                                   "QIHB",
+                                   AP_HAL::micros64(),
+                                   _stats_total_us,
+                                   _stats_worst_us,
+                                   _stats_worst_dev);
+        }
+        _stats_total_us = 0;
+        _stats_worst_us = 0;
+        _stats_worst_dev = 0;
+    }
+#endif
+
     //reset the events
     memset(&AP_Notify::events, 0, sizeof(AP_Notify::events));
 }
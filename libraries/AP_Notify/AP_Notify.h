@@ -18,6 +18,7 @@
 
 #include <AP_Common/AP_Common.h>
 #include <AP_Param/AP_Param.h>
+#include <AP_Logger/AP_Logger_config.h>
 #include "AP_Notify_config.h"
 #include <AP_IOMCU/AP_IOMCU.h>
 
@@ -260,6 +261,14 @@ private:
 
     static NotifyDevice* _devices[];
     static uint8_t _num_devices;
+
+#if HAL_LOGGING_ENABLED
+    // per-device update cost statistics, logged as NTFY at 1Hz
+    uint32_t _stats_last_ms;
+    uint32_t _stats_total_us;
+    uint16_t _stats_worst_us;
+    uint8_t _stats_worst_dev;
+#endif
 };
 
 namespace AP {
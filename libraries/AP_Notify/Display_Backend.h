@@ -4,6 +4,12 @@
 
 #define NOTIFY_DISPLAY_I2C_ADDR 0x3C
 
+// maximum number of display pages (8 pixel rows each) transferred per
+// refresh tick, bounding the time a refresh holds the I2C bus
+#ifndef AP_NOTIFY_DISPLAY_PAGE_BUDGET
+#define AP_NOTIFY_DISPLAY_PAGE_BUDGET 4
+#endif
+
 class Display_Backend {
 
 public:
@@ -19,4 +25,9 @@ protected:
 
     virtual bool hw_init() = 0;
 
+    // bitmask of display pages (8 pixel rows each) whose framebuffer
+    // contents have changed since the last transfer; backends use it to
+    // transfer only the pages which no longer match the panel
+    uint8_t _dirty_pages;
+
 };
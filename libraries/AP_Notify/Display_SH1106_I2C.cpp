@@ -61,7 +61,8 @@ bool Display_SH1106_I2C::hw_init()
     bool success = dev.transfer((uint8_t *)&init_seq, sizeof(init_seq), nullptr, 0);
 
     if (success) {
-        _need_hw_update = true;
+        // push the full blank framebuffer to the panel
+        _pending_pages = 0xFF;
         dev.register_periodic_callback(20000, FUNCTOR_BIND_MEMBER(&Display_SH1106_I2C::_timer, void));
     }
 
@@ -70,15 +71,19 @@ bool Display_SH1106_I2C::hw_init()
 
 void Display_SH1106_I2C::hw_update()
 {
-    _need_hw_update = true;
+    // queue only the pages whose contents changed; a static screen
+    // costs no I2C traffic
+    if (_dirty_pages != 0) {
+        _pending_pages |= _dirty_pages;
+        _dirty_pages = 0;
+    }
 }
 
 void Display_SH1106_I2C::_timer()
 {
-    if (!_need_hw_update) {
+    if (_pending_pages == 0) {
         return;
     }
-    _need_hw_update = false;
 
     struct PACKED {
         uint8_t reg;
@@ -92,8 +97,16 @@ void Display_SH1106_I2C::_timer()
         uint8_t db[SH1106_COLUMNS/2];
     } display_buffer = { 0x40, {} };
 
-    // write buffer to display
-    for (uint8_t i = 0; i < (SH1106_ROWS / SH1106_ROWS_PER_PAGE); i++) {
+    // write dirty pages to the display, at most
+    // AP_NOTIFY_DISPLAY_PAGE_BUDGET per tick to bound time on the bus,
+    // resuming where we left off on the next tick
+    const uint8_t num_pages = SH1106_ROWS / SH1106_ROWS_PER_PAGE;
+    uint8_t budget = AP_NOTIFY_DISPLAY_PAGE_BUDGET;
+    for (uint8_t n = 0; n < num_pages && budget > 0; n++) {
+        const uint8_t i = (_page_cursor + n) % num_pages;
+        if ((_pending_pages & (1U << i)) == 0) {
+            continue;
+        }
         command.page = 0xB0 | (i & 0x0F);
         dev.transfer((uint8_t *)&command, sizeof(command), nullptr, 0);
 
@@ -101,6 +114,10 @@ void Display_SH1106_I2C::_timer()
         dev.transfer((uint8_t *)&display_buffer, SH1106_COLUMNS/2 + 1, nullptr, 0);
         memcpy(&display_buffer.db[0], &_displaybuffer[i * SH1106_COLUMNS + SH1106_COLUMNS/2 ], SH1106_COLUMNS/2);
         dev.transfer((uint8_t *)&display_buffer, SH1106_COLUMNS/2 + 1, nullptr, 0);
+
+        _pending_pages &= ~(1U << i);
+        _page_cursor = (i + 1) % num_pages;
+        budget--;
     }
 }
 
@@ -111,7 +128,12 @@ void Display_SH1106_I2C::set_pixel(uint16_t x, uint16_t y)
         return;
     }
     // set pixel in buffer
-    _displaybuffer[x + (y / 8 * SH1106_COLUMNS)] |= 1 << (y % 8);
+    uint8_t &byte = _displaybuffer[x + (y / 8 * SH1106_COLUMNS)];
+    const uint8_t mask = 1 << (y % 8);
+    if ((byte & mask) == 0) {
+        byte |= mask;
+        _dirty_pages |= 1U << (y / 8);
+    }
 }
 
 void Display_SH1106_I2C::clear_pixel(uint16_t x, uint16_t y)
@@ -121,10 +143,24 @@ void Display_SH1106_I2C::clear_pixel(uint16_t x, uint16_t y)
         return;
     }
     // clear pixel in buffer
-    _displaybuffer[x + (y / 8 * SH1106_COLUMNS)] &= ~(1 << (y % 8));
+    uint8_t &byte = _displaybuffer[x + (y / 8 * SH1106_COLUMNS)];
+    const uint8_t mask = 1 << (y % 8);
+    if ((byte & mask) != 0) {
+        byte &= ~mask;
+        _dirty_pages |= 1U << (y / 8);
+    }
 }
 
 void Display_SH1106_I2C::clear_screen()
 {
+    // only pages with something on them need a transfer
+    for (uint8_t p = 0; p < (SH1106_ROWS / SH1106_ROWS_PER_PAGE); p++) {
+        for (uint16_t i = 0; i < SH1106_COLUMNS; i++) {
+            if (_displaybuffer[p * SH1106_COLUMNS + i] != 0) {
+                _dirty_pages |= 1U << p;
+                break;
+            }
+        }
+    }
     memset(_displaybuffer, 0, SH1106_COLUMNS * SH1106_ROWS_PER_PAGE);
 }
@@ -34,6 +34,9 @@ private:
 
     AP_HAL::Device &dev;
     uint8_t _displaybuffer[SH1106_COLUMNS * SH1106_ROWS_PER_PAGE];
-    bool _need_hw_update;
+    // pages queued for transfer to the panel, consumed by _timer()
+    volatile uint8_t _pending_pages;
+    // page at which the next budgeted transfer resumes
+    uint8_t _page_cursor;
 
 };
@@ -35,5 +35,8 @@ private:
 
     AP_HAL::Device &dev;
     uint8_t _displaybuffer[SSD1306_COLUMNS * SSD1306_ROWS_PER_PAGE];
-    bool _need_hw_update;
+    // pages queued for transfer to the panel, consumed by _timer()
+    volatile uint8_t _pending_pages;
+    // page at which the next budgeted transfer resumes
+    uint8_t _page_cursor;
 };
@@ -16,7 +16,6 @@
  */
 
 #include "AP_OLC.h"
-#include <cmath>
 #include <AP_Math/AP_Math.h>
 
 #if HAL_PLUSCODE_ENABLE
@@ -39,25 +38,35 @@ static constexpr uint32_t OLC_DEG_MULTIPLIER = 10000000U; // 1e7
 static constexpr int32_t LAT_MAX = static_cast<int32_t>(90 * OLC_DEG_MULTIPLIER);
 static constexpr int32_t LON_MAX = static_cast<int32_t>(180 * OLC_DEG_MULTIPLIER);
 
-const int32_t AP_OLC::INITIAL_EXPONENT = floorf(logf(2 * (LON_MAX / OLC_DEG_MULTIPLIER)) / logf(ENCODING_BASE));
-// Work out the enclosing resolution (in degrees) for the grid algorithm.
-const int32_t AP_OLC::GRID_SIZE = (1 / powf(ENCODING_BASE, PAIR_CODE_LEN / 2 - (INITIAL_EXPONENT + 1))) * OLC_DEG_MULTIPLIER;
-// Work out the initial resolution
-const int32_t AP_OLC::INITIAL_RESOLUTION = powf(ENCODING_BASE, INITIAL_EXPONENT) * OLC_DEG_MULTIPLIER;
-
 constexpr char AP_OLC::olc_alphabet[];
 
-// Compute the latitude precision value for a given code length.  Lengths <= 10
-// have the same precision for latitude and longitude, but lengths > 10 have
-// different precisions due to the grid method having fewer columns than rows.
-float AP_OLC::compute_precision_for_length(uint8_t length)
+// Latitude precision (in deg * OLC_DEG_MULTIPLIER) for each code length,
+// precomputed so no floating point math is needed at encode time.  Lengths
+// <= 10 use 20^(2 - length/2); longer codes divide the length-10 precision
+// by 5 for each extra grid digit (the grid has fewer columns than rows).
+static constexpr int64_t olc_precision_e7[CODE_LEN_MAX + 1] = {
+    4000000000,     // 0: 20^2 deg
+    4000000000,     // 1: 20^2 deg
+    2000000000,     // 2: 20^1 deg
+    2000000000,     // 3: 20^1 deg
+    10000000,       // 4: 1 deg
+    10000000,       // 5: 1 deg
+    500000,         // 6: 1/20 deg
+    500000,         // 7: 1/20 deg
+    25000,          // 8: 1/400 deg
+    25000,          // 9: 1/400 deg
+    1250,           // 10: 1/8000 deg
+    250,            // 11
+    50,             // 12
+    10,             // 13
+    2,              // 14
+    0,              // 15: below OLC_DEG_MULTIPLIER resolution
+};
+
+// Return the latitude precision value for a given code length.
+int64_t AP_OLC::precision_for_length(uint8_t length)
 {
-    // Magic numbers!
-    if (length <= PAIR_CODE_LEN) {
-        return powf(ENCODING_BASE, floorf((length / -2) + 2));
-    }
-
-    return powf(ENCODING_BASE, -3) / powf(5, length - PAIR_CODE_LEN);
+    return olc_precision_e7[MIN(length, CODE_LEN_MAX)];
 }
 
 int32_t AP_OLC::adjust_latitude(int32_t lat, uint8_t code_len)
@@ -67,8 +76,7 @@ int32_t AP_OLC::adjust_latitude(int32_t lat, uint8_t code_len)
 
     if (lat >= LAT_MAX) {
         // Subtract half the code precision to get the latitude into the code area.
-        int32_t precision = compute_precision_for_length(code_len) * OLC_DEG_MULTIPLIER;
-        lat -= precision / 2;
+        lat = int64_t(lat) - precision_for_length(code_len) / 2;
     }
     return lat;
 }
@@ -35,15 +35,16 @@ public:
     static uint32_t olc_encode(int32_t lat, int32_t lon, uint8_t length, char *buf, uint8_t bufsize);
 
 private:
-    static const int32_t INITIAL_EXPONENT;
-    // Work out the enclosing resolution (in degrees) for the grid algorithm.
-    static const int32_t GRID_SIZE;
-    // Work out the initial resolution
-    static const int32_t INITIAL_RESOLUTION;
+    // Exponent of the largest pair resolution: floor(log(360) / log(20))
+    static constexpr int32_t INITIAL_EXPONENT = 1;
+    // Enclosing resolution (deg * OLC_DEG_MULTIPLIER) for the grid algorithm: 1/20^3 deg
+    static constexpr int32_t GRID_SIZE = 1250;
+    // Initial resolution (deg * OLC_DEG_MULTIPLIER): 20^INITIAL_EXPONENT deg
+    static constexpr int32_t INITIAL_RESOLUTION = 200000000;
 
     static constexpr char olc_alphabet[] = "23456789CFGHJMPQRVWX";
 
-    static float compute_precision_for_length(uint8_t length);
+    static int64_t precision_for_length(uint8_t length);
     static int32_t adjust_latitude(int32_t lat, uint8_t code_len);
     static int32_t normalize_longitude(int32_t lon);
     static uint32_t encode_pairs(uint32_t lat, uint32_t lon, uint8_t length, char *buf, uint8_t bufsize);
@@ -0,0 +1,34 @@
+#include <AP_gbenchmark.h>
+
+#include <AP_Math/AP_Math.h>
+#include <AP_OLC/AP_OLC.h>
+
+const AP_HAL::HAL& hal = AP_HAL::get_HAL();
+
+/*
+ * The OSD pluscode panel encodes the vehicle position as an
+ * open-location-code on every drawn frame, so encode cost is paid at the
+ * OSD refresh rate.  Benchmarked at the panel lengths in use: the default
+ * pair code length (10) and a grid-refined length (13).
+ */
+
+static void BM_OLCEncode(benchmark::State& state)
+{
+    const uint8_t length = state.range(0);
+    char buf[16];
+    int32_t lat = -353632620;   // deg * 1e7
+    int32_t lon = 1491652373;
+
+    while (state.KeepRunning()) {
+        uint32_t n = AP_OLC::olc_encode(lat, lon, length, buf, sizeof(buf));
+        gbenchmark_escape(&n);
+        // move the location each iteration so the digit branches are not
+        // unrealistically predictable
+        lat += 1000;
+        lon += 1000;
+    }
+}
+
+BENCHMARK(BM_OLCEncode)->Arg(10)->Arg(13);
+
+BENCHMARK_MAIN();
@@ -23,6 +23,9 @@
 #if HAL_WITH_MSP_DISPLAYPORT
 
 #include <GCS_MAVLink/GCS.h>
+#if HAL_LOGGING_ENABLED
+#include <AP_Logger/AP_Logger.h>
+#endif
 
 static const struct AP_Param::defaults_table_struct defaults_table[] = {
     /*
@@ -62,16 +65,10 @@ void AP_OSD_MSP_DisplayPort::osd_thread_run_once()
 
 void AP_OSD_MSP_DisplayPort::clear(void)
 {
-    // check if we need to enable some options
-    // but only for actual OSD screens
-    if (_osd.get_current_screen() < AP_OSD_NUM_DISPLAY_SCREENS) {
-        const uint8_t txt_resolution = _osd.screen[_osd.get_current_screen()].get_txt_resolution();
-        const uint8_t font_index = _osd.screen[_osd.get_current_screen()].get_font_index();
-        _displayport->msp_displayport_set_options(font_index, txt_resolution);
-    }
-
-    // clear remote MSP screen
-    _displayport->msp_displayport_clear_screen();
+    // only clear the local framebuffer; the remote screen is cleared
+    // on full redraws and otherwise kept in sync by flush() sending
+    // the characters which changed
+    memset(frame, ' ', sizeof(frame));
 
     // toggle flashing @1Hz
     const uint32_t now = AP_HAL::millis();
@@ -82,6 +79,16 @@ void AP_OSD_MSP_DisplayPort::clear(void)
 }
 
 void AP_OSD_MSP_DisplayPort::write(uint8_t x, uint8_t y, const char* text)
+{
+    if (y >= video_rows) {
+        return;
+    }
+    for (uint8_t i=0; text[i] != 0 && x + i < video_cols; i++) {
+        frame[y][x + i] = text[i];
+    }
+}
+
+void AP_OSD_MSP_DisplayPort::send_text(uint8_t x, uint8_t y, const char* text)
 {
 #if AP_MSP_INAV_FONTS_ENABLED
     const AP_MSP *msp = AP::msp();
@@ -142,6 +149,106 @@ uint8_t AP_OSD_MSP_DisplayPort::format_string_for_osd(char* buff, uint8_t size,
 
 void AP_OSD_MSP_DisplayPort::flush(void)
 {
+    const uint32_t now = AP_HAL::millis();
+    uint8_t txt_resolution = 0;
+    uint8_t font_index = 0;
+    if (_osd.get_current_screen() < AP_OSD_NUM_DISPLAY_SCREENS) {
+        txt_resolution = _osd.screen[_osd.get_current_screen()].get_txt_resolution();
+        font_index = _osd.screen[_osd.get_current_screen()].get_font_index();
+    }
+    // a full redraw is needed when the options change, as the remote
+    // buffer is rebuilt at the new resolution, and periodically so a
+    // power-cycled goggle recovers the whole screen
+    if (force_full_redraw ||
+        now - last_full_redraw_ms >= 2000U ||
+        txt_resolution != last_txt_resolution ||
+        font_index != last_font_index) {
+        force_full_redraw = false;
+        last_full_redraw_ms = now;
+        last_txt_resolution = txt_resolution;
+        last_font_index = font_index;
+        if (_osd.get_current_screen() < AP_OSD_NUM_DISPLAY_SCREENS) {
+            _displayport->msp_displayport_set_options(font_index, txt_resolution);
+        }
+        _displayport->msp_displayport_clear_screen();
+        memset(shadow_frame, ' ', sizeof(shadow_frame));
+    }
+
+    // send only the characters which changed since the last flush,
+    // bridging small unchanged gaps to save per-packet overhead
+    char buffer[DISPLAYPORT_WRITE_BUFFER_MAX_LEN];
+    for (uint8_t y=0; y<video_rows; y++) {
+        uint8_t x = 0;
+        while (x < video_cols) {
+            if (frame[y][x] == shadow_frame[y][x]) {
+                x++;
+                continue;
+            }
+            uint8_t len = 0;
+            uint8_t gap = 0;
+            while (x + len < video_cols && len < sizeof(buffer)-1) {
+                if (frame[y][x+len] != shadow_frame[y][x+len]) {
+                    gap = 0;
+                } else {
+                    gap++;
+                    if (gap > 2) {
+                        break;
+                    }
+                }
+                buffer[len] = frame[y][x+len];
+                len++;
+            }
+            // drop trailing unchanged characters from the run
+            while (len > 0 && frame[y][x+len-1] == shadow_frame[y][x+len-1]) {
+                len--;
+            }
+            buffer[len] = 0;
+            send_text(x, y, buffer);
+            memcpy(&shadow_frame[y][x], &frame[y][x], len);
+            x += len;
+#if HAL_LOGGING_ENABLED
+            stats_cells += len;
+            stats_packets++;
+            // sub-command, row, column and attribute bytes plus the text
+            stats_bytes += 4 + len;
+#endif
+        }
+    }
+
+#if HAL_LOGGING_ENABLED
+    // model what re-sending every populated cell each cycle would
+    // cost, to show what the delta transmission saves
+    for (uint8_t y=0; y<video_rows; y++) {
+        uint8_t row_cells = 0;
+        for (uint8_t x=0; x<video_cols; x++) {
+            if (frame[y][x] != ' ') {
+                row_cells++;
+            }
+        }
+        if (row_cells > 0) {
+            stats_full_bytes += 4 + row_cells;
+        }
+    }
+    if (now - stats_last_ms >= 1000U) {
+        stats_last_ms = now;
+        // @LoggerMessage: OSDD
+        // @Description: MSP DisplayPort link bandwidth statistics
+        // @Field: TimeUS: Time since system startup
+        // @Field: Cell: characters sent in the last second
+        // @Field: Pkt: MSP draw packets sent in the last second
+        // @Field: Byte: MSP payload bytes sent in the last second
+        // @Field: FByte: payload bytes a full redraw every cycle would have sent
+        AP::logger().WriteStreaming(
+            "OSDD", "TimeUS,Cell,Pkt,Byte,FByte", "s--bb", "F----", "QHHII",
+            AP_HAL::micros64(),
+            stats_cells, stats_packets, stats_bytes, stats_full_bytes);
+        stats_cells = 0;
+        stats_packets = 0;
+        stats_bytes = 0;
+        stats_full_bytes = 0;
+    }
+#endif
+
     // grab the screen and force a redraw
     _displayport->msp_displayport_grab();
     _displayport->msp_displayport_draw_screen();
@@ -1,5 +1,6 @@
 #include <AP_OSD/AP_OSD_Backend.h>
 #include <AP_MSP/AP_MSP.h>
+#include <AP_Logger/AP_Logger_config.h>
 
 #if HAL_WITH_MSP_DISPLAYPORT
 
@@ -60,8 +61,37 @@ private:
     void setup_defaults(void);
     char displayport_write_buffer[DISPLAYPORT_WRITE_BUFFER_MAX_LEN]; // terminator
 
+    // send a run of characters to the remote screen
+    void send_text(uint8_t x, uint8_t y, const char* text);
+
     AP_MSP_Telem_Backend* _displayport;
 
+    // largest supported text grid (60x22 HD)
+    static const uint8_t video_cols = 60;
+    static const uint8_t video_rows = 22;
+
+    // local framebuffer, with a shadow of what the remote screen
+    // holds so that flush() only sends the characters which changed
+    uint8_t frame[video_rows][video_cols] {};
+    uint8_t shadow_frame[video_rows][video_cols] {};
+
+    // time of last full redraw; periodic full redraws recover the
+    // remote screen after a goggle power cycle
+    uint32_t last_full_redraw_ms;
+    uint8_t last_txt_resolution;
+    uint8_t last_font_index;
+    bool force_full_redraw = true;
+
+#if HAL_LOGGING_ENABLED
+    // link bandwidth statistics, written as OSDD at 1Hz
+    uint32_t stats_last_ms;
+    uint16_t stats_cells;
+    uint16_t stats_packets;
+    uint32_t stats_bytes;
+    uint32_t stats_full_bytes;
+#endif
+
+
     // MSP DisplayPort symbols
     static const uint8_t SYM_M = 0x0C;
     static const uint8_t SYM_KM = 0x7D;
@@ -143,6 +143,7 @@ void AP_OpenDroneID::set_basic_id() {
         char buffer[21];
         snprintf(buffer, sizeof(buffer), "%s", id_str);
         memcpy(pkt_basic_id.uas_id, buffer, sizeof(pkt_basic_id.uas_id));
+        basic_id_version++;
     }
 }
 
@@ -767,18 +768,22 @@ void AP_OpenDroneID::handle_msg(mavlink_channel_t chan, const mavlink_message_t
     // accept other messages from the GCS
     case MAVLINK_MSG_ID_OPEN_DRONE_ID_OPERATOR_ID:
         mavlink_msg_open_drone_id_operator_id_decode(&msg, &pkt_operator_id);
+        operator_id_version++;
         break;
     case MAVLINK_MSG_ID_OPEN_DRONE_ID_SELF_ID:
         mavlink_msg_open_drone_id_self_id_decode(&msg, &pkt_self_id);
+        self_id_version++;
         break;
     case MAVLINK_MSG_ID_OPEN_DRONE_ID_BASIC_ID:
         if (id_len == 0) {
             mavlink_msg_open_drone_id_basic_id_decode(&msg, &pkt_basic_id);
+            basic_id_version++;
         }
         break;
     case MAVLINK_MSG_ID_OPEN_DRONE_ID_SYSTEM:
         mavlink_msg_open_drone_id_system_decode(&msg, &pkt_system);
         last_system_ms = AP_HAL::millis();
+        system_version++;
         break;
     case MAVLINK_MSG_ID_OPEN_DRONE_ID_SYSTEM_UPDATE: {
         mavlink_open_drone_id_system_update_t pkt_system_update;
@@ -788,6 +793,7 @@ void AP_OpenDroneID::handle_msg(mavlink_channel_t chan, const mavlink_message_t
         pkt_system.operator_altitude_geo = pkt_system_update.operator_altitude_geo;
         pkt_system.timestamp = pkt_system_update.timestamp;
         last_system_update_ms = AP_HAL::millis();
+        system_version++;
         if (last_system_ms != 0) {
             // we can only mark system as updated if we have the other
             // information already
@@ -189,6 +189,15 @@ private:
     float create_altitude(float altitude) const;
     float create_location_timestamp(float timestamp) const;
 
+    // content versions of the static packets, bumped whenever the source
+    // packet is rewritten. The DroneCAN backend compares these against the
+    // version its cached translation was built from so unchanged messages
+    // are fanned out without re-assembly
+    uint32_t basic_id_version;
+    uint32_t system_version;
+    uint32_t self_id_version;
+    uint32_t operator_id_version;
+
     // mask of what UAVCAN drivers need to send each packet
     const uint8_t dronecan_send_all = (1U<<HAL_MAX_CAN_PROTOCOL_DRIVERS)-1;
     uint8_t driver_mask;
@@ -31,6 +31,19 @@ static Canard::Publisher<dronecan_remoteid_SelfID>* dc_self_id[HAL_MAX_CAN_PROTO
 static Canard::Publisher<dronecan_remoteid_System>* dc_system[HAL_MAX_CAN_PROTOCOL_DRIVERS];
 static Canard::Publisher<dronecan_remoteid_OperatorID>* dc_operator_id[HAL_MAX_CAN_PROTOCOL_DRIVERS];
 
+// cached translations of the static messages, shared by all CAN drivers.
+// Each cache is rebuilt only when the content version of the source packet
+// changes; otherwise the same image is broadcast by reference on every
+// driver, avoiding the per-cycle field-by-field re-assembly
+static dronecan_remoteid_BasicID cached_basic_id;
+static uint32_t cached_basic_id_version = UINT32_MAX;
+static dronecan_remoteid_System cached_system;
+static uint32_t cached_system_version = UINT32_MAX;
+static dronecan_remoteid_SelfID cached_self_id;
+static uint32_t cached_self_id_version = UINT32_MAX;
+static dronecan_remoteid_OperatorID cached_operator_id;
+static uint32_t cached_operator_id_version = UINT32_MAX;
+
 static void handle_arm_status(AP_DroneCAN* ap_dronecan, const CanardRxTransfer &transfer, const dronecan_remoteid_ArmStatus &msg);
 
 void AP_OpenDroneID::dronecan_init(AP_DroneCAN *uavcan)
@@ -158,53 +171,69 @@ void AP_OpenDroneID::dronecan_send_location(AP_DroneCAN *uavcan)
 
 void AP_OpenDroneID::dronecan_send_basic_id(AP_DroneCAN *uavcan)
 {
-    dronecan_remoteid_BasicID msg {};
-    const auto &pkt = pkt_basic_id;
-    ODID_COPY_STR(id_or_mac);
-    ODID_COPY(id_type);
-    ODID_COPY(ua_type);
-    ODID_COPY_STR(uas_id);
-    dc_basic_id[uavcan->get_driver_index()]->broadcast(msg);
+    if (cached_basic_id_version != basic_id_version) {
+        auto &msg = cached_basic_id;
+        memset(&msg, 0, sizeof(msg));
+        const auto &pkt = pkt_basic_id;
+        ODID_COPY_STR(id_or_mac);
+        ODID_COPY(id_type);
+        ODID_COPY(ua_type);
+        ODID_COPY_STR(uas_id);
+        cached_basic_id_version = basic_id_version;
+    }
+    dc_basic_id[uavcan->get_driver_index()]->broadcast(cached_basic_id);
 }
 
 void AP_OpenDroneID::dronecan_send_system(AP_DroneCAN *uavcan)
 {
-    dronecan_remoteid_System msg {};
-    const auto &pkt = pkt_system;
-    ODID_COPY_STR(id_or_mac);
-    ODID_COPY(operator_location_type);
-    ODID_COPY(classification_type);
-    ODID_COPY(operator_latitude);
-    ODID_COPY(operator_longitude);
-    ODID_COPY(area_count);
-    ODID_COPY(area_radius);
-    ODID_COPY(area_ceiling);
-    ODID_COPY(area_floor);
-    ODID_COPY(category_eu);
-    ODID_COPY(class_eu);
-    ODID_COPY(operator_altitude_geo);
-    ODID_COPY(timestamp);
-    dc_system[uavcan->get_driver_index()]->broadcast(msg);
+    if (cached_system_version != system_version) {
+        auto &msg = cached_system;
+        memset(&msg, 0, sizeof(msg));
+        const auto &pkt = pkt_system;
+        ODID_COPY_STR(id_or_mac);
+        ODID_COPY(operator_location_type);
+        ODID_COPY(classification_type);
+        ODID_COPY(operator_latitude);
+        ODID_COPY(operator_longitude);
+        ODID_COPY(area_count);
+        ODID_COPY(area_radius);
+        ODID_COPY(area_ceiling);
+        ODID_COPY(area_floor);
+        ODID_COPY(category_eu);
+        ODID_COPY(class_eu);
+        ODID_COPY(operator_altitude_geo);
+        ODID_COPY(timestamp);
+        cached_system_version = system_version;
+    }
+    dc_system[uavcan->get_driver_index()]->broadcast(cached_system);
 }
 
 void AP_OpenDroneID::dronecan_send_self_id(AP_DroneCAN *uavcan)
 {
-    dronecan_remoteid_SelfID msg {};
-    const auto &pkt = pkt_self_id;
-    ODID_COPY_STR(id_or_mac);
-    ODID_COPY(description_type);
-    ODID_COPY_STR(description);
-    dc_self_id[uavcan->get_driver_index()]->broadcast(msg);
+    if (cached_self_id_version != self_id_version) {
+        auto &msg = cached_self_id;
+        memset(&msg, 0, sizeof(msg));
+        const auto &pkt = pkt_self_id;
+        ODID_COPY_STR(id_or_mac);
+        ODID_COPY(description_type);
+        ODID_COPY_STR(description);
+        cached_self_id_version = self_id_version;
+    }
+    dc_self_id[uavcan->get_driver_index()]->broadcast(cached_self_id);
 }
 
 void AP_OpenDroneID::dronecan_send_operator_id(AP_DroneCAN *uavcan)
 {
-    dronecan_remoteid_OperatorID msg {};
-    const auto &pkt = pkt_operator_id;
-    ODID_COPY_STR(id_or_mac);
-    ODID_COPY(operator_id_type);
-    ODID_COPY_STR(operator_id);
-    dc_operator_id[uavcan->get_driver_index()]->broadcast(msg);
+    if (cached_operator_id_version != operator_id_version) {
+        auto &msg = cached_operator_id;
+        memset(&msg, 0, sizeof(msg));
+        const auto &pkt = pkt_operator_id;
+        ODID_COPY_STR(id_or_mac);
+        ODID_COPY(operator_id_type);
+        ODID_COPY_STR(operator_id);
+        cached_operator_id_version = operator_id_version;
+    }
+    dc_operator_id[uavcan->get_driver_index()]->broadcast(cached_operator_id);
 }
 
 /*
@@ -36,6 +36,9 @@
 #include <AP_Filesystem/AP_Filesystem.h>
 #include <stdio.h>
 #include <AP_ROMFS/AP_ROMFS.h>
+#if AP_PARAM_DEFAULTS_CACHE_ENABLED
+#include <AP_Common/AP_FWVersion.h>
+#endif
 
 #if CONFIG_HAL_BOARD == HAL_BOARD_SITL
     #include <SITL/SITL.h>
@@ -104,6 +107,14 @@ uint16_t AP_Param::_count_marker;
 uint16_t AP_Param::_count_marker_done;
 HAL_Semaphore AP_Param::_count_sem;
 
+#if AP_PARAM_NAME_INDEX_ENABLED
+// hashed name index for find()
+struct AP_Param::NameIndexEntry *AP_Param::_name_index;
+uint16_t AP_Param::_name_index_size;
+uint16_t AP_Param::_name_index_marker_done;
+HAL_Semaphore AP_Param::_name_index_sem;
+#endif
+
 // storage and naming information about all types that can be saved
 const AP_Param::Info *AP_Param::_var_info;
 
@@ -117,6 +128,11 @@ bool AP_Param::eeprom_full;
 
 ObjectBuffer_TS<AP_Param::param_save> AP_Param::save_queue{30};
 bool AP_Param::registered_save_handler;
+uint32_t AP_Param::save_queue_first_push_ms;
+
+// while armed, saves queued within this window are coalesced into one
+// storage write pass
+#define AP_PARAM_SAVE_COALESCE_MS 200
 
 bool AP_Param::done_all_default_params;
 
@@ -917,6 +933,14 @@ AP_Param::find_group(const char *name, uint16_t vindex, ptrdiff_t group_offset,
 AP_Param *
 AP_Param::find(const char *name, enum ap_var_type *ptype, uint16_t *flags)
 {
+#if AP_PARAM_NAME_INDEX_ENABLED
+    AP_Param *ap = find_in_name_index(name, ptype, flags);
+    if (ap != nullptr) {
+        return ap;
+    }
+    // misses fall through to the tree walk; the index doesn't cover
+    // disabled groups or whole-vector names
+#endif
     for (uint16_t i=0; i<_num_vars; i++) {
         const auto &info = var_info(i);
         uint8_t type = info.type;
@@ -1250,6 +1274,11 @@ void AP_Param::save(bool force_save)
     struct param_save p, p2;
     p.param = this;
     p.force_save = force_save;
+    if (save_queue.available() == 0) {
+        // start of a new burst, for the coalescing window in
+        // save_io_handler()
+        save_queue_first_push_ms = AP_HAL::millis();
+    }
     if (save_queue.peek(p2) &&
         p2.param == this &&
         p2.force_save == force_save) {
@@ -1282,8 +1311,40 @@ void AP_Param::save(bool force_save)
 void AP_Param::save_io_handler(void)
 {
     struct param_save p;
-    while (save_queue.pop(p)) {
-        p.param->save_sync(p.force_save, true);
+    /*
+      while armed, hold a burst of saves (eg. a script writing many
+      parameters) for a short window so duplicates are merged and
+      storage sees a single write pass rather than one transaction per
+      variable. When disarmed saves are processed immediately, which
+      also guarantees any pending set is flushed as we disarm
+     */
+    if (hal.util->get_soft_armed() &&
+        save_queue.available() > 0 &&
+        save_queue.space() > 0 &&
+        AP_HAL::millis() - save_queue_first_push_ms < AP_PARAM_SAVE_COALESCE_MS) {
+        return;
+    }
+    while (save_queue.available() > 0) {
+        // drain in batches, merging repeated saves of the same
+        // variable within a batch
+        struct param_save batch[16];
+        uint8_t num_saves = 0;
+        while (num_saves < ARRAY_SIZE(batch) && save_queue.pop(p)) {
+            bool merged = false;
+            for (uint8_t i=0; i<num_saves; i++) {
+                if (batch[i].param == p.param) {
+                    batch[i].force_save |= p.force_save;
+                    merged = true;
+                    break;
+                }
+            }
+            if (!merged) {
+                batch[num_saves++] = p;
+            }
+        }
+        for (uint8_t i=0; i<num_saves; i++) {
+            batch[i].param->save_sync(batch[i].force_save, true);
+        }
     }
     if (hal.scheduler->is_system_initialized()) {
         // pay the cost of parameter counting in the IO thread
@@ -2409,6 +2470,23 @@ bool AP_Param::load_defaults_file(const char *filename, bool last_pass)
         return false;
     }
 
+#if AP_PARAM_DEFAULTS_CACHE_ENABLED
+    /*
+      if the defaults text is unchanged since the cache was written we
+      can skip the two-pass text parse entirely. Only attempted for a
+      single filename; comma separated lists use the text parser
+     */
+    bool have_text_crc = false;
+    uint32_t text_crc = 0;
+    if (strchr(filename, ',') == nullptr &&
+        AP::FS().crc32(filename, text_crc)) {
+        have_text_crc = true;
+        if (load_defaults_cache(filename, text_crc)) {
+            return true;
+        }
+    }
+#endif
+
     char *mutable_filename = strdup(filename);
     if (mutable_filename == nullptr) {
         AP_HAL::panic("AP_Param: Failed to allocate mutable string");
@@ -2460,12 +2538,173 @@ bool AP_Param::load_defaults_file(const char *filename, bool last_pass)
 
     num_param_overrides = num_defaults;
 
+#if AP_PARAM_DEFAULTS_ENABLED
+    purge_defaults_list_overrides();
+#endif
+
+#if AP_PARAM_DEFAULTS_CACHE_ENABLED
+    /*
+      only write the cache once every name has resolved; on earlier
+      passes some libraries have not yet registered their parameters
+     */
+    if (have_text_crc && done_all_default_params) {
+        save_defaults_cache(filename, text_crc);
+    }
+#endif
+
+    return true;
+}
+
+#if AP_PARAM_DEFAULTS_CACHE_ENABLED
+#define AP_PARAM_DEFAULTS_CACHE_MAGIC 0x50434B31  // 'PCK1'
+
+/*
+  apply defaults from the binary sidecar cache, bypassing the text
+  parser. Returns false if the cache is missing or does not match the
+  current defaults text and firmware, in which case the caller falls
+  back to parsing the text
+ */
+bool AP_Param::load_defaults_cache(const char *filename, uint32_t text_crc)
+{
+    char *cache_name = nullptr;
+    if (asprintf(&cache_name, "%s.pck", filename) <= 0) {
+        return false;
+    }
+    int fd = AP::FS().open(cache_name, O_RDONLY);
+    free(cache_name);
+    if (fd == -1) {
+        return false;
+    }
+
+    struct defaults_cache_header hdr;
+    if (AP::FS().read(fd, &hdr, sizeof(hdr)) != sizeof(hdr) ||
+        hdr.magic != AP_PARAM_DEFAULTS_CACHE_MAGIC ||
+        hdr.text_crc != text_crc ||
+        hdr.fw_hash != AP::fwversion().fw_hash) {
+        AP::FS().close(fd);
+        return false;
+    }
+
+    delete[] param_overrides;
+    param_overrides = nullptr;
+    param_overrides_len = 0;
+    num_param_overrides = 0;
+    num_read_only = 0;
+
+    param_overrides = NEW_NOTHROW param_override[hdr.count];
+    if (param_overrides == nullptr) {
+        AP::FS().close(fd);
+        return false;
+    }
+    param_overrides_len = hdr.count;
+
+    bool done_all = true;
+    uint16_t idx = 0;
+    for (uint16_t i=0; i<hdr.count; i++) {
+        struct defaults_cache_entry e;
+        if (AP::FS().read(fd, &e, sizeof(e)) != sizeof(e)) {
+            // truncated cache; fall back to the text parser
+            AP::FS().close(fd);
+            return false;
+        }
+        e.name[AP_MAX_NAME_SIZE] = 0;
+        enum ap_var_type var_type;
+        AP_Param *vp = find(e.name, &var_type);
+        if (vp == nullptr) {
+            // not yet registered; a later pass will retry
+            done_all = false;
+            continue;
+        }
+        param_overrides[idx].object_ptr = vp;
+        param_overrides[idx].value = e.value;
+        param_overrides[idx].read_only = e.read_only != 0;
+        if (e.read_only) {
+            num_read_only++;
+        }
+        idx++;
+        if (!vp->configured_in_storage()) {
+            vp->set_float(e.value, var_type);
+        }
+    }
+    AP::FS().close(fd);
+
+    num_param_overrides = idx;
+    done_all_default_params = done_all;
+
 #if AP_PARAM_DEFAULTS_ENABLED
     purge_defaults_list_overrides();
 #endif
 
     return true;
 }
+
+/*
+  write the binary sidecar cache after a successful text parse. Best
+  effort - on a read-only filesystem the text parser simply remains
+  the boot path
+ */
+void AP_Param::save_defaults_cache(const char *filename, uint32_t text_crc)
+{
+    int tfd = AP::FS().open(filename, O_RDONLY, true);
+    if (tfd == -1) {
+        return;
+    }
+
+    char *cache_name = nullptr;
+    if (asprintf(&cache_name, "%s.pck", filename) <= 0) {
+        AP::FS().close(tfd);
+        return;
+    }
+    int fd = AP::FS().open(cache_name, O_WRONLY|O_CREAT|O_TRUNC);
+    if (fd == -1) {
+        free(cache_name);
+        AP::FS().close(tfd);
+        return;
+    }
+
+    struct defaults_cache_header hdr {};
+    hdr.magic = AP_PARAM_DEFAULTS_CACHE_MAGIC;
+    hdr.text_crc = text_crc;
+    hdr.fw_hash = AP::fwversion().fw_hash;
+    hdr.count = num_param_overrides;
+
+    bool ok = AP::FS().write(fd, &hdr, sizeof(hdr)) == sizeof(hdr);
+
+    /*
+      re-parse the text for the names; with done_all_default_params
+      set every parseable line resolves, so entries land in the same
+      order as param_overrides
+     */
+    uint16_t written = 0;
+    char line[100];
+    while (ok && AP::FS().fgets(line, sizeof(line)-1, tfd)) {
+        char *pname;
+        float value;
+        bool read_only;
+        if (!parse_param_line(line, &pname, value, read_only)) {
+            continue;
+        }
+        enum ap_var_type var_type;
+        if (!find(pname, &var_type)) {
+            continue;
+        }
+        struct defaults_cache_entry e {};
+        strncpy(e.name, pname, AP_MAX_NAME_SIZE);
+        e.value = value;
+        e.read_only = read_only;
+        ok = AP::FS().write(fd, &e, sizeof(e)) == sizeof(e);
+        written++;
+    }
+    AP::FS().close(tfd);
+    AP::FS().close(fd);
+
+    if (!ok || written != num_param_overrides) {
+        AP::FS().unlink(cache_name);
+    }
+    free(cache_name);
+}
+#endif // AP_PARAM_DEFAULTS_CACHE_ENABLED
+
 #endif // AP_PARAM_DEFAULTS_FILE_PARSING_ENABLED
 
 #if AP_PARAM_MAX_EMBEDDED_PARAM > 0 || defined(HAL_HAVE_AP_ROMFS_EMBEDDED_H)
@@ -2727,6 +2966,109 @@ void AP_Param::invalidate_count(void)
     _count_marker++;
 }
 
+#if AP_PARAM_NAME_INDEX_ENABLED
+/*
+  build or rebuild the hashed name index. Called with _name_index_sem
+  held. On allocation failure the index stays empty and find() uses
+  the tree walk
+ */
+void AP_Param::build_name_index(void)
+{
+    const uint16_t marker = _count_marker;
+    delete[] _name_index;
+    _name_index = nullptr;
+    _name_index_size = 0;
+    // mark the build done up-front so an allocation failure doesn't
+    // retry on every find() until the tree changes again
+    _name_index_marker_done = marker;
+
+    uint16_t count = 0;
+    {
+        ParamToken token {};
+        for (AP_Param *ap = first(&token, nullptr);
+             ap != nullptr;
+             ap = next_scalar(&token, nullptr)) {
+            count++;
+        }
+    }
+    if (count == 0) {
+        return;
+    }
+
+    // size to the next power of two with at least 50% headroom, to
+    // keep probe chains short
+    uint16_t size = 16;
+    while (size < count + count/2 && size < 0x8000) {
+        size <<= 1;
+    }
+    _name_index = NEW_NOTHROW NameIndexEntry[size]{};
+    if (_name_index == nullptr) {
+        return;
+    }
+    _name_index_size = size;
+
+    ParamToken token {};
+    enum ap_var_type ptype;
+    for (AP_Param *ap = first(&token, &ptype);
+         ap != nullptr;
+         ap = next_scalar(&token, &ptype)) {
+        char name[AP_MAX_NAME_SIZE+1] {};
+        ap->copy_name_token(token, name, sizeof(name), true);
+        const uint32_t crc = crc32_small(0, (const uint8_t *)name, strlen(name));
+        uint16_t slot = crc & (size-1);
+        while (_name_index[slot].ptr != nullptr) {
+            slot = (slot+1) & (size-1);
+        }
+        _name_index[slot].crc = crc;
+        _name_index[slot].ptr = ap;
+        _name_index[slot].token = token;
+        _name_index[slot].type = ptype;
+    }
+}
+
+/*
+  look a name up in the hashed index, returning nullptr on a miss so
+  the caller falls back to the tree walk
+ */
+AP_Param *AP_Param::find_in_name_index(const char *name, enum ap_var_type *ptype, uint16_t *flags)
+{
+    WITH_SEMAPHORE(_name_index_sem);
+    if (_name_index_marker_done != _count_marker) {
+        build_name_index();
+    }
+    if (_name_index == nullptr) {
+        return nullptr;
+    }
+    const uint32_t crc = crc32_small(0, (const uint8_t *)name, strlen(name));
+    uint16_t slot = crc & (_name_index_size-1);
+    while (_name_index[slot].ptr != nullptr) {
+        const NameIndexEntry &entry = _name_index[slot];
+        if (entry.crc == crc) {
+            // guard against CRC collisions by checking the name
+            char buf[AP_MAX_NAME_SIZE+1] {};
+            entry.ptr->copy_name_token(entry.token, buf, sizeof(buf), true);
+            if (strcmp(buf, name) == 0) {
+                *ptype = (enum ap_var_type)entry.type;
+                if (flags != nullptr) {
+                    *flags = 0;
+                    uint32_t group_element = 0;
+                    const struct GroupInfo *ginfo;
+                    struct GroupNesting group_nesting {};
+                    uint8_t idx;
+                    entry.ptr->find_var_info(&group_element, ginfo, group_nesting, &idx);
+                    if (ginfo != nullptr) {
+                        *flags = ginfo->flags;
+                    }
+                }
+                return entry.ptr;
+            }
+        }
+        slot = (slot+1) & (_name_index_size-1);
+    }
+    return nullptr;
+}
+#endif // AP_PARAM_NAME_INDEX_ENABLED
+
 /*
   set a default value by name
  */
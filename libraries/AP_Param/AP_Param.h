@@ -787,6 +787,29 @@ private:
     // load defaults from supplied string:
     static void load_param_defaults(const volatile char *ptr, int32_t length, bool last_pass);
 
+#if AP_PARAM_DEFAULTS_CACHE_ENABLED
+    /*
+      binary cache of a parsed defaults file, stored alongside the
+      text with a ".pck" extension. Keyed on the CRC of the defaults
+      text and the firmware hash so any change to either falls back
+      to the text parser
+     */
+    struct defaults_cache_header {
+        uint32_t magic;
+        uint32_t text_crc;
+        uint32_t fw_hash;
+        uint16_t count;
+        uint16_t reserved;
+    };
+    struct defaults_cache_entry {
+        char name[AP_MAX_NAME_SIZE+1];
+        float value;
+        uint8_t read_only;
+    };
+    static bool load_defaults_cache(const char *filename, uint32_t text_crc);
+    static void save_defaults_cache(const char *filename, uint32_t text_crc);
+#endif
+
     /*
       load defaults from embedded parameters
      */
@@ -818,6 +841,33 @@ private:
     static HAL_Semaphore        _count_sem;
     static const struct Info *  _var_info;
 
+#if AP_PARAM_NAME_INDEX_ENABLED
+    /*
+      open-addressed hash index from name CRC to parameter, making
+      find() near constant time. Built lazily on first lookup and
+      rebuilt when the parameter tree changes (same marker as the
+      parameter count cache). Lookups that miss fall back to the tree
+      walk
+     */
+    struct NameIndexEntry {
+        uint32_t crc;
+        AP_Param *ptr;
+        ParamToken token;
+        uint8_t type;
+    };
+    static struct NameIndexEntry *_name_index;
+    static uint16_t             _name_index_size;   // power of two
+    static uint16_t             _name_index_marker_done;
+    static HAL_Semaphore        _name_index_sem;
+
+    // build or rebuild the index; on allocation failure the index is
+    // disabled and find() uses the tree walk
+    static void build_name_index(void);
+
+    // look a name up in the index, nullptr on miss
+    static AP_Param *find_in_name_index(const char *name, enum ap_var_type *ptype, uint16_t *flags);
+#endif
+
 #if AP_PARAM_DYNAMIC_ENABLED
     // allow for a dynamically allocated var table
     static uint16_t             _num_vars_base;
@@ -862,6 +912,10 @@ private:
     static ObjectBuffer_TS<struct param_save> save_queue;
     static bool registered_save_handler;
 
+    // time the first entry of the current burst was queued, for the
+    // coalescing window in save_io_handler()
+    static uint32_t save_queue_first_push_ms;
+
     // background function for saving parameters
     void save_io_handler(void);
 
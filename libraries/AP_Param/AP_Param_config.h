@@ -11,3 +11,20 @@
 #ifndef FORCE_APJ_DEFAULT_PARAMETERS
 #define FORCE_APJ_DEFAULT_PARAMETERS 0
 #endif
+
+/*
+  binary sidecar cache of the parsed defaults file. When the defaults
+  text and firmware are unchanged since the cache was written the
+  two-pass text parse is skipped at boot
+ */
+#ifndef AP_PARAM_DEFAULTS_CACHE_ENABLED
+#define AP_PARAM_DEFAULTS_CACHE_ENABLED (AP_PARAM_DEFAULTS_FILE_PARSING_ENABLED && AP_FILESYSTEM_FILE_WRITING_ENABLED)
+#endif
+
+/*
+  hashed name index for AP_Param::find(). Costs about 16 bytes of heap
+  per parameter, so defaults on only where memory is plentiful
+ */
+#ifndef AP_PARAM_NAME_INDEX_ENABLED
+#define AP_PARAM_NAME_INDEX_ENABLED (CONFIG_HAL_BOARD == HAL_BOARD_SITL || CONFIG_HAL_BOARD == HAL_BOARD_LINUX)
+#endif
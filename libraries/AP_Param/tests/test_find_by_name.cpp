@@ -85,4 +85,16 @@ TEST(FindByName, Bob)
     }
 }
 
+// also exercises the hashed name index on boards where it is enabled
+TEST(FindByName, Find)
+{
+    for (const auto &x : TestVehicle::var_info) {
+        enum ap_var_type ptype = (ap_var_type)-1;
+        AP_Param *p = AP_Param::find(x.name, &ptype);
+        EXPECT_TRUE(p);
+    }
+    enum ap_var_type ptype = (ap_var_type)-1;
+    EXPECT_EQ(AP_Param::find("NOSUCHPARAM", &ptype), nullptr);
+}
+
 AP_GTEST_MAIN()
@@ -39,6 +39,8 @@ void AP_Proximity_Boundary_3D::init()
             _boundary_points[layer][sector] = _sector_edge_vector[layer][sector] * PROXIMITY_BOUNDARY_DIST_DEFAULT;
         }
     }
+    // all cached obstacle vectors need refilling
+    _obstacle_vector_dirty_layers = (1U << PROXIMITY_NUM_LAYERS) - 1;
 }
 
 // returns face corresponding to the provided yaw and (optionally) pitch
@@ -76,6 +78,7 @@ void AP_Proximity_Boundary_3D::set_face_attributes(const Face &face, float pitch
     _pitch_deg[face.layer][face.sector] = pitch;
     _distance[face.layer][face.sector] = distance;
     _distance_valid[face.layer][face.sector] = true;
+    _valid_sector_mask[face.layer] |= (1U << face.sector);
     _prx_instance[face.layer][face.sector] = prx_instance;
 
     // apply filter
@@ -169,6 +172,9 @@ void AP_Proximity_Boundary_3D::update_boundary(const Face &face)
     if (!_distance_valid[layer][prev_sector_ccw]) {
         _boundary_points[layer][prev_sector_ccw] = _sector_edge_vector[layer][prev_sector_ccw] * shortest_distance;
     }
+
+    // the layer's cached obstacle vectors are now stale
+    _obstacle_vector_dirty_layers |= (1U << layer);
 }
 
 // reset boundary.  marks all distances as invalid
@@ -178,6 +184,7 @@ void AP_Proximity_Boundary_3D::reset()
         for (uint8_t sector=0; sector < PROXIMITY_NUM_SECTORS; sector++) {
             _distance_valid[layer][sector] = false;
         }
+        _valid_sector_mask[layer] = 0;
     }
 }
 
@@ -204,6 +211,7 @@ void AP_Proximity_Boundary_3D::reset_face(const Face &face, uint8_t prx_instance
     }
 
     _distance_valid[face.layer][face.sector] = false;
+    _valid_sector_mask[face.layer] &= ~(1U << face.sector);
 
     // update simple avoidance boundary
     update_boundary(face);
@@ -225,6 +233,7 @@ void AP_Proximity_Boundary_3D::check_face_timeout()
                 if ((now_ms - _last_update_ms[layer][sector]) > PROXIMITY_FACE_RESET_MS) {
                     // this face has a valid distance but wasn't updated for a long time, reset it
                     _distance_valid[layer][sector] = false;
+                    _valid_sector_mask[layer] &= ~(1U << sector);
                     update_boundary(AP_Proximity_Boundary_3D::Face{layer, sector});
                 }
             }
@@ -265,14 +274,12 @@ bool AP_Proximity_Boundary_3D::convert_obstacle_num_to_face(uint8_t obstacle_num
     face.sector = sector;
     face.layer = layer;
 
-    uint8_t valid_sector = sector;
-    // check for 3 adjacent sectors
-    for (uint8_t i=0; i < 3; i++) {
-        if (_distance_valid[layer][valid_sector]) {
-            // update boundary has manipulated this face
-            return true;
-        }
-        valid_sector = get_next_sector(valid_sector);
+    // check for 3 adjacent sectors with a single test against the validity summary mask
+    const uint8_t next_sector = get_next_sector(sector);
+    const uint8_t window = (1U << sector) | (1U << next_sector) | (1U << get_next_sector(next_sector));
+    if ((_valid_sector_mask[layer] & window) != 0) {
+        // update boundary has manipulated this face
+        return true;
     }
 
     // this face was not manipulated by "update_boundary" and is stale. Don't use it
@@ -291,15 +298,26 @@ bool AP_Proximity_Boundary_3D::get_obstacle(uint8_t obstacle_num, Vector3f& vec_
         // not a valid face
         return false;
     }
-    const uint8_t sector_end = face.sector;
-    const uint8_t sector_start = get_next_sector(face.sector);
-    
-    const Vector3f start = _boundary_points[face.layer][sector_start];
-    const Vector3f end = _boundary_points[face.layer][sector_end];
-    vec_to_obstacle = Vector3f::point_on_line_closest_to_other_point(start, end, Vector3f{});
+    // refill the layer's closest-point cache if boundary points have changed
+    if (_obstacle_vector_dirty_layers & (1U << face.layer)) {
+        refresh_obstacle_vectors(face.layer);
+    }
+    vec_to_obstacle = _obstacle_vector[face.layer][face.sector];
     return true;
 }
 
+// recompute the cached vector to the closest point on each face of a layer
+// done once per boundary change rather than for every avoidance iteration
+void AP_Proximity_Boundary_3D::refresh_obstacle_vectors(uint8_t layer) const
+{
+    for (uint8_t sector=0; sector < PROXIMITY_NUM_SECTORS; sector++) {
+        const Vector3f &start = _boundary_points[layer][get_next_sector(sector)];
+        const Vector3f &end = _boundary_points[layer][sector];
+        _obstacle_vector[layer][sector] = Vector3f::point_on_line_closest_to_other_point(start, end, Vector3f{});
+    }
+    _obstacle_vector_dirty_layers &= ~(1U << layer);
+}
+
 // Appropriate layer and sector are found from the passed obstacle_num
 // This function then draws a line between this sector, and sector + 1 at the given layer
 // Then returns the closest point on this line from the segment that was passed, in body-frame.
@@ -343,6 +361,10 @@ bool AP_Proximity_Boundary_3D::get_closest_object(float& angle_deg, float &dista
     // only check for middle layers and higher
     // lower layers might contain ground, which will give false pre-arm failure
     for (uint8_t layer=PROXIMITY_MIDDLE_LAYER; layer<PROXIMITY_NUM_LAYERS; layer++) {
+        if (_valid_sector_mask[layer] == 0) {
+            // no valid distances anywhere in this layer
+            continue;
+        }
         for (uint8_t sector=0; sector<PROXIMITY_NUM_SECTORS; sector++) {
             if (_distance_valid[layer][sector]) {
                 if (!closest_found || (_distance[layer][sector] < _distance[closest_layer][closest_sector])) {
@@ -167,9 +167,26 @@ private:
     // Return filtered distance for the passed in face
     bool get_filtered_distance(const Face &face, float &distance) const;
 
+    // refill the cached closest-point vectors for all faces of a layer and
+    // clear the layer's dirty bit
+    void refresh_obstacle_vectors(uint8_t layer) const;
+
     Vector3f _sector_edge_vector[PROXIMITY_NUM_LAYERS][PROXIMITY_NUM_SECTORS];
     Vector3f _boundary_points[PROXIMITY_NUM_LAYERS][PROXIMITY_NUM_SECTORS];
 
+    // summary of _distance_valid maintained incrementally as faces are updated.  one
+    // bit per sector, used to answer convert_obstacle_num_to_face's three-adjacent-
+    // sector check with a single mask test in the avoidance loop
+    static_assert(PROXIMITY_NUM_SECTORS <= 8, "PROXIMITY_NUM_SECTORS must fit in a uint8_t mask");
+    uint8_t _valid_sector_mask[PROXIMITY_NUM_LAYERS];
+
+    // cached vector to the closest point on each face, used by get_obstacle.  layers
+    // are marked dirty when their boundary points change (at sensor message rate) and
+    // refilled on first use so the avoidance loop normally only reads the cache
+    static_assert(PROXIMITY_NUM_LAYERS <= 8, "PROXIMITY_NUM_LAYERS must fit in a uint8_t mask");
+    mutable Vector3f _obstacle_vector[PROXIMITY_NUM_LAYERS][PROXIMITY_NUM_SECTORS];
+    mutable uint8_t _obstacle_vector_dirty_layers;
+
     float _angle_deg[PROXIMITY_NUM_LAYERS][PROXIMITY_NUM_SECTORS];          // yaw angle in degrees to closest object within each sector and layer
     float _pitch_deg[PROXIMITY_NUM_LAYERS][PROXIMITY_NUM_SECTORS];          // pitch angle in degrees to the closest object within each sector and layer
     float _distance[PROXIMITY_NUM_LAYERS][PROXIMITY_NUM_SECTORS];       // distance to closest object within each sector and layer
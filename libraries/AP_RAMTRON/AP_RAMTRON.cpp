@@ -116,17 +116,23 @@ bool AP_RAMTRON::init(void)
 }
 
 /*
-  send a command and offset
+  fill b with a command and offset, returning the header length. The
+  header is combined with the data phase into a single transfer so
+  each operation is one SPI transaction rather than one per phase
  */
-void AP_RAMTRON::send_offset(uint8_t cmd, uint32_t offset) const
+uint8_t AP_RAMTRON::make_cmd_offset(uint8_t *b, uint8_t cmd, uint32_t offset) const
 {
+    b[0] = cmd;
     if (ramtron_ids[id].addrlen == 3) {
-        uint8_t b[4] = { cmd, uint8_t((offset>>16)&0xFF), uint8_t((offset>>8)&0xFF), uint8_t(offset&0xFF) };
-        dev->transfer(b, sizeof(b), nullptr, 0);
-    } else /* len 2 */ {
-        uint8_t b[3] = { cmd, uint8_t((offset>>8)&0xFF), uint8_t(offset&0xFF) };
-        dev->transfer(b, sizeof(b), nullptr, 0);
+        b[1] = uint8_t((offset>>16)&0xFF);
+        b[2] = uint8_t((offset>>8)&0xFF);
+        b[3] = uint8_t(offset&0xFF);
+        return 4;
     }
+    /* len 2 */
+    b[1] = uint8_t((offset>>8)&0xFF);
+    b[2] = uint8_t(offset&0xFF);
+    return 3;
 }
 
 // read from device
@@ -150,6 +156,9 @@ bool AP_RAMTRON::read(uint32_t offset, uint8_t *buf, uint32_t size)
         size -= maxread;
     }
 
+    uint8_t b[4];
+    const uint8_t hdrlen = make_cmd_offset(b, RAMTRON_READ, offset);
+
     for (uint8_t r=0; r<RAMTRON_RETRIES; r++) {
         if (r != 0) {
             hal.scheduler->delay(RAMTRON_DELAY_MS);
@@ -160,20 +169,14 @@ bool AP_RAMTRON::read(uint32_t offset, uint8_t *buf, uint32_t size)
          */
         {
             WITH_SEMAPHORE(dev->get_semaphore());
-            dev->set_chip_select(true);
-            send_offset(RAMTRON_READ, offset);
-            dev->transfer(nullptr, 0, buf, size);
-            dev->set_chip_select(false);
+            dev->transfer(b, hdrlen, buf, size);
         }
 
         uint32_t crc1 = crc_crc32(0, buf, size);
 
         {
             WITH_SEMAPHORE(dev->get_semaphore());
-            dev->set_chip_select(true);
-            send_offset(RAMTRON_READ, offset);
-            dev->transfer(nullptr, 0, buf, size);
-            dev->set_chip_select(false);
+            dev->transfer(b, hdrlen, buf, size);
         }
         uint32_t crc2 = crc_crc32(0, buf, size);
 
@@ -198,6 +201,27 @@ bool AP_RAMTRON::write(uint32_t offset, const uint8_t *buf, uint32_t size)
         return false;
     }
 
+    // bound the burst so the combined header and data buffer stays
+    // small; storage backends never write more than 256 bytes at a time
+    const uint32_t maxwrite = 256;
+    while (size > maxwrite) {
+        if (!write(offset, buf, maxwrite)) {
+            return false;
+        }
+        offset += maxwrite;
+        buf += maxwrite;
+        size -= maxwrite;
+    }
+
+    // assemble command, address and data so the whole write goes out
+    // as a single SPI burst
+    uint8_t b[4 + maxwrite];
+    const uint8_t hdrlen = make_cmd_offset(b, RAMTRON_WRITE, offset);
+    memcpy(&b[hdrlen], buf, size);
+
+    uint8_t rb[4];
+    const uint8_t rlen = make_cmd_offset(rb, RAMTRON_READ, offset);
+
     WITH_SEMAPHORE(dev->get_semaphore());
 
     for (uint8_t r=0; r<RAMTRON_RETRIES; r++) {
@@ -207,14 +231,9 @@ bool AP_RAMTRON::write(uint32_t offset, const uint8_t *buf, uint32_t size)
 
         // we need to enable writes every time. The WREN bit is
         // automatically reset on completion of the write call
-        dev->set_chip_select(true);
         dev->transfer(&RAMTRON_WREN, 1, nullptr, 0);
-        dev->set_chip_select(false);
 
-        dev->set_chip_select(true);
-        send_offset(RAMTRON_WRITE, offset);
-        dev->transfer(buf, size, nullptr, 0);
-        dev->set_chip_select(false);
+        dev->transfer(b, hdrlen+size, nullptr, 0);
 
         /*
           verify first 32 bytes of every write using a crc
@@ -223,10 +242,7 @@ bool AP_RAMTRON::write(uint32_t offset, const uint8_t *buf, uint32_t size)
         const uint8_t nverify = MIN(size, sizeof(rbuf));
         uint32_t crc1 = crc_crc32(0, buf, nverify);
 
-        dev->set_chip_select(true);
-        send_offset(RAMTRON_READ, offset);
-        dev->transfer(nullptr, 0, rbuf, nverify);
-        dev->set_chip_select(false);
+        dev->transfer(rb, rlen, rbuf, nverify);
 
         uint32_t crc2 = crc_crc32(0, rbuf, nverify);
 
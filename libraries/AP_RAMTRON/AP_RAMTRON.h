@@ -46,5 +46,6 @@ private:
     // perform a single device read
     bool _read(uint32_t offset, uint8_t * const buf, uint32_t size);
 
-    void send_offset(uint8_t cmd, uint32_t offset) const;
+    // fill b with a command and offset, returning the header length
+    uint8_t make_cmd_offset(uint8_t *b, uint8_t cmd, uint32_t offset) const;
 };
@@ -303,6 +303,37 @@ bool AP_RCProtocol::process_byte(uint8_t byte, uint32_t baudrate)
     return false;
 }
 
+/*
+  process a buffer of bytes in one pass. When locked onto a byte based
+  protocol the whole buffer is handed to that backend so it can parse
+  frame-at-a-time; while searching we fall back to byte-at-a-time so
+  every backend sees the same stream
+ */
+void AP_RCProtocol::process_bytes(const uint8_t *bytes, uint16_t count, uint32_t baudrate)
+{
+    uint32_t now = AP_HAL::millis();
+
+#if AP_RC_CHANNEL_ENABLED
+    rc_protocols_mask = rc().enabled_protocols();
+#endif
+
+    if (_detected_protocol != AP_RCProtocol::NONE &&
+        _detected_with_bytes &&
+        !should_search(now) &&
+        protocol_enabled(_detected_protocol)) {
+        backend[_detected_protocol]->process_bytes(bytes, count, baudrate);
+        if (backend[_detected_protocol]->new_input()) {
+            _new_input = true;
+            _last_input_ms = now;
+        }
+        return;
+    }
+
+    for (uint16_t i = 0; i < count; i++) {
+        process_byte(bytes[i], baudrate);
+    }
+}
+
 // handshake if nothing else has succeeded so far
 void AP_RCProtocol::process_handshake( uint32_t baudrate)
 {
@@ -380,11 +411,14 @@ void AP_RCProtocol::check_added_uart(void)
 
     uint32_t n = added.uart->available();
     n = MIN(n, 255U);
-    for (uint8_t i=0; i<n; i++) {
-        int16_t b = added.uart->read();
-        if (b >= 0) {
-            process_byte(uint8_t(b), current_baud);
+    uint8_t buf[64];
+    while (n > 0) {
+        const ssize_t nread = added.uart->read(buf, MIN(n, uint32_t(sizeof(buf))));
+        if (nread <= 0) {
+            break;
         }
+        process_bytes(buf, nread, current_baud);
+        n -= nread;
     }
     if (searching) {
         if (now - added.last_config_change_ms > 1000) {
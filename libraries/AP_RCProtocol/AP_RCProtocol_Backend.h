@@ -32,6 +32,13 @@ public:
     virtual ~AP_RCProtocol_Backend() {}
     virtual void process_pulse(uint32_t width_s0, uint32_t width_s1) {}
     virtual void process_byte(uint8_t byte, uint32_t baudrate) {}
+    // process a buffer of bytes in one pass, backends that parse
+    // frame-at-a-time can override this to avoid per-byte overhead
+    virtual void process_bytes(const uint8_t *bytes, uint16_t count, uint32_t baudrate) {
+        for (uint16_t i = 0; i < count; i++) {
+            process_byte(bytes[i], baudrate);
+        }
+    }
     virtual void process_handshake(uint32_t baudrate) {}
     uint16_t read(uint8_t chan);
     void read(uint16_t *pwm, uint8_t n);
@@ -168,36 +168,58 @@ void AP_RCProtocol_CRSF::process_byte(uint8_t byte, uint32_t baudrate)
     if ((baudrate != CRSF_BAUDRATE && baudrate != CRSF_BAUDRATE_1MBIT && baudrate != CRSF_BAUDRATE_2MBIT) || _uart) {
         return;
     }
-    _process_byte(byte);
+    _process_bytes(&byte, 1);
 }
 
-// process a byte provided by a uart
-void AP_RCProtocol_CRSF::_process_byte(uint8_t byte)
+// process a buffer of bytes provided by a uart from rc stack
+void AP_RCProtocol_CRSF::process_bytes(const uint8_t *bytes, uint16_t count, uint32_t baudrate)
+{
+    // reject RC data if we have been configured for standalone mode
+    if ((baudrate != CRSF_BAUDRATE && baudrate != CRSF_BAUDRATE_1MBIT && baudrate != CRSF_BAUDRATE_2MBIT) || _uart) {
+        return;
+    }
+    _process_bytes(bytes, count);
+}
+
+// process a buffer of bytes provided by a uart, parsing frame-at-a-time
+// rather than paying the parser overhead on every byte
+void AP_RCProtocol_CRSF::_process_bytes(const uint8_t *bytes, uint16_t count)
 {
-    //debug("process_byte(0x%x)", byte);
     const uint32_t now = AP_HAL::micros();
 
-    // extra check for overflow, should never happen since it will have been handled in check_frame()
-    if (_frame_ofs >= sizeof(_frame)) {
-        _frame_ofs = 0;
-    }
+    while (count > 0) {
+        // extra check for overflow, should never happen since it will have been handled in check_frame()
+        if (_frame_ofs >= sizeof(_frame)) {
+            _frame_ofs = 0;
+        }
 
-    // check for long frame gaps
-    // we took too long decoding, start again - the RX will only send complete frames so this is unlikely to fail,
-    // however thread scheduling can introduce longer delays even when the data has been received
-    if (_frame_ofs > 0 && (now - _start_frame_time_us) > CRSF_FRAME_TIMEOUT_US) {
-        _frame_ofs = 0;
-    }
+        // check for long frame gaps
+        // we took too long decoding, start again - the RX will only send complete frames so this is unlikely to fail,
+        // however thread scheduling can introduce longer delays even when the data has been received
+        if (_frame_ofs > 0 && (now - _start_frame_time_us) > CRSF_FRAME_TIMEOUT_US) {
+            _frame_ofs = 0;
+        }
 
-    // start of a new frame
-    if (_frame_ofs == 0) {
-        _start_frame_time_us = now;
-    }
-    
-    _frame_bytes[_frame_ofs++] = byte;
-    
-    if (!check_frame(now)) {
-        skip_to_next_frame(now);
+        // start of a new frame
+        if (_frame_ofs == 0) {
+            _start_frame_time_us = now;
+        }
+
+        const uint16_t n = MIN(count, uint16_t(sizeof(_frame) - _frame_ofs));
+        memcpy(&_frame_bytes[_frame_ofs], bytes, n);
+        _frame_ofs += n;
+        bytes += n;
+        count -= n;
+
+        // consume as many complete frames as the buffer holds. Telemetry
+        // replies triggered by decoding are written in the same pass
+        uint8_t prev_ofs;
+        do {
+            prev_ofs = _frame_ofs;
+            if (!check_frame(now)) {
+                skip_to_next_frame(now);
+            }
+        } while (_frame_ofs > 0 && _frame_ofs != prev_ofs);
     }
 }
 
@@ -306,11 +328,14 @@ void AP_RCProtocol_CRSF::update(void)
         }
         uint32_t n = _uart->available();
         n = MIN(n, 255U);
-        for (uint8_t i = 0; i < n; i++) {
-            int16_t b = _uart->read();
-            if (b >= 0) {
-                _process_byte(uint8_t(b));
+        uint8_t buf[64];
+        while (n > 0) {
+            const ssize_t nread = _uart->read(buf, MIN(n, uint32_t(sizeof(buf))));
+            if (nread <= 0) {
+                break;
             }
+            _process_bytes(buf, nread);
+            n -= nread;
         }
     }
 
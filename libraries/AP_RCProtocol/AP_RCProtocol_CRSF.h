@@ -41,6 +41,7 @@ public:
     AP_RCProtocol_CRSF(AP_RCProtocol &_frontend);
     virtual ~AP_RCProtocol_CRSF();
     void process_byte(uint8_t byte, uint32_t baudrate) override;
+    void process_bytes(const uint8_t *bytes, uint16_t count, uint32_t baudrate) override;
     void process_handshake(uint32_t baudrate) override;
     void update(void) override;
 #if HAL_CRSF_TELEM_ENABLED
@@ -212,7 +213,7 @@ private:
 
     static AP_RCProtocol_CRSF* _singleton;
 
-    void _process_byte(uint8_t byte);
+    void _process_bytes(const uint8_t *bytes, uint16_t count);
     bool check_frame(uint32_t timestamp_us);
     void skip_to_next_frame(uint32_t timestamp_us);
     bool decode_crsf_packet();
@@ -25,6 +25,19 @@
 
 #include <string.h>
 
+#if AP_ROMFS_CACHE_ENABLED
+#include <AP_HAL/AP_HAL.h>
+#include <AP_Common/ExpandingString.h>
+#include <AP_Math/AP_Math.h>
+
+extern const AP_HAL::HAL &hal;
+
+AP_ROMFS::cache_entry AP_ROMFS::cache[8];
+uint32_t AP_ROMFS::cached_bytes;
+AP_ROMFS::cache_stats_t AP_ROMFS::cache_stats;
+HAL_Semaphore AP_ROMFS::sem;
+#endif
+
 #ifdef HAL_HAVE_AP_ROMFS_EMBEDDED_H
 #include <ap_romfs_embedded.h>
 #else
@@ -60,6 +73,15 @@ const uint8_t *AP_ROMFS::find_decompress(const char *name, uint32_t &size)
     size = f->decompressed_size;
     return f->contents;
 #else
+#if AP_ROMFS_CACHE_ENABLED
+    WITH_SEMAPHORE(sem);
+    uint8_t *cached = cache_lookup(f);
+    if (cached != nullptr) {
+        size = f->decompressed_size;
+        return cached;
+    }
+#endif
+
     // add one byte for null termination; ArduPilot's malloc will zero it.
     uint8_t *decompressed_data = (uint8_t *)malloc(f->decompressed_size+1);
     if (!decompressed_data) {
@@ -97,7 +119,11 @@ const uint8_t *AP_ROMFS::find_decompress(const char *name, uint32_t &size)
         ::free(decompressed_data);
         return nullptr;
     }
-    
+
+#if AP_ROMFS_CACHE_ENABLED
+    cache_insert(f, decompressed_data);
+#endif
+
     size = f->decompressed_size;
     return decompressed_data;
 #endif
@@ -107,10 +133,136 @@ const uint8_t *AP_ROMFS::find_decompress(const char *name, uint32_t &size)
 void AP_ROMFS::free(const uint8_t *data)
 {
 #ifndef HAL_ROMFS_UNCOMPRESSED
+#if AP_ROMFS_CACHE_ENABLED
+    WITH_SEMAPHORE(sem);
+    if (cache_release(data)) {
+        // still cached for the next open
+        return;
+    }
+#endif
     ::free(const_cast<uint8_t *>(data));
 #endif
 }
 
+#if AP_ROMFS_CACHE_ENABLED
+// return cached data for a file, taking a reference, or nullptr
+uint8_t *AP_ROMFS::cache_lookup(const embedded_file *f)
+{
+    for (auto &c : cache) {
+        if (c.f == f) {
+            c.refcount++;
+            c.last_use_ms = AP_HAL::millis();
+            cache_stats.hits++;
+            return c.data;
+        }
+    }
+    cache_stats.misses++;
+    return nullptr;
+}
+
+// evict the least recently used unreferenced entry. Returns false if
+// all entries are referenced
+bool AP_ROMFS::cache_evict_lru(void)
+{
+    cache_entry *oldest = nullptr;
+    for (auto &c : cache) {
+        if (c.f == nullptr || c.refcount != 0) {
+            continue;
+        }
+        if (oldest == nullptr || c.last_use_ms < oldest->last_use_ms) {
+            oldest = &c;
+        }
+    }
+    if (oldest == nullptr) {
+        return false;
+    }
+    cached_bytes -= oldest->f->decompressed_size;
+    cache_stats.evictions++;
+    ::free(oldest->data);
+    memset(oldest, 0, sizeof(*oldest));
+    return true;
+}
+
+/*
+  try to add newly decompressed data to the cache. On failure the data
+  is simply left uncached and AP_ROMFS::free() will release it
+ */
+void AP_ROMFS::cache_insert(const embedded_file *f, uint8_t *data)
+{
+    if (f->decompressed_size == 0) {
+        // not worth a slot
+        return;
+    }
+    // cap the cache at the lower of the configured maximum and a
+    // quarter of the free heap, so we never squeeze out callers that
+    // need the memory for real work
+    const uint32_t limit = MIN((uint32_t)AP_ROMFS_CACHE_SIZE_MAX,
+                               uint32_t(hal.util->available_memory() / 4));
+    while (cached_bytes + f->decompressed_size > limit) {
+        if (!cache_evict_lru()) {
+            return;
+        }
+    }
+    cache_entry *slot = nullptr;
+    for (auto &c : cache) {
+        if (c.f == nullptr) {
+            slot = &c;
+            break;
+        }
+    }
+    if (slot == nullptr) {
+        if (!cache_evict_lru()) {
+            return;
+        }
+        for (auto &c : cache) {
+            if (c.f == nullptr) {
+                slot = &c;
+                break;
+            }
+        }
+    }
+    slot->f = f;
+    slot->data = data;
+    slot->refcount = 1;
+    slot->last_use_ms = AP_HAL::millis();
+    cached_bytes += f->decompressed_size;
+}
+
+// drop a reference. Returns false if the data is not cached
+bool AP_ROMFS::cache_release(const uint8_t *data)
+{
+    for (auto &c : cache) {
+        if (c.f != nullptr && c.data == data) {
+            if (c.refcount > 0) {
+                c.refcount--;
+            }
+            c.last_use_ms = AP_HAL::millis();
+            return true;
+        }
+    }
+    return false;
+}
+
+// report decompression cache statistics, appended to @SYS/memory.txt
+void AP_ROMFS::cache_info(ExpandingString &str)
+{
+    WITH_SEMAPHORE(sem);
+    str.printf("ROMFS_CACHE BYTES=%6u HITS=%4u MISS=%4u EVICT=%4u\n",
+               unsigned(cached_bytes),
+               unsigned(cache_stats.hits),
+               unsigned(cache_stats.misses),
+               unsigned(cache_stats.evictions));
+    for (const auto &c : cache) {
+        if (c.f != nullptr) {
+            str.printf("  %s LEN=%6u REF=%u\n",
+                       c.f->filename,
+                       unsigned(c.f->decompressed_size),
+                       unsigned(c.refcount));
+        }
+    }
+}
+#endif // AP_ROMFS_CACHE_ENABLED
+
 /*
   directory listing interface. Start with ofs=0. Returns pathnames
   that match dirname prefix. Ends with nullptr return when no more
@@ -5,6 +5,26 @@
 
 #include <stdint.h>
 
+#include <AP_HAL/AP_HAL_Boards.h>
+#include <AP_HAL/Semaphores.h>
+
+// cache decompressed files so that repeated opens (eg. Lua script
+// restarts) don't pay the decompression cost each time. Not worthwhile
+// when the ROMFS is stored uncompressed
+#ifndef AP_ROMFS_CACHE_ENABLED
+#if defined(HAL_ROMFS_UNCOMPRESSED) || defined(HAL_BOOTLOADER_BUILD) || defined(IOMCU_FW)
+#define AP_ROMFS_CACHE_ENABLED 0
+#else
+#define AP_ROMFS_CACHE_ENABLED 1
+#endif
+#endif
+
+// upper bound on cached decompressed bytes. The effective limit is the
+// lower of this and a quarter of the free heap
+#ifndef AP_ROMFS_CACHE_SIZE_MAX
+#define AP_ROMFS_CACHE_SIZE_MAX 65536U
+#endif
+
 class AP_ROMFS {
 public:
     //  Find the named file and return its decompressed data and size. Caller
@@ -26,6 +46,11 @@ public:
     */
     static const char *dir_list(const char *dirname, uint16_t &ofs);
 
+#if AP_ROMFS_CACHE_ENABLED
+    // report decompression cache statistics, appended to @SYS/memory.txt
+    static void cache_info(class ExpandingString &str);
+#endif
+
 private:
     struct embedded_file {
         const char *filename;
@@ -39,4 +64,36 @@ private:
     static const AP_ROMFS::embedded_file *find_file(const char *name);
 
     static const struct embedded_file files[];
+
+#if AP_ROMFS_CACHE_ENABLED
+    /*
+      cache of decompressed files. Entries with a zero refcount keep
+      their data and are evicted least-recently-used when space is
+      needed for a new entry
+     */
+    struct cache_entry {
+        const embedded_file *f;
+        uint8_t *data;
+        uint8_t refcount;
+        uint32_t last_use_ms;
+    };
+    static cache_entry cache[8];
+    static uint32_t cached_bytes;
+    static struct cache_stats_t {
+        uint32_t hits;
+        uint32_t misses;
+        uint32_t evictions;
+    } cache_stats;
+    static HAL_Semaphore sem;
+
+    // return cached data for a file, taking a reference, or nullptr
+    static uint8_t *cache_lookup(const embedded_file *f);
+    // try to add newly decompressed data to the cache
+    static void cache_insert(const embedded_file *f, uint8_t *data);
+    // drop a reference. Returns false if the data is not cached
+    static bool cache_release(const uint8_t *data);
+    // evict the least recently used unreferenced entry. Returns false
+    // if all entries are referenced
+    static bool cache_evict_lru(void);
+#endif
 };
@@ -52,13 +52,27 @@ void AP_RPM_Pin::update(void)
             IGNORE_RETURN(hal.gpio->detach_interrupt(last_pin));
             interrupt_attached = false;
         }
+        if (accumulator_attached) {
+            IGNORE_RETURN(hal.gpio->detach_pulse_accumulator(last_pin));
+            accumulator_attached = false;
+        }
         irq_state[state.instance].dt_count = 0;
         irq_state[state.instance].dt_sum = 0;
         // attach to new pin
         last_pin = get_pin();
         if (last_pin > 0) {
             hal.gpio->pinMode(last_pin, HAL_GPIO_INPUT);
-            if (hal.gpio->attach_interrupt(
+            // prefer the HAL pulse-period accumulator: periods are
+            // batched at source with no callback per pulse, which
+            // matters at the thousands of pulses per second a heli
+            // rotor sensor produces. Period bounds match the
+            // bounce/gap rejection in irq_handler
+            if (hal.gpio->attach_pulse_accumulator(
+                    last_pin,
+                    AP_HAL::GPIO::INTERRUPT_RISING,
+                    100, 1000*1000)) {
+                accumulator_attached = true;
+            } else if (hal.gpio->attach_interrupt(
                     last_pin,
                     FUNCTOR_BIND_MEMBER(&AP_RPM_Pin::irq_handler, void, uint8_t, bool, uint32_t),
                     AP_HAL::GPIO::INTERRUPT_RISING)) {
@@ -69,6 +83,15 @@ void AP_RPM_Pin::update(void)
         }
     }
 
+    if (accumulator_attached) {
+        uint32_t period_sum_us, period_count;
+        if (hal.gpio->read_pulse_periods(last_pin, period_sum_us, period_count) &&
+            period_count > 0) {
+            irq_state[state.instance].dt_sum = period_sum_us;
+            irq_state[state.instance].dt_count = period_count;
+        }
+    }
+
     if (irq_state[state.instance].dt_count > 0) {
 
         // disable interrupts to prevent race with irq_handler
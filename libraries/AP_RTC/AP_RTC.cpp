@@ -40,10 +40,36 @@ const AP_Param::GroupInfo AP_RTC::var_info[] = {
     // @Range: -720 +840
     // @User: Advanced
     AP_GROUPINFO("_TZ_MIN",  2, AP_RTC, tz_min, 0),
-    
+
+#if AP_RTC_TIMESYNC_ENABLED
+    // @Param: _PPS_PIN
+    // @DisplayName: PPS input pin
+    // @Description: Pin receiving a pulse-per-second signal whose rising edge marks a UTC whole-second boundary. Used to discipline the sub-second phase of the RTC; the coarse time must still come from GPS or MAVLink.
+    // @Values: -1:Disabled,50:AUX1,51:AUX2,52:AUX3,53:AUX4,54:AUX5,55:AUX6
+    // @User: Advanced
+    // @RebootRequired: True
+    AP_GROUPINFO("_PPS_PIN",  3, AP_RTC, pps_pin, -1),
+#endif
+
     AP_GROUPEND
 };
 
+void AP_RTC::init()
+{
+#if AP_RTC_TIMESYNC_ENABLED
+    if (pps_pin >= 0) {
+        // ensure we are in input mode
+        hal.gpio->pinMode(pps_pin, HAL_GPIO_INPUT);
+        if (hal.gpio->attach_interrupt(pps_pin, FUNCTOR_BIND_MEMBER(&AP_RTC::pps_pin_isr, void, uint8_t, bool, uint32_t),
+                                       AP_HAL::GPIO::INTERRUPT_RISING)) {
+            // apply corrections from the IO thread; the ISR only
+            // records the edge time
+            hal.scheduler->register_io_process(FUNCTOR_BIND_MEMBER(&AP_RTC::pps_check, void));
+        }
+    }
+#endif
+}
+
 void AP_RTC::set_utc_usec(uint64_t time_utc_usec, source_type type)
 {
     const uint64_t oldest_acceptable_date_us = 1640995200ULL*1000*1000; // 2022-01-01 0:00
@@ -318,6 +344,160 @@ bool AP_RTC::get_date_and_time_utc(uint16_t& year, uint8_t& month, uint8_t& day,
     return true;
 }
 
+#if AP_RTC_TIMESYNC_ENABLED
+// find the peer state for sysid, optionally allocating a slot
+AP_RTC::TimesyncPeer *AP_RTC::find_timesync_peer(uint8_t sysid, bool allocate)
+{
+    for (uint8_t i = 0; i < num_timesync_peers; i++) {
+        if (timesync_peers[i].sysid == sysid) {
+            return &timesync_peers[i];
+        }
+    }
+    if (!allocate || num_timesync_peers >= TIMESYNC_MAX_PEERS) {
+        return nullptr;
+    }
+    TimesyncPeer &peer = timesync_peers[num_timesync_peers++];
+    peer.sysid = sysid;
+    return &peer;
+}
+
+// ingest one TIMESYNC round trip.  All arguments are in nanoseconds;
+// local_sent_ns/local_recv_ns are on our clock, remote_ns is the
+// peer's receive timestamp on its own clock.
+void AP_RTC::handle_timesync_response(uint8_t sysid, uint64_t remote_ns, uint64_t local_sent_ns, uint64_t local_recv_ns)
+{
+    if (local_recv_ns <= local_sent_ns) {
+        return;
+    }
+    const uint64_t rtt_ns = local_recv_ns - local_sent_ns;
+
+    // the peer stamped remote_ns somewhere inside the round trip;
+    // assume a symmetric link and pair it with the midpoint
+    const int64_t offset = int64_t(remote_ns) - int64_t(local_sent_ns + rtt_ns/2);
+
+    WITH_SEMAPHORE(rsem);
+
+    TimesyncPeer *peer = find_timesync_peer(sysid, true);
+    if (peer == nullptr) {
+        // all slots taken by other systems
+        return;
+    }
+
+    if (peer->sample_count == 0) {
+        peer->offset_ns = offset;
+        peer->min_rtt_ns = rtt_ns;
+        peer->last_local_ns = local_recv_ns;
+        peer->sample_count = 1;
+        return;
+    }
+
+    // let the round-trip floor recover slowly so one fast outlier
+    // does not gate all later samples
+    peer->min_rtt_ns = MIN(rtt_ns, peer->min_rtt_ns + peer->min_rtt_ns/16);
+
+    if (rtt_ns > peer->min_rtt_ns*2) {
+        // round trip much worse than the best seen; the midpoint
+        // pairing is unreliable so discard the sample
+        return;
+    }
+
+    const int64_t innovation = offset - peer->offset_ns;
+    const float dt_s = (local_recv_ns - peer->last_local_ns) * 1.0e-9f;
+    if (dt_s > 0.1f && dt_s < 60) {
+        // slow estimate of the relative clock drift
+        const float skew_sample_ppm = (innovation * 1.0e-3f) / dt_s;
+        peer->skew_ppm += 0.05f * (skew_sample_ppm - peer->skew_ppm);
+    }
+    peer->offset_ns += innovation / 4;
+    peer->last_local_ns = local_recv_ns;
+    if (peer->sample_count < UINT8_MAX) {
+        peer->sample_count++;
+    }
+}
+
+// convert a timestamp from the given remote system's clock into the
+// local AP_HAL::micros64() timebase
+bool AP_RTC::convert_remote_timestamp_us(uint8_t sysid, uint64_t remote_usec, uint64_t &local_usec)
+{
+    WITH_SEMAPHORE(rsem);
+
+    const TimesyncPeer *peer = find_timesync_peer(sysid, false);
+    if (peer == nullptr || peer->sample_count < 3) {
+        return false;
+    }
+
+    // extrapolate the offset forward using the drift estimate
+    const uint64_t now_ns = AP_HAL::micros64() * 1000ULL;
+    const float age_s = (now_ns - peer->last_local_ns) * 1.0e-9f;
+    const int64_t offset_ns = peer->offset_ns + int64_t(peer->skew_ppm * age_s * 1000);
+
+    local_usec = uint64_t(int64_t(remote_usec) - offset_ns/1000);
+    return true;
+}
+
+// true when convert_remote_timestamp_us() would succeed for sysid
+bool AP_RTC::timesync_available(uint8_t sysid)
+{
+    WITH_SEMAPHORE(rsem);
+    const TimesyncPeer *peer = find_timesync_peer(sysid, false);
+    return peer != nullptr && peer->sample_count >= 3;
+}
+
+// interrupt handler for the PPS pin; just records the edge time
+void AP_RTC::pps_pin_isr(uint8_t pin, bool pin_high, uint32_t timestamp_us)
+{
+    pps_edge_us = timestamp_us;
+}
+
+// called on the IO thread; snaps the sub-second phase of the RTC to
+// the last captured PPS edge
+void AP_RTC::pps_check()
+{
+    const uint32_t edge_us = pps_edge_us;
+    if (edge_us == pps_edge_handled_us) {
+        return;
+    }
+    pps_edge_handled_us = edge_us;
+
+    if (rtc_source_type == SOURCE_NONE || rtc_source_type == SOURCE_HW) {
+        // we need a coarse UTC estimate before a pulse can be paired
+        // with a whole second
+        return;
+    }
+
+    // extend the 32-bit capture to 64 bits
+    const uint64_t now64 = AP_HAL::micros64();
+    const uint64_t edge64 = now64 - uint32_t(now64 - edge_us);
+
+    // the pulse marks a whole-second boundary; measure how far our
+    // clock phase is from it
+    int64_t phase_us = int64_t((edge64 + rtc_shift) % 1000000ULL);
+    if (phase_us > 500000) {
+        phase_us -= 1000000;
+    }
+    if (phase_us == 0) {
+        return;
+    }
+    if (phase_us > 0 && hal.util->get_soft_armed()) {
+        // as in set_utc_usec(), never step time backwards while armed
+        return;
+    }
+
+    {
+        WITH_SEMAPHORE(rsem);
+        rtc_shift -= phase_us;
+    }
+
+#if AP_RTC_LOGGING_ENABLED
+    // once disciplined the per-pulse correction is a handful of
+    // microseconds; only log the large steps
+    if (phase_us > 1000 || phase_us < -1000) {
+        AP::logger().Write_RTC();
+    }
+#endif  // AP_RTC_LOGGING_ENABLED
+}
+#endif  // AP_RTC_TIMESYNC_ENABLED
+
 // singleton instance
 AP_RTC *AP_RTC::_singleton;
 
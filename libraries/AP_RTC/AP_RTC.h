@@ -18,6 +18,12 @@ public:
 
     AP_Int8 allowed_types;
     AP_Int16 tz_min;
+#if AP_RTC_TIMESYNC_ENABLED
+    AP_Int8 pps_pin;
+#endif
+
+    // set up optional hardware inputs (PPS pin); called by AP_BoardConfig
+    void init();
 
     // ordering is important in source_type; lower-numbered is
     // considered a better time source.  These values are documented
@@ -71,6 +77,29 @@ public:
     // emit an RTC message to the onboard logs
     void Log_RTC();
 
+#if AP_RTC_TIMESYNC_ENABLED
+    /*
+      time synchronisation with remote systems (gimbals, companion
+      computers).  Fed with TIMESYNC round trips by GCS_MAVLINK,
+      maintains a per-system offset and drift estimate so timestamps
+      stamped on a remote clock can be moved into the local
+      AP_HAL::micros64() timebase.
+     */
+
+    // ingest one TIMESYNC round trip.  All arguments are in
+    // nanoseconds; local_sent_ns/local_recv_ns are on our clock,
+    // remote_ns is the peer's receive timestamp on its own clock.
+    void handle_timesync_response(uint8_t sysid, uint64_t remote_ns, uint64_t local_sent_ns, uint64_t local_recv_ns);
+
+    // convert a timestamp from the given remote system's clock into
+    // the local AP_HAL::micros64() timebase.  Returns false if no
+    // usable offset estimate is available for that system.
+    bool convert_remote_timestamp_us(uint8_t sysid, uint64_t remote_usec, uint64_t &local_usec);
+
+    // true when convert_remote_timestamp_us() would succeed for sysid
+    bool timesync_available(uint8_t sysid);
+#endif  // AP_RTC_TIMESYNC_ENABLED
+
 private:
 
     static AP_RTC *_singleton;
@@ -79,6 +108,28 @@ private:
     source_type rtc_source_type = SOURCE_NONE;
     int64_t rtc_shift;
 
+#if AP_RTC_TIMESYNC_ENABLED
+    static const uint8_t TIMESYNC_MAX_PEERS = 4;
+    struct TimesyncPeer {
+        uint8_t sysid;
+        uint8_t sample_count;
+        int64_t offset_ns;       // remote clock minus local clock
+        uint64_t min_rtt_ns;     // best round trip seen, used as a quality gate
+        uint64_t last_local_ns;  // local time of the last accepted sample
+        float skew_ppm;          // drift of offset_ns, parts-per-million
+    } timesync_peers[TIMESYNC_MAX_PEERS];
+    uint8_t num_timesync_peers;
+
+    // find the peer state for sysid, optionally allocating a slot
+    TimesyncPeer *find_timesync_peer(uint8_t sysid, bool allocate);
+
+    // PPS input support
+    void pps_pin_isr(uint8_t pin, bool pin_high, uint32_t timestamp_us);
+    void pps_check();
+    uint32_t pps_edge_us;          // written by the ISR
+    uint32_t pps_edge_handled_us;  // last edge consumed by pps_check()
+#endif  // AP_RTC_TIMESYNC_ENABLED
+
     void clock_ms_to_hms_fields(const uint64_t time_ms, uint8_t &hour, uint8_t &min, uint8_t &sec, uint16_t &ms) const;
 
     static bool _is_leap(uint32_t y);
@@ -10,3 +10,7 @@
 #ifndef AP_RTC_LOGGING_ENABLED
 #define AP_RTC_LOGGING_ENABLED AP_RTC_ENABLED && HAL_LOGGING_ENABLED
 #endif
+
+#ifndef AP_RTC_TIMESYNC_ENABLED
+#define AP_RTC_TIMESYNC_ENABLED AP_RTC_ENABLED
+#endif
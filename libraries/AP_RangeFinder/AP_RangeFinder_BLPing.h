@@ -150,6 +150,10 @@ protected:
         return MAV_DISTANCE_SENSOR_ULTRASOUND;
     }
 
+    // update() re-initialises the sensor over the UART so parsing
+    // must stay on the main thread
+    bool parse_on_io_thread() const override { return false; }
+
     /**
      * @brief Sensor protocol class
      *
@@ -20,6 +20,9 @@
 #include <AP_HAL/AP_HAL.h>
 #include "AP_RangeFinder_Backend_Serial.h"
 #include <AP_SerialManager/AP_SerialManager.h>
+#if AP_RANGEFINDER_SERIAL_PARSE_STATS
+#include <GCS_MAVLink/GCS.h>
+#endif
 
 #include <ctype.h>
 
@@ -42,7 +45,15 @@ void AP_RangeFinder_Backend_Serial::init_serial(uint8_t serial_instance)
 {
     uart = AP::serialmanager().find_serial(AP_SerialManager::SerialProtocol_Rangefinder, serial_instance);
     if (uart != nullptr) {
-        uart->begin(initial_baudrate(serial_instance), rx_bufsize(), tx_bufsize());
+        baudrate = initial_baudrate(serial_instance);
+        uart->begin(baudrate, rx_bufsize(), tx_bufsize());
+        if (parse_on_io_thread()) {
+            // parse on the IO thread so update() only collects state
+            hal.scheduler->register_io_process(FUNCTOR_BIND_MEMBER(&AP_RangeFinder_Backend_Serial::check_uart, void));
+        }
+#if AP_RANGEFINDER_SERIAL_PARSE_STATS
+        parse_stats.instance = serial_instance;
+#endif
     }
 }
 
@@ -51,17 +62,80 @@ uint32_t AP_RangeFinder_Backend_Serial::initial_baudrate(const uint8_t serial_in
     return AP::serialmanager().find_baudrate(AP_SerialManager::SerialProtocol_Rangefinder, serial_instance);
 }
 
+/*
+  parse incoming bytes on the IO thread, staging any decoded reading
+  for collection by update()
+*/
+void AP_RangeFinder_Backend_Serial::check_uart()
+{
+    if (uart == nullptr) {
+        return;
+    }
+
+    // reads must come from the thread that owns the UART, so the
+    // first callback re-opens it to take ownership from the thread
+    // which ran init_serial()
+    if (!uart->is_owned_by_current_thread()) {
+        uart->begin(baudrate, rx_bufsize(), tx_bufsize());
+    }
+
+#if AP_RANGEFINDER_SERIAL_PARSE_STATS
+    const uint32_t start_us = AP_HAL::micros();
+#endif
+
+    float distance_m;
+    if (get_reading(distance_m)) {
+        WITH_SEMAPHORE(_sem);
+        pending.distance_m = distance_m;
+        pending.signal_quality_pct = get_signal_quality_pct();
+        pending.last_reading_ms = AP_HAL::millis();
+        pending.available = true;
+    }
+
+#if AP_RANGEFINDER_SERIAL_PARSE_STATS
+    const uint32_t dt_us = AP_HAL::micros() - start_us;
+    parse_stats.total_us += dt_us;
+    parse_stats.max_us = MAX(parse_stats.max_us, dt_us);
+    parse_stats.calls++;
+    const uint32_t now_ms = AP_HAL::millis();
+    if (now_ms - parse_stats.last_report_ms >= 10000 && parse_stats.calls > 0) {
+        parse_stats.last_report_ms = now_ms;
+        GCS_SEND_TEXT(MAV_SEVERITY_DEBUG, "RFND%u: parse avg %uus max %uus",
+                      unsigned(parse_stats.instance),
+                      unsigned(parse_stats.total_us / parse_stats.calls),
+                      unsigned(parse_stats.max_us));
+        parse_stats.total_us = 0;
+        parse_stats.max_us = 0;
+        parse_stats.calls = 0;
+    }
+#endif
+}
+
 /*
    update the state of the sensor
 */
 void AP_RangeFinder_Backend_Serial::update(void)
 {
-    if (get_reading(state.distance_m)) {
+    if (parse_on_io_thread() && uart != nullptr) {
+        // collect the reading decoded on the IO thread
+        WITH_SEMAPHORE(_sem);
+        if (pending.available) {
+            pending.available = false;
+            state.distance_m = pending.distance_m;
+            state.signal_quality_pct = pending.signal_quality_pct;
+            // update range_valid state based on distance measured
+            state.last_reading_ms = pending.last_reading_ms;
+            update_status();
+            return;
+        }
+    } else if (get_reading(state.distance_m)) {
         state.signal_quality_pct = get_signal_quality_pct();
         // update range_valid state based on distance measured
         state.last_reading_ms = AP_HAL::millis();
         update_status();
-    } else if (AP_HAL::millis() - state.last_reading_ms > read_timeout_ms()) {
+        return;
+    }
+    if (AP_HAL::millis() - state.last_reading_ms > read_timeout_ms()) {
         set_status(RangeFinder::Status::NoData);
     }
 }
@@ -6,6 +6,11 @@
 
 #include "AP_RangeFinder_Backend.h"
 
+// enable per-instance parse CPU statistics, reported via GCS text
+#ifndef AP_RANGEFINDER_SERIAL_PARSE_STATS
+#define AP_RANGEFINDER_SERIAL_PARSE_STATS 0
+#endif
+
 class AP_RangeFinder_Backend_Serial : public AP_RangeFinder_Backend
 {
 public:
@@ -41,6 +46,39 @@ protected:
 
     // maximum time between readings before we change state to NoData:
     virtual uint16_t read_timeout_ms() const { return 200; }
+
+    // true if get_reading() should be called from the IO thread,
+    // leaving update() to collect the decoded reading. Drivers that
+    // drive the UART from their own update() must return false
+    virtual bool parse_on_io_thread() const { return true; }
+
+private:
+
+    // IO thread callback which parses incoming bytes via get_reading()
+    void check_uart();
+
+    // baudrate passed to begin(), kept so the IO thread can re-open
+    // the UART to take ownership of it
+    uint32_t baudrate;
+
+    // reading decoded on the IO thread, awaiting collection by update()
+    struct {
+        float distance_m;
+        int8_t signal_quality_pct;
+        uint32_t last_reading_ms;
+        bool available;
+    } pending;
+
+#if AP_RANGEFINDER_SERIAL_PARSE_STATS
+    // per-instance parse CPU statistics
+    struct {
+        uint32_t total_us;
+        uint32_t max_us;
+        uint32_t calls;
+        uint32_t last_report_ms;
+        uint8_t instance;
+    } parse_stats;
+#endif
 };
 
 #endif  // AP_RANGEFINDER_ENABLED
@@ -35,6 +35,10 @@ protected:
         return MAV_DISTANCE_SENSOR_LASER;
     }
 
+    // update() reconfigures the sensor over the UART, including baud
+    // changes, so parsing must stay on the main thread
+    bool parse_on_io_thread() const override { return false; }
+
 private:
 
     AP_RangeFinder_Wasp(RangeFinder::RangeFinder_State &_state,
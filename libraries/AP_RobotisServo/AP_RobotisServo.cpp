@@ -42,6 +42,7 @@
 #include <AP_HAL/utility/sparse-endian.h>
 #include <AP_Math/AP_Math.h>
 #include <AP_SerialManager/AP_SerialManager.h>
+#include <AP_Servo_Telem/AP_Servo_Telem.h>
 #include <SRV_Channel/SRV_Channel.h>
 
 extern const AP_HAL::HAL& hal;
@@ -102,6 +103,20 @@ extern const AP_HAL::HAL& hal;
 
 #define REG_GOAL_POSITION 116
 
+// contiguous block of present value registers covered by one sync
+// read: velocity(4), position(4), velocity trajectory(4), position
+// trajectory(4), input voltage(2), temperature(1)
+#define REG_PRESENT_VELOCITY 128
+#define TELEM_READ_LEN        19
+
+// scaling of present values. Position is 0.088 deg per count,
+// velocity 0.229 rev/min per count, voltage 0.1V per count
+#define POSITION_TO_DEG    (360.0 / 4096)
+#define VELOCITY_TO_DEG_S  (0.229 * 360 / 60)
+
+// interval between sync reads of servo telemetry
+#define TELEM_INTERVAL_MS 100
+
 // how many times to send servo configure msgs
 #define CONFIGURE_SERVO_COUNT 4
 
@@ -277,6 +292,43 @@ void AP_RobotisServo::send_command(uint8_t id, uint16_t reg, uint32_t value, uin
     send_packet(txpacket);
 }
 
+#if AP_SERVO_TELEM_ENABLED
+/*
+  request telemetry from all detected servos with a single sync
+  read. Each servo replies in turn with one status packet, so the
+  whole set costs one transaction on the bus
+ */
+void AP_RobotisServo::send_telem_request(void)
+{
+    uint8_t txpacket[32] {};
+
+    uint8_t num_ids = 0;
+    for (uint8_t i=0; i<ARRAY_SIZE(last_command_deg); i++) {
+        if ((1U<<i) & servo_mask) {
+            txpacket[PKT_INSTRUCTION+5+num_ids] = i+1;
+            num_ids++;
+        }
+    }
+    if (num_ids == 0) {
+        return;
+    }
+
+    txpacket[PKT_ID] = BROADCAST_ID;
+    txpacket[PKT_LENGTH_L] = DXL_LOBYTE(7 + num_ids);
+    txpacket[PKT_LENGTH_H] = DXL_HIBYTE(7 + num_ids);
+    txpacket[PKT_INSTRUCTION] = INST_SYNC_READ;
+    txpacket[PKT_INSTRUCTION+1] = DXL_LOBYTE(REG_PRESENT_VELOCITY);
+    txpacket[PKT_INSTRUCTION+2] = DXL_HIBYTE(REG_PRESENT_VELOCITY);
+    txpacket[PKT_INSTRUCTION+3] = DXL_LOBYTE(TELEM_READ_LEN);
+    txpacket[PKT_INSTRUCTION+4] = DXL_HIBYTE(TELEM_READ_LEN);
+
+    send_packet(txpacket);
+
+    // allow time for the status reply from each servo
+    delay_time_us += num_ids * ((11 + TELEM_READ_LEN) * us_per_byte + us_gap);
+}
+#endif  // AP_SERVO_TELEM_ENABLED
+
 /*
   read response bytes
  */
@@ -294,42 +346,42 @@ void AP_RobotisServo::read_bytes(void)
         pktbuf[pktbuf_ofs++] = port->read();
     }
 
-    // discard bad leading data. This should be rare
-    while (pktbuf_ofs >= 4 &&
-           (pktbuf[0] != 0xFF || pktbuf[1] != 0xFF || pktbuf[2] != 0xFD || pktbuf[3] != 0x00)) {
-        memmove(pktbuf, &pktbuf[1], pktbuf_ofs-1);
-        pktbuf_ofs--;
-    }
+    // a sync read leaves one status reply per servo pending, so
+    // process all complete packets in the buffer, not just the first
+    while (true) {
+        // discard bad leading data. This should be rare
+        while (pktbuf_ofs >= 4 &&
+               (pktbuf[0] != 0xFF || pktbuf[1] != 0xFF || pktbuf[2] != 0xFD || pktbuf[3] != 0x00)) {
+            memmove(pktbuf, &pktbuf[1], pktbuf_ofs-1);
+            pktbuf_ofs--;
+        }
 
-    if (pktbuf_ofs < 10) {
-        // not enough data yet
-        return;
-    }
+        if (pktbuf_ofs < 10) {
+            // not enough data yet
+            return;
+        }
 
-    const uint16_t total_packet_length = DXL_MAKEWORD(pktbuf[PKT_LENGTH_L], pktbuf[PKT_LENGTH_H]) + PKT_INSTRUCTION;
-    if (total_packet_length > sizeof(pktbuf)) {
-        pktbuf_ofs = 0;
-        return;
-    }
-    if (pktbuf_ofs < total_packet_length) {
-        // more data needed
-        return;
-    }
+        const uint16_t total_packet_length = DXL_MAKEWORD(pktbuf[PKT_LENGTH_L], pktbuf[PKT_LENGTH_H]) + PKT_INSTRUCTION;
+        if (total_packet_length > sizeof(pktbuf)) {
+            pktbuf_ofs = 0;
+            return;
+        }
+        if (pktbuf_ofs < total_packet_length) {
+            // more data needed
+            return;
+        }
+
+        // check CRC
+        const uint16_t crc = DXL_MAKEWORD(pktbuf[total_packet_length-2], pktbuf[total_packet_length-1]);
+        const uint16_t calc_crc = crc_crc16_ibm(0, pktbuf, total_packet_length - 2);
+        if (calc_crc == crc) {
+            // process full packet
+            process_packet(pktbuf, total_packet_length);
+        }
 
-    // check CRC
-    const uint16_t crc = DXL_MAKEWORD(pktbuf[total_packet_length-2], pktbuf[total_packet_length-1]);
-    const uint16_t calc_crc = crc_crc16_ibm(0, pktbuf, total_packet_length - 2);
-    if (calc_crc != crc) {
         memmove(pktbuf, &pktbuf[total_packet_length], pktbuf_ofs - total_packet_length);
         pktbuf_ofs -= total_packet_length;
-        return;
     }
-
-    // process full packet
-    process_packet(pktbuf, total_packet_length);
-
-    memmove(pktbuf, &pktbuf[total_packet_length], pktbuf_ofs - total_packet_length);
-    pktbuf_ofs -= total_packet_length;
 }
 
 /*
@@ -350,6 +402,36 @@ void AP_RobotisServo::process_packet(const uint8_t *pkt, uint8_t length)
         servo_mask |= id_mask;
         DEV_PRINTF("Robotis: new servo %u\n", id);
     }
+
+#if AP_SERVO_TELEM_ENABLED
+    // a reply to our sync read carries the present value block. A
+    // reply needing byte stuffing has a longer length and is
+    // discarded, costing one reading for that servo
+    if (pkt[PKT_INSTRUCTION] == INST_STATUS && length == TELEM_READ_LEN + 11) {
+        const uint8_t *p = &pkt[PKT_PARAMETER0+1];
+        const int32_t velocity = (int32_t)DXL_MAKEDWORD(DXL_MAKEWORD(p[0], p[1]), DXL_MAKEWORD(p[2], p[3]));
+        const int32_t position = (int32_t)DXL_MAKEDWORD(DXL_MAKEWORD(p[4], p[5]), DXL_MAKEWORD(p[6], p[7]));
+        const uint16_t voltage = DXL_MAKEWORD(p[16], p[17]);
+        const uint8_t temperature = p[18];
+
+        AP_Servo_Telem *servo_telem = AP_Servo_Telem::get_singleton();
+        if (servo_telem != nullptr) {
+            const AP_Servo_Telem::TelemetryData telem_data {
+                .command_position = last_command_deg[id-1],
+                .measured_position = float(position * POSITION_TO_DEG),
+                .speed = float(velocity * VELOCITY_TO_DEG_S),
+                .voltage = voltage * 0.1f,
+                .motor_temperature_cdeg = int16_t(temperature * 100),
+                .present_types = AP_Servo_Telem::TelemetryData::Types::COMMANDED_POSITION |
+                                 AP_Servo_Telem::TelemetryData::Types::MEASURED_POSITION |
+                                 AP_Servo_Telem::TelemetryData::Types::SPEED |
+                                 AP_Servo_Telem::TelemetryData::Types::VOLTAGE |
+                                 AP_Servo_Telem::TelemetryData::Types::MOTOR_TEMP
+            };
+            servo_telem->update_telem_data(id-1, telem_data);
+        }
+    }
+#endif  // AP_SERVO_TELEM_ENABLED
 }
 
 
@@ -409,7 +491,22 @@ void AP_RobotisServo::update()
         float v = float(pwm - min) / (max - min);
         uint32_t value = pos_min + v * (pos_max - pos_min);
         send_command(i+1, REG_GOAL_POSITION, value, 4);
+#if AP_SERVO_TELEM_ENABLED
+        if (i < ARRAY_SIZE(last_command_deg)) {
+            last_command_deg[i] = value * POSITION_TO_DEG;
+        }
+#endif
+    }
+
+#if AP_SERVO_TELEM_ENABLED
+    // poll all servos for telemetry with one sync read
+    const uint32_t now_ms = AP_HAL::millis();
+    if (AP_Servo_Telem::get_singleton() != nullptr &&
+        now_ms - last_telem_request_ms >= TELEM_INTERVAL_MS) {
+        last_telem_request_ms = now_ms;
+        send_telem_request();
     }
+#endif
 }
 
 #endif  // AP_ROBOTISSERVO_ENABLED
@@ -28,6 +28,7 @@
 
 #include <AP_HAL/AP_HAL.h>
 #include <AP_Param/AP_Param.h>
+#include <AP_Servo_Telem/AP_Servo_Telem_config.h>
 
 class AP_RobotisServo {
 public:
@@ -71,6 +72,15 @@ private:
 
     uint32_t last_send_us;
     uint32_t delay_time_us;
+
+#if AP_SERVO_TELEM_ENABLED
+    // poll all detected servos with a single sync read
+    void send_telem_request(void);
+    uint32_t last_telem_request_ms;
+
+    // last commanded position in degrees, reported with telemetry
+    float last_command_deg[16];
+#endif
 };
 
 #endif  // AP_ROBOTISSERVO_ENABLED
@@ -70,10 +70,26 @@ const AP_Param::GroupInfo AP_Scheduler::var_info[] = {
     // @Param: OPTIONS
     // @DisplayName: Scheduling options
     // @Description: This controls optional aspects of the scheduler.
-    // @Bitmask: 0:Enable per-task perf info
+    // @Bitmask: 0:Enable per-task perf info,1:Run offloadable tasks on a worker thread
+    // @RebootRequired: True
     // @User: Advanced
     AP_GROUPINFO("OPTIONS",  2, AP_Scheduler, _options, 0),
 
+    // @Param: SHED_LOAD
+    // @DisplayName: Load shedding threshold
+    // @Description: Average CPU load percentage above which the scheduler runs tasks with a priority value at or above SCHED_SHED_PRI at half their normal rate. Shedding is released once the load has dropped 10 percent below this threshold, giving hysteresis so the task rates do not oscillate around the threshold. Set to zero to disable load shedding.
+    // @Range: 0 100
+    // @Units: %
+    // @User: Advanced
+    AP_GROUPINFO("SHED_LOAD", 3, AP_Scheduler, _shed_load, 0),
+
+    // @Param: SHED_PRI
+    // @DisplayName: Load shedding priority threshold
+    // @Description: Tasks with a priority value at or above this are considered optional and run at half rate while load shedding is engaged. Control and sensor tasks use small priority values and run earlier in the loop; telemetry and logging niceties use large values. Only used when SCHED_SHED_LOAD is non-zero.
+    // @Range: 0 255
+    // @User: Advanced
+    AP_GROUPINFO("SHED_PRI", 4, AP_Scheduler, _shed_pri, 200),
+
     AP_GROUPEND
 };
 
@@ -143,6 +159,17 @@ void AP_Scheduler::init(const AP_Scheduler::Task *tasks, uint8_t num_tasks, uint
         perf_info.allocate_task_info(_num_tasks);
     }
 
+#if AP_SCHEDULER_OFFLOAD_ENABLED
+    if (_options & uint8_t(Options::OFFLOAD_AUX_TASKS)) {
+        // worker for tasks flagged TASK_FLAG_OFFLOAD. If thread
+        // creation fails the flagged tasks simply run inline as they
+        // always have
+        _offload_thread_created = hal.scheduler->thread_create(
+            FUNCTOR_BIND_MEMBER(&AP_Scheduler::offload_thread, void),
+            "sched_aux", 2048, AP_HAL::Scheduler::PRIORITY_IO, 0);
+    }
+#endif
+
     _log_performance_bit = log_performance_bit;
 
     // sanity check the task lists to ensure the priorities are
@@ -235,6 +262,11 @@ void AP_Scheduler::run(uint32_t time_available)
             if (interval_ticks < 1) {
                 interval_ticks = 1;
             }
+            if (_load_shedding && task.priority >= _shed_pri) {
+                // trade optional tasks for control headroom while the
+                // CPU is overloaded
+                interval_ticks *= 2;
+            }
             if (dt < interval_ticks) {
                 // this task is not yet scheduled to run again
                 continue;
@@ -252,6 +284,21 @@ void AP_Scheduler::run(uint32_t time_available)
                 task_not_achieved++;
             }
 
+#if AP_SCHEDULER_OFFLOAD_ENABLED
+            if ((task.flags & TASK_FLAG_OFFLOAD) &&
+                _offload_thread_created &&
+                _offload_task == nullptr) {
+                // hand this task to the worker thread; it costs no
+                // main-loop budget. If the worker is still busy with
+                // an earlier task we fall through and run inline
+                _last_run[i] = _tick_counter;
+                _offload_task_index = i;
+                _offload_task = &task;
+                _offload_sem.signal();
+                continue;
+            }
+#endif
+
             if (_task_time_allowed > time_available) {
                 // not enough time to run this task.  Continue loop -
                 // maybe another task will fit into time remaining
@@ -316,6 +363,33 @@ void AP_Scheduler::run(uint32_t time_available)
     }
 }
 
+#if AP_SCHEDULER_OFFLOAD_ENABLED
+/*
+  worker thread for tasks flagged TASK_FLAG_OFFLOAD. Runs at IO
+  priority so offloaded work only consumes cycles the main loop and
+  drivers do not want
+ */
+void AP_Scheduler::offload_thread(void)
+{
+    while (true) {
+        _offload_sem.wait_blocking();
+        const Task *task = _offload_task;
+        if (task == nullptr) {
+            continue;
+        }
+        const uint32_t time_started = AP_HAL::micros();
+        task->function();
+        const uint32_t time_taken = AP_HAL::micros() - time_started;
+        perf_info.update_task_info(_offload_task_index, time_taken,
+                                   time_taken > task->max_time_micros);
+        // clearing the mailbox only after the task has completed is
+        // the completion fence run() relies on before dispatching the
+        // next offloadable task
+        _offload_task = nullptr;
+    }
+}
+#endif  // AP_SCHEDULER_OFFLOAD_ENABLED
+
 /*
   return number of micros until the current task reaches its deadline
  */
@@ -328,6 +402,43 @@ uint16_t AP_Scheduler::time_available_usec(void) const
     return _task_time_allowed - dt;
 }
 
+/*
+  return true if the current task is over its max_time_micros budget
+  and should yield. Callers are expected to stop work and resume from
+  saved state on their next scheduled run
+ */
+bool AP_Scheduler::budget_exceeded(void)
+{
+    const uint32_t dt = AP_HAL::micros() - _task_time_started;
+    if (dt <= _task_time_allowed) {
+        return false;
+    }
+    _task_yields++;
+    return true;
+}
+
+/*
+  engage or release automatic load shedding based on the load
+  average. The 10% gap between the engage and release thresholds
+  provides hysteresis so task rates do not oscillate when the load sits
+  near the threshold
+ */
+void AP_Scheduler::update_load_shedding(void)
+{
+    if (_shed_load <= 0) {
+        _load_shedding = false;
+        return;
+    }
+    const float load = load_average();
+    if (!_load_shedding && load >= _shed_load * 0.01f) {
+        _load_shedding = true;
+        debug(2, "Scheduler load shedding engaged (load %u%%)\n", (unsigned)(load * 100));
+    } else if (_load_shedding && load <= (_shed_load - 10) * 0.01f) {
+        _load_shedding = false;
+        debug(2, "Scheduler load shedding released (load %u%%)\n", (unsigned)(load * 100));
+    }
+}
+
 /*
   calculate load average as a number from 0 to 1
  */
@@ -395,6 +506,9 @@ void AP_Scheduler::loop()
     // add in extra loop time determined by not achieving scheduler tasks
     time_available += extra_loop_us;
 
+    // update load shedding state before running the tasks
+    update_load_shedding();
+
     // run the tasks
     run(time_available);
 
@@ -475,6 +589,7 @@ void AP_Scheduler::Log_Write_Performance()
         i2c_count        : pd.i2c_count,
         i2c_isr_count    : pd.i2c_isr_count,
         extra_loop_us    : extra_loop_us,
+        task_yields      : _task_yields,
         rtc              : rtc,
     };
     AP::logger().WriteCriticalBlock(&pkt, sizeof(pkt));
@@ -51,6 +51,23 @@
     .priority = _priority \
 }
 
+/*
+  variant of SCHED_TASK_CLASS for tasks with no ordering requirement
+  relative to the rest of the task table. When SCHED_OPTIONS enables
+  offload these may run on a low-priority worker thread instead of the
+  main loop, so they must not rely on running before or after any other
+  task in the same tick. Tasks keeping such a flag honest is the
+  author's responsibility - the scheduler cannot check it.
+ */
+#define SCHED_TASK_CLASS_OFFLOADABLE(classname, classptr, func, _rate_hz, _max_time_micros, _priority) { \
+    .function = FUNCTOR_BIND(classptr, &classname::func, void),\
+    AP_SCHEDULER_NAME_INITIALIZER(classname, func)\
+    .rate_hz = _rate_hz,\
+    .max_time_micros = _max_time_micros,        \
+    .priority = _priority, \
+    .flags = AP_Scheduler::TASK_FLAG_OFFLOAD \
+}
+
 /*
   useful macro for creating the fastloop task table
  */
@@ -91,10 +108,18 @@ public:
         float rate_hz;
         uint16_t max_time_micros;
         uint8_t priority; // task priority
+        uint8_t flags;    // task flags, see TaskFlags
+    };
+
+    // flags for the Task::flags field. Tables built with SCHED_TASK /
+    // SCHED_TASK_CLASS leave this zero
+    enum TaskFlags : uint8_t {
+        TASK_FLAG_OFFLOAD = 1U << 0, // task has no ordering requirement and may run on the worker thread
     };
 
     enum class Options : uint8_t {
-        RECORD_TASK_INFO = 1 << 0
+        RECORD_TASK_INFO = 1 << 0,
+        OFFLOAD_AUX_TASKS = 1 << 1,
     };
 
     enum FastTaskPriorities {
@@ -132,6 +157,14 @@ public:
     // return the number of microseconds available for the current task
     uint16_t time_available_usec(void) const;
 
+    // return true if the currently running task has used up its
+    // max_time_micros allowance. Long-running tasks can poll this at
+    // points where their state allows resumption and yield, picking
+    // the work up again on their next scheduled run. Only valid from
+    // the main thread. Each true return is counted as a voluntary
+    // yield and logged in PM.Yld
+    bool budget_exceeded(void);
+
     // return debug parameter
     uint8_t debug_flags(void) { return _debug; }
 
@@ -175,6 +208,25 @@ public:
         return perf_info.get_filtered_loop_rate_hz();
     }
 
+    // performance metrics for scripting load-shedding. These are
+    // plain reads of counters maintained by the main loop; no locks
+    // are taken so they are safe to poll at script rate
+
+    // average loop time over the current logging interval in microseconds
+    uint32_t get_avg_loop_time_us(void) const {
+        return perf_info.get_avg_time();
+    }
+
+    // number of slow loops in the current logging interval
+    uint16_t get_num_long_running(void) const {
+        return perf_info.get_num_long_running();
+    }
+
+    // total number of task overruns since boot
+    uint32_t get_task_overrun_count(void) const {
+        return perf_info.get_task_overrun_count();
+    }
+
     // get the time in seconds that the last loop took
     float get_last_loop_time_s(void) const {
         return _last_loop_time_s;
@@ -190,6 +242,12 @@ public:
         return extra_loop_us;
     }
 
+    // true while automatic load shedding is engaged and optional
+    // tasks are being run at reduced rate
+    bool load_shedding_active(void) const {
+        return _load_shedding;
+    }
+
     HAL_Semaphore &get_semaphore(void) { return _rsem; }
 
     void task_info(ExpandingString &str);
@@ -211,7 +269,20 @@ private:
 
     // scheduler options
     AP_Int8 _options;
-    
+
+    // load percentage above which optional tasks are run at reduced
+    // rate. zero disables load shedding
+    AP_Int8 _shed_load;
+
+    // lowest task priority value considered optional for load shedding
+    AP_Int16 _shed_pri;
+
+    // true while load shedding is engaged
+    bool _load_shedding;
+
+    // engage/release load shedding based on the load average
+    void update_load_shedding(void);
+
     // calculated loop period in usec
     uint16_t _loop_period_us;
 
@@ -269,11 +340,27 @@ private:
     // cope with low CPU conditions
     uint32_t task_not_achieved;
     uint32_t task_all_achieved;
+
+    // number of times a task polled budget_exceeded() and was told to
+    // yield
+    uint32_t _task_yields;
     
     // extra time available for each loop - used to dynamically adjust
     // the loop rate in case we are well over budget
     uint32_t extra_loop_us;
 
+#if AP_SCHEDULER_OFFLOAD_ENABLED
+    // worker thread executing tasks flagged TASK_FLAG_OFFLOAD. A
+    // single-slot mailbox: run() only dispatches while _offload_task
+    // is nullptr and the worker stores nullptr back once the task has
+    // completed, so at most one offloaded task is ever in flight and a
+    // task can never run concurrently with itself
+    void offload_thread(void);
+    const Task *_offload_task;
+    uint8_t _offload_task_index;
+    HAL_BinarySemaphore _offload_sem;
+    bool _offload_thread_created;
+#endif
 
     // semaphore that is held while not waiting for ins samples
     HAL_Semaphore _rsem;
@@ -9,3 +9,15 @@
 #ifndef AP_SCHEDULER_EXTENDED_TASKINFO_ENABLED
 #define AP_SCHEDULER_EXTENDED_TASKINFO_ENABLED 1
 #endif
+
+// support offloading flagged tasks to a low-priority worker thread
+#ifndef AP_SCHEDULER_OFFLOAD_ENABLED
+#define AP_SCHEDULER_OFFLOAD_ENABLED AP_SCHEDULER_ENABLED
+#endif
+
+// keep a log2-bucketed run-time histogram per task in @SYS/tasks.txt.
+// Costs 24 bytes per task while SCHED_OPTIONS per-task perf info is
+// enabled
+#ifndef AP_SCHEDULER_TASK_HISTOGRAM_ENABLED
+#define AP_SCHEDULER_TASK_HISTOGRAM_ENABLED AP_SCHEDULER_EXTENDED_TASKINFO_ENABLED
+#endif
@@ -64,6 +64,10 @@ void AP::PerfInfo::free_task_info()
 // called after each run of a task to update its statistics based on measurements taken by the scheduler
 void AP::PerfInfo::update_task_info(uint8_t task_index, uint16_t task_time_us, bool overrun)
 {
+    if (overrun) {
+        total_overrun_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
     if (_task_info == nullptr) {
         return;
     }
@@ -89,6 +93,13 @@ void AP::PerfInfo::TaskInfo::update(uint16_t task_time_us, bool overrun)
     if (overrun) {
         overrun_count++;
     }
+#if AP_SCHEDULER_TASK_HISTOGRAM_ENABLED
+    const uint8_t bit = task_time_us > 0 ? (31 - __builtin_clz(task_time_us)) : 0;
+    const uint8_t bucket = MIN(bit, uint8_t(NUM_TIME_BUCKETS - 1));
+    if (time_histogram[bucket] < UINT16_MAX) {
+        time_histogram[bucket]++;
+    }
+#endif
 }
 
 void AP::PerfInfo::TaskInfo::print(const char* task_name, uint32_t total_time, ExpandingString& str) const
@@ -100,13 +111,21 @@ void AP::PerfInfo::TaskInfo::print(const char* task_name, uint32_t total_time, E
         avg = MIN(uint16_t(elapsed_time_us / tick_count), 9999);
     }
 #if AP_SCHEDULER_EXTENDED_TASKINFO_ENABLED
-    const char* fmt = "%-32.32s MIN=%4u MAX=%4u AVG=%4u OVR=%3u SLP=%3u, TOT=%4.1f%%\n";
+    const char* fmt = "%-32.32s MIN=%4u MAX=%4u AVG=%4u OVR=%3u SLP=%3u, TOT=%4.1f%%";
 #else
-    const char* fmt = "%-16.16s MIN=%4u MAX=%4u AVG=%4u OVR=%3u SLP=%3u, TOT=%4.1f%%\n";
+    const char* fmt = "%-16.16s MIN=%4u MAX=%4u AVG=%4u OVR=%3u SLP=%3u, TOT=%4.1f%%";
 #endif
     str.printf(fmt, task_name,
                 unsigned(MIN(min_time_us, 9999)), unsigned(MIN(max_time_us, 9999)), unsigned(avg),
                 unsigned(MIN(overrun_count, 999)), unsigned(MIN(slip_count, 999)), pct);
+#if AP_SCHEDULER_TASK_HISTOGRAM_ENABLED
+    // run-time distribution; bucket n counts runs of 2^n to 2^(n+1)-1 us
+    str.printf(" HIST=");
+    for (uint8_t i = 0; i < NUM_TIME_BUCKETS; i++) {
+        str.printf(i == 0 ? "%u" : "/%u", unsigned(time_histogram[i]));
+    }
+#endif
+    str.printf("\n");
 }
 
 // check_loop_time - check latest loop time vs min, max and overtime threshold
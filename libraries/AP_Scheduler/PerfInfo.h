@@ -5,6 +5,7 @@
 #if AP_SCHEDULER_ENABLED
 
 #include <stdint.h>
+#include <atomic>
 #include <AP_Common/ExpandingString.h>
 
 namespace AP {
@@ -21,6 +22,14 @@ public:
         uint32_t tick_count;
         uint16_t slip_count;
         uint16_t overrun_count;
+#if AP_SCHEDULER_TASK_HISTOGRAM_ENABLED
+        // log2-bucketed run-time histogram: bucket n counts runs
+        // taking 2^n to 2^(n+1)-1 us, with the last bucket collecting
+        // the tail. Unlike max_time_us this shows the distribution, so
+        // a single cold-cache first run doesn't hide typical behaviour
+        static constexpr uint8_t NUM_TIME_BUCKETS = 12;
+        uint16_t time_histogram[NUM_TIME_BUCKETS];
+#endif
 
         void update(uint16_t task_time_us, bool overrun);
         void print(const char* task_name, uint32_t total_time, ExpandingString& str) const;
@@ -55,6 +64,13 @@ public:
     }
     // called after each run of a task to update its statistics based on measurements taken by the scheduler
     void update_task_info(uint8_t task_index, uint16_t task_time_us, bool overrun);
+    // total number of task overruns since boot. Kept independently of
+    // the optional per-task statistics and atomic so other threads
+    // (e.g. scripting) can read it without a lock
+    uint32_t get_task_overrun_count() const {
+        return total_overrun_count.load(std::memory_order_relaxed);
+    }
+
     // record that a task slipped
     void task_slipped(uint8_t task_index) {
         if (_task_info && task_index < _num_tasks) {
@@ -71,6 +87,7 @@ private:
     uint64_t sigma_time;
     uint64_t sigmasquared_time;
     uint16_t long_running;
+    std::atomic<uint32_t> total_overrun_count{0};
     uint32_t last_check_us;
     float filtered_loop_time;
     bool ignore_loop;
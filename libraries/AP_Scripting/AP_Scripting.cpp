@@ -98,6 +98,7 @@ const AP_Param::GroupInfo AP_Scripting::var_info[] = {
     // @Bitmask: 4: Disable pre-arm check
     // @Bitmask: 5: Save CRC of current scripts to loaded and running checksum parameters enabling pre-arm
     // @Bitmask: 6: Disable heap expansion on allocation failure
+    // @Bitmask: 7: Use incremental garbage collection steps instead of a full collection after each script, bounding GC pauses
     // @User: Advanced
     AP_GROUPINFO("DEBUG_OPTS", 4, AP_Scripting, _debug_options, 0),
 
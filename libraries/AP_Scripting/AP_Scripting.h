@@ -161,6 +161,7 @@ public:
         DISABLE_PRE_ARM = 1U << 4,
         SAVE_CHECKSUM = 1U << 5,
         DISABLE_HEAP_EXPANSION = 1U << 6,
+        INCREMENTAL_GC = 1U << 7,
     };
 
 private:
@@ -4,6 +4,12 @@
 
 #include "AP_Scripting_helpers.h"
 #include <AP_Scripting/lua_generated_bindings.h>
+#if AP_AHRS_ENABLED
+#include <AP_AHRS/AP_AHRS.h>
+#endif
+#if AP_RANGEFINDER_ENABLED
+#include <AP_RangeFinder/AP_RangeFinder.h>
+#endif
 
 /// Fast param access via pointer helper class
 
@@ -191,6 +197,74 @@ bool Parameter::set_default(float value)
     return false;
 }
 
+#if AP_AHRS_ENABLED
+// capture vehicle state, one AHRS semaphore take per call
+bool VehicleStateSnapshot::update()
+{
+    auto &ahrs = AP::ahrs();
+    {
+        WITH_SEMAPHORE(ahrs.get_semaphore());
+        have_location = ahrs.get_location(loc);
+        have_velocity = ahrs.get_velocity_NED(vel_ned);
+        have_quaternion = ahrs.get_quaternion(quat);
+        roll_rad = ahrs.get_roll_rad();
+        pitch_rad = ahrs.get_pitch_rad();
+        yaw_rad = ahrs.get_yaw_rad();
+        gyro = ahrs.get_gyro();
+    }
+#if AP_RANGEFINDER_ENABLED
+    have_rangefinder = false;
+    const RangeFinder *rangefinder = RangeFinder::get_singleton();
+    if (rangefinder != nullptr &&
+        rangefinder->has_orientation(ROTATION_PITCH_270) &&
+        rangefinder->status_orient(ROTATION_PITCH_270) == RangeFinder::Status::Good) {
+        rangefinder_dist_m = rangefinder->distance_orient(ROTATION_PITCH_270);
+        have_rangefinder = true;
+    }
+#endif
+    timestamp_ms = AP_HAL::millis();
+    return have_location || have_velocity || have_quaternion;
+}
+
+bool VehicleStateSnapshot::get_location(Location &loc_out)
+{
+    if (!have_location) {
+        return false;
+    }
+    loc_out = loc;
+    return true;
+}
+
+bool VehicleStateSnapshot::get_velocity_NED(Vector3f &vel)
+{
+    if (!have_velocity) {
+        return false;
+    }
+    vel = vel_ned;
+    return true;
+}
+
+bool VehicleStateSnapshot::get_quaternion(Quaternion &quat_out)
+{
+    if (!have_quaternion) {
+        return false;
+    }
+    quat_out = quat;
+    return true;
+}
+
+#if AP_RANGEFINDER_ENABLED
+bool VehicleStateSnapshot::get_rangefinder_dist(float &dist_m)
+{
+    if (!have_rangefinder) {
+        return false;
+    }
+    dist_m = rangefinder_dist_m;
+    return true;
+}
+#endif
+#endif // AP_AHRS_ENABLED
+
 #if HAL_ENABLE_DRONECAN_DRIVERS
 
 #define IFACE_ALL uint8_t(((1U<<(HAL_NUM_CAN_IFACES))-1U))
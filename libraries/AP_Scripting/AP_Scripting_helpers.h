@@ -3,6 +3,9 @@
 #include <AP_Param/AP_Param.h>
 #include "lua/src/lua.hpp"
 #include <AP_DroneCAN/AP_DroneCAN.h>
+#include <AP_AHRS/AP_AHRS_config.h>
+#include <AP_RangeFinder/AP_RangeFinder_config.h>
+#include <AP_Common/Location.h>
 
 int lua_new_Parameter(lua_State *L);
 
@@ -29,6 +32,51 @@ private:
     AP_Param *vp;
 };
 
+#if AP_AHRS_ENABLED
+/*
+  coherent vehicle state snapshot. update() captures the commonly
+  polled navigation state in a single locked operation per script
+  tick; the accessors then return the captured values without any
+  further semaphore takes
+ */
+class VehicleStateSnapshot
+{
+public:
+
+    // capture vehicle state, one AHRS semaphore take per call
+    bool update();
+
+    // accessors for the captured state, all lock free
+    bool get_location(Location &loc_out);
+    bool get_velocity_NED(Vector3f &vel);
+    bool get_quaternion(Quaternion &quat_out);
+    float get_roll_rad() const { return roll_rad; }
+    float get_pitch_rad() const { return pitch_rad; }
+    float get_yaw_rad() const { return yaw_rad; }
+    Vector3f get_gyro() const { return gyro; }
+#if AP_RANGEFINDER_ENABLED
+    bool get_rangefinder_dist(float &dist_m);
+#endif
+    uint32_t time_ms() const { return timestamp_ms; }
+
+private:
+    Location loc;
+    Vector3f vel_ned;
+    Quaternion quat;
+    Vector3f gyro;
+    float roll_rad;
+    float pitch_rad;
+    float yaw_rad;
+#if AP_RANGEFINDER_ENABLED
+    float rangefinder_dist_m;
+    bool have_rangefinder;
+#endif
+    uint32_t timestamp_ms;
+    bool have_location;
+    bool have_velocity;
+    bool have_quaternion;
+};
+#endif // AP_AHRS_ENABLED
 
 #if HAL_ENABLE_DRONECAN_DRIVERS
 
@@ -90,6 +90,10 @@ function millis() end
 ---@return uint32_t_ud -- microseconds
 function micros() end
 
+-- free heap memory in bytes
+---@return uint32_t_ud -- bytes
+function available_memory() end
+
 -- receive mission command from running mission
 ---@return uint32_t_ud|nil -- command start time milliseconds
 ---@return integer|nil -- command param 1
@@ -754,6 +758,61 @@ local Parameter_ud = {}
 ---@return Parameter_ud
 function Parameter() end
 
+---@class (exact) VehicleStateSnapshot_ud
+local VehicleStateSnapshot_ud = {}
+
+-- Create a new vehicle state snapshot helper. Call update once per tick to
+-- capture position, velocity, attitude and rangefinder state in a single
+-- locked operation, then read the captured values with the accessors.
+---@return VehicleStateSnapshot_ud
+function VehicleStateSnapshot() end
+
+-- Capture the vehicle state. Takes the AHRS semaphore once; all accessors then
+-- return the captured values without any further locking.
+-- Returns false if no position, velocity or attitude estimate is available.
+---@return boolean
+function VehicleStateSnapshot_ud:update() end
+
+-- Get the captured position.
+-- Returns nil if no position estimate was available at capture time.
+---@return Location_ud|nil
+function VehicleStateSnapshot_ud:get_location() end
+
+-- Get the captured NED velocity in meters/second.
+-- Returns nil if no velocity estimate was available at capture time.
+---@return Vector3f_ud|nil
+function VehicleStateSnapshot_ud:get_velocity_NED() end
+
+-- Get the captured attitude quaternion.
+-- Returns nil if no attitude estimate was available at capture time.
+---@return Quaternion_ud|nil
+function VehicleStateSnapshot_ud:get_quaternion() end
+
+-- Get the captured roll in radians.
+---@return number
+function VehicleStateSnapshot_ud:get_roll_rad() end
+
+-- Get the captured pitch in radians.
+---@return number
+function VehicleStateSnapshot_ud:get_pitch_rad() end
+
+-- Get the captured yaw in radians.
+---@return number
+function VehicleStateSnapshot_ud:get_yaw_rad() end
+
+-- Get the captured gyro vector in radians/second.
+---@return Vector3f_ud
+function VehicleStateSnapshot_ud:get_gyro() end
+
+-- Get the captured downward facing rangefinder distance in meters.
+-- Returns nil if no healthy downward rangefinder was available at capture time.
+---@return number|nil
+function VehicleStateSnapshot_ud:get_rangefinder_dist() end
+
+-- Get the system time the snapshot was captured at in milliseconds.
+---@return uint32_t_ud
+function VehicleStateSnapshot_ud:time_ms() end
+
 -- Set the defualt value of this parameter, if the parameter has not been configured by the user its value will be updated to the new defualt.
 ---@param value number
 ---@return boolean
@@ -2577,6 +2636,39 @@ function rc:find_channel_for_option(aux_fun) end
 function rc:get_pwm(chan_num) end
 
 
+-- The scheduler library exposes main loop performance metrics so
+-- scripts can shed optional work when CPU headroom shrinks. All reads
+-- are lock free
+scheduler = {}
+
+-- main loop load average between 0 and 1, 1 means no spare time
+---@return number -- load average
+function scheduler:load_average() end
+
+-- configured main loop rate
+---@return integer -- loop rate in Hz
+function scheduler:get_loop_rate_hz() end
+
+-- filtered achieved main loop rate
+---@return number -- loop rate in Hz
+function scheduler:get_filtered_loop_rate_hz() end
+
+-- average loop time over the current logging interval
+---@return uint32_t_ud -- microseconds
+function scheduler:get_avg_loop_time_us() end
+
+-- number of slow loops in the current logging interval
+---@return integer -- slow loop count
+function scheduler:get_num_long_running() end
+
+-- total number of scheduler task overruns since boot
+---@return uint32_t_ud -- overrun count
+function scheduler:get_task_overrun_count() end
+
+-- extra time being added to each loop to cope with overload
+---@return uint32_t_ud -- microseconds
+function scheduler:get_extra_loop_us() end
+
 -- desc
 SRV_Channels = {}
 
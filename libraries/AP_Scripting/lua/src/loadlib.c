@@ -497,12 +497,62 @@ static int checkload (lua_State *L, int stat, const char *filename) {
 }
 
 
+#if defined(ARDUPILOT_BUILD)
+/*
+** registry key of the compiled chunk cache shared by all scripts.
+** The cache maps a module's filename to the binary dump of its
+** compiled chunk so later scripts requiring the same module skip the
+** file read and compile. Caching the dump rather than the closure
+** means every require still builds a fresh _ENV upvalue, so one
+** script's environment can never leak into another through a shared
+** module.
+*/
+#define AP_CHUNK_CACHE "_CHUNK_CACHE"
+
+static int chunk_writer (lua_State *L, const void *b, size_t size, void *ud) {
+  (void)L;
+  luaL_addlstring((luaL_Buffer *)ud, (const char *)b, size);
+  return 0;
+}
+#endif
+
 static int searcher_Lua (lua_State *L) {
   const char *filename;
   const char *name = luaL_checkstring(L, 1);
   filename = findfile(L, name, "path", LUA_LSUBSEP);
   if (filename == NULL) return 1;  /* module not found in this path */
+#if defined(ARDUPILOT_BUILD)
+  luaL_getsubtable(L, LUA_REGISTRYINDEX, AP_CHUNK_CACHE);
+  if (lua_getfield(L, -1, filename) == LUA_TSTRING) {  /* cached chunk? */
+    size_t sz;
+    const char *dump = lua_tolstring(L, -1, &sz);
+    int stat = (luaL_loadbufferx(L, dump, sz, filename, "b") == LUA_OK);
+    lua_remove(L, -2);  /* remove dump */
+    lua_remove(L, -2);  /* remove cache table */
+    return checkload(L, stat, filename);
+  }
+  lua_pop(L, 1);  /* remove failed field lookup */
+  if (luaL_loadfile(L, filename) != LUA_OK) {
+    lua_remove(L, -2);  /* remove cache table below error message */
+    return checkload(L, 0, filename);
+  }
+  {  /* store the dump of the compiled chunk for the next script */
+    luaL_Buffer b;
+    luaL_buffinit(L, &b);
+    if (lua_dump(L, chunk_writer, &b, 0) == 0) {
+      luaL_pushresult(&b);
+      lua_setfield(L, -3, filename);  /* cache[filename] = dump */
+    }
+    else {
+      luaL_pushresult(&b);
+      lua_pop(L, 1);  /* discard partial dump */
+    }
+  }
+  lua_remove(L, -2);  /* remove cache table */
+  return checkload(L, 1, filename);
+#else
   return checkload(L, (luaL_loadfile(L, filename) == LUA_OK), filename);
+#endif
 }
 
 
@@ -59,6 +59,15 @@ int lua_micros(lua_State *L) {
     return 1;
 }
 
+// free heap memory, cheap enough for load-shedding scripts to poll
+int lua_available_memory(lua_State *L) {
+    binding_argcheck(L, 0);
+
+    *new_uint32_t(L) = hal.util->available_memory();
+
+    return 1;
+}
+
 #if HAL_GCS_ENABLED
 int lua_mavlink_init(lua_State *L) {
     fix_dot_access_never_add_another_call(L, "mavlink");
@@ -1024,10 +1033,12 @@ int lua_get_current_env_ref()
 }
 
 // This is used when loading modules with require, lua must only look in enabled directory's
+// precompiled bytecode (?.luac) is searched ahead of source so a fleet
+// build can ship compiled modules
 const char* lua_get_modules_path()
 {
-#define LUA_PATH_ROMFS "@ROMFS/scripts/modules/?.lua;" "@ROMFS/scripts/modules/?/init.lua"
-#define LUA_PATH_SCRIPTS LUA_LDIR"?.lua;"  LUA_LDIR"?/init.lua"
+#define LUA_PATH_ROMFS "@ROMFS/scripts/modules/?.luac;" "@ROMFS/scripts/modules/?.lua;" "@ROMFS/scripts/modules/?/init.lua"
+#define LUA_PATH_SCRIPTS LUA_LDIR"?.luac;" LUA_LDIR"?.lua;"  LUA_LDIR"?/init.lua"
 
     uint16_t dir_disable = AP_Scripting::get_singleton()->get_disabled_dir();
     dir_disable &= uint16_t(AP_Scripting::SCR_DIR::SCRIPTS) | uint16_t(AP_Scripting::SCR_DIR::ROMFS);
@@ -4,6 +4,7 @@
 
 int lua_millis(lua_State *L);
 int lua_micros(lua_State *L);
+int lua_available_memory(lua_State *L);
 int lua_mission_receive(lua_State *L);
 int AP_Logger_Write(lua_State *L);
 int lua_get_i2c_device(lua_State *L);
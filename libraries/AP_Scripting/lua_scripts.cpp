@@ -21,6 +21,9 @@
 #include <AP_HAL/AP_HAL.h>
 #include "AP_Scripting.h"
 #include <AP_Logger/AP_Logger.h>
+#if AP_FILESYSTEM_SYS_ENABLED
+#include <AP_Common/ExpandingString.h>
+#endif
 
 #include <AP_Scripting/lua_generated_bindings.h>
 
@@ -39,6 +42,15 @@ uint32_t lua_scripts::loaded_checksum;
 uint32_t lua_scripts::running_checksum;
 HAL_Semaphore lua_scripts::crc_sem;
 
+#if AP_FILESYSTEM_SYS_ENABLED
+struct lua_scripts::alloc_stats lua_scripts::stats[12];
+HAL_Semaphore lua_scripts::stats_sem;
+uint32_t lua_scripts::run_alloc_count;
+uint32_t lua_scripts::run_alloc_bytes;
+uint32_t lua_scripts::heap_used;
+uint32_t lua_scripts::heap_peak;
+#endif
+
 // return string error message for error object at top of stack
 static const char *get_error_object_message(lua_State *L) {
     const char *m = lua_tostring(L, -1);
@@ -257,7 +269,10 @@ void lua_scripts::load_all_scripts_in_dir(lua_State *L, const char *dirname) {
         return;
     }
 
-    // load anything that ends in .lua
+    // load anything that ends in .lua, or .luac for precompiled
+    // bytecode. The loader rejects bytecode built by a different Lua
+    // version, so a stale .luac fails with a load error rather than
+    // running
     for (struct dirent *de=AP::FS().readdir(d); de; de=AP::FS().readdir(d)) {
         uint8_t length = strlen(de->d_name);
         if (length < 5) {
@@ -265,13 +280,36 @@ void lua_scripts::load_all_scripts_in_dir(lua_State *L, const char *dirname) {
             continue;
         }
 
-        if ((de->d_name[0] == '.') || strncmp(&de->d_name[length-4], ".lua", 4)) {
-            // starts with . (hidden file) or doesn't end in .lua
+        if (de->d_name[0] == '.') {
+            // hidden file
+            continue;
+        }
+
+        const bool is_source = strncmp(&de->d_name[length-4], ".lua", 4) == 0;
+        const bool is_bytecode = (length >= 6) && (strncmp(&de->d_name[length-5], ".luac", 5) == 0);
+        if (!is_source && !is_bytecode) {
             continue;
         }
 
         // FIXME: because chunk name fetching is not working we are allocating and storing an extra string we shouldn't need to
         size_t size = strlen(dirname) + strlen(de->d_name) + 2;
+
+        if (is_source) {
+            // if a precompiled copy of this script exists alongside
+            // the source then skip the source; the .luac is loaded
+            // when its own directory entry comes up
+            const size_t csize = size + 1;
+            char *cname = (char *)_heap.allocate(csize);
+            if (cname != nullptr) {
+                snprintf(cname, csize, "%s/%sc", dirname, de->d_name);
+                struct stat st;
+                const bool have_bytecode = AP::FS().stat(cname, &st) == 0;
+                _heap.deallocate(cname);
+                if (have_bytecode) {
+                    continue;
+                }
+            }
+        }
         char * filename = (char *) _heap.allocate(size);
         script_info *script = (script_info *)_heap.allocate(sizeof(script_info));
         if ((filename == nullptr) || (script == nullptr)) {
@@ -472,8 +510,78 @@ MultiHeap lua_scripts::_heap;
 
 void *lua_scripts::alloc(void *ud, void *ptr, size_t osize, size_t nsize) {
     (void)ud; /* not used */
-    return _heap.change_size(ptr, osize, nsize);
+    void *ret = _heap.change_size(ptr, osize, nsize);
+#if AP_FILESYSTEM_SYS_ENABLED
+    // account for heap usage. Note that when ptr is null osize encodes
+    // the type of the new object, not a size
+    if (ptr == nullptr) {
+        if (ret != nullptr && nsize > 0) {
+            run_alloc_count++;
+            run_alloc_bytes += nsize;
+            heap_used += nsize;
+        }
+    } else if (nsize == 0) {
+        heap_used -= osize;
+    } else if (ret != nullptr) {
+        if (nsize > osize) {
+            run_alloc_count++;
+            run_alloc_bytes += nsize - osize;
+            heap_used += nsize - osize;
+        } else {
+            heap_used -= osize - nsize;
+        }
+    }
+    if (heap_used > heap_peak) {
+        heap_peak = heap_used;
+    }
+#endif
+    return ret;
+}
+
+#if AP_FILESYSTEM_SYS_ENABLED
+// fold the allocation counters of the last script run into the slot
+// for the named script
+void lua_scripts::record_alloc_stats(const char *name)
+{
+    const char *name_short = strrchr(name, '/');
+    if (name_short != nullptr) {
+        name = name_short + 1;
+    }
+    WITH_SEMAPHORE(stats_sem);
+    for (auto &s : stats) {
+        if (s.name[0] != 0 && strncmp(s.name, name, sizeof(s.name)) != 0) {
+            continue;
+        }
+        if (s.name[0] == 0) {
+            strncpy_noterm(s.name, name, sizeof(s.name));
+        }
+        s.runs++;
+        s.allocs += run_alloc_count;
+        s.alloc_bytes += run_alloc_bytes;
+        s.peak_bytes = MAX(s.peak_bytes, heap_peak);
+        return;
+    }
+    // table full, stats for this script are dropped
+}
+
+void lua_scripts::alloc_info(ExpandingString &str)
+{
+    str.printf("heap used %u bytes\n", unsigned(heap_used));
+    str.printf("%-16s %8s %10s %12s %10s\n", "NAME", "RUNS", "ALLOCS", "BYTES", "PEAK");
+    WITH_SEMAPHORE(stats_sem);
+    for (const auto &s : stats) {
+        if (s.name[0] == 0) {
+            continue;
+        }
+        str.printf("%-16.16s %8u %10u %12u %10u\n",
+                   s.name,
+                   unsigned(s.runs),
+                   unsigned(s.allocs),
+                   unsigned(s.alloc_bytes),
+                   unsigned(s.peak_bytes));
+    }
 }
+#endif // AP_FILESYSTEM_SYS_ENABLED
 
 void lua_scripts::run(void) {
     if (!_heap.available()) {
@@ -607,6 +715,12 @@ int lua_scripts::run_engine(lua_State *L) {
             const int startMem = lua_gc(L, LUA_GCCOUNT, 0) * 1024 + lua_gc(L, LUA_GCCOUNTB, 0);
             const uint32_t loadEnd = AP_HAL::micros();
 
+#if AP_FILESYSTEM_SYS_ENABLED
+            run_alloc_count = 0;
+            run_alloc_bytes = 0;
+            heap_peak = heap_used;
+#endif
+
             // NOTE!  the base pointer of our scripts linked list,
             // *and all its contents* may become invalid as part of
             // "run_next_script"!  So do *NOT* attempt to access
@@ -622,9 +736,33 @@ int lua_scripts::run_engine(lua_State *L) {
 
             update_stats(script_name, runEnd - loadEnd, endMem, endMem - startMem);
 
+#if AP_FILESYSTEM_SYS_ENABLED
+            record_alloc_stats(script_name);
+#endif
 
             // garbage collect after each script, this shouldn't matter, but seems to resolve a memory leak
-            lua_gc(L, LUA_GCCOLLECT, 0);
+            if (option_is_set(AP_Scripting::DebugOption::INCREMENTAL_GC)) {
+                // run bounded GC steps in the idle time before the
+                // next script is due rather than a full collection,
+                // trading some memory headroom for bounded pauses
+                uint32_t budget_us = 1000;
+                if (scripts != nullptr) {
+                    const uint64_t now_ms = AP_HAL::millis64();
+                    if (scripts->next_run_ms > now_ms) {
+                        const uint64_t idle_ms = scripts->next_run_ms - now_ms;
+                        budget_us = idle_ms >= 5 ? 5000 : uint32_t(idle_ms * 1000);
+                    }
+                }
+                const uint32_t gc_start_us = AP_HAL::micros();
+                while ((AP_HAL::micros() - gc_start_us) < budget_us) {
+                    if (lua_gc(L, LUA_GCSTEP, 0) == 1) {
+                        // collection cycle complete
+                        break;
+                    }
+                }
+            } else {
+                lua_gc(L, LUA_GCCOLLECT, 0);
+            }
 
         } else {
             if (option_is_set(AP_Scripting::DebugOption::NO_SCRIPTS_TO_RUN)) {
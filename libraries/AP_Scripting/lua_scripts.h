@@ -23,6 +23,7 @@
 #include <AP_HAL/ap_setjmp.h>
 
 #include <AP_Filesystem/posix_compat.h>
+#include <AP_Filesystem/AP_Filesystem_config.h>
 #include <AP_Scripting/AP_Scripting.h>
 #include <GCS_MAVLink/GCS_MAVLink.h>
 #include <AP_HAL/Semaphores.h>
@@ -31,6 +32,8 @@
 
 #include "lua/src/lua.hpp"
 
+class ExpandingString;
+
 class lua_scripts;
 
 static inline lua_scripts* ls_object_from_state(lua_State *L) {
@@ -104,6 +107,27 @@ private:
 
     static MultiHeap _heap;
 
+#if AP_FILESYSTEM_SYS_ENABLED
+    // per-script allocation statistics, maintained by alloc() and
+    // folded into a slot per script after each run for @SYS/scripts.txt
+    struct alloc_stats {
+        char name[16];        // script name, without directory
+        uint32_t runs;
+        uint32_t allocs;
+        uint32_t alloc_bytes;
+        uint32_t peak_bytes;  // scripting heap high-water mark seen while this script ran
+    };
+    static struct alloc_stats stats[12];
+    static HAL_Semaphore stats_sem;
+    static void record_alloc_stats(const char *name);
+
+    // allocation counters, updated only in the scripting thread
+    static uint32_t run_alloc_count;
+    static uint32_t run_alloc_bytes;
+    static uint32_t heap_used;    // bytes currently allocated from the scripting heap
+    static uint32_t heap_peak;    // high-water mark of heap_used, reset before each script run
+#endif
+
     // helper for print and log of runtime stats
     void update_stats(const char *name, uint32_t run_time, int total_mem, int run_mem);
 
@@ -133,6 +157,11 @@ public:
     static uint32_t get_loaded_checksum();
     static uint32_t get_running_checksum();
 
+#if AP_FILESYSTEM_SYS_ENABLED
+    // fill in per-script allocation statistics for @SYS/scripts.txt
+    static void alloc_info(ExpandingString &str);
+#endif
+
 };
 
 #endif  // AP_SCRIPTING_ENABLED
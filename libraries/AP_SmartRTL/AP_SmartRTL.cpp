@@ -393,6 +393,11 @@ void AP_SmartRTL::run_background_cleanup()
     // perform routine cleanup which removes 10 to 50 points if possible
     routine_cleanup(path_points_count, path_points_completed_limit);
 
+    // update pruning debt: the number of path points the loop detection has
+    // not yet covered.  persistently large values mean cleanup is falling
+    // behind point capture
+    _prune.debt = (path_points_count > _prune.path_points_completed) ? (path_points_count - _prune.path_points_completed) : 0;
+
     // warn if buffer is about to be filled
     uint32_t now_ms = AP_HAL::millis();
     if ((path_points_count >0) && (path_points_count >= _path_points_max - 9) && (now_ms - _last_low_space_notify_ms > 10000)) {
@@ -400,6 +405,12 @@ void AP_SmartRTL::run_background_cleanup()
        _last_low_space_notify_ms = now_ms;
     }
 
+    // warn if pruning is falling badly behind; it must catch up before the
+    // path fills or SmartRTL will deactivate
+    if ((_prune.debt > _path_points_max / 2) && (now_ms - _last_prune_debt_notify_ms > 10000)) {
+        GCS_SEND_TEXT(MAV_SEVERITY_INFO, "SmartRTL: pruning %u points behind", (unsigned)_prune.debt);
+        _last_prune_debt_notify_ms = now_ms;
+    }
 }
 
 // routine cleanup is called regularly from run_background_cleanup
@@ -600,8 +611,35 @@ void AP_SmartRTL::detect_loops()
             }
         }
 
+        // update the outer segment's bounding box (expanded by the pruning
+        // delta) when the outer loop index changes
+        if (_prune.i != _prune.bounds_i) {
+            const Vector3f &s1 = _path[_prune.i-1];
+            const Vector3f &s2 = _path[_prune.i];
+            _prune.seg_bounds_min = Vector3f{MIN(s1.x, s2.x), MIN(s1.y, s2.y), MIN(s1.z, s2.z)};
+            _prune.seg_bounds_max = Vector3f{MAX(s1.x, s2.x), MAX(s1.y, s2.y), MAX(s1.z, s2.z)};
+            const Vector3f delta {SMARTRTL_PRUNING_DELTA, SMARTRTL_PRUNING_DELTA, SMARTRTL_PRUNING_DELTA};
+            _prune.seg_bounds_min -= delta;
+            _prune.seg_bounds_max += delta;
+            _prune.bounds_i = _prune.i;
+        }
+
+        // cheap reject: a segment whose endpoints both lie beyond the same
+        // face of the expanded bounding box cannot come within the pruning
+        // delta of the outer segment, so skip the full distance calculation
+        const Vector3f &p1 = _path[_prune.j-1];
+        const Vector3f &p2 = _path[_prune.j];
+        if ((p1.x > _prune.seg_bounds_max.x && p2.x > _prune.seg_bounds_max.x) ||
+            (p1.x < _prune.seg_bounds_min.x && p2.x < _prune.seg_bounds_min.x) ||
+            (p1.y > _prune.seg_bounds_max.y && p2.y > _prune.seg_bounds_max.y) ||
+            (p1.y < _prune.seg_bounds_min.y && p2.y < _prune.seg_bounds_min.y) ||
+            (p1.z > _prune.seg_bounds_max.z && p2.z > _prune.seg_bounds_max.z) ||
+            (p1.z < _prune.seg_bounds_min.z && p2.z < _prune.seg_bounds_min.z)) {
+            continue;
+        }
+
         // find the closest distance between two line segments and the mid-point
-        dist_point dp = segment_segment_dist(_path[_prune.i], _path[_prune.i-1], _path[_prune.j-1], _path[_prune.j]);
+        dist_point dp = segment_segment_dist(_path[_prune.i], _path[_prune.i-1], p1, p2);
         if (dp.distance < SMARTRTL_PRUNING_DELTA) {
             // if there is a loop here, add to loop array
             if (!add_loop(_prune.j, _prune.i-1, dp.midpoint)) {
@@ -656,6 +694,7 @@ void AP_SmartRTL::restart_pruning(uint16_t path_points_count)
     _prune.complete = false;
     _prune.i = (path_points_count > 0) ? path_points_count - 1 : 0;
     _prune.j = 0;
+    _prune.bounds_i = UINT16_MAX;
     _prune.path_points_count = path_points_count;
 }
 
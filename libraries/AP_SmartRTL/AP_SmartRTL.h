@@ -41,6 +41,11 @@ public:
     // returns number of points on the path
     uint16_t get_num_points() const;
 
+    // returns the number of path points the background pruning has not yet checked
+    // for loops.  A persistently large value means cleanup is falling behind point
+    // capture and SmartRTL is at risk of deactivating when the path fills
+    uint16_t get_pruning_debt() const { return _prune.debt; }
+
     // get a point on the path
     const Vector3f& get_point(uint16_t index) const { return _path[index]; }
 
@@ -197,6 +202,7 @@ private:
     uint32_t _thorough_clean_request_ms;// the last system time the thorough cleanup was requested (set by thorough_cleanup method, used by background cleanup)
     uint32_t _thorough_clean_complete_ms; // set to _thorough_clean_request_ms when the background thread completes the thorough cleanup
     uint32_t _last_low_space_notify_ms; //last time low on SmartRTL space was notified on Mavlink. Minimum time is required before re-notification to avoid nagging.
+    uint32_t _last_prune_debt_notify_ms; //last time falling-behind pruning was notified on Mavlink, throttled as above
     ThoroughCleanupType _thorough_clean_type;   // used by example sketch to test simplify and prune separately
 
     // path variables
@@ -236,6 +242,10 @@ private:
         uint16_t path_points_completed; // number of points in that path that have already been checked for loops and should be ignored
         uint16_t i;     // loop search's outer loop index
         uint16_t j;     // loop search's inner loop index
+        uint16_t bounds_i;  // outer loop index for which seg_bounds_min/max are valid (UINT16_MAX if none)
+        Vector3f seg_bounds_min;    // bounding box of the outer loop's segment expanded by the pruning
+        Vector3f seg_bounds_max;    // delta, used to cheaply reject inner segments that cannot be close
+        uint16_t debt;      // number of path points not yet checked for loops, updated each background cleanup
         prune_loop_t* loops;// the result of the pruning algorithm
         uint16_t loops_max; // maximum number of elements in the _prunable_loops array
         uint16_t loops_count;   // number of elements in the _prunable_loops array
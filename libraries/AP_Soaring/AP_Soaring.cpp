@@ -325,7 +325,14 @@ void SoaringController::update_thermalling()
         return;
     }
 
-    Vector3f wind_drift = _ahrs.wind_estimate()*deltaT*_vario.get_filtered_climb()/_ekf.X[0];
+    // use the smoothed AHRS wind; thermal drift integration wants the
+    // mean wind, not per-loop estimator noise
+    Vector3f wind;
+    float wind_uncertainty_ms;
+    if (!_ahrs.wind_estimate_smoothed(wind, wind_uncertainty_ms)) {
+        wind = _ahrs.wind_estimate();
+    }
+    Vector3f wind_drift = wind*deltaT*_vario.get_filtered_climb()/_ekf.X[0];
 
     // update the filter
     _ekf.update(_vario.reading, current_position.x, current_position.y, wind_drift.x, wind_drift.y);
@@ -392,7 +399,13 @@ void SoaringController::update_cruising()
     // Calculate the optimal airspeed for the current conditions of wind along current direction,
     // expected lift in next thermal and filtered sink rate.
 
-    Vector3f wind    = AP::ahrs().wind_estimate();
+    // speed-to-fly should respond to the mean wind, so prefer the
+    // smoothed AHRS estimate
+    Vector3f wind;
+    float wind_uncertainty_ms;
+    if (!AP::ahrs().wind_estimate_smoothed(wind, wind_uncertainty_ms)) {
+        wind = AP::ahrs().wind_estimate();
+    }
     Vector3f wind_bf = AP::ahrs().earth_to_body(wind);
 
     const float wx = wind_bf.x;
@@ -401,23 +401,25 @@ void AP_TECS::_update_speed(float DT)
 
     // Convert equivalent airspeeds to true airspeeds and harmonise limits
 
-    float EAS2TAS = _ahrs.get_EAS2TAS();
+    const float EAS2TAS = _ahrs.get_EAS2TAS();
+    const float TASmin_param = aparm.airspeed_min * EAS2TAS;
+    const float TASmax_param = aparm.airspeed_max * EAS2TAS;
     _TAS_dem = _EAS_dem * EAS2TAS;
     if (_flags.reset || !should_use_airspeed) {
-        _TASmax = aparm.airspeed_max * EAS2TAS;
+        _TASmax = TASmax_param;
     } else if (_thr_clip_status == clipStatus::MAX) {
         // wind down airspeed upper limit  to prevent a situation where the aircraft can't climb
         // at the maximum speed
-        const float velRateMin = 0.5f * _STEdot_min / MAX(_TAS_state, aparm.airspeed_min * EAS2TAS);
+        const float velRateMin = 0.5f * _STEdot_min / MAX(_TAS_state, TASmin_param);
         _TASmax += _DT * velRateMin;
         _TASmax = MAX(_TASmax, aparm.airspeed_cruise * EAS2TAS);
     } else {
         // wind airspeed upper limit back to parameter defined value
-        const float velRateMax = 0.5f * _STEdot_max / MAX(_TAS_state, aparm.airspeed_min * EAS2TAS);
+        const float velRateMax = 0.5f * _STEdot_max / MAX(_TAS_state, TASmin_param);
         _TASmax += _DT * velRateMax;
     }
-    _TASmax   = MIN(_TASmax, aparm.airspeed_max * EAS2TAS);
-    _TASmin   = aparm.airspeed_min * EAS2TAS;
+    _TASmax   = MIN(_TASmax, TASmax_param);
+    _TASmin   = TASmin_param;
 
     if (_landing.is_on_final() && is_positive(aparm.airspeed_stall)) {
         _TASmin = aparm.airspeed_stall * EAS2TAS;
@@ -80,8 +80,8 @@ const AP_Param::GroupInfo AP_Terrain::var_info[] = {
 
     // @Param: CACHE_SZ
     // @DisplayName: Terrain cache size
-    // @Description: The number of 32x28 cache blocks to keep in memory. Each block uses about 1800 bytes of memory
-    // @Range: 0 128
+    // @Description: The number of 32x28 cache blocks to keep in memory. Each block uses about 1800 bytes of memory. On boards with plenty of RAM this can be raised far enough to keep the terrain for the whole mission area resident, avoiding disk reads in flight
+    // @Range: 0 500
     // @User: Advanced
     AP_GROUPINFO("CACHE_SZ",  5, AP_Terrain, config_cache_size, TERRAIN_GRID_BLOCK_CACHE_SIZE),
 
@@ -493,6 +493,8 @@ void AP_Terrain::log_terrain_data()
         pending        : pending,
         loaded         : loaded,
         reference_offset : have_reference_offset?reference_offset:0,
+        prefetch_index : next_mission_index,
+        reads          : disk_read_count,
     };
     AP::logger().WriteBlock(&pkt, sizeof(pkt));
 }
@@ -403,9 +403,18 @@ private:
     }
 
     // cache of grids in memory, LRU
-    uint8_t cache_size = 0;
+    uint16_t cache_size = 0;
     struct grid_cache *cache = nullptr;
 
+    // generation-stamped memo of the last grid looked up. All
+    // consumers (navigation, object avoidance, scripting) tend to
+    // query the same block repeatedly, so this makes the common
+    // lookup O(1). The generation is bumped whenever a cache entry is
+    // reassigned to a different tile, invalidating the memo
+    struct grid_cache *last_grid;
+    uint32_t last_grid_generation;
+    uint32_t cache_generation;
+
     // a grid_cache block waiting for disk IO
     enum DiskIoState {
         DiskIoIdle      = 0,
@@ -471,6 +480,17 @@ private:
     // next mission position to check
     uint8_t next_mission_pos;
 
+    // previous nav waypoint, for prefetching terrain along the leg
+    // to the next waypoint
+    bool have_prev_mission_loc;
+    Location prev_mission_loc;
+
+    // how far along the current leg we have prefetched, in meters
+    float next_mission_leg_ofs;
+
+    // total grid blocks read from disk, for fetch-depth logging
+    uint32_t disk_read_count;
+
     // last time the mission changed
     uint32_t last_mission_change_ms;
 
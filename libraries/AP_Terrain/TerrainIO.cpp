@@ -20,6 +20,7 @@
 
 #if AP_TERRAIN_AVAILABLE
 
+#include <AP_AHRS/AP_AHRS.h>
 #include <AP_Filesystem/AP_Filesystem.h>
 #include <AP_HAL/AP_HAL.h>
 #include <AP_Common/AP_Common.h>
@@ -34,13 +35,34 @@ extern const AP_HAL::HAL& hal;
  */
 void AP_Terrain::check_disk_read(void)
 {
+    // service the pending block closest to the current position
+    // first, so demand reads for flight are prioritised over
+    // background mission prefetch
+    Location current_loc;
+    const bool have_loc = AP::ahrs().get_location(current_loc);
+    int16_t best_idx = -1;
+    float best_distance = 0;
     for (uint16_t i=0; i<cache_size; i++) {
-        if (cache[i].state == GRID_CACHE_DISKWAIT) {
-            disk_block.block = cache[i].grid;
-            disk_io_state = DiskIoWaitRead;
-            return;
+        if (cache[i].state != GRID_CACHE_DISKWAIT) {
+            continue;
         }
-    }    
+        if (!have_loc) {
+            best_idx = i;
+            break;
+        }
+        Location block_loc;
+        block_loc.lat = cache[i].grid.lat;
+        block_loc.lng = cache[i].grid.lon;
+        const float distance = current_loc.get_distance(block_loc);
+        if (best_idx == -1 || distance < best_distance) {
+            best_idx = i;
+            best_distance = distance;
+        }
+    }
+    if (best_idx != -1) {
+        disk_block.block = cache[best_idx].grid;
+        disk_io_state = DiskIoWaitRead;
+    }
 }
 
 /*
@@ -92,6 +114,7 @@ void AP_Terrain::schedule_disk_io(void)
             cache[cache_idx].state = GRID_CACHE_VALID;
             cache[cache_idx].last_access_ms = AP_HAL::millis();
         }
+        disk_read_count++;
         disk_io_state = DiskIoIdle;
         break;
     }
@@ -26,6 +26,7 @@
 #include <AP_Mission/AP_Mission.h>
 #include <AP_Rally/AP_Rally.h>
 #include <AP_GPS/AP_GPS.h>
+#include <AP_Scheduler/AP_Scheduler.h>
 
 extern const AP_HAL::HAL& hal;
 
@@ -45,6 +46,8 @@ void AP_Terrain::update_mission_data(void)
         // the mission has changed - start again
         next_mission_index = 1;
         next_mission_pos = 0;
+        have_prev_mission_loc = false;
+        next_mission_leg_ofs = 0;
         last_mission_change_ms = mission->last_change_time_ms();
         last_mission_spacing = grid_spacing;
     }
@@ -63,11 +66,20 @@ void AP_Terrain::update_mission_data(void)
     // don't do more than 20 waypoints at a time, to prevent too much
     // CPU usage
     for (uint8_t i=0; i<20; i++) {
+#if AP_SCHEDULER_ENABLED
+        if (AP::scheduler().budget_exceeded()) {
+            // out of main loop budget; we resume from
+            // next_mission_index on our next scheduled run
+            return;
+        }
+#endif
         // get next mission command
         AP_Mission::Mission_Command cmd;
         if (!mission->read_cmd_from_storage(next_mission_index, cmd)) {
             // nothing more to do
             next_mission_index = 0;
+            have_prev_mission_loc = false;
+            next_mission_leg_ofs = 0;
             return;
         }
 
@@ -81,10 +93,34 @@ void AP_Terrain::update_mission_data(void)
                 // nothing more to do
                 next_mission_index = 0;
                 next_mission_pos = 0;
+                have_prev_mission_loc = false;
+                next_mission_leg_ofs = 0;
                 return;
             }
         }
 
+        // prefetch terrain along the leg from the previous nav
+        // waypoint before the area around the waypoint itself, so the
+        // path between widely spaced waypoints is covered and a fast
+        // aircraft doesn't outrun the fetcher mid-leg
+        if (have_prev_mission_loc) {
+            const float leg_length = prev_mission_loc.get_distance(cmd.content.location);
+            if (next_mission_leg_ofs < leg_length) {
+                Location loc = prev_mission_loc;
+                loc.offset_bearing(prev_mission_loc.get_bearing_to(cmd.content.location) * 0.01f, next_mission_leg_ofs);
+                float leg_height;
+                if (!height_amsl(loc, leg_height)) {
+                    // if we can't get data for a leg point then return
+                    // and check again next time
+                    return;
+                }
+                // a grid block spans 32 grid points, so stepping 16
+                // spacings touches every block along the leg
+                next_mission_leg_ofs += grid_spacing.get() * 16;
+                continue;
+            }
+        }
+
         // we will fetch 5 points around the waypoint. Four at 10 grid
         // spacings away at 45, 135, 225 and 315 degrees, and the
         // point itself
@@ -107,6 +143,9 @@ void AP_Terrain::update_mission_data(void)
 #endif
 
             // move to next waypoint
+            prev_mission_loc = cmd.content.location;
+            have_prev_mission_loc = true;
+            next_mission_leg_ofs = 0;
             next_mission_index++;
             next_mission_pos = 0;
         }
@@ -145,6 +184,13 @@ void AP_Terrain::update_rally_data(void)
     }
 
     while (true) {
+#if AP_SCHEDULER_ENABLED
+        if (AP::scheduler().budget_exceeded()) {
+            // out of main loop budget; we resume from
+            // next_rally_index on our next scheduled run
+            return;
+        }
+#endif
         // get next rally point
         struct RallyLocation rp;
         if (!rally->get_rally_point_with_index(next_rally_index, rp)) {
@@ -106,26 +106,55 @@ void AP_Terrain::calculate_grid_info(const Location &loc, struct grid_info &info
  */
 AP_Terrain::grid_cache &AP_Terrain::find_grid_cache(const struct grid_info &info)
 {
+    const auto now_ms = AP_HAL::millis();
+
+    // fast path: repeated lookups of the same block are the common
+    // case for all consumers, so check the generation-stamped memo of
+    // the last lookup before scanning the cache
+    if (last_grid != nullptr &&
+        last_grid_generation == cache_generation &&
+        TERRAIN_LATLON_EQUAL(last_grid->grid.lat,info.grid_lat) &&
+        TERRAIN_LATLON_EQUAL(last_grid->grid.lon,info.grid_lon) &&
+        last_grid->grid.spacing == grid_spacing) {
+        last_grid->last_access_ms = now_ms;
+        return *last_grid;
+    }
+
     uint16_t oldest_i = 0;
+    int32_t oldest_idle_i = -1;
 
     // see if we have that grid
-    const auto now_ms = AP_HAL::millis();
     for (uint16_t i=0; i<cache_size; i++) {
         if (TERRAIN_LATLON_EQUAL(cache[i].grid.lat,info.grid_lat) &&
             TERRAIN_LATLON_EQUAL(cache[i].grid.lon,info.grid_lon) &&
             cache[i].grid.spacing == grid_spacing) {
             cache[i].last_access_ms = now_ms;
+            last_grid = &cache[i];
+            last_grid_generation = cache_generation;
             return cache[i];
         }
         if (cache[i].last_access_ms < cache[oldest_i].last_access_ms) {
             oldest_i = i;
         }
+        // track the oldest block with no disk IO outstanding; we
+        // prefer not to evict blocks that are waiting to be read or
+        // written
+        if (cache[i].state != GRID_CACHE_DISKWAIT &&
+            cache[i].state != GRID_CACHE_DIRTY &&
+            (oldest_idle_i == -1 ||
+             cache[i].last_access_ms < cache[oldest_idle_i].last_access_ms)) {
+            oldest_idle_i = i;
+        }
+    }
+    if (oldest_idle_i != -1) {
+        oldest_i = oldest_idle_i;
     }
 
     // Not found. Use the oldest grid and make it this grid,
     // initially unpopulated
     struct grid_cache &grid = cache[oldest_i];
     memset(&grid, 0, sizeof(grid));
+    cache_generation++;
 
     grid.grid.lat = info.grid_lat;
     grid.grid.lon = info.grid_lon;
@@ -141,6 +170,9 @@ AP_Terrain::grid_cache &AP_Terrain::find_grid_cache(const struct grid_info &info
     // mark as waiting for disk read
     grid.state = GRID_CACHE_DISKWAIT;
 
+    last_grid = &grid;
+    last_grid_generation = cache_generation;
+
     return grid;
 }
 
@@ -22,6 +22,7 @@
 #include <AP_HAL_ChibiOS/hwdef/common/stm32_util.h>
 #endif
 #include <AP_DDS/AP_DDS_Client.h>
+#include <AP_Common/ExpandingString.h>
 #if HAL_WITH_IO_MCU
 #include <AP_IOMCU/AP_IOMCU.h>
 extern AP_IOMCU iomcu;
@@ -302,6 +303,12 @@ AP_Vehicle& vehicle = *AP_Vehicle::get_singleton();
 extern AP_Vehicle& vehicle;
 #endif
 
+#if AP_BOOT_TIMING_ENABLED
+#define BOOT_STAGE(name) boot_stage(name)
+#else
+#define BOOT_STAGE(name) do {} while (0)
+#endif
+
 /*
   setup is called when the sketch starts
  */
@@ -329,6 +336,8 @@ void AP_Vehicle::setup()
     AP_Param::check_var_info();
     load_parameters();
 
+    BOOT_STAGE("parameters");
+
 #if CONFIG_HAL_BOARD == HAL_BOARD_CHIBIOS
     if (AP_BoardConfig::get_sdcard_slowdown() != 0) {
         // user wants the SDcard slower, we need to remount
@@ -376,6 +385,8 @@ void AP_Vehicle::setup()
     gcs().setup_console();
 #endif
 
+    BOOT_STAGE("serial");
+
 #if AP_SCRIPTING_ENABLED
 #if AP_SCRIPTING_SERIALDEVICE_ENABLED
     // must be done now so ports are registered and drivers get set up properly
@@ -414,6 +425,8 @@ void AP_Vehicle::setup()
     can_mgr.init();
 #endif
 
+    BOOT_STAGE("board");
+
 #if HAL_MSP_ENABLED
     // call MSP init before init_ardupilot to allow for MSP sensors
     msp.init();
@@ -423,6 +436,8 @@ void AP_Vehicle::setup()
     logger.init(get_log_bitmask(), get_log_structures(), get_num_log_structures());
 #endif
 
+    BOOT_STAGE("logger");
+
     // init cargo gripper
 #if AP_GRIPPER_ENABLED
     AP::gripper().init();
@@ -431,8 +446,11 @@ void AP_Vehicle::setup()
     // init_ardupilot is where the vehicle does most of its initialisation.
     init_ardupilot();
 
+    BOOT_STAGE("vehicle");
+
 #if AP_SCRIPTING_ENABLED
     scripting.init();
+    BOOT_STAGE("scripting");
 #endif // AP_SCRIPTING_ENABLED
 
 #if AP_AIRSPEED_ENABLED
@@ -542,6 +560,8 @@ void AP_Vehicle::setup()
     // initialisation
     AP_Param::invalidate_count();
 
+    BOOT_STAGE("peripherals");
+
     GCS_SEND_TEXT(MAV_SEVERITY_INFO, "ArduPilot Ready");
 
 #if AP_DDS_ENABLED
@@ -555,6 +575,36 @@ void AP_Vehicle::setup()
 #endif
 }
 
+#if AP_BOOT_TIMING_ENABLED
+// record completion of a named stage of setup(). The serial probe
+// timeouts of absent optional devices show up as time spent in the
+// stage that probes for them
+void AP_Vehicle::boot_stage(const char *name)
+{
+    if (num_boot_stages >= ARRAY_SIZE(boot_stages)) {
+        return;
+    }
+    boot_stages[num_boot_stages].name = name;
+    boot_stages[num_boot_stages].done_us = AP_HAL::micros();
+    num_boot_stages++;
+}
+
+/*
+  dump per-stage boot timing for @SYS/boot.txt, one line per stage of
+  setup() with the time spent in that stage
+ */
+void AP_Vehicle::boot_info(ExpandingString &str) const
+{
+    uint32_t last_us = 0;
+    for (uint8_t i = 0; i < num_boot_stages; i++) {
+        str.printf("%-12s %8u us\n", boot_stages[i].name,
+                   unsigned(boot_stages[i].done_us - last_us));
+        last_us = boot_stages[i].done_us;
+    }
+    str.printf("%-12s %8u us\n", "total", unsigned(last_us));
+}
+#endif // AP_BOOT_TIMING_ENABLED
+
 void AP_Vehicle::loop()
 {
 #if AP_SCHEDULER_ENABLED
@@ -640,9 +690,6 @@ const AP_Scheduler::Task AP_Vehicle::scheduler_tasks[] = {
 #endif
 #if AP_VIDEOTX_ENABLED
     SCHED_TASK_CLASS(AP_VideoTX,   &vehicle.vtx,            update,                    2, 100, 220),
-#endif
-#if AP_TRAMP_ENABLED
-    SCHED_TASK_CLASS(AP_Tramp,     &vehicle.tramp,          update,                   50,  50, 225),
 #endif
     SCHED_TASK(send_watchdog_reset_statustext,         0.1,     20, 225),
 #if HAL_WITH_ESC_TELEM
@@ -89,6 +89,7 @@
 #include <AP_IBus_Telem/AP_IBus_Telem.h>
 
 class AP_DDS_Client;
+class ExpandingString;
 
 class AP_Vehicle : public AP_HAL::HAL::Callbacks {
 
@@ -320,6 +321,13 @@ public:
     virtual bool set_home(const Location& loc, bool lock) WARN_IF_UNUSED { return false; }
 #endif
 
+#if AP_BOOT_TIMING_ENABLED
+    // record completion of a named stage of setup()
+    void boot_stage(const char *name);
+    // dump per-stage boot timing for @SYS/boot.txt
+    void boot_info(ExpandingString &str) const;
+#endif
+
 protected:
 
     virtual void init_ardupilot() = 0;
@@ -604,6 +612,14 @@ private:
 
     bool done_safety_init;
 
+#if AP_BOOT_TIMING_ENABLED
+    // completion timestamps of the stages of setup(), in boot order
+    struct {
+        const char *name;
+        uint32_t done_us;
+    } boot_stages[12];
+    uint8_t num_boot_stages;
+#endif
 
     uint32_t _last_internal_errors;  // backup of AP_InternalError::internal_errors bitmask
 
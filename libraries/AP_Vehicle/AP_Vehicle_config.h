@@ -1,7 +1,13 @@
 #pragma once
 
 #include <AP_HAL/AP_HAL_Boards.h>
+#include <AP_Filesystem/AP_Filesystem_config.h>
 
 #ifndef AP_VEHICLE_ENABLED
 #define AP_VEHICLE_ENABLED 1
 #endif
+
+// per-stage boot timing, reported via @SYS/boot.txt
+#ifndef AP_BOOT_TIMING_ENABLED
+#define AP_BOOT_TIMING_ENABLED (AP_VEHICLE_ENABLED && AP_FILESYSTEM_SYS_ENABLED)
+#endif
@@ -209,13 +209,17 @@ char AP_Tramp::receive_response()
         return 0;
     }
 
-    for (uint16_t i = 0; i < bytesNeeded; i++) {
-        const int16_t b = port->read();
-        if (b < 0) {
-            // uart claimed bytes available, but there were none
-            return 0;
-        }
-        const uint8_t c = uint8_t(b);
+    // bulk read so the uart lock is only taken once per packet rather
+    // than once per byte
+    uint8_t buf[TRAMP_BUF_SIZE];
+    const ssize_t nread = port->read(buf, bytesNeeded);
+    if (nread <= 0) {
+        // uart claimed bytes available, but there were none
+        return 0;
+    }
+
+    for (uint16_t i = 0; i < nread; i++) {
+        const uint8_t c = buf[i];
         response_buffer[receive_pos++] = c;
 
         switch (receive_state) {
@@ -477,12 +481,8 @@ void AP_Tramp::set_frequency(uint16_t freq)
     }
 }
 
-void AP_Tramp::update()
+void AP_Tramp::update_parameters()
 {
-    if (port == nullptr) {
-        return;
-    }
-
     AP_VideoTX& vtx = AP::vtx();
 
     if (vtx.have_params_changed() && retry_count == 0) {
@@ -520,8 +520,6 @@ void AP_Tramp::update()
             }
         }
     }
-
-    process_requests();
 }
 
 // we missed a response too many times - update the baud rate in case the temperature has increased
@@ -563,13 +561,13 @@ bool AP_Tramp::init(void)
     // init uart
     port = AP::serialmanager().find_serial(AP_SerialManager::SerialProtocol_Tramp, 0);
     if (port != nullptr) {
-        port->configure_parity(0);
-        port->set_stop_bits(1);
-        port->set_flow_control(AP_HAL::UARTDriver::FLOW_CONTROL_DISABLE);
-        port->set_options((port->get_options() & ~AP_HAL::UARTDriver::OPTION_RXINV));
-
-        port->begin(AP_TRAMP_UART_BAUD, AP_TRAMP_UART_BUFSIZE_RX, AP_TRAMP_UART_BUFSIZE_TX);
-        debug("port opened");
+        // run the protocol on its own thread so that serial servicing
+        // never costs main loop time
+        if (!hal.scheduler->thread_create(FUNCTOR_BIND_MEMBER(&AP_Tramp::loop, void),
+                                          "Tramp",
+                                          768, AP_HAL::Scheduler::PRIORITY_IO, -1)) {
+            return false;
+        }
 
         AP::vtx().set_provider_enabled(AP_VideoTX::VTXType::Tramp);
 
@@ -578,4 +576,27 @@ bool AP_Tramp::init(void)
     return false;
 }
 
+void AP_Tramp::loop()
+{
+    while (!hal.scheduler->is_system_initialized()) {
+        hal.scheduler->delay(100);
+    }
+
+    // initialise the uart here as begin() must be called from the same
+    // thread as the port is used from
+    port->configure_parity(0);
+    port->set_stop_bits(1);
+    port->set_flow_control(AP_HAL::UARTDriver::FLOW_CONTROL_DISABLE);
+    port->set_options((port->get_options() & ~AP_HAL::UARTDriver::OPTION_RXINV));
+
+    port->begin(AP_TRAMP_UART_BAUD, AP_TRAMP_UART_BUFSIZE_RX, AP_TRAMP_UART_BUFSIZE_TX);
+    debug("port opened");
+
+    while (true) {
+        update_parameters();
+        process_requests();
+        hal.scheduler->delay(20);
+    }
+}
+
 #endif // VTX_TRAMP
@@ -57,13 +57,16 @@ public:
     }
 
     bool init(void);
-    void update();
 
     // actual transmitted power reported by the VTX in the 'v' response
     uint16_t get_current_actual_power() const { return cur_act_power; }
     int16_t get_current_temp() const { return cur_temp; }
 
 private:
+    // protocol thread; all serial servicing happens here
+    void loop();
+    // push pending parameter changes towards the device
+    void update_parameters();
     uint8_t checksum(uint8_t *buf);
     // Check if race lock is enabled
     bool is_race_lock_enabled(void) {
@@ -78,6 +78,61 @@ void AP_VisualOdom_Backend::handle_vision_position_delta_msg(const mavlink_messa
 }
 #endif  // HAL_GCS_ENABLED
 
+// minimum interval between poses sent to the EKF. This matches
+// NavEKF3's extNavIntervalMin_ms; anything faster is dropped by the
+// EKF with whatever arrival phase the sensor happens to have
+#define VISUALODOM_EXTNAV_INTERVAL_MS 20
+
+// send a pose to the EKF, decimating bursts to the EKF's external nav
+// fusion cadence
+void AP_VisualOdom_Backend::write_extnav_data(const Vector3f &pos, const Quaternion &att, float posErr, float angErr, uint32_t time_ms, uint32_t reset_timestamp_ms)
+{
+    // write through immediately for the first sample and after a
+    // position reset so the EKF sees the reset without delay. The
+    // previous sample is discarded so we never interpolate across a
+    // reset
+    if (!_extnav_have_prev || reset_timestamp_ms != _extnav_last_reset_ms) {
+        AP::ahrs().writeExtNavData(pos, att, posErr, angErr, time_ms, _frontend.get_delay_ms(), reset_timestamp_ms);
+        _extnav_last_write_ms = time_ms;
+        _extnav_last_reset_ms = reset_timestamp_ms;
+        _extnav_prev = {time_ms, pos, att, posErr, angErr};
+        _extnav_have_prev = true;
+        return;
+    }
+
+    if (time_ms - _extnav_last_write_ms >= VISUALODOM_EXTNAV_INTERVAL_MS) {
+        const uint32_t target_ms = _extnav_last_write_ms + VISUALODOM_EXTNAV_INTERVAL_MS;
+        if (_extnav_prev.time_ms - _extnav_last_write_ms == 0 ||
+            _extnav_prev.time_ms - _extnav_last_write_ms >= VISUALODOM_EXTNAV_INTERVAL_MS) {
+            // sensor is at or below the fusion cadence so pass the raw sample through
+            AP::ahrs().writeExtNavData(pos, att, posErr, angErr, time_ms, _frontend.get_delay_ms(), reset_timestamp_ms);
+            _extnav_last_write_ms = time_ms;
+        } else {
+            // sensor is faster than the fusion cadence. Interpolate
+            // the bracketing samples to an evenly spaced timestamp so
+            // burst arrival does not alias with the fusion step
+            const float f = float(target_ms - _extnav_prev.time_ms) / float(time_ms - _extnav_prev.time_ms);
+            const Vector3f pos_interp = _extnav_prev.pos + (pos - _extnav_prev.pos) * f;
+
+            // interpolate attitude along the geodesic between the two samples
+            Vector3f axis_angle;
+            _extnav_prev.att.angular_difference(att).to_axis_angle(axis_angle);
+            Quaternion att_step;
+            att_step.from_axis_angle(axis_angle * f);
+            Quaternion att_interp = _extnav_prev.att * att_step;
+            att_interp.normalize();
+
+            AP::ahrs().writeExtNavData(pos_interp, att_interp,
+                                       MAX(_extnav_prev.posErr, posErr),
+                                       MAX(_extnav_prev.angErr, angErr),
+                                       target_ms, _frontend.get_delay_ms(), reset_timestamp_ms);
+            _extnav_last_write_ms = target_ms;
+        }
+    }
+
+    _extnav_prev = {time_ms, pos, att, posErr, angErr};
+}
+
 // returns the system time of the last reset if reset_counter has not changed
 // updates the reset timestamp to the current system time if the reset_counter has changed
 uint32_t AP_VisualOdom_Backend::get_reset_timestamp_ms(uint8_t reset_counter)
@@ -84,6 +84,12 @@ protected:
     // apply rotation and correction to position
     void rotate_and_correct_position(Vector3f &position) const;
 
+    // send a pose to the EKF, decimating bursts to the EKF's external
+    // nav fusion cadence. Samples arriving faster than the cadence are
+    // interpolated to an evenly spaced timestamp instead of leaving
+    // the EKF to keep whichever sample of each burst arrives first
+    void write_extnav_data(const Vector3f &pos, const Quaternion &att, float posErr, float angErr, uint32_t time_ms, uint32_t reset_timestamp_ms);
+
     AP_VisualOdom &_frontend;   // reference to frontend
     uint32_t _last_update_ms;   // system time of last update from sensor (used by health checks)
 
@@ -99,6 +105,21 @@ protected:
 
     // quality
     int8_t _quality;                // last recorded quality
+
+private:
+
+    // timestamped pose, most recent consumed sample kept for
+    // interpolation to the EKF fusion cadence
+    struct extnav_sample {
+        uint32_t time_ms;           // system time the measurement was taken
+        Vector3f pos;               // position in NED meters
+        Quaternion att;             // attitude
+        float posErr;               // position error estimate (m)
+        float angErr;               // angular error estimate (rad)
+    } _extnav_prev;
+    bool _extnav_have_prev;         // true if _extnav_prev holds a sample
+    uint32_t _extnav_last_write_ms; // measurement timestamp of the last pose sent to the EKF
+    uint32_t _extnav_last_reset_ms; // reset timestamp of the last pose sent to the EKF
 };
 
 #endif  // HAL_VISUALODOM_ENABLED
@@ -66,8 +66,8 @@ void AP_VisualOdom_IntelT265::handle_pose_estimate(uint64_t remote_time_us, uint
     // check for recent position reset
     bool consume = should_consume_sensor_data(true, reset_counter) && (_quality >= _frontend.get_quality_min());
     if (consume) {
-        // send attitude and position to EKF
-        AP::ahrs().writeExtNavData(pos, att, posErr, angErr, time_ms, _frontend.get_delay_ms(), get_reset_timestamp_ms(reset_counter));
+        // send attitude and position to EKF, decimated to the fusion cadence
+        write_extnav_data(pos, att, posErr, angErr, time_ms, get_reset_timestamp_ms(reset_counter));
     }
 
     // calculate euler orientation for logging
@@ -48,7 +48,7 @@ void AP_VisualOdom_MAV::handle_pose_estimate(uint64_t remote_time_us, uint32_t t
     // send attitude and position to EKF if quality OK
     bool consume = (_quality >= _frontend.get_quality_min());
     if (consume) {
-        AP::ahrs().writeExtNavData(pos, attitude, posErr, angErr, time_ms, _frontend.get_delay_ms(), get_reset_timestamp_ms(reset_counter));
+        write_extnav_data(pos, attitude, posErr, angErr, time_ms, get_reset_timestamp_ms(reset_counter));
     }
 
     // calculate euler orientation for logging
@@ -133,9 +133,11 @@ void AP_Volz_Protocol::loop()
     const uint16_t receive_us = send_us * 2;
 
     // This gives a total time of 1560us, message rate of 641 Hz.
-    // One servo at 641Hz, two at 320.5 each, three at 213.7 each ect...
-    // Note that we send a telem request every time servo sending is complete. This is like a extra servo.
-    // So for a single servo position commands are at 320.5Hz and telem at 320.5Hz.
+    // Position commands and telem requests alternate, so each gets 320.5 messages per second.
+    // Positions: one servo at 320.5Hz, two at 160.3 each, ten at 32 each ect...
+    // Telem: three items per servo, one servo refreshes fully at 106.8Hz, ten at 10.7Hz each.
+    // The fixed half share keeps full-fleet servo health at 10Hz or better up to ten servos,
+    // rather than telemetry getting a single request slot per pass over the outputs.
 
     while (port != nullptr) {
 
@@ -148,11 +150,10 @@ void AP_Volz_Protocol::loop()
         }
 
 #if AP_SERVO_TELEM_ENABLED
-        // Send a command for each servo, then one telem request
-        const uint8_t num_servos = __builtin_popcount(bitmask.get());
-        if (sent_count < num_servos) {
+        // Alternate between a position command and a telem request
+        if (sent_count == 0) {
             send_position_cmd();
-            sent_count++;
+            sent_count = 1;
 
         } else {
             request_telem();
@@ -119,6 +119,7 @@ private:
     void read_telem();
     void process_response(const CMD &cmd);
 
+    // toggles between position command and telem request slots
     uint8_t sent_count;
 
     struct {
@@ -537,7 +537,7 @@ void AR_WPNav::set_turn_params(float turn_radius, bool pivot_possible)
 
 // calculate the crosstrack error
 // value is negative when the vehicle is on the path's left side
-float AR_WPNav::calc_crosstrack_error(const Location& current_loc) const
+float AR_WPNav::calc_crosstrack_error(const Location& current_loc)
 {
     if (!_orig_and_dest_valid) {
         return 0.0f;
@@ -547,22 +547,31 @@ float AR_WPNav::calc_crosstrack_error(const Location& current_loc) const
     const Location &orig = get_oa_origin();
     const Location &dest = get_oa_destination();
 
-    // calculate the NE position of destination relative to origin
-    Vector2f dest_from_origin = orig.get_distance_NE(dest);
+    // the track direction only changes when the segment does, so the
+    // unit vector is cached and only recomputed on a change
+    if (!_track_unit_valid || !orig.same_latlon_as(_track_unit_orig) || !dest.same_latlon_as(_track_unit_dest)) {
+        // calculate the NE position of destination relative to origin
+        Vector2f dest_from_origin = orig.get_distance_NE(dest);
+        _track_unit_valid = dest_from_origin.length() >= 1.0e-6f;
+        if (_track_unit_valid) {
+            // convert to a vector indicating direction only
+            dest_from_origin.normalize();
+            _track_unit_vec = dest_from_origin;
+            _track_unit_orig = orig;
+            _track_unit_dest = dest;
+        }
+    }
 
     // return distance to destination if length of track is very small
-    if (dest_from_origin.length() < 1.0e-6f) {
+    if (!_track_unit_valid) {
         return current_loc.get_distance_NE(dest).length();
     }
 
-    // convert to a vector indicating direction only
-    dest_from_origin.normalize();
-
     // calculate the NE position of the vehicle relative to origin
     const Vector2f veh_from_origin = orig.get_distance_NE(current_loc);
 
     // calculate distance to target track, for reporting
-    return veh_from_origin % dest_from_origin;
+    return veh_from_origin % _track_unit_vec;
 }
 
 // calculate yaw change at next waypoint in degrees
@@ -125,7 +125,7 @@ protected:
 
     // calculate the crosstrack error
     // value is negative when the vehicle is on the path's left side
-    float calc_crosstrack_error(const Location& current_loc) const;
+    float calc_crosstrack_error(const Location& current_loc);
 
     // calculate yaw change at next waypoint in degrees
     // returns zero if the angle cannot be calculated because some points are on top of others
@@ -172,6 +172,12 @@ protected:
     Location _next_destination;     // next destination Location when in Guided_WP
     bool _orig_and_dest_valid;      // true if the origin and destination have been set
     bool _reversed;                 // execute the mission by backing up
+
+    // unit vector along the current (possibly OA-adjusted) track, recomputed only when the segment endpoints change
+    Location _track_unit_orig;      // origin the cached unit vector was computed from
+    Location _track_unit_dest;      // destination the cached unit vector was computed from
+    Vector2f _track_unit_vec;       // unit vector from _track_unit_orig to _track_unit_dest
+    bool _track_unit_valid;         // true if _track_unit_vec can be used
     enum class NavControllerType {
         NAV_SCURVE = 0,             // scurves used for navigation
         NAV_PSC_INPUT_SHAPING       // position controller input shaping used for navigation
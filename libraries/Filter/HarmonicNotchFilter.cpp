@@ -18,11 +18,15 @@
 #pragma GCC optimize("O2")
 #endif
 
+#include <new>
+
 #include "HarmonicNotchFilter.h"
 #include <GCS_MAVLink/GCS.h>
 #include <AP_Logger/AP_Logger.h>
 #include <AP_Vehicle/AP_Vehicle_Type.h>
 
+extern const AP_HAL::HAL& hal;
+
 /*
   optional logging for SITL only of all notch frequencies
  */
@@ -151,7 +155,7 @@ const AP_Param::GroupInfo HarmonicNotchFilterParams::var_info[] = {
  */
 template <class T>
 HarmonicNotchFilter<T>::~HarmonicNotchFilter() {
-    delete[] _filters;
+    hal.util->free_type(_filters, _num_filters * sizeof(NotchFilter<T>), AP_HAL::Util::MEM_FAST);
     _num_filters = 0;
     _num_enabled_filters = 0;
 }
@@ -216,7 +220,7 @@ void HarmonicNotchFilter<T>::allocate_filters(uint8_t num_notches, uint32_t harm
     _harmonics = harmonics;
 
     if (_num_filters > 0) {
-        _filters = NEW_NOTHROW NotchFilter<T>[_num_filters];
+        _filters = allocate_filter_array(_num_filters);
         if (_filters == nullptr) {
             GCS_SEND_TEXT(MAV_SEVERITY_ERROR, "Failed to allocate %u bytes for notch filter", (unsigned int)(_num_filters * sizeof(NotchFilter<T>)));
             _num_filters = 0;
@@ -224,6 +228,25 @@ void HarmonicNotchFilter<T>::allocate_filters(uint8_t num_notches, uint32_t harm
     }
 }
 
+/*
+  allocate an array of notch filters. The filter states are updated at
+  the gyro backend rate, so ask for fast memory (eg. DTCM on H7) where
+  the board provides it, in the same way the EKF cores and DSP buffers
+  are placed
+ */
+template <class T>
+NotchFilter<T> *HarmonicNotchFilter<T>::allocate_filter_array(uint16_t count) const
+{
+    auto *filters = (NotchFilter<T> *)hal.util->malloc_type(count * sizeof(NotchFilter<T>), AP_HAL::Util::MEM_FAST);
+    if (filters == nullptr) {
+        return nullptr;
+    }
+    for (uint16_t i = 0; i < count; i++) {
+        new (&filters[i]) NotchFilter<T>();
+    }
+    return filters;
+}
+
 /*
   expand the number of filters at runtime, allowing for RPM sources such as lua scripts
  */
@@ -242,16 +265,17 @@ void HarmonicNotchFilter<T>::expand_filter_count(uint16_t total_notches)
       note that we rely on the semaphore in
       AP_InertialSensor_Backend.cpp to make this thread safe
      */
-    auto filters = NEW_NOTHROW NotchFilter<T>[total_notches];
+    auto filters = allocate_filter_array(total_notches);
     if (filters == nullptr) {
         _alloc_has_failed = true;
         return;
     }
     memcpy(filters, _filters, sizeof(filters[0])*_num_filters);
     auto _old_filters = _filters;
+    const uint16_t old_num_filters = _num_filters;
     _filters = filters;
     _num_filters = total_notches;
-    delete[] _old_filters;
+    hal.util->free_type(_old_filters, old_num_filters * sizeof(NotchFilter<T>), AP_HAL::Util::MEM_FAST);
 }
 
 /*
@@ -393,6 +417,13 @@ void HarmonicNotchFilter<T>::update(uint8_t num_centers, const float center_freq
 
 /*
   apply a sample to each of the underlying filters in turn and return the output
+
+  this runs the whole cascade as one fused pass rather than calling
+  NotchFilter::apply() per stage. In a cascade each stage's input
+  history is the previous stage's output history, so those values are
+  carried in registers between stages instead of being re-loaded from
+  each filter. The arithmetic per stage is unchanged, so the output is
+  identical to applying the filters individually
  */
 template <class T>
 T HarmonicNotchFilter<T>::apply(const T &sample)
@@ -409,15 +440,48 @@ T HarmonicNotchFilter<T>::apply(const T &sample)
 #endif
 
     T output = sample;
+
+    // input history for the first stage is its own stored past samples
+    T in1 {}, in2 {};
+    if (_num_enabled_filters > 0) {
+        in1 = _filters[0].ntchsig1;
+        in2 = _filters[0].ntchsig2;
+    }
+
     for (uint16_t i = 0; i < _num_enabled_filters; i++) {
+        NotchFilter<T> &f = _filters[i];
 #if NOTCH_DEBUG_LOGGING
-        if (!_filters[i].initialised) {
+        if (!f.initialised) {
             ::dprintf(dfd, "------- ");
         } else {
-            ::dprintf(dfd, "%.4f ", _filters[i]._center_freq_hz);
+            ::dprintf(dfd, "%.4f ", f._center_freq_hz);
         }
 #endif
-        output = _filters[i].apply(output);
+        // the old output history is also the next stage's old input history
+        const T old_sig1 = f.signal1;
+        const T old_sig2 = f.signal2;
+
+        if (!f.initialised || f.need_reset) {
+            // an uninitialised stage passes its input through and
+            // primes its history with it
+            f.signal1 = output;
+            f.signal2 = output;
+            f.ntchsig1 = output;
+            f.ntchsig2 = output;
+            f.need_reset = false;
+        } else {
+            const T next = output*f.b0 + in1*f.b1 + in2*f.b2 - old_sig1*f.a1 - old_sig2*f.a2;
+
+            f.ntchsig2 = in1;
+            f.ntchsig1 = output;
+
+            f.signal2 = old_sig1;
+            f.signal1 = next;
+            output = next;
+        }
+
+        in1 = old_sig1;
+        in2 = old_sig2;
     }
 #if NOTCH_DEBUG_LOGGING
     if (_num_enabled_filters > 0) {
@@ -442,6 +506,22 @@ void HarmonicNotchFilter<T>::reset()
     }
 }
 
+/*
+  prime each of the underlying filters as if they had been running at a
+  steady signal level, avoiding the settle transient that a reset produces
+ */
+template <class T>
+void HarmonicNotchFilter<T>::warm_start(const T &value)
+{
+    if (!_initialised) {
+        return;
+    }
+
+    for (uint16_t i = 0; i < _num_filters; i++) {
+        _filters[i].warm_start(value);
+    }
+}
+
 #if HAL_LOGGING_ENABLED
 // @LoggerMessage: FCN
 // @Description: Filter Center Message - per motor
@@ -53,6 +53,8 @@ public:
     T apply(const T &sample);
     // reset each of the underlying filters
     void reset();
+    // prime each of the underlying filters from the current signal level
+    void warm_start(const T &value);
 
     /*
       log notch center frequencies and first harmonic
@@ -60,6 +62,9 @@ public:
     void log_notch_centers(uint8_t instance, uint64_t now_us) const;
 
 private:
+    // allocate an array of notch filters, preferring fast memory
+    NotchFilter<T> *allocate_filter_array(uint16_t count) const;
+
     // underlying bank of notch filters
     NotchFilter<T>*  _filters;
     // sample frequency for each filter
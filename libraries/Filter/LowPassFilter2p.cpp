@@ -34,8 +34,55 @@ T DigitalBiquadFilter<T>::apply(const T &sample, const struct biquad_params &par
     return output;
 }
 
+// filter a block of contiguous samples, out may alias samples. Arithmetically
+// identical to applying the per-sample version n times but keeps the delay
+// line in locals so the compiler can hold it in registers, and processes two
+// samples per iteration so the delay elements swap roles instead of being
+// shuffled through memory
 template <class T>
-void DigitalBiquadFilter<T>::reset() { 
+void DigitalBiquadFilter<T>::apply(const T *samples, T *out, uint16_t n, const struct biquad_params &params) {
+    if (!is_positive(params.cutoff_freq) || !is_positive(params.sample_freq)) {
+        if (out != samples) {
+            for (uint16_t i = 0; i < n; i++) {
+                out[i] = samples[i];
+            }
+        }
+        return;
+    }
+
+    if (n == 0) {
+        return;
+    }
+
+    if (!initialised) {
+        reset(samples[0], params);
+    }
+
+    T d1 = _delay_element_1;
+    T d2 = _delay_element_2;
+
+    uint16_t i = 0;
+    for (; i + 1 < n; i += 2) {
+        const T d0a = samples[i] - d1 * params.a1 - d2 * params.a2;
+        out[i] = d0a * params.b0 + d1 * params.b1 + d2 * params.b2;
+        const T d0b = samples[i+1] - d0a * params.a1 - d1 * params.a2;
+        out[i+1] = d0b * params.b0 + d0a * params.b1 + d1 * params.b2;
+        d2 = d0a;
+        d1 = d0b;
+    }
+    if (i < n) {
+        const T d0 = samples[i] - d1 * params.a1 - d2 * params.a2;
+        out[i] = d0 * params.b0 + d1 * params.b1 + d2 * params.b2;
+        d2 = d1;
+        d1 = d0;
+    }
+
+    _delay_element_1 = d1;
+    _delay_element_2 = d2;
+}
+
+template <class T>
+void DigitalBiquadFilter<T>::reset() {
     initialised = false;
 }
 
@@ -105,6 +152,12 @@ T LowPassFilter2p<T>::apply(const T &sample) {
     return _filter.apply(sample, _params);
 }
 
+// filter a block of contiguous samples, out may alias samples
+template <class T>
+void LowPassFilter2p<T>::apply(const T *samples, T *out, uint16_t n) {
+    _filter.apply(samples, out, n, _params);
+}
+
 template <class T>
 void LowPassFilter2p<T>::reset(void) {
     return _filter.reset();
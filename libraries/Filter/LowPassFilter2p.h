@@ -40,6 +40,8 @@ public:
     DigitalBiquadFilter();
 
     T apply(const T &sample, const struct biquad_params &params);
+    // filter a block of contiguous samples, out may alias samples
+    void apply(const T *samples, T *out, uint16_t n, const struct biquad_params &params);
     void reset();
     void reset(const T &value, const struct biquad_params &params);
     static void compute_params(float sample_freq, float cutoff_freq, biquad_params &ret);
@@ -62,6 +64,10 @@ public:
     float get_cutoff_freq(void) const;
     float get_sample_freq(void) const;
     T apply(const T &sample);
+    // filter a block of contiguous samples, out may alias samples. Filtering in
+    // blocks keeps the delay line in registers which is considerably cheaper
+    // than repeated per-sample calls on high rate IMU data
+    void apply(const T *samples, T *out, uint16_t n);
     void reset(void);
     void reset(const T &value);
 
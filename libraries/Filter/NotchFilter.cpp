@@ -25,6 +25,50 @@ const static float NOTCH_MAX_SLEW       = 0.05f;
 const static float NOTCH_MAX_SLEW_LOWER = 1.0f - NOTCH_MAX_SLEW;
 const static float NOTCH_MAX_SLEW_UPPER = 1.0f / NOTCH_MAX_SLEW_LOWER;
 
+#if NOTCH_FAST_TRIG
+/*
+  quarter-wave sine table with linear interpolation, shared by all notch
+  instances. Filled lazily; concurrent first use writes identical values
+  so the race is benign
+ */
+static const uint16_t NOTCH_TRIG_TABLE_SIZE = 128;
+static float notch_trig_table[NOTCH_TRIG_TABLE_SIZE+1];
+static bool notch_trig_table_filled;
+
+static void notch_fill_trig_table(void)
+{
+    for (uint16_t i=0; i<=NOTCH_TRIG_TABLE_SIZE; i++) {
+        notch_trig_table[i] = sinf((M_PI_2 * i) / NOTCH_TRIG_TABLE_SIZE);
+    }
+    notch_trig_table_filled = true;
+}
+
+// sine by table lookup, valid for 0 <= x <= PI
+static float notch_table_sinf(float x)
+{
+    if (!notch_trig_table_filled) {
+        notch_fill_trig_table();
+    }
+    if (x > M_PI_2) {
+        x = M_PI - x;
+    }
+    const float fidx = (x / M_PI_2) * NOTCH_TRIG_TABLE_SIZE;
+    const uint16_t idx = uint16_t(fidx);
+    if (idx >= NOTCH_TRIG_TABLE_SIZE) {
+        return notch_trig_table[NOTCH_TRIG_TABLE_SIZE];
+    }
+    const float frac = fidx - idx;
+    return notch_trig_table[idx] + (notch_trig_table[idx+1] - notch_trig_table[idx]) * frac;
+}
+
+// cosine via the same table, valid for 0 <= x <= PI
+static float notch_table_cosf(float x)
+{
+    const float y = M_PI_2 - x;
+    return y >= 0 ? notch_table_sinf(y) : -notch_table_sinf(-y);
+}
+#endif // NOTCH_FAST_TRIG
+
 /*
    calculate the attenuation and quality factors of the filter
  */
@@ -57,9 +101,12 @@ void NotchFilter<T>::init(float sample_freq_hz, float center_freq_hz, float band
 template <class T>
 void NotchFilter<T>::init_with_A_and_Q(float sample_freq_hz, float center_freq_hz, float A, float Q)
 {
-    // don't update if no updates required
+    // don't update if no updates required. A center frequency change of
+    // less than NOTCH_UPDATE_MIN_RATIO of the current center is also
+    // skipped so telemetry jitter doesn't recompute the coefficients
     if (initialised &&
-        is_equal(center_freq_hz, _center_freq_hz) &&
+        (is_equal(center_freq_hz, _center_freq_hz) ||
+         fabsf(center_freq_hz - _center_freq_hz) <= NOTCH_UPDATE_MIN_RATIO * _center_freq_hz) &&
         is_equal(sample_freq_hz, _sample_freq_hz) &&
         is_equal(A, _A)) {
         return;
@@ -75,9 +122,16 @@ void NotchFilter<T>::init_with_A_and_Q(float sample_freq_hz, float center_freq_h
 
     if (is_positive(new_center_freq) && (new_center_freq < 0.5 * sample_freq_hz) && (Q > 0.0)) {
         float omega = 2.0 * M_PI * new_center_freq / sample_freq_hz;
-        float alpha = sinf(omega) / (2 * Q);
+#if NOTCH_FAST_TRIG
+        const float sin_omega = notch_table_sinf(omega);
+        const float cos_omega = notch_table_cosf(omega);
+#else
+        const float sin_omega = sinf(omega);
+        const float cos_omega = cosf(omega);
+#endif
+        float alpha = sin_omega / (2 * Q);
         b0 =  1.0 + alpha*sq(A);
-        b1 = -2.0 * cosf(omega);
+        b1 = -2.0 * cos_omega;
         b2 =  1.0 - alpha*sq(A);
         a1 = b1;
         a2 =  1.0 - alpha;
@@ -134,6 +188,21 @@ void NotchFilter<T>::reset()
     need_reset = true;
 }
 
+/*
+  prime the delay line as if the filter had been running at a steady signal
+  level. The notch has unity DC gain so a constant input equal to value gives
+  a steady-state output of value, making this transient-free
+ */
+template <class T>
+void NotchFilter<T>::warm_start(const T &value)
+{
+    signal1 = value;
+    signal2 = value;
+    ntchsig1 = value;
+    ntchsig2 = value;
+    need_reset = false;
+}
+
 #if HAL_LOGGING_ENABLED
 // return the frequency to log for the notch
 template <class T>
@@ -25,6 +25,23 @@
 #include <inttypes.h>
 #include <AP_Param/AP_Param.h>
 
+// relative center frequency change below which a dynamic update does not
+// recompute the biquad coefficients. The default of zero keeps the
+// exact-match behaviour; boards driving the notch from noisy ESC telemetry
+// can set e.g. 0.001f (0.1%) from hwdef so throttle transients don't
+// recompute every notch every gyro filter update
+#ifndef NOTCH_UPDATE_MIN_RATIO
+#define NOTCH_UPDATE_MIN_RATIO 0.0f
+#endif
+
+// use a shared table-based sin/cos approximation for notch coefficient
+// calculation instead of libm trig. Worst case sine error is about 2e-5
+// which moves a notch center by well under the ESC telemetry resolution;
+// opt-in from hwdef for boards without fast hardware trig
+#ifndef NOTCH_FAST_TRIG
+#define NOTCH_FAST_TRIG 0
+#endif
+
 
 template <class T>
 class HarmonicNotchFilter;
@@ -38,6 +55,9 @@ public:
     void init_with_A_and_Q(float sample_freq_hz, float center_freq_hz, float A, float Q);
     T apply(const T &sample);
     void reset();
+    // prime the delay line as if the filter had been running at a steady
+    // signal level, avoiding a settle transient on the next samples
+    void warm_start(const T &value);
     float center_freq_hz() const { return _center_freq_hz; }
     float sample_freq_hz() const { return _sample_freq_hz; }
 
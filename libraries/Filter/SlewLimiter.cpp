@@ -26,6 +26,10 @@
  */
 #include "SlewLimiter.h"
 
+// modifier() runs per-axis at up to the gyro rate when a fast rate
+// loop is active, so compile for speed
+#pragma GCC optimize("O2")
+
 #define WINDOW_MS 300                   // time in msec required for a half cycle of the slowest oscillation frequency expected
 #define MODIFIER_GAIN 1.5f              // ratio of modifier reduction to slew rate exceedance ratio
 #define DERIVATIVE_CUTOFF_FREQ 25.0f
@@ -0,0 +1,82 @@
+#include <AP_gbenchmark.h>
+
+#include <Filter/LowPassFilter2p.h>
+
+const AP_HAL::HAL& hal = AP_HAL::get_HAL();
+
+// representative of one gyro FIFO drain at 8kHz sampling
+static const uint16_t BLOCK_SIZE = 8;
+
+static void BM_LowPassFilter2pFloatPerSample(benchmark::State& state)
+{
+    LowPassFilter2pFloat filter(8000.0f, 188.0f);
+    float samples[BLOCK_SIZE];
+    for (uint16_t i = 0; i < BLOCK_SIZE; i++) {
+        samples[i] = sinf(i * 0.1f);
+    }
+
+    while (state.KeepRunning()) {
+        float out[BLOCK_SIZE];
+        for (uint16_t i = 0; i < BLOCK_SIZE; i++) {
+            out[i] = filter.apply(samples[i]);
+        }
+        gbenchmark_escape(out);
+    }
+}
+
+BENCHMARK(BM_LowPassFilter2pFloatPerSample);
+
+static void BM_LowPassFilter2pFloatBlock(benchmark::State& state)
+{
+    LowPassFilter2pFloat filter(8000.0f, 188.0f);
+    float samples[BLOCK_SIZE];
+    for (uint16_t i = 0; i < BLOCK_SIZE; i++) {
+        samples[i] = sinf(i * 0.1f);
+    }
+
+    while (state.KeepRunning()) {
+        float out[BLOCK_SIZE];
+        filter.apply(samples, out, BLOCK_SIZE);
+        gbenchmark_escape(out);
+    }
+}
+
+BENCHMARK(BM_LowPassFilter2pFloatBlock);
+
+static void BM_LowPassFilter2pVector3fPerSample(benchmark::State& state)
+{
+    LowPassFilter2pVector3f filter(8000.0f, 188.0f);
+    Vector3f samples[BLOCK_SIZE];
+    for (uint16_t i = 0; i < BLOCK_SIZE; i++) {
+        samples[i] = Vector3f(sinf(i * 0.1f), cosf(i * 0.1f), sinf(i * 0.2f));
+    }
+
+    while (state.KeepRunning()) {
+        Vector3f out[BLOCK_SIZE];
+        for (uint16_t i = 0; i < BLOCK_SIZE; i++) {
+            out[i] = filter.apply(samples[i]);
+        }
+        gbenchmark_escape(out);
+    }
+}
+
+BENCHMARK(BM_LowPassFilter2pVector3fPerSample);
+
+static void BM_LowPassFilter2pVector3fBlock(benchmark::State& state)
+{
+    LowPassFilter2pVector3f filter(8000.0f, 188.0f);
+    Vector3f samples[BLOCK_SIZE];
+    for (uint16_t i = 0; i < BLOCK_SIZE; i++) {
+        samples[i] = Vector3f(sinf(i * 0.1f), cosf(i * 0.1f), sinf(i * 0.2f));
+    }
+
+    while (state.KeepRunning()) {
+        Vector3f out[BLOCK_SIZE];
+        filter.apply(samples, out, BLOCK_SIZE);
+        gbenchmark_escape(out);
+    }
+}
+
+BENCHMARK(BM_LowPassFilter2pVector3fBlock);
+
+BENCHMARK_MAIN();
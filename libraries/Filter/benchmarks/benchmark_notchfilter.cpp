@@ -0,0 +1,89 @@
+#include <AP_gbenchmark.h>
+
+#include <Filter/NotchFilter.h>
+#include <Filter/HarmonicNotchFilter.h>
+
+const AP_HAL::HAL& hal = AP_HAL::get_HAL();
+
+// representative of one gyro FIFO drain at 8kHz sampling
+static const uint16_t BLOCK_SIZE = 8;
+static const float SAMPLE_RATE_HZ = 8000.0f;
+
+static void fill_samples(Vector3f *samples, uint16_t n)
+{
+    for (uint16_t i = 0; i < n; i++) {
+        samples[i] = Vector3f(sinf(i * 0.1f), cosf(i * 0.1f), sinf(i * 0.2f));
+    }
+}
+
+static void BM_NotchFilterVector3f(benchmark::State& state)
+{
+    NotchFilterVector3f filter;
+    filter.init(SAMPLE_RATE_HZ, 120.0f, 60.0f, 40.0f);
+    Vector3f samples[BLOCK_SIZE];
+    fill_samples(samples, BLOCK_SIZE);
+
+    while (state.KeepRunning()) {
+        Vector3f out;
+        for (uint16_t i = 0; i < BLOCK_SIZE; i++) {
+            out = filter.apply(samples[i]);
+        }
+        gbenchmark_escape(&out);
+    }
+}
+
+BENCHMARK(BM_NotchFilterVector3f);
+
+// a typical multirotor setup: double notch on four harmonics
+static void BM_HarmonicNotchFilterVector3f(benchmark::State& state)
+{
+    HarmonicNotchFilterParams notch_params {};
+    notch_params.set_options(uint16_t(HarmonicNotchFilterParams::Options::DoubleNotch));
+    notch_params.set_attenuation(40.0f);
+    notch_params.set_bandwidth_hz(60.0f);
+    notch_params.set_center_freq_hz(120.0f);
+
+    HarmonicNotchFilterVector3f filter;
+    filter.allocate_filters(1, 0xF, notch_params.num_composite_notches());
+    filter.init(SAMPLE_RATE_HZ, notch_params);
+    filter.update(120.0f);
+
+    Vector3f samples[BLOCK_SIZE];
+    fill_samples(samples, BLOCK_SIZE);
+
+    while (state.KeepRunning()) {
+        Vector3f out;
+        for (uint16_t i = 0; i < BLOCK_SIZE; i++) {
+            out = filter.apply(samples[i]);
+        }
+        gbenchmark_escape(&out);
+    }
+}
+
+BENCHMARK(BM_HarmonicNotchFilterVector3f);
+
+// cost of retuning the cascade as dynamic tracking does every gyro filter update
+static void BM_HarmonicNotchFilterUpdate(benchmark::State& state)
+{
+    HarmonicNotchFilterParams notch_params {};
+    notch_params.set_options(uint16_t(HarmonicNotchFilterParams::Options::DoubleNotch));
+    notch_params.set_attenuation(40.0f);
+    notch_params.set_bandwidth_hz(60.0f);
+    notch_params.set_center_freq_hz(120.0f);
+
+    HarmonicNotchFilterVector3f filter;
+    filter.allocate_filters(1, 0xF, notch_params.num_composite_notches());
+    filter.init(SAMPLE_RATE_HZ, notch_params);
+
+    float center_freq_hz = 120.0f;
+    while (state.KeepRunning()) {
+        // sweep the center so the coefficients are actually recomputed
+        center_freq_hz = center_freq_hz < 200.0f ? center_freq_hz + 1.0f : 120.0f;
+        filter.update(center_freq_hz);
+        gbenchmark_escape(&filter);
+    }
+}
+
+BENCHMARK(BM_HarmonicNotchFilterUpdate);
+
+BENCHMARK_MAIN();
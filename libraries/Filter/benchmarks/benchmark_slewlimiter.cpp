@@ -0,0 +1,25 @@
+#include <AP_gbenchmark.h>
+
+#include <Filter/SlewLimiter.h>
+
+const AP_HAL::HAL& hal = AP_HAL::get_HAL();
+
+static void BM_SlewLimiterModifier(benchmark::State& state)
+{
+    const float slew_rate_max = 150.0f;
+    const float slew_rate_tau = 1.0f;
+    SlewLimiter limiter(slew_rate_max, slew_rate_tau);
+    // controller output at a typical 400Hz loop rate
+    const float dt = 1.0f / 400.0f;
+
+    uint32_t i = 0;
+    while (state.KeepRunning()) {
+        const float sample = sinf(i++ * 0.1f);
+        float out = limiter.modifier(sample, dt);
+        gbenchmark_escape(&out);
+    }
+}
+
+BENCHMARK(BM_SlewLimiterModifier);
+
+BENCHMARK_MAIN();
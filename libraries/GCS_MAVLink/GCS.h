@@ -476,6 +476,13 @@ public:
       returns true if a match is found
      */
     static bool find_by_mavtype_and_compid(uint8_t mav_type, uint8_t compid, uint8_t &sysid, mavlink_channel_t &channel) { return routing.find_by_mavtype_and_compid(mav_type, compid, sysid, channel); }
+
+#if AP_FILESYSTEM_SYS_ENABLED
+    /*
+      fill in the routing table and per-route statistics for @SYS/routes.txt
+    */
+    static void routing_info(ExpandingString &str) { routing.routing_info(str); }
+#endif
     // same as above, but returns a pointer to the GCS_MAVLINK object
     // corresponding to the channel
     static GCS_MAVLINK *find_by_mavtype_and_compid(uint8_t mav_type, uint8_t compid, uint8_t &sysid);
@@ -483,6 +490,21 @@ public:
 #if AP_MAVLINK_SIGNING_ENABLED
     // update signing timestamp on GPS lock
     static void update_signing_timestamp(uint64_t timestamp_usec);
+
+    // true if the link owning the given parser status has the
+    // SIGNING_CONTROL_PLANE_ONLY option set
+    static bool signing_control_plane_only(const mavlink_status_t *status);
+
+    // counts of unsigned bulk telemetry messages accepted, and of
+    // unsigned non-telemetry messages rejected, under
+    // SIGNING_CONTROL_PLANE_ONLY
+    static uint32_t signing_bulk_accepted;
+    static uint32_t signing_control_rejected;
+
+#if AP_FILESYSTEM_SYS_ENABLED
+    // fill in signing state and statistics for @SYS/signing.txt
+    static void signing_info(ExpandingString &str);
+#endif
 #endif  // AP_MAVLINK_SIGNING_ENABLED
 
     // return current packet overhead for a channel
@@ -543,6 +565,8 @@ protected:
         NO_FORWARD                = (1U << 1),  // don't forward MAVLink data to or from this device
         NOSTREAMOVERRIDE          = (1U << 2),  // ignore REQUEST_DATA_STREAM messages (eg. from GCSs)
         FORWARD_BAD_CRC           = (1U << 3),  // forward mavlink packets that don't pass CRC
+        ADAPTIVE_STREAMRATE       = (1U << 4),  // adapt stream rates to our own transmit buffer occupancy; for links with no RADIO_STATUS feedback (eg. LTE or WiFi bridges)
+        SIGNING_CONTROL_PLANE_ONLY = (1U << 5), // accept an allowlist of bulk telemetry unsigned; all other messages still require MAVLink2 signatures
     };
     bool option_enabled(Option option) const {
         return options & static_cast<uint16_t>(option);
@@ -676,7 +700,9 @@ protected:
     struct {
         int64_t sent_ts1;
         uint32_t last_sent_ms;
-        const uint16_t interval_ms = 10000;
+        // reduced once a peer answers, so links with an active sync
+        // peer are sampled often enough to track clock drift
+        uint16_t interval_ms = 10000;
     }  _timesync_request;
 
     void handle_statustext(const mavlink_message_t &msg);
@@ -877,6 +903,12 @@ private:
     // number of extra ms to add to slow things down for the radio
     uint16_t         stream_slowdown_ms;
 
+    // adaptive software flow control for links that send no
+    // RADIO_STATUS feedback; see update_txbuf_slowdown()
+    void update_txbuf_slowdown(void);
+    uint32_t txbuf_slowdown_check_ms;
+    uint32_t txspace_max;
+
     // outbound ("deferred message") queue.
 
     // "special" messages such as heartbeat, next_param etc are stored
@@ -917,6 +949,14 @@ private:
     void find_next_bucket_to_send(uint16_t now16_ms);
     void remove_message_from_bucket(int8_t bucket, ap_message id);
 
+    // deadline classes: buckets carrying a hard-deadline message keep
+    // their schedule during bulk transfers and win ties for service
+    bool bucket_has_hard_deadline(const deferred_message_bucket_t &deferred) const;
+    // worst observed bucket service lateness since the last MAV log
+    // message, split by deadline class
+    uint16_t max_lag_hard_ms;
+    uint16_t max_lag_bulk_ms;
+
     // bitmask of IDs the code has spontaneously decided it wants to
     // send out.  Examples include HEARTBEAT (gcs_send_heartbeat)
     Bitmask<MSG_LAST> pushed_ap_message_ids;
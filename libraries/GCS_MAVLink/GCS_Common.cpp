@@ -950,6 +950,57 @@ void GCS_MAVLINK::handle_radio_status(const mavlink_message_t &msg)
 #endif
 }
 
+/*
+  adaptive software flow control for links that give us no
+  RADIO_STATUS feedback (eg. LTE or WiFi bridges). The fraction of our
+  own transmit buffer that is free stands in for the radio's txbuf
+  report, feeding the same slowdown state the radio path uses, so on a
+  dual-link vehicle each link is driven at its own capacity. Opt-in
+  per link via MAVx_OPTIONS as it would fight the RADIO_STATUS
+  adaptation on a SiK link
+ */
+void GCS_MAVLINK::update_txbuf_slowdown(void)
+{
+    if (!option_enabled(Option::ADAPTIVE_STREAMRATE)) {
+        return;
+    }
+    const uint32_t now = AP_HAL::millis();
+    if (now - txbuf_slowdown_check_ms < 1000 || _port == nullptr) {
+        return;
+    }
+    txbuf_slowdown_check_ms = now;
+
+    const uint32_t space = _port->txspace();
+    // learn the empty-buffer size from the largest free space seen
+    if (space > txspace_max) {
+        txspace_max = space;
+        return;
+    }
+    if (txspace_max == 0) {
+        return;
+    }
+    const uint8_t pct_free = (100U * space) / txspace_max;
+
+    // same thresholds as handle_radio_status()
+    if (pct_free < 20 && stream_slowdown_ms < 2000) {
+        // we are very low on space - slow down a lot
+        stream_slowdown_ms += 60;
+    } else if (pct_free < 50 && stream_slowdown_ms < 2000) {
+        // we are a bit low on space, slow down slightly
+        stream_slowdown_ms += 20;
+    } else if (pct_free > 95 && stream_slowdown_ms > 200) {
+        // the buffer has plenty of space, speed up a lot
+        stream_slowdown_ms -= 40;
+    } else if (pct_free > 90 && stream_slowdown_ms != 0) {
+        // the buffer has enough space, speed up a bit
+        if (stream_slowdown_ms > 20) {
+            stream_slowdown_ms -= 20;
+        } else {
+            stream_slowdown_ms = 0;
+        }
+    }
+}
+
 void GCS_MAVLINK::handle_mission_item(const mavlink_message_t &msg)
 {
     mavlink_mission_item_int_t mission_item_int;
@@ -1246,12 +1297,30 @@ bool GCS_MAVLINK::should_send_message_in_delay_callback(const ap_message id) con
     return false;
 }
 
+/*
+  messages a GCS uses for real-time display or failsafe decisions are
+  hard-deadline; buckets carrying one keep their schedule while bulk
+  transfers (params, missions, ftp) are penalizing the other streams
+ */
+bool GCS_MAVLINK::bucket_has_hard_deadline(const deferred_message_bucket_t &deferred) const
+{
+    return deferred.ap_message_ids.get(MSG_ATTITUDE) ||
+        deferred.ap_message_ids.get(MSG_SYS_STATUS);
+}
+
 uint16_t GCS_MAVLINK::get_reschedule_interval_ms(const deferred_message_bucket_t &deferred) const
 {
     uint32_t interval_ms = deferred.interval_ms;
 
     interval_ms += stream_slowdown_ms;
 
+    if (bucket_has_hard_deadline(deferred)) {
+        // hard-deadline messages keep their schedule during bulk
+        // transfers; stream_slowdown_ms still applies as it reflects
+        // the link capacity
+        return MIN(interval_ms, 60000U);
+    }
+
     // slow most messages down if we're transfering parameters or
     // waypoints:
     if (_queued_parameter) {
@@ -1287,23 +1356,36 @@ void GCS_MAVLINK::find_next_bucket_to_send(uint16_t now16_ms)
     // all done sending this bucket... find another bucket...
     sending_bucket_id = no_bucket_to_send;
     uint16_t ms_before_send_next_bucket_to_send = UINT16_MAX;
+    bool next_bucket_is_hard_deadline = false;
     for (uint8_t i=0; i<ARRAY_SIZE(deferred_message_bucket); i++) {
         if (deferred_message_bucket[i].ap_message_ids.count() == 0) {
             // no entries
             continue;
         }
+        const bool hard_deadline = bucket_has_hard_deadline(deferred_message_bucket[i]);
         const uint16_t interval = get_reschedule_interval_ms(deferred_message_bucket[i]);
         const uint16_t ms_since_last_sent = now16_ms - deferred_message_bucket[i].last_sent_ms;
         uint16_t ms_before_send_this_bucket;
         if (ms_since_last_sent > interval) {
             // should already have sent this bucket!
             ms_before_send_this_bucket = 0;
+            // record how late we are servicing it, per deadline class
+            const uint16_t lag = ms_since_last_sent - interval;
+            uint16_t &max_lag = hard_deadline ? max_lag_hard_ms : max_lag_bulk_ms;
+            if (lag > max_lag) {
+                max_lag = lag;
+            }
         } else {
             ms_before_send_this_bucket = interval - ms_since_last_sent;
         }
-        if (ms_before_send_this_bucket < ms_before_send_next_bucket_to_send) {
+        if (ms_before_send_this_bucket < ms_before_send_next_bucket_to_send ||
+            (ms_before_send_this_bucket == ms_before_send_next_bucket_to_send &&
+             hard_deadline && !next_bucket_is_hard_deadline)) {
+            // hard-deadline buckets win ties so overdue bulk traffic
+            // cannot starve them
             sending_bucket_id = i;
             ms_before_send_next_bucket_to_send = ms_before_send_this_bucket;
+            next_bucket_is_hard_deadline = hard_deadline;
         }
     }
     if (sending_bucket_id != no_bucket_to_send) {
@@ -1583,6 +1665,10 @@ void GCS_MAVLINK::update_send()
     // check for any in-progress tasks; check_tasks does its own rate-limiting
     GCS_MAVLINK_InProgress::check_tasks();
 
+    // adapt stream rates on links without radio feedback; does its
+    // own rate-limiting
+    update_txbuf_slowdown();
+
     const uint32_t start = AP_HAL::millis();
     const uint16_t start16 = start & 0xFFFF;
     while (AP_HAL::millis() - start < 5) { // spend a max of 5ms sending messages.  This should never trigger - out_of_time() should become true
@@ -2133,7 +2219,11 @@ void GCS_MAVLINK::log_mavlink_stats()
     stream_slowdown_ms     : stream_slowdown_ms,
     times_full             : out_of_space_to_send_count,
     GCS_SYSID_last_seen_ms : _sysid_gcs_last_seen_time_ms,
+    max_lag_hard_ms        : max_lag_hard_ms,
+    max_lag_bulk_ms        : max_lag_bulk_ms,
     };
+    max_lag_hard_ms = 0;
+    max_lag_bulk_ms = 0;
 
     AP::logger().WriteBlock(&pkt, sizeof(pkt));
 }
@@ -3790,8 +3880,22 @@ void GCS_MAVLINK::handle_timesync(const mavlink_message_t &msg)
                         round_trip_time_us*0.001f);
 #endif
 
+        const uint64_t receive_timestamp_ns = timesync_receive_timestamp_ns();
+
+#if AP_RTC_TIMESYNC_ENABLED
+        // feed the round trip to the RTC time-sync service.  Subtract
+        // the sysid fudge added in timesync_timestamp_ns() to recover
+        // the true send time.  A responding peer makes this link
+        // worth sampling much faster than the 10s default.
+        AP::rtc().handle_timesync_response(msg.sysid,
+                                           tsync.tc1,
+                                           _timesync_request.sent_ts1 - mavlink_system.sysid,
+                                           receive_timestamp_ns);
+        _timesync_request.interval_ms = 1000;
+#endif
+
 #if HAL_LOGGING_ENABLED
-        const uint64_t round_trip_time_us = (timesync_receive_timestamp_ns() - _timesync_request.sent_ts1)*0.001f;
+        const uint64_t round_trip_time_us = (receive_timestamp_ns - _timesync_request.sent_ts1)*0.001f;
         AP_Logger *logger = AP_Logger::get_singleton();
         if (logger != nullptr) {
             AP::logger().Write(
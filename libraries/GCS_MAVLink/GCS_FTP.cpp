@@ -40,12 +40,22 @@ GCS_FTP *GCS_FTP::ftp;
 // timeout for session inactivity, when we will kill an idle session
 #define FTP_SESSION_KILL_TIMEOUT 20000
 
+// number of reply chunks read ahead per filesystem call in a burst
+#define FTP_BURST_READAHEAD_CHUNKS 8
+
 bool GCS_FTP::init(void)
 {
     if (initialised) {
         return true;
     }
 
+    if (burst_buf == nullptr) {
+        // without the read-ahead buffer every burst chunk pays a
+        // filesystem round-trip; transfers still work if the
+        // allocation fails, just more slowly
+        burst_buf = (uint8_t *)malloc(FTP_BURST_READAHEAD_CHUNKS * sizeof(Transaction::data));
+    }
+
     initialised = hal.scheduler->thread_create(FUNCTOR_BIND_MEMBER(&GCS_FTP::worker, void),
                                                "FTP", 2560, AP_HAL::Scheduler::PRIORITY_IO, 0);
     if (!initialised) {
@@ -592,10 +602,41 @@ bool GCS_FTP::Session::handle_request(Transaction &request, Transaction &reply)
 
         // this transfer size is enough for a full parameter file with max parameters
         const uint32_t transfer_size = 2000;
+        const uint16_t chunk = MIN(sizeof(reply.data), max_read);
+        // read several chunks ahead per filesystem call; the
+        // filesystem semaphore and storage command overhead are paid
+        // per call, not per byte
+        uint8_t *const rbuf = ftp->burst_buf;
+        const uint32_t rbuf_size = FTP_BURST_READAHEAD_CHUNKS * sizeof(reply.data);
+        uint32_t rbuf_len = 0;
+        uint32_t rbuf_ofs = 0;
         reply.offset = request.offset;
         for (uint32_t i = 0; (i < transfer_size); i++) {
             // fill the buffer
-            const ssize_t read_bytes = AP::FS().read(fd, reply.data, MIN(sizeof(reply.data), max_read));
+            ssize_t read_bytes;
+            if (rbuf == nullptr) {
+                read_bytes = AP::FS().read(fd, reply.data, chunk);
+            } else {
+                read_bytes = 0;
+                if (rbuf_len - rbuf_ofs < chunk) {
+                    // top up the read-ahead buffer so that only the
+                    // final chunk of the file can be short
+                    memmove(rbuf, &rbuf[rbuf_ofs], rbuf_len - rbuf_ofs);
+                    rbuf_len -= rbuf_ofs;
+                    rbuf_ofs = 0;
+                    const ssize_t n = AP::FS().read(fd, &rbuf[rbuf_len], rbuf_size - rbuf_len);
+                    if (n > 0) {
+                        rbuf_len += n;
+                    } else if (n == -1 && rbuf_len == 0) {
+                        read_bytes = -1;
+                    }
+                }
+                if (read_bytes != -1) {
+                    read_bytes = MIN(uint32_t(chunk), rbuf_len - rbuf_ofs);
+                    memcpy(reply.data, &rbuf[rbuf_ofs], read_bytes);
+                    rbuf_ofs += read_bytes;
+                }
+            }
             if (read_bytes == -1) {
                 reply.burst_complete = true;
                 GCS_FTP::error(reply, FTP_ERROR::FailErrno);
@@ -101,6 +101,10 @@ private:
 
     bool init(void);
 
+    // read-ahead buffer for burst reads, only touched by the worker
+    // thread. One filesystem call fills several reply chunks
+    uint8_t *burst_buf;
+
     static bool send_reply(const Transaction &reply);
     static void error(Transaction &response, FTP_ERROR error);
 
@@ -76,6 +76,16 @@ bool gcs_alternative_active[MAVLINK_COMM_NUM_BUFFERS];
 static HAL_Semaphore chan_locks[MAVLINK_COMM_NUM_BUFFERS];
 static bool chan_discard[MAVLINK_COMM_NUM_BUFFERS];
 
+// segments of the packet being assembled between comm_send_lock() and
+// comm_send_unlock(). The mavlink helpers send a packet as separate
+// header, payload, CRC and signature pieces; these are queued here and
+// flushed as a single gather write on unlock, taking the port lock
+// once per packet instead of once per piece. The pieces stay in scope
+// in the helper until MAVLINK_END_UART_SEND so queuing pointers is safe
+static AP_HAL::UARTDriver::WriteVector chan_segments[MAVLINK_COMM_NUM_BUFFERS][4];
+static uint8_t chan_num_segments[MAVLINK_COMM_NUM_BUFFERS];
+static bool chan_gather[MAVLINK_COMM_NUM_BUFFERS];
+
 mavlink_system_t mavlink_system = {7,1};
 
 // routing table
@@ -127,6 +137,31 @@ uint16_t comm_get_txspace(mavlink_channel_t chan)
     return link->txspace();
 }
 
+/*
+  flush any segments queued by comm_send_buffer() as a single gather
+  write
+ */
+static void comm_flush_segments(uint8_t chan)
+{
+    const uint8_t num_segments = chan_num_segments[chan];
+    if (num_segments == 0) {
+        return;
+    }
+    chan_num_segments[chan] = 0;
+    const size_t written = mavlink_comm_port[chan]->writev(chan_segments[chan], num_segments);
+#if CONFIG_HAL_BOARD == HAL_BOARD_SITL
+    size_t total = 0;
+    for (uint8_t i = 0; i < num_segments; i++) {
+        total += chan_segments[chan][i].len;
+    }
+    if (written < total && !mavlink_comm_port[chan]->is_write_locked()) {
+        AP_HAL::panic("Short write on UART: %lu < %lu", (unsigned long)written, (unsigned long)total);
+    }
+#else
+    (void)written;
+#endif
+}
+
 /*
   send a buffer out a MAVLink channel
  */
@@ -146,6 +181,13 @@ void comm_send_buffer(mavlink_channel_t chan, const uint8_t *buf, uint8_t len)
         // an alternative protocol is active
         return;
     }
+    if (chan_gather[chan] && chan_num_segments[chan] < ARRAY_SIZE(chan_segments[chan])) {
+        chan_segments[chan][chan_num_segments[chan]++] = { buf, len };
+        return;
+    }
+    // not gathering, or out of segment slots; preserve ordering by
+    // flushing anything already queued before the direct write
+    comm_flush_segments(chan);
     const size_t written = mavlink_comm_port[chan]->write(buf, len);
 #if CONFIG_HAL_BOARD == HAL_BOARD_SITL
     if (written < len && !mavlink_comm_port[chan]->is_write_locked()) {
@@ -170,6 +212,7 @@ void comm_send_lock(mavlink_channel_t chan_m, uint16_t size)
         chan_discard[chan] = true;
         gcs_out_of_space_to_send(chan_m);
     }
+    chan_gather[chan] = true;
 }
 
 /*
@@ -178,6 +221,8 @@ void comm_send_lock(mavlink_channel_t chan_m, uint16_t size)
 void comm_send_unlock(mavlink_channel_t chan_m)
 {
     const uint8_t chan = uint8_t(chan_m);
+    chan_gather[chan] = false;
+    comm_flush_segments(chan);
     chan_discard[chan] = false;
     chan_locks[chan].give();
 }
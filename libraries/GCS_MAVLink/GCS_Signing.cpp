@@ -21,6 +21,8 @@
 
 #include "GCS.h"
 
+#include <AP_Common/ExpandingString.h>
+
 #if AP_MAVLINK_SIGNING_ENABLED
 
 extern const AP_HAL::HAL& hal;
@@ -44,6 +46,10 @@ mavlink_signing_streams_t GCS_MAVLINK::signing_streams;
 // last time we saved the timestamp
 uint32_t GCS_MAVLINK::last_signing_save_ms;
 
+// counters for the SIGNING_CONTROL_PLANE_ONLY option
+uint32_t GCS_MAVLINK::signing_bulk_accepted;
+uint32_t GCS_MAVLINK::signing_control_rejected;
+
 bool GCS_MAVLINK::signing_key_save(const struct SigningKey &key)
 {
     if (_signing_storage.size() < sizeof(key)) {
@@ -112,7 +118,28 @@ static const uint32_t accept_list[] = {
     MAVLINK_MSG_ID_RADIO_STATUS,
     MAVLINK_MSG_ID_RADIO
 };
-    
+
+// messages that may be accepted without a signature when the
+// SIGNING_CONTROL_PLANE_ONLY option is set. This is an allowlist of
+// the high-rate bulk telemetry the option exists for; anything not
+// listed, including any future state-changing message ID, falls
+// through to normal signature verification and so fails safe.
+// RADIO/RADIO_STATUS are already accepted via accept_list above
+static const uint32_t bulk_telemetry_list[] = {
+    MAVLINK_MSG_ID_HEARTBEAT,
+    MAVLINK_MSG_ID_SYS_STATUS,
+    MAVLINK_MSG_ID_BATTERY_STATUS,
+    MAVLINK_MSG_ID_GPS_RAW_INT,
+    MAVLINK_MSG_ID_ATTITUDE,
+    MAVLINK_MSG_ID_ATTITUDE_QUATERNION,
+    MAVLINK_MSG_ID_LOCAL_POSITION_NED,
+    MAVLINK_MSG_ID_GLOBAL_POSITION_INT,
+    MAVLINK_MSG_ID_VFR_HUD,
+    MAVLINK_MSG_ID_RC_CHANNELS,
+    MAVLINK_MSG_ID_SERVO_OUTPUT_RAW,
+    MAVLINK_MSG_ID_GPS_RTCM_DATA,
+};
+
 static bool accept_unsigned_callback(const mavlink_status_t *status, uint32_t msgId)
 {
     if (status == mavlink_get_channel_status(MAVLINK_COMM_0)) {
@@ -125,9 +152,60 @@ static bool accept_unsigned_callback(const mavlink_status_t *status, uint32_t ms
             return true;
         }
     }
+    if (GCS_MAVLINK::signing_control_plane_only(status)) {
+        // the link accepts listed bulk telemetry unsigned to keep the
+        // RX path cheap; everything else, including all state-changing
+        // messages, still requires a valid signature
+        for (uint8_t i=0; i<ARRAY_SIZE(bulk_telemetry_list); i++) {
+            if (bulk_telemetry_list[i] == msgId) {
+                GCS_MAVLINK::signing_bulk_accepted++;
+                return true;
+            }
+        }
+        GCS_MAVLINK::signing_control_rejected++;
+        return false;
+    }
+    return false;
+}
+}
+
+/*
+  return true if the link owning the given parser status has the
+  SIGNING_CONTROL_PLANE_ONLY option set
+ */
+bool GCS_MAVLINK::signing_control_plane_only(const mavlink_status_t *status)
+{
+    for (uint8_t i=0; i<MAVLINK_COMM_NUM_BUFFERS; i++) {
+        if (status != mavlink_get_channel_status((mavlink_channel_t)(MAVLINK_COMM_0+i))) {
+            continue;
+        }
+        const GCS_MAVLINK *link = gcs().chan(i);
+        return link != nullptr && link->option_enabled(Option::SIGNING_CONTROL_PLANE_ONLY);
+    }
     return false;
 }
+
+#if AP_FILESYSTEM_SYS_ENABLED
+/*
+  fill in signing state and statistics for @SYS/signing.txt
+ */
+void GCS_MAVLINK::signing_info(ExpandingString &str)
+{
+    str.printf("bulk_accepted %lu control_rejected %lu\n",
+               (unsigned long)signing_bulk_accepted,
+               (unsigned long)signing_control_rejected);
+    for (uint8_t i=0; i<MAVLINK_COMM_NUM_BUFFERS; i++) {
+        const GCS_MAVLINK *link = gcs().chan(i);
+        if (link == nullptr) {
+            continue;
+        }
+        str.printf("chan%u signing %u control_plane_only %u\n",
+                   (unsigned)i,
+                   (unsigned)link->signing_enabled(),
+                   (unsigned)link->option_enabled(Option::SIGNING_CONTROL_PLANE_ONLY));
+    }
 }
+#endif // AP_FILESYSTEM_SYS_ENABLED
 
 /*
   load signing key
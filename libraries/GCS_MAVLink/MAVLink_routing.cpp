@@ -23,6 +23,7 @@
 #include <stdio.h>
 #include <AP_HAL/AP_HAL.h>
 #include <AP_Common/AP_Common.h>
+#include <AP_Common/ExpandingString.h>
 #include "GCS.h"
 #include "MAVLink_routing.h"
 
@@ -238,6 +239,10 @@ bool MAVLink_routing::forward(GCS_MAVLINK &in_link,
                              (int)target_component);
 #endif
                     _mavlink_resend_uart(routes[i].channel, &msg);
+#if AP_FILESYSTEM_SYS_ENABLED
+                    routes[i].fwd_packets++;
+                    routes[i].fwd_bytes += msg.len + GCS_MAVLINK::packet_overhead_chan(routes[i].channel);
+#endif
                 }
                 sent_to_chan[routes[i].channel] = true;
                 forwarded = true;
@@ -345,12 +350,63 @@ bool MAVLink_routing::find_by_mavtype_and_compid(uint8_t mavtype, uint8_t compid
     return false;
 }
 
+/*
+  starting probe slot in the hash index for a route key
+*/
+uint8_t MAVLink_routing::hash_slot(uint8_t sysid, uint8_t compid, mavlink_channel_t channel)
+{
+    const uint32_t key = (uint32_t(sysid)<<16) | (uint32_t(compid)<<8) | uint32_t(channel);
+    // avalanche the low bits so nearby sysids don't cluster
+    return uint8_t((key * 2654435761UL) >> 24) & (MAVLINK_ROUTE_HASH_SIZE-1);
+}
+
+/*
+  find a route by hash probe, returning its index or 0xff. The index
+  always has at least one empty slot, so the probe terminates
+*/
+uint8_t MAVLink_routing::find_route(uint8_t sysid, uint8_t compid, mavlink_channel_t channel) const
+{
+    uint8_t slot = hash_slot(sysid, compid, channel);
+    while (route_hash[slot] != 0) {
+        const uint8_t i = route_hash[slot] - 1;
+        if (routes[i].sysid == sysid &&
+            routes[i].compid == compid &&
+            routes[i].channel == channel) {
+            return i;
+        }
+        slot = (slot+1) & (MAVLINK_ROUTE_HASH_SIZE-1);
+    }
+    return 0xff;
+}
+
+/*
+  add routes[index] to the hash index
+*/
+void MAVLink_routing::hash_insert(uint8_t index)
+{
+    uint8_t slot = hash_slot(routes[index].sysid, routes[index].compid, routes[index].channel);
+    while (route_hash[slot] != 0) {
+        slot = (slot+1) & (MAVLINK_ROUTE_HASH_SIZE-1);
+    }
+    route_hash[slot] = index+1;
+}
+
+/*
+  rebuild the hash index after a route slot is reused
+*/
+void MAVLink_routing::rebuild_hash(void)
+{
+    memset(route_hash, 0, sizeof(route_hash));
+    for (uint8_t i=0; i<num_routes; i++) {
+        hash_insert(i);
+    }
+}
+
 /*
   see if the message is for a new route and learn it
 */
 void MAVLink_routing::learn_route(GCS_MAVLINK &in_link, const mavlink_message_t &msg)
 {
-    uint8_t i;
     if (msg.sysid == 0) {
         // don't learn routes to the broadcast system
         return;
@@ -368,32 +424,78 @@ void MAVLink_routing::learn_route(GCS_MAVLINK &in_link, const mavlink_message_t
         return;
     }
     const mavlink_channel_t in_channel = in_link.get_chan();
-    for (i=0; i<num_routes; i++) {
-        if (routes[i].sysid == msg.sysid &&
-            routes[i].compid == msg.compid &&
-            routes[i].channel == in_channel) {
-            if (routes[i].mavtype == 0 && msg.msgid == MAVLINK_MSG_ID_HEARTBEAT) {
-                routes[i].mavtype = mavlink_msg_heartbeat_get_type(&msg);
-            }
-            break;
-        }
-    }
-    if (i == num_routes && i<MAVLINK_MAX_ROUTES) {
-        routes[i].sysid = msg.sysid;
-        routes[i].compid = msg.compid;
-        routes[i].channel = in_channel;
-        if (msg.msgid == MAVLINK_MSG_ID_HEARTBEAT) {
+    uint8_t i = find_route(msg.sysid, msg.compid, in_channel);
+    if (i != 0xff) {
+        if (routes[i].mavtype == 0 && msg.msgid == MAVLINK_MSG_ID_HEARTBEAT) {
             routes[i].mavtype = mavlink_msg_heartbeat_get_type(&msg);
         }
+        routes[i].last_seen_ms = AP_HAL::millis();
+        return;
+    }
+    bool evicted = false;
+    if (num_routes < MAVLINK_MAX_ROUTES) {
+        i = num_routes;
         num_routes++;
+    } else {
+        evicted = true;
+        // table full, evict the route that has been silent longest
+        i = 0;
+        for (uint8_t j=1; j<num_routes; j++) {
+            if (routes[j].last_seen_ms < routes[i].last_seen_ms) {
+                i = j;
+            }
+        }
 #if ROUTING_DEBUG
-        ::printf("learned route %u %u via %u\n",
-                 (unsigned)msg.sysid,
-                 (unsigned)msg.compid,
-                 (unsigned)in_channel);
+        ::printf("evicted route %u %u via %u\n",
+                 (unsigned)routes[i].sysid,
+                 (unsigned)routes[i].compid,
+                 (unsigned)routes[i].channel);
 #endif
     }
+    routes[i] = {};
+    routes[i].sysid = msg.sysid;
+    routes[i].compid = msg.compid;
+    routes[i].channel = in_channel;
+    routes[i].last_seen_ms = AP_HAL::millis();
+    if (msg.msgid == MAVLINK_MSG_ID_HEARTBEAT) {
+        routes[i].mavtype = mavlink_msg_heartbeat_get_type(&msg);
+    }
+    // a reused slot leaves a stale entry under the old key, so
+    // rebuild the index rather than insert in that case
+    if (evicted) {
+        rebuild_hash();
+    } else {
+        hash_insert(i);
+    }
+#if ROUTING_DEBUG
+    ::printf("learned route %u %u via %u\n",
+             (unsigned)msg.sysid,
+             (unsigned)msg.compid,
+             (unsigned)in_channel);
+#endif
+}
+
+#if AP_FILESYSTEM_SYS_ENABLED
+/*
+  fill in a string with the routing table and per-route statistics,
+  for @SYS/routes.txt
+*/
+void MAVLink_routing::routing_info(ExpandingString &str) const
+{
+    const uint32_t now_ms = AP_HAL::millis();
+    str.printf("SYSID COMPID CHAN TYPE    AGE_MS      PKTS     BYTES\n");
+    for (uint8_t i=0; i<num_routes; i++) {
+        str.printf("%5u %6u %4u %4u %9lu %9lu %9lu\n",
+                   (unsigned)routes[i].sysid,
+                   (unsigned)routes[i].compid,
+                   (unsigned)(routes[i].channel-MAVLINK_COMM_0),
+                   (unsigned)routes[i].mavtype,
+                   (unsigned long)(now_ms - routes[i].last_seen_ms),
+                   (unsigned long)routes[i].fwd_packets,
+                   (unsigned long)routes[i].fwd_bytes);
+    }
 }
+#endif // AP_FILESYSTEM_SYS_ENABLED
 
 
 /*
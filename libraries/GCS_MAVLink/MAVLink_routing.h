@@ -3,11 +3,20 @@
 #pragma once
 
 #include <AP_Common/AP_Common.h>
+#include <AP_Filesystem/AP_Filesystem_config.h>
 #include "GCS_MAVLink.h"
 
+class ExpandingString;
+
 // 20 routes should be enough for now. This may need to increase as
 // we make more extensive use of MAVLink forwarding
+#ifndef MAVLINK_MAX_ROUTES
 #define MAVLINK_MAX_ROUTES 20
+#endif
+
+// size of the open-addressed index over routes[]. Must be a power of
+// two larger than MAVLINK_MAX_ROUTES so a probe always terminates
+#define MAVLINK_ROUTE_HASH_SIZE 64
 
 /*
   object to handle MAVLink packet routing
@@ -51,17 +60,48 @@ public:
      */
     bool find_by_mavtype_and_compid(uint8_t mavtype, uint8_t compid, uint8_t &sysid, mavlink_channel_t &channel) const;
 
+#if AP_FILESYSTEM_SYS_ENABLED
+    // fill in a string with the routing table and per-route
+    // statistics, for @SYS/routes.txt
+    void routing_info(ExpandingString &str) const;
+#endif
+
 private:
-    // a simple linear routing table. We don't expect to have a lot of
-    // routes, so a scalable structure isn't worthwhile yet.
+    // the routing table. Lookups by sysid/compid/channel go through
+    // an open-addressed hash index so that the per-packet route learn
+    // check stays O(1) as the table fills
     uint8_t num_routes;
     struct route {
         uint8_t sysid;
         uint8_t compid;
         mavlink_channel_t channel;
         uint8_t mavtype;
+        // time the route was last seen, for LRU eviction
+        uint32_t last_seen_ms;
+#if AP_FILESYSTEM_SYS_ENABLED
+        uint32_t fwd_packets;
+        uint32_t fwd_bytes;
+#endif
     } routes[MAVLINK_MAX_ROUTES];
-    
+
+    static_assert(MAVLINK_MAX_ROUTES < MAVLINK_ROUTE_HASH_SIZE, "route hash must be larger than the route table");
+
+    // hash index over routes[], holding route index plus one, zero
+    // means empty
+    uint8_t route_hash[MAVLINK_ROUTE_HASH_SIZE] {};
+
+    // starting probe slot for a route key
+    static uint8_t hash_slot(uint8_t sysid, uint8_t compid, mavlink_channel_t channel);
+
+    // find a route by hash probe, returning its index or 0xff
+    uint8_t find_route(uint8_t sysid, uint8_t compid, mavlink_channel_t channel) const;
+
+    // add routes[index] to the hash index
+    void hash_insert(uint8_t index);
+
+    // rebuild the hash index after a route slot is reused
+    void rebuild_hash(void);
+
     // a channel mask to block routing as required
     uint8_t no_route_mask;
     
@@ -253,6 +253,7 @@ const AP_Param::GroupInfo RC_Channel::var_info[] = {
     // @Values{Copter, Rover, Plane, Blimp, Sub}: 185:Mount Roll/Pitch Lock
     // @Values{Copter, Rover, Plane, Blimp, Sub}: 186:Mount POI Lock
     // @Values{Copter, Rover, Plane, Blimp, Sub}: 187:EKF Reset
+    // @Values{Copter, Rover, Plane, Blimp, Sub}: 188:Sampling Profiler
     // @Values{Rover}: 201:Roll
     // @Values{Rover}: 202:Pitch
     // @Values{Rover}: 207:MainSail
@@ -725,6 +726,7 @@ void RC_Channel::init_aux_function(const AUX_FUNC ch_option, const AuxSwitchPos
 #if AP_AHRS_EKF_RESET_ENABLED
     case AUX_FUNC::EKF_RESET:
 #endif
+    case AUX_FUNC::SAMPLING_PROFILER:
 #if HAL_GENERATOR_ENABLED
     case AUX_FUNC::GENERATOR: // don't turn generator on or off initially
 #endif
@@ -1978,6 +1980,12 @@ bool RC_Channel::do_aux_function(const AuxFuncTrigger &trigger)
     }
 #endif  // AP_AHRS_ENABLED
 
+    case AUX_FUNC::SAMPLING_PROFILER:
+        if (!hal.util->profiler_control(ch_flag == AuxSwitchPos::HIGH)) {
+            GCS_SEND_TEXT(MAV_SEVERITY_WARNING, "Profiler unavailable");
+        }
+        break;
+
 #if HAL_TORQEEDO_ENABLED
     // clear torqeedo error
     case AUX_FUNC::TORQEEDO_CLEAR_ERR: {
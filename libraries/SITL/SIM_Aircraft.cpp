@@ -311,7 +311,12 @@ void Aircraft::sync_frame_time(void)
     // accumulate sleep debt if we're running too fast
     sleep_debt_us += target_dt_us - dt_us;
 
-    if (sleep_debt_us < -1.0e5) {
+    if (fast_forward) {
+        // a long idle wait is in progress on the main thread, run
+        // the physics flat out instead of pacing to the target
+        // speedup
+        sleep_debt_us = 0;
+    } else if (sleep_debt_us < -1.0e5) {
         // don't let a large negative debt build up
         sleep_debt_us = -1.0e5;
     }
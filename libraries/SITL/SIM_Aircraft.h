@@ -68,6 +68,13 @@ public:
     void set_speedup(float speedup);
     float get_speedup() const { return target_speedup; }
 
+    /*
+      suspend wall-clock pacing during a long idle wait on the main
+      thread. Pacing only shapes wall-clock time, simulation results
+      are unaffected
+     */
+    void set_fast_forward(bool ff) { fast_forward = ff; }
+
     /*
       set instance number
      */
@@ -297,6 +304,7 @@ protected:
     uint8_t instance;
     const char *autotest_dir;
     bool use_time_sync = true;
+    bool fast_forward;
     float last_speedup = -1.0f;
     const char *config_ = "";
     float eas2tas = 1.0;